@@ -1,19 +1,31 @@
 #include "./utils/chat.pb.h" // Include the generated protobuf header
 #include "./utils/message.h"
+#include "./utils/batcher.h"
+#include "./utils/ring.h"
+#include "./utils/constants.h"
 #include <iostream>
 #include <sys/socket.h>
 #include <arpa/inet.h>
+#include <netinet/tcp.h> // For TCP_NODELAY
 #include <unistd.h>
 #include <cstring>
 #include <string>
 #include <thread>
 #include <vector>
 #include <atomic>
-#include <deque>
-#include <atomic>
 #include <mutex>
 #include <condition_variable>
+#include <deque>
 #include <sstream>
+#include <ctime>
+#include <iomanip>
+#include <unordered_map>
+#include <algorithm> // For std::max, std::min
+#include <random>    // For std::mt19937
+#include <fstream>   // For std::ifstream
+#include <map>
+#include <cstdlib>   // For std::strtod
+#include <cmath>     // For std::isfinite
 
 #define RED "\x1b[31m"
 #define GREEN "\x1b[32m"
@@ -29,20 +41,78 @@ std::atomic<bool> waiting_response{false};
 std::atomic<bool> terminate_execution{false};
 std::atomic<bool> streaming_mode{false};
 std::mutex cout_mutex;
-std::deque<std::string> message_buffer; // Buffer for messages received during input mode
+
+// Incoming notifications (messages and receipts) on their way from the listener to the screen,
+// still unrendered, so the listener never waits on the terminal. Printed as they come in streaming
+// mode, otherwise once the command being typed is done; new ones are dropped while it is full.
+SpscRing<chat::Response> inbox(CLIENT_INBOX_SIZE);
+std::atomic<uint32_t> inbox_pushed{0};
+std::atomic<uint64_t> inbox_dropped{0};
+std::mutex inbox_mutex; // With inbox_ready, wakes the display thread when inbox_pushed moves
+std::condition_variable inbox_ready;
+std::mutex render_mutex; // Held by the thread taking from the inbox, there is one consumer at a time
 
 // save globally the username
 std::string username_global;
 
+// Server to reconnect to, the socket of the current connection and the delay a draining server asked for
+sockaddr_in server_address;
+std::atomic<int> server_sock{-1};
+std::atomic<uint32_t> reconnect_after_ms{0};
+
+// Outgoing requests after the registration, messages sent close together share a frame
+RequestBatcher *batcher = nullptr;
+
+// Script mode: commands sent and still waiting for their reply, oldest first (a connection gets
+// its replies in order), and the reply latencies and errors by command; guarded by script_mutex
+struct ScriptCommand
+{
+  std::string name;
+  std::chrono::steady_clock::time_point sent;
+};
+struct ScriptStats
+{
+  std::vector<uint64_t> latencies_us;
+  uint64_t errors = 0;
+};
+std::atomic<bool> script_mode{false};
+std::mutex script_mutex;
+std::condition_variable script_replied;
+std::deque<ScriptCommand> script_in_flight;
+std::map<std::string, ScriptStats> script_stats;
+uint64_t script_lost = 0; // Sent before a reconnect, their replies never came
+std::deque<size_t> script_batches; // Requests of each BATCH frame sent, the server may refuse the frame whole
+
+// Session state the listener updates on arrival, guarded by session_mutex
+std::mutex session_mutex;
+
+// Direct messages to acknowledge: delivered when they arrive, read once printed. With read
+// receipts off messages are only acknowledged as delivered.
+std::atomic<bool> read_receipts{true};
+std::vector<uint64_t> acks_delivered;
+std::vector<uint64_t> acks_read;
+
+// Compact wire mode: names of the senders the server announced, by their id
+std::unordered_map<uint32_t, std::string> sender_names;
+
+// Resumable session: the token of the REGISTER_USER reply, the highest notification seq received
+// and the notifications received since the server was last told
+uint64_t resume_token = 0;
+uint64_t last_seq = 0;
+size_t unacknowledged_frames = 0;
+
 // TODO: add identifier uuid to each request and response to match them
 
-void terminationHandler(int sock, std::string username, std::thread &listener)
+void terminationHandler(std::string username, std::thread &listener)
 {
   while (!terminate_execution)
   {
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
   }
-  std::cout << "Connection terminated abruptly." << std::endl;
+  if (running)
+  {
+    std::cout << "Connection terminated abruptly." << std::endl;
+  }
   // If by some reason the listener thread is still running, stop it
   running = false;
   if (listener.joinable())
@@ -50,110 +120,509 @@ void terminationHandler(int sock, std::string username, std::thread &listener)
     listener.join(); // Wait for the listener thread to finish
   }
   // Close the socket
-  close(sock);
+  close(server_sock);
 
   std::cout << "Exiting..." << std::endl;
   exit(0); // Terminate the program
 }
 
-void flush_message_buffer()
+/**
+ * Acknowledges the direct messages received or read since the last call, in one request. The
+ * seq received rides along, and every RESUME_ACK_FRAMES notifications it is sent by itself.
+ */
+void send_acknowledgements()
 {
-  std::lock_guard<std::mutex> lock(cout_mutex);
-  while (!message_buffer.empty())
+  chat::Request request;
   {
-    std::cout << message_buffer.front() << std::endl;
-    message_buffer.pop_front();
+    std::lock_guard<std::mutex> lock(session_mutex);
+    if (acks_delivered.empty() && acks_read.empty() && (resume_token == 0 || unacknowledged_frames < RESUME_ACK_FRAMES))
+      return;
+    request.set_operation(chat::Operation::ACKNOWLEDGE);
+    request.mutable_acknowledge()->mutable_delivered()->Add(acks_delivered.begin(), acks_delivered.end());
+    request.mutable_acknowledge()->mutable_read()->Add(acks_read.begin(), acks_read.end());
+    if (resume_token != 0)
+      request.mutable_acknowledge()->set_received_seq(last_seq);
+    acks_delivered.clear();
+    acks_read.clear();
+    unacknowledged_frames = 0;
   }
+  batcher->send(request);
 }
 
-void messageListener(int sock)
+/**
+ * Compact wire mode: a message with both name and id announces the id, later ones of the
+ * same sender may carry the id alone. Noted on arrival, the message announcing a sender may
+ * be one dropped from the inbox.
+ */
+void remember_sender(const chat::IncomingMessageResponse &msg)
 {
-  while (running)
+  if (msg.sender_id() == 0 || msg.sender().empty())
+    return;
+  std::lock_guard<std::mutex> lock(session_mutex);
+  sender_names[msg.sender_id()] = msg.sender();
+}
+
+std::string resolve_sender(const chat::IncomingMessageResponse &msg)
+{
+  if (msg.sender_id() == 0 || !msg.sender().empty())
+    return msg.sender();
+  std::lock_guard<std::mutex> lock(session_mutex);
+  auto it = sender_names.find(msg.sender_id());
+  return it == sender_names.end() ? "#" + std::to_string(msg.sender_id()) : it->second;
+}
+
+/**
+ * Text of a response as it is printed
+ */
+std::string render_response(const chat::Response &response)
+{
+  std::string message;
+  if (response.operation() == chat::Operation::SERVER_SHUTDOWN)
   {
-    chat::Response response;
-    if (RPM(sock, response))
+    message = YELLOW "SERVER: " + response.message() + RESET;
+  }
+  else if (response.status_code() != chat::StatusCode::OK)
+  {
+    message = RED "Server error: " + response.message() + RESET;
+  }
+  else
+  {
+    switch (response.operation())
     {
-      std::lock_guard<std::mutex> lock(cout_mutex);
-      std::string message;
-      if (response.status_code() != chat::StatusCode::OK)
+    case chat::Operation::INCOMING_MESSAGE:
+      if (response.has_incoming_message())
       {
-        message = RED "Server error: " + response.message() + RESET;
+        const auto &msg = response.incoming_message();
+        if (msg.type() == chat::MessageType::ROOM)
+        {
+          message = GREEN "Room #" + msg.room() + " message from " + resolve_sender(msg) + ": " + msg.content() + RESET;
+        }
+        else
+        {
+          std::string type = (msg.type() == chat::MessageType::BROADCAST) ? "Broadcast" : "Direct";
+          message = BLUE + type + " message from " + resolve_sender(msg) + ": " + msg.content() + RESET;
+        }
       }
-      else
+      break;
+    case chat::Operation::RECEIPTS:
+      if (response.has_receipts())
       {
-        switch (response.operation())
+        message = std::string(CYAN);
+        for (uint64_t id : response.receipts().delivered())
+          message += "Message #" + std::to_string(id) + " delivered. ";
+        for (uint64_t id : response.receipts().read())
+          message += "Message #" + std::to_string(id) + " read. ";
+        message += RESET;
+      }
+      break;
+    case chat::Operation::GET_HISTORY:
+      if (response.has_history())
+      {
+        const auto &history = response.history();
+        message = std::string(CYAN);
+        if (history.page() == 0 && history.messages_size() == 0)
         {
-        case chat::Operation::INCOMING_MESSAGE:
-          if (response.has_incoming_message())
-          {
-            const auto &msg = response.incoming_message();
-            std::string type = (msg.type() == chat::MessageType::BROADCAST) ? "Broadcast" : "Direct";
-            message = BLUE + type + " message from " + msg.sender() + ": " + msg.content() + RESET;
-          }
-          break;
-        case chat::Operation::GET_USERS:
-          if (response.has_user_list())
+          message += "No messages in history.";
+        }
+        for (const auto &msg : history.messages())
+        {
+          std::time_t seconds = msg.timestamp() / 1000;
+          std::ostringstream line;
+          line << "[" << std::put_time(std::localtime(&seconds), "%Y-%m-%d %H:%M:%S") << "] " << msg.sender() << ": " << msg.content();
+          if (message.size() > std::string(CYAN).size())
           {
-            const auto &user_list = response.user_list();
-            if (user_list.type() == chat::UserListType::SINGLE)
-            {
-              message = std::string(MAGENTA) + "User info: ";
-            }
-            else
-            {
-              message = std::string(MAGENTA) + "Users online: ";
-            }
-            for (const auto &user : user_list.users())
-            {
-              std::string status;
-              switch (user.status())
-              {
-              case chat::UserStatus::ONLINE:
-                status = "ONLINE";
-                break;
-              case chat::UserStatus::BUSY:
-                status = "BUSY";
-                break;
-              case chat::UserStatus::OFFLINE:
-                status = "OFFLINE";
-                break;
-              default:
-                status = "UNKNOWN";
-              }
-
-              message += user.username() + " " + status + ", ";
-            }
-            message += RESET;
+            message += "\n";
           }
-          break;
-        default:
-          message = "SERVER: " + response.message();
-          break;
+          message += line.str();
         }
+        message += RESET;
       }
-
-      if (response.operation() == chat::Operation::INCOMING_MESSAGE)
+      break;
+    case chat::Operation::GET_USERS:
+      if (response.has_user_list())
       {
-        if (streaming_mode)
+        const auto &user_list = response.user_list();
+        if (user_list.type() == chat::UserListType::SINGLE)
         {
-          std::cout << message << std::endl;
+          message = std::string(MAGENTA) + "User info: ";
         }
         else
         {
-          message_buffer.push_back(message);
+          message = std::string(MAGENTA) + "Users online: ";
         }
+        for (const auto &user : user_list.users())
+        {
+          std::string status;
+          switch (user.status())
+          {
+          case chat::UserStatus::ONLINE:
+            status = "ONLINE";
+            break;
+          case chat::UserStatus::BUSY:
+            status = "BUSY";
+            break;
+          case chat::UserStatus::OFFLINE:
+            status = "OFFLINE";
+            break;
+          default:
+            status = "UNKNOWN";
+          }
+
+          message += user.username() + " " + status + ", ";
+        }
+        message += RESET;
       }
-      else
+      break;
+    default:
+      message = "SERVER: " + response.message();
+      if (response.message_id() != 0)
+        message += " (#" + std::to_string(response.message_id()) + ")";
+      break;
+    }
+  }
+
+  return message;
+}
+
+/**
+ * Prints the notifications waiting in the inbox, rendered here and not by the listener, and
+ * acknowledges the direct messages among them as read
+ */
+void flush_message_buffer()
+{
+  static uint64_t reported_drops = 0; // Guarded by render_mutex
+  {
+    std::lock_guard<std::mutex> render_lock(render_mutex);
+    chat::Response response;
+    while (inbox.try_pop(response))
+    {
+      std::string message = render_response(response);
+      uint64_t id = response.has_incoming_message() ? response.incoming_message().message_id() : 0;
+      if (id != 0 && read_receipts)
+      {
+        std::lock_guard<std::mutex> lock(session_mutex);
+        acks_read.push_back(id);
+      }
+      std::lock_guard<std::mutex> lock(cout_mutex);
+      std::cout << message << std::endl;
+    }
+
+    uint64_t dropped = inbox_dropped;
+    if (dropped != reported_drops)
+    {
+      std::lock_guard<std::mutex> lock(cout_mutex);
+      std::cout << YELLOW << dropped - reported_drops << " incoming messages dropped, the client could not keep up." RESET << std::endl;
+      reported_drops = dropped;
+    }
+  }
+  send_acknowledgements();
+}
+
+/**
+ * Script mode: matches a reply with the oldest command waiting for one. Replies to requests the
+ * script did not send (the listener's ACKNOWLEDGE) are skipped, a refused BATCH answers for
+ * every request it carried.
+ */
+void record_script_reply(const chat::Response &response)
+{
+  auto now = std::chrono::steady_clock::now();
+  std::lock_guard<std::mutex> lock(script_mutex);
+  size_t replies = 1;
+  switch (response.operation())
+  {
+  case chat::Operation::SEND_MESSAGE:
+  case chat::Operation::UPDATE_STATUS:
+  case chat::Operation::GET_USERS:
+    break;
+  case chat::Operation::BATCH:
+    // A batch of incoming messages, or one of replies whose items were recorded one by one
+    if (response.has_batch() && (response.batch().responses_size() == 0 || response.batch().responses(0).operation() != chat::Operation::SEND_MESSAGE))
+      return;
+    if (script_batches.empty())
+      return; // Sent before a reconnect
+    replies = script_batches.front();
+    script_batches.pop_front();
+    if (response.has_batch())
+      return;
+    break;
+  default:
+    return;
+  }
+
+  for (; replies > 0 && !script_in_flight.empty(); replies--)
+  {
+    const ScriptCommand &command = script_in_flight.front();
+    ScriptStats &stats = script_stats[command.name];
+    stats.latencies_us.push_back(std::chrono::duration_cast<std::chrono::microseconds>(now - command.sent).count());
+    if (response.status_code() != chat::StatusCode::OK)
+      stats.errors++;
+    script_in_flight.pop_front();
+  }
+  if (script_in_flight.empty())
+    script_replied.notify_all();
+}
+
+/**
+ * Listener side of a response. Notifications are queued in the inbox as they are, only what
+ * the session must know right away (announced senders, delivery) is noted here; replies are
+ * printed and complete the command being waited on.
+ */
+void handleResponse(chat::Response &response)
+{
+  if (response.operation() == chat::Operation::INCOMING_MESSAGE || response.operation() == chat::Operation::RECEIPTS)
+  {
+    uint64_t id = 0;
+    if (response.has_incoming_message())
+    {
+      remember_sender(response.incoming_message());
+      id = response.incoming_message().message_id();
+    }
+
+    bool queued = inbox.try_push(response);
+    if (queued)
+    {
+      inbox_pushed.fetch_add(1, std::memory_order_release);
+      // Through the lock, the display thread may be between its check and its wait
       {
-        std::cout << message << std::endl;
+        std::lock_guard<std::mutex> lock(inbox_mutex);
+      }
+      inbox_ready.notify_one();
+    }
+    else
+    {
+      inbox_dropped++;
+    }
+
+    // Streaming with read receipts: printed at once, the read receipt is enough
+    if (id != 0 && (!queued || !read_receipts || !streaming_mode))
+    {
+      std::lock_guard<std::mutex> lock(session_mutex);
+      acks_delivered.push_back(id);
+    }
+    return;
+  }
+
+  if (response.operation() == chat::Operation::SERVER_SHUTDOWN && response.has_shutdown())
+  {
+    reconnect_after_ms = response.shutdown().reconnect_after_ms();
+  }
+  else if (script_mode && response.operation() != chat::Operation::UNREGISTER_USER)
+  {
+    record_script_reply(response);
+    return;
+  }
+
+  std::string message = render_response(response);
+  std::lock_guard<std::mutex> lock(cout_mutex);
+  std::cout << message << std::endl;
+
+  // History is streamed in several pages, only the last one completes the command
+  bool more_pages = response.operation() == chat::Operation::GET_HISTORY && response.has_history() && !response.history().last_page();
+  if (waiting_response && !more_pages)
+  {
+    waiting_response = false;
+  }
+}
+
+/**
+ * Streaming mode: prints the notifications as the listener queues them
+ */
+void display_loop()
+{
+  uint32_t seen = 0;
+  while (running)
+  {
+    {
+      std::unique_lock<std::mutex> lock(inbox_mutex);
+      inbox_ready.wait(lock, [&seen]
+                       { return inbox_pushed.load(std::memory_order_acquire) != seen; });
+      seen = inbox_pushed.load(std::memory_order_acquire);
+    }
+    if (streaming_mode)
+    {
+      flush_message_buffer();
+    }
+  }
+}
+
+/**
+ * Opens a connection to the server, -1 on failure
+ */
+int open_connection()
+{
+  int sock = socket(AF_INET, SOCK_STREAM, 0);
+  if (sock < 0)
+  {
+    return -1;
+  }
+  if (connect(sock, (struct sockaddr *)&server_address, sizeof(server_address)) < 0)
+  {
+    close(sock);
+    return -1;
+  }
+
+  // Outgoing requests are already coalesced by the batcher, Nagle would only delay them
+  int no_delay = 1;
+  setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+  return sock;
+}
+
+/**
+ * REGISTER_USER on a new connection, the reply is left in response. A new session starts its
+ * sequence numbers and sender ids over.
+ */
+bool register_user(int sock, chat::Response &response)
+{
+  chat::Request request;
+  request.set_operation(chat::Operation::REGISTER_USER);
+  auto *new_user = request.mutable_register_user();
+  new_user->set_username(username_global);
+  new_user->set_compression(chat::Compression::COMPRESSION_DEFLATE);
+  new_user->set_compact(true);
+  new_user->set_resumable(true);
 
-        if (waiting_response)
+  if (!SPM(sock, request) || !RPM(sock, response))
+  {
+    response.set_message("Connection closed.");
+    return false;
+  }
+  if (response.status_code() != chat::StatusCode::OK)
+  {
+    return false;
+  }
+
+  // Older servers leave the field unset and get plain frames
+  set_compression(sock, response.compression() == chat::Compression::COMPRESSION_DEFLATE);
+  std::lock_guard<std::mutex> lock(session_mutex);
+  resume_token = response.resume_token();
+  last_seq = 0;
+  unacknowledged_frames = 0;
+  sender_names.clear();
+  return true;
+}
+
+/**
+ * RESUME on a new connection: takes back the session the server kept since the connection
+ * dropped, the notifications missed meanwhile follow the reply. False when there is none
+ * (it expired, or the server restarted), the client then registers again.
+ */
+bool resume_session(int sock)
+{
+  chat::Request request;
+  request.set_operation(chat::Operation::RESUME);
+  auto *resume = request.mutable_resume();
+  {
+    std::lock_guard<std::mutex> lock(session_mutex);
+    if (resume_token == 0)
+      return false;
+    resume->set_token(resume_token);
+    resume->set_last_seq(last_seq);
+  }
+  resume->set_username(username_global);
+  resume->set_compression(chat::Compression::COMPRESSION_DEFLATE);
+
+  chat::Response response;
+  if (!SPM(sock, request) || !RPM(sock, response) || response.status_code() != chat::StatusCode::OK)
+  {
+    return false;
+  }
+  set_compression(sock, response.compression() == chat::Compression::COMPRESSION_DEFLATE);
+  return true;
+}
+
+/**
+ * Connects again after the connection dropped, the commands entered meanwhile are kept by the
+ * batcher. Attempts are spread by a jittered delay whose ceiling doubles each time, so clients
+ * of a restarting server do not all come back at once; the first waits at least as long as a
+ * draining server asked. Returns the new socket, -1 when it gave up.
+ */
+int reconnect(int old_sock)
+{
+  batcher->disconnect();
+  set_compression(old_sock, false);
+  close(old_sock);
+
+  std::mt19937 random(std::random_device{}());
+  uint32_t ceiling = CLIENT_RECONNECT_BASE_MS;
+  uint32_t delay = reconnect_after_ms.exchange(0);
+  for (int attempt = 1; attempt <= CLIENT_RECONNECT_ATTEMPTS && running; attempt++)
+  {
+    delay += std::uniform_int_distribution<uint32_t>(ceiling / 2, ceiling)(random);
+    ceiling = std::min(ceiling * 2, CLIENT_RECONNECT_MAX_MS);
+    {
+      std::lock_guard<std::mutex> lock(cout_mutex);
+      std::cout << YELLOW "Connection lost, reconnecting in " << delay << " ms (attempt " << attempt << ")." RESET << std::endl;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+    delay = 0;
+
+    int sock = open_connection();
+    if (sock == -1)
+    {
+      continue;
+    }
+
+    bool resumed = resume_session(sock);
+    chat::Response response;
+    if (!resumed && !register_user(sock, response))
+    {
+      std::lock_guard<std::mutex> lock(cout_mutex);
+      std::cout << RED "Reconnect failed: " + response.message() + RESET << std::endl;
+      set_compression(sock, false);
+      close(sock);
+      continue;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(cout_mutex);
+      std::cout << GREEN << (resumed ? "Reconnected, session resumed." : "Reconnected, registered again.") << RESET << std::endl;
+    }
+    server_sock = sock;
+    {
+      std::lock_guard<std::mutex> lock(script_mutex);
+      script_lost += script_in_flight.size();
+      script_in_flight.clear();
+      script_batches.clear();
+      script_replied.notify_all();
+    }
+    batcher->reconnect(sock);
+    waiting_response = false; // The reply to a command sent before the drop may never come
+    return sock;
+  }
+  return -1;
+}
+
+void messageListener(int sock)
+{
+  while (running)
+  {
+    chat::Response response;
+    if (RPM(sock, response))
+    {
+      if (response.seq() != 0)
+      {
+        std::lock_guard<std::mutex> lock(session_mutex);
+        last_seq = std::max(last_seq, response.seq());
+        unacknowledged_frames++;
+      }
+
+      // A batch carries the replies to a batch of requests, or several incoming messages
+      if (response.operation() == chat::Operation::BATCH && response.has_batch())
+      {
+        for (auto &item : *response.mutable_batch()->mutable_responses())
         {
-          waiting_response = false;
+          handleResponse(item);
         }
+        if (script_mode)
+          record_script_reply(response);
+      }
+      else
+      {
+        handleResponse(response);
       }
+      send_acknowledgements();
     }
-    else
+    else if (!running || (sock = reconnect(sock)) == -1)
     {
       break;
     }
@@ -170,23 +639,28 @@ void displayHelp()
   std::cout << "    status <status>\n";
   std::cout << "    list\n";
   std::cout << "    info <username>\n";
+  std::cout << "    history [username|#room] [limit] [from <username>]\n";
+  std::cout << "    join <room>\n";
+  std::cout << "    leave <room>\n";
+  std::cout << "    sendroom <room> <message>\n";
   std::cout << "    help\n";
   std::cout << "    stream\n";
+  std::cout << "    receipts <on|off>\n";
   std::cout << "    exit\n\n";
   std::cout << RESET;
 }
 
-void handleBroadcastMessage(int sock, const std::string &message)
+void handleBroadcastMessage(const std::string &message)
 {
   chat::Request request;
   request.set_operation(chat::Operation::SEND_MESSAGE);
   auto *msg = request.mutable_send_message();
   msg->set_content(message);
 
-  SPM(sock, request);
+  batcher->send(request);
 }
 
-void handleDirectMessage(int sock, const std::string &recipient, const std::string &message)
+void handleDirectMessage(const std::string &recipient, const std::string &message)
 {
   chat::Request request;
   request.set_operation(chat::Operation::SEND_MESSAGE);
@@ -194,10 +668,10 @@ void handleDirectMessage(int sock, const std::string &recipient, const std::stri
   msg->set_content(message);
   msg->set_recipient(recipient);
 
-  SPM(sock, request);
+  batcher->send(request);
 }
 
-bool handleChangeStatus(int sock, const std::string &status)
+bool handleChangeStatus(const std::string &status)
 {
   chat::Request request;
   request.set_operation(chat::Operation::UPDATE_STATUS);
@@ -223,44 +697,182 @@ bool handleChangeStatus(int sock, const std::string &status)
     return false;
   }
 
-  SPM(sock, request);
+  batcher->send(request);
   return true;
 }
 
-void handleListUsers(int sock)
+void handleListUsers()
 {
   chat::Request request;
   request.set_operation(chat::Operation::GET_USERS);
   auto *user_list = request.mutable_get_users();
 
-  SPM(sock, request);
+  batcher->send(request);
 }
 
-void handleGetUserInfo(int sock, const std::string &username)
+void handleGetUserInfo(const std::string &username)
 {
   chat::Request request;
   request.set_operation(chat::Operation::GET_USERS);
   auto *user_list = request.mutable_get_users();
   user_list->set_username(username);
 
-  SPM(sock, request);
+  batcher->send(request);
+}
+
+void handleGetHistory(const std::string &conversation, uint32_t limit, const std::string &sender)
+{
+  chat::Request request;
+  request.set_operation(chat::Operation::GET_HISTORY);
+  auto *history = request.mutable_get_history();
+  history->set_conversation(conversation);
+  history->set_limit(limit);
+  history->set_sender(sender);
+
+  batcher->send(request);
+}
+
+void handleRoomRequest(chat::Operation operation, const std::string &room, const std::string &message = "")
+{
+  chat::Request request;
+  request.set_operation(operation);
+  auto *room_request = request.mutable_room();
+  room_request->set_room(room);
+  room_request->set_content(message);
+
+  batcher->send(request);
 }
 
-void handleUnregisterUser(int sock, const std::string &username)
+void handleUnregisterUser(const std::string &username)
 {
   chat::Request request;
   request.set_operation(chat::Operation::UNREGISTER_USER);
   auto *unregister_user = request.mutable_unregister_user();
   unregister_user->set_username(username);
 
-  SPM(sock, request);
+  batcher->send(request);
+}
+
+/**
+ * Script mode: sends one command of a script, false when it is not one a script can use
+ */
+bool send_script_command(const std::string &line)
+{
+  std::istringstream iss(line);
+  std::string command, argument;
+  iss >> command >> argument;
+  std::string rest;
+  std::getline(iss >> std::ws, rest);
+
+  chat::UserStatus status;
+  bool valid = (command == "send" && !argument.empty()) || (command == "sendto" && !rest.empty()) ||
+               (command == "status" && chat::UserStatus_Parse(argument, &status) && rest.empty()) ||
+               (command == "list" && argument.empty());
+  if (!valid)
+    return false;
+
+  // Counted before it is sent, the reply may come back first
+  {
+    std::lock_guard<std::mutex> lock(script_mutex);
+    script_in_flight.push_back({command, std::chrono::steady_clock::now()});
+  }
+  if (command == "send")
+    handleBroadcastMessage(line.substr(line.find(argument, command.size())));
+  else if (command == "sendto")
+    handleDirectMessage(argument, rest);
+  else if (command == "status")
+    handleChangeStatus(argument);
+  else
+    handleListUsers();
+  return true;
+}
+
+/**
+ * Script mode: the reply latency percentiles of each command
+ */
+void print_script_report(size_t sent, size_t skipped, std::chrono::duration<double> elapsed)
+{
+  std::lock_guard<std::mutex> lock(script_mutex);
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "Script: " << sent << " commands sent in " << elapsed.count() << " s (" << sent / std::max(elapsed.count(), 1e-6)
+            << "/s), " << skipped << " skipped, " << script_in_flight.size() + script_lost << " without a reply.\n";
+  std::cout << "Incoming notifications: " << inbox_pushed + inbox_dropped << ".\n";
+  std::cout << std::left << std::setw(10) << "command" << std::right << std::setw(8) << "count" << std::setw(8) << "errors"
+            << std::setw(10) << "p50 ms" << std::setw(10) << "p90 ms" << std::setw(10) << "p99 ms" << std::setw(10) << "max ms" << "\n";
+  for (auto &entry : script_stats)
+  {
+    std::vector<uint64_t> &latencies = entry.second.latencies_us;
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p)
+    { return latencies.empty() ? 0.0 : latencies[std::min(latencies.size() - 1, static_cast<size_t>(p * latencies.size()))] / 1000.0; };
+    std::cout << std::left << std::setw(10) << entry.first << std::right << std::setw(8) << latencies.size() << std::setw(8) << entry.second.errors
+              << std::setw(10) << percentile(0.5) << std::setw(10) << percentile(0.9) << std::setw(10) << percentile(0.99) << std::setw(10) << percentile(1.0) << "\n";
+  }
+  std::cout << std::flush;
+}
+
+/**
+ * Script mode: pipelines the send, sendto, status and list commands of a script, one per line,
+ * without waiting for the replies, at full speed or at rate commands per second. Then waits
+ * for the outstanding replies and reports the latency of each kind of command.
+ */
+void run_script(std::istream &input, double rate)
+{
+  auto started = std::chrono::steady_clock::now();
+  auto next = started;
+  size_t sent = 0, skipped = 0;
+  std::string line;
+  while (std::getline(input, line) && !terminate_execution)
+  {
+    if (line.empty() || line[0] == '#')
+      continue;
+    if (rate > 0)
+    {
+      std::this_thread::sleep_until(next);
+      next += std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / rate));
+    }
+    if (send_script_command(line))
+    {
+      sent++;
+    }
+    else
+    {
+      skipped++;
+      std::cout << "Skipped: " << line << std::endl;
+    }
+  }
+  batcher->flush();
+
+  {
+    std::unique_lock<std::mutex> lock(script_mutex);
+    script_replied.wait_for(lock, std::chrono::milliseconds(SCRIPT_REPLY_TIMEOUT_MS), []
+                            { return script_in_flight.empty(); });
+  }
+  print_script_report(sent, skipped, std::chrono::steady_clock::now() - started);
 }
 
 int main(int argc, char *argv[])
 {
-  if (argc != 4)
+  // Optional flags after the positional arguments run a script instead of the prompt
+  std::string script_path;
+  double script_rate = 0;
+  for (int i = 4; i + 1 < argc; i += 2)
+  {
+    if (std::string(argv[i]) == "--script")
+      script_path = argv[i + 1];
+    else if (std::string(argv[i]) == "--rate")
+    {
+      char *end;
+      script_rate = std::strtod(argv[i + 1], &end);
+      if (*end != '\0' || !std::isfinite(script_rate) || script_rate <= 0)
+        argc = 0;
+    }
+    else
+      argc = 0;
+  }
+  if (argc < 4 || argc % 2 != 0 || (script_rate != 0 && script_path.empty()))
   {
-    std::cerr << "Usage: " << argv[0] << " <server IP> <server port> <username>\n";
+    std::cerr << "Usage: " << argv[0] << " <server IP> <server port> <username> [--script <file>|-] [--rate <commands per second>]\n";
     return 1;
   }
 
@@ -269,63 +881,76 @@ int main(int argc, char *argv[])
   std::string username = argv[3];
   username_global = username;
 
-  int sock = 0;
-  struct sockaddr_in serv_addr;
-
-  if ((sock = socket(AF_INET, SOCK_STREAM, 0)) < 0)
-  {
-    std::cerr << "Socket creation error \n";
-    return -1;
-  }
-
-  serv_addr.sin_family = AF_INET;
-  serv_addr.sin_port = htons(server_port);
+  server_address.sin_family = AF_INET;
+  server_address.sin_port = htons(server_port);
 
-  if (inet_pton(AF_INET, server_ip.c_str(), &serv_addr.sin_addr) <= 0)
+  if (inet_pton(AF_INET, server_ip.c_str(), &server_address.sin_addr) <= 0)
   {
     std::cerr << "Invalid address/ Address not supported \n";
     return -1;
   }
 
-  if (connect(sock, (struct sockaddr *)&serv_addr, sizeof(serv_addr)) < 0)
+  int sock = open_connection();
+  if (sock == -1)
   {
     std::cerr << "Connection Failed \n";
     return -1;
   }
 
   // Register the user first
-  chat::Request request;
-  request.set_operation(chat::Operation::REGISTER_USER);
-  auto *new_user = request.mutable_register_user();
-  new_user->set_username(username);
-
-  SPM(sock, request);
-
   chat::Response response;
-  if (RPM(sock, response))
-  {
-    if (response.status_code() != chat::StatusCode::OK)
-    {
-      std::cout << RED "ERROR: " + response.message() + RESET << std::endl;
-      return -1;
-    }
-
-    std::cout << "SERVER: " << response.message() << std::endl;
-  }
-  else
+  if (!register_user(sock, response))
   {
-    std::cerr << "Connection closed." << std::endl;
+    std::cout << RED "ERROR: " + response.message() + RESET << std::endl;
     close(sock);
     return -1;
   }
+  std::cout << "SERVER: " << response.message() << std::endl;
+  server_sock = sock;
+
+  batcher = new RequestBatcher(sock, std::chrono::microseconds(CLIENT_BATCH_WINDOW_US), CLIENT_BATCH_MAX_REQUESTS, CLIENT_OFFLINE_REQUESTS);
 
   std::thread listener(messageListener, sock);
   listener.detach();
 
   // Start the termination handler thread
-  std::thread terminator(terminationHandler, sock, username, std::ref(listener));
+  std::thread terminator(terminationHandler, username, std::ref(listener));
   terminator.detach(); // Detach the thread so it can run independently
 
+  if (!script_path.empty())
+  {
+    std::ifstream file;
+    if (script_path != "-")
+    {
+      file.open(script_path);
+      if (!file)
+      {
+        std::cerr << "Could not open script " << script_path << std::endl;
+      }
+    }
+    script_mode = true;
+    batcher->on_batch([](size_t requests)
+                      {
+                        std::lock_guard<std::mutex> lock(script_mutex);
+                        script_batches.push_back(requests); });
+    if (script_path == "-" || file)
+    {
+      run_script(script_path == "-" ? std::cin : file, script_rate);
+    }
+
+    // Unregister, the listener prints the reply and keeps the late ones of the script out of the way
+    running = false;
+    waiting_response = true;
+    handleUnregisterUser(username);
+    for (int waited = 0; waiting_response && !terminate_execution && waited < 20; waited++)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    close(server_sock);
+    return 0;
+  }
+  std::thread(display_loop).detach();
+
   int choice = 0;
 
   displayHelp();
@@ -362,7 +987,7 @@ int main(int argc, char *argv[])
       else
       {
         std::string message = command.substr(command.find(" ") + 1);
-        handleBroadcastMessage(sock, message);
+        handleBroadcastMessage(message);
       }
     }
     else if (words[0] == "sendto")
@@ -376,7 +1001,7 @@ int main(int argc, char *argv[])
       {
         std::string recipient = words[1];
         std::string message = command.substr(command.find(recipient) + recipient.length() + 1);
-        handleDirectMessage(sock, recipient, message);
+        handleDirectMessage(recipient, message);
       }
     }
     else if (words[0] == "status")
@@ -388,7 +1013,7 @@ int main(int argc, char *argv[])
       }
       else
       {
-        const bool accepted_status = handleChangeStatus(sock, words[1]);
+        const bool accepted_status = handleChangeStatus(words[1]);
         if (accepted_status)
         {
           waiting_response = true;
@@ -408,7 +1033,7 @@ int main(int argc, char *argv[])
       }
       else
       {
-        handleListUsers(sock);
+        handleListUsers();
       }
     }
     else if (words[0] == "info")
@@ -420,7 +1045,66 @@ int main(int argc, char *argv[])
       }
       else
       {
-        handleGetUserInfo(sock, words[1]);
+        handleGetUserInfo(words[1]);
+      }
+    }
+    else if (words[0] == "history")
+    {
+      // "history #room 20 from bob" only lists what bob wrote
+      std::string sender;
+      if (length >= 3 && words[length - 2] == "from")
+      {
+        sender = words[length - 1];
+        length -= 2;
+      }
+      if (length > 3)
+      {
+        std::cout << "Invalid command. Usage: history [username|#room] [limit] [from <username>]\n";
+        waiting_response = false;
+      }
+      else
+      {
+        // "history 20" asks for the broadcast channel, "history bob 20" for a direct conversation
+        std::string conversation;
+        uint32_t limit = 0;
+        for (size_t i = 1; i < length; i++)
+        {
+          if (i == length - 1 && words[i].find_first_not_of("0123456789") == std::string::npos)
+          {
+            limit = std::stoul(words[i]);
+          }
+          else
+          {
+            conversation = words[i];
+          }
+        }
+        handleGetHistory(conversation, limit, sender);
+      }
+    }
+    else if (words[0] == "join" || words[0] == "leave")
+    {
+      if (length != 2)
+      {
+        std::cout << "Invalid command. Usage: " << words[0] << " <room>\n";
+        waiting_response = false;
+      }
+      else
+      {
+        handleRoomRequest(words[0] == "join" ? chat::Operation::JOIN_ROOM : chat::Operation::LEAVE_ROOM, words[1]);
+      }
+    }
+    else if (words[0] == "sendroom")
+    {
+      if (length < 3)
+      {
+        std::cout << "Invalid command. Usage: sendroom <room> <message>\n";
+        waiting_response = false;
+      }
+      else
+      {
+        std::string room = words[1];
+        std::string message = command.substr(command.find(room, command.find("sendroom") + 8) + room.length() + 1);
+        handleRoomRequest(chat::Operation::SEND_ROOM_MESSAGE, room, message);
       }
     }
     else if (words[0] == "help")
@@ -453,6 +1137,19 @@ int main(int argc, char *argv[])
       }
       waiting_response = false;
     }
+    else if (words[0] == "receipts")
+    {
+      if (length != 2 || (words[1] != "on" && words[1] != "off"))
+      {
+        std::cout << "Invalid command. Usage: receipts <on|off>\n";
+      }
+      else
+      {
+        read_receipts = words[1] == "on";
+        std::cout << "Read receipts: " << (read_receipts ? "ON" : "OFF") << std::endl;
+      }
+      waiting_response = false;
+    }
     else if (words[0] == "exit")
     {
       if (length != 1)
@@ -469,9 +1166,9 @@ int main(int argc, char *argv[])
           listener.join(); // Wait for the listener thread to finish
         }
         // 2. Send the unregister request
-        handleUnregisterUser(sock, username);
+        handleUnregisterUser(username);
         // 3. Wait for the server to respond
-        if (RPM(sock, response))
+        if (RPM(server_sock, response))
         {
           std::cout << "SERVER: " << response.message() << std::endl;
         }
@@ -508,7 +1205,7 @@ int main(int argc, char *argv[])
     listener.join(); // Wait for the listener thread to finish
   }
   // Close the socket
-  close(sock);
+  close(server_sock);
 
   std::cout << "Exiting..." << std::endl;
   return 0;
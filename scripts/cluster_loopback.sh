@@ -0,0 +1,95 @@
+#!/usr/bin/env bash
+# cluster_loopback.sh
+#
+# Starts N server nodes on loopback, each joining the ones started before it, and one client
+# per node. Checks that presence converges (every client lists every user) and that direct
+# messages are routed between nodes (each user writes to the user of the next node).
+#
+# Usage: SERVER=<server binary> CLIENT=<client binary> ./scripts/cluster_loopback.sh [nodes]
+# Both binaries must be built from this tree, the ones committed in ./executables predate the
+# cluster. BASE_PORT and CLUSTER_BASE_PORT choose the ports, node i uses BASE_PORT + i and
+# CLUSTER_BASE_PORT + i.
+
+set -u
+
+NODES=${1:-3}
+if [ -z "${SERVER:-}" ] || [ -z "${CLIENT:-}" ] || [ ! -x "$SERVER" ] || [ ! -x "$CLIENT" ]; then
+  echo "Set SERVER and CLIENT to the server and client built from this tree (see the README)."
+  exit 2
+fi
+SERVER=$(realpath "$SERVER")
+CLIENT=$(realpath "$CLIENT")
+BASE_PORT=${BASE_PORT:-9300}
+CLUSTER_BASE_PORT=${CLUSTER_BASE_PORT:-9400}
+CONVERGE_SECONDS=${CONVERGE_SECONDS:-3} # Links retry every PEER_RETRY_SECONDS, gossip every GOSSIP_INTERVAL_MS
+
+if [ "$NODES" -lt 2 ]; then
+  echo "A cluster needs at least 2 nodes."
+  exit 2
+fi
+
+# Nodes write their history and snapshots in the working directory
+WORK=$(mktemp -d)
+cd "$WORK" || exit 2
+SERVER_PIDS=()
+cleanup()
+{
+  kill "${SERVER_PIDS[@]}" 2>/dev/null
+  wait 2>/dev/null
+  rm -rf "$WORK"
+}
+trap cleanup EXIT
+
+for i in $(seq 1 "$NODES"); do
+  peers=()
+  for j in $(seq 1 $((i - 1))); do
+    peers+=("127.0.0.1:$((CLUSTER_BASE_PORT + j))")
+  done
+  "$SERVER" $((BASE_PORT + i)) "n$i" $((CLUSTER_BASE_PORT + i)) "${peers[@]}" < /dev/null > "server_n$i.log" 2>&1 &
+  SERVER_PIDS+=($!)
+done
+sleep 1
+
+# Each client streams its inbox, waits for the other users, writes to the next node's user and
+# lists the users; the commands are fed with pauses so every client is registered meanwhile
+CLIENT_PIDS=()
+for i in $(seq 1 "$NODES"); do
+  next=$((i % NODES + 1))
+  {
+    echo "stream"
+    sleep "$CONVERGE_SECONDS"
+    echo "sendto u$next hello from u$i"
+    sleep 2
+    echo "list"
+    sleep 1
+    echo "exit"
+  } | "$CLIENT" 127.0.0.1 $((BASE_PORT + i)) "u$i" > "client_u$i.log" 2>&1 &
+  CLIENT_PIDS+=($!)
+done
+wait "${CLIENT_PIDS[@]}"
+
+failures=0
+for i in $(seq 1 "$NODES"); do
+  previous=$(((i + NODES - 2) % NODES + 1))
+  if ! grep -aq "from u$previous: hello from u$previous" "client_u$i.log"; then
+    echo "FAIL: u$i (node n$i) did not get the message of u$previous (node n$previous)"
+    failures=$((failures + 1))
+  fi
+  users=$(grep -a "Users online:" "client_u$i.log")
+  for j in $(seq 1 "$NODES"); do
+    if [[ "$users" != *" u$j ("* ]]; then
+      echo "FAIL: u$i (node n$i) does not list u$j"
+      failures=$((failures + 1))
+    fi
+  done
+done
+
+if [ "$failures" -gt 0 ]; then
+  for log in server_n*.log client_u*.log; do
+    echo "--- $log"
+    tail -n 20 "$log"
+  done
+  echo "$failures checks failed."
+  exit 1
+fi
+echo "$NODES nodes: presence converged and direct messages were routed between nodes."
@@ -1,6 +1,22 @@
 #include "./utils/chat.pb.h" // Include the generated protobuf header
 #include "./utils/message.h"
 #include "./utils/constants.h"
+#include "./utils/history.h"
+#include "./utils/room.h"
+#include "./utils/federation.h"
+#include "./utils/metrics.h"
+#include "./utils/rate_limit.h"
+#include "./utils/worker_pool.h"
+#include "./utils/coroutine.h"
+#include "./utils/handoff.h"
+#include "./utils/snapshot.h"
+#include "./utils/flush.h"
+#include "./utils/user_directory.h"
+#include "./utils/wire.h"
+#include "./utils/pool.h"
+#include "./utils/receipts.h"
+#include "./utils/timer.h"
+#include "./utils/outbox.h"
 #include <iostream>
 #include <string>
 #include <map>
@@ -14,24 +30,139 @@
 #include <chrono>
 #include <errno.h> // For errno, EPIPE
 #include <cstring> // For strerror
+#include <csignal> // For signal, SIGINT
+#include <algorithm> // For std::min, std::binary_search
+#include <memory>    // For std::shared_ptr
+#include <poll.h>    // For poll
+#include <fcntl.h>   // For fcntl, O_NONBLOCK
+#include <deque>     // For std::deque
+#include <sys/epoll.h> // For epoll_create1, epoll_ctl, epoll_wait
+#include <random>      // For std::mt19937
+#include <sys/wait.h>  // For waitpid
+#include <functional>  // For std::function
 
 std::mutex clients_mutex;
-std::map<int, std::string> client_sessions;                               // Maps client socket to username
-std::map<std::string, std::string> user_details;                          // Maps username to IP address
-std::map<std::string, chat::UserStatus> user_status;                      // Maps username to status
-std::map<std::string, std::chrono::system_clock::time_point> last_active; // User activity tracking TODO: Auto Status Modification
+UserDirectory local_users; // Registered users by interned id: socket, IP, status and last activity
+
+MessageHistory message_history; // Relayed messages, queried through GET_HISTORY
+RoomDirectory room_directory;   // Room membership, keyed by client socket
+Federation federation;          // Links to the other nodes of the cluster, if any
+ReceiptTracker receipt_tracker; // Direct messages of local users waiting for their recipient's acknowledgement
+uint64_t next_seq = 1;          // Sequence number of the next notification fan-out, guarded by clients_mutex
+
+std::string snapshot_path;                                // Where the periodic snapshots go
+std::map<std::string, chat::SnapshotUser> restored_users; // Users of the loaded snapshot that have not registered again, guarded by clients_mutex
+
+std::mutex ip_limits_mutex;
+std::map<std::string, std::shared_ptr<TokenBucket>> ip_limits; // Maps IP to the bucket shared by its connections
+
+// Admission control counters, a connection is in handshake until it registers
+struct AdmissionCounts
+{
+  int connections = 0;
+  int handshakes = 0;
+};
+std::mutex admission_mutex;
+AdmissionCounts admission_total;
+std::map<std::string, AdmissionCounts> admission_by_ip;
+
+// A request queued by the I/O thread. SEND_MESSAGE is usually only peeked (see wire.h): its
+// payload is kept as it came, request is left empty and the peeked fields are kept as offsets
+// into the payload, the session does not scan it again.
+struct PendingRequest
+{
+  chat::Request request;
+  std::string wire; // Payload of a peeked SEND_MESSAGE, never empty for one
+  size_t recipient_offset = 0;
+  size_t recipient_size = 0;
+  size_t content_offset = 0;
+  size_t content_size = 0;
+
+  // Keeps where the fields of a peek of payload lie, wire gets a copy of payload
+  void keep_peek(const char *payload, size_t length, const RequestPeek &peek)
+  {
+    wire.assign(payload, length);
+    recipient_offset = peek.recipient.empty() ? 0 : peek.recipient.data() - payload;
+    recipient_size = peek.recipient.size();
+    content_offset = peek.content.empty() ? 0 : peek.content.data() - payload;
+    content_size = peek.content.size();
+  }
+  std::string_view recipient() const { return std::string_view(wire).substr(recipient_offset, recipient_size); }
+  std::string_view content() const { return std::string_view(wire).substr(content_offset, content_size); }
+};
+
+// One client connection. The I/O thread owns the input buffer, the session fields are
+// guarded by session_mutex and everything else is only touched by the running session.
+// What a send pump did: sent everything (or failed), sent part of it, or could not start anything
+enum class PumpResult
+{
+  Done,
+  Progress,
+  Stalled
+};
+
+struct Connection
+{
+  int sock;
+  int epoll_fd; // Of the I/O thread reading the socket
+  std::string ip;
+  std::atomic<bool> registered{false};
+  std::atomic<bool> timed_out{false};
+  UserId user_id = NO_USER; // Interned username once registered
+  bool open = true;
+  bool superseded = false; // A resume on another connection took the session over
+  ClientRateLimits limits;
+  std::chrono::steady_clock::time_point accepted_at = std::chrono::steady_clock::now();
+  std::string input;
+  Reassembly reassembly; // Large messages still arriving in chunks, used by the I/O thread only
+
+  std::mutex session_mutex;
+  std::deque<PendingRequest, PoolAllocator<PendingRequest>> pending;
+  bool closing = false;
+  std::coroutine_handle<> recv_waiter; // Session suspended in co_recv_message
+  std::coroutine_handle<> send_waiter; // Session suspended in co_send_message
+  std::function<PumpResult()> send_pump; // Sends what that session has left
+};
+
+// An epoll loop and the connections it reads
+struct IoThread
+{
+  int epoll_fd = -1;
+  std::atomic<bool> stopped{false};
+  std::mutex connections_mutex;
+  std::map<int, std::shared_ptr<Connection>> connections;
+};
+
+WorkerPool *worker_pool;            // Runs the request handlers
+std::vector<IoThread *> io_threads; // Connections are spread round robin over them
+size_t next_io = 0;                 // Only touched by the main thread
 
 std::atomic<bool> running(true);
+std::atomic<bool> draining(false); // Set by exit or a signal, the accept loop stops and the server drains
+std::atomic<int> handoff_sock(-1); // Connection of a replacement process asking to take over
 int server_fd;
 /**
- * REGISTER_USER main function
+ * Resumable sessions: the secret a client takes its session back with, never 0
+ */
+uint64_t new_resume_token()
+{
+  std::random_device random;
+  uint64_t token = 0;
+  while (token == 0)
+    token = (static_cast<uint64_t>(random()) << 32) | random();
+  return token;
+}
+
+/**
+ * REGISTER_USER main function, returns the id the username was interned as or NO_USER
  */
-bool handle_registration(const chat::Request &request, int client_sock, chat::Operation operation)
+UserId handle_registration(const chat::Request &request, int client_sock, chat::Operation operation)
 {
   auto user_request = request.register_user();
   const auto &username = user_request.username();
 
-  std::lock_guard<std::mutex> lock(clients_mutex);
+  Outbox outbox; // The reply is queued under the lock, ahead of the notifications of later holders
+  std::unique_lock<std::mutex> lock(clients_mutex);
 
   chat::Response response;
   response.set_operation(operation);
@@ -51,63 +182,89 @@ bool handle_registration(const chat::Request &request, int client_sock, chat::Op
     ip_str = "Unknown IP"; // TODO: this case is needed to be handled -> not allow to register
     response.set_message("Unable to retrieve IP address.");
     response.set_status_code(chat::StatusCode::BAD_REQUEST);
-    SPM(client_sock, response);
-    return false;
+    outbox.add_reply(client_sock, response);
+    return NO_USER;
   }
 
   // Check for unique IP if HANDLE_UNIQUE_IP is true
   if (HANDLE_UNIQUE_IP)
   {
-    for (const auto &entry : user_details)
+    for (const auto &entry : local_users.by_name())
     {
-      if (entry.second == ip_str)
+      if (local_users[entry.second].ip == ip_str)
       {
         response.set_message("IP address is already in use.");
         response.set_status_code(chat::StatusCode::BAD_REQUEST);
-        SPM(client_sock, response);
-        return false;
+        outbox.add_reply(client_sock, response);
+        return NO_USER;
       }
     }
   }
 
-  // Check if the username is already taken
-  if (user_details.find(username) != user_details.end())
+  // Check if the username is already taken, here or on another node of the cluster
+  RemoteUser remote_user;
+  if (local_users.find(username) != NO_USER || federation.find_user(username, remote_user))
   {
     response.set_message("Username is already taken.");
     response.set_status_code(chat::StatusCode::BAD_REQUEST);
-    SPM(client_sock, response);
-    return false;
+    outbox.add_reply(client_sock, response);
+    return NO_USER;
   }
 
   std::cout << "Registering user: " << username << " with IP: " << ip_str << std::endl;
 
-  // Register user
-  user_details.emplace(username, ip_str);
-  user_status.emplace(username, chat::UserStatus::ONLINE); // Set status to online
-  client_sessions.emplace(client_sock, username);          // Link socket to username
+  // Register user, online and linked to its socket
+  UserId id = local_users.add(username, ip_str, client_sock);
 
   response.set_message("User registered successfully.");
   response.set_status_code(chat::StatusCode::OK);
 
-  SPM(client_sock, response);
-  return true;
+  // The reply itself still goes uncompressed, the client only knows after reading it
+  bool compress = COMPRESSION_ENABLED && user_request.compression() == chat::Compression::COMPRESSION_DEFLATE;
+  if (compress)
+    response.set_compression(chat::Compression::COMPRESSION_DEFLATE);
+  local_users[id].compact = COMPACT_MESSAGES_ENABLED && user_request.compact();
+  response.set_compact(local_users[id].compact);
+  if (RESUME_GRACE_MS > 0 && user_request.resumable())
+  {
+    local_users[id].resume_token = new_resume_token();
+    response.set_resume_token(local_users[id].resume_token);
+  }
+
+  outbox.add_reply(client_sock, response);
+  lock.unlock();
+
+  outbox.send();
+  set_compression(client_sock, compress);
+  return id;
 }
 
 /**
  * GET_USERS auxiliary function
  */
-void add_user_to_response(const std::pair<std::string, std::string> &user, chat::UserListResponse &response)
+void add_user_to_response(const LocalUser &user, chat::UserListResponse &response)
 {
   chat::User *user_proto = response.add_users();
   // Username concatenated string: <username> (<ip>)
-  user_proto->set_username(user.first + " (" + user.second + ")");
-  user_proto->set_status(user_status[user.first]);
+  user_proto->set_username(user.name + " (" + user.ip + ")");
+  user_proto->set_status(user.status);
+}
+
+/**
+ * GET_USERS auxiliary function
+ */
+void add_remote_user_to_response(const std::string &username, const RemoteUser &user, chat::UserListResponse &response)
+{
+  chat::User *user_proto = response.add_users();
+  // Username concatenated string: <username> (@<node>)
+  user_proto->set_username(username + " (@" + user.node + ")");
+  user_proto->set_status(user.status);
 }
 
 /**
  * GET_USERS main function
  */
-void handle_get_users(const chat::Request &request, int client_sock, chat::Operation operation)
+chat::Response handle_get_users(const chat::Request &request, chat::Operation operation)
 {
   std::lock_guard<std::mutex> lock(clients_mutex);
 
@@ -120,9 +277,13 @@ void handle_get_users(const chat::Request &request, int client_sock, chat::Opera
   {
     // Return all connected users
     user_list_response.set_type(chat::UserListType::ALL);
-    for (const auto &user : user_details)
+    for (const auto &user : local_users.by_name())
+    {
+      add_user_to_response(local_users[user.second], user_list_response);
+    }
+    for (const auto &user : federation.remote_users_snapshot())
     {
-      add_user_to_response(user, user_list_response);
+      add_remote_user_to_response(user.first, user.second, user_list_response);
     }
     std::cout << "All users fetched successfully." << std::endl;
     response.set_message("All users fetched successfully.");
@@ -132,11 +293,19 @@ void handle_get_users(const chat::Request &request, int client_sock, chat::Opera
   {
     user_list_response.set_type(chat::UserListType::SINGLE);
     // Return only the specified user
-    auto it = user_details.find(request.get_users().username());
-    if (it != user_details.end())
+    UserId id = local_users.find(request.get_users().username());
+    RemoteUser remote_user;
+    if (id != NO_USER)
+    {
+      add_user_to_response(local_users[id], user_list_response);
+      std::cout << "User fetched successfully: " << local_users.name(id) << std::endl;
+      response.set_message("User fetched successfully.");
+      response.set_status_code(chat::StatusCode::OK);
+    }
+    else if (federation.find_user(request.get_users().username(), remote_user))
     {
-      add_user_to_response(*it, user_list_response);
-      std::cout << "User fetched successfully: " << it->first << std::endl;
+      add_remote_user_to_response(request.get_users().username(), remote_user, user_list_response);
+      std::cout << "Remote user fetched successfully: " << request.get_users().username() << std::endl;
       response.set_message("User fetched successfully.");
       response.set_status_code(chat::StatusCode::OK);
     }
@@ -150,158 +319,475 @@ void handle_get_users(const chat::Request &request, int client_sock, chat::Opera
 
   // Copy the user list to the response
   response.mutable_user_list()->CopyFrom(user_list_response);
-  // Send the complete response
-  SPM(client_sock, response);
+  return response;
 }
 /**
  * SEND_MESSAGE auxiliary function
  */
-chat::IncomingMessageResponse prepare_message_response(const chat::Request &request, int client_sock)
+chat::IncomingMessageResponse prepare_message_response(std::string_view content, int client_sock)
 {
-  auto message = request.send_message();
   chat::IncomingMessageResponse message_response;
   std::lock_guard<std::mutex> lock(clients_mutex); // Lock the clients mutex, for thread safety
-  message_response.set_sender(client_sessions[client_sock]);
-  message_response.set_content(message.content());
+  message_response.set_sender(local_users.name_by_socket(client_sock));
+  message_response.set_content(std::string(content));
   return message_response;
 }
 
 /**
- * SEND_MESSAGE auxiliary function
+ * SEND_MESSAGE auxiliary function: the incoming message of the recipients' frames, which take
+ * the content from the request bytes instead
  */
-void send_broadcast_message(const chat::IncomingMessageResponse &message_response, int client_sock)
+void copy_without_content(const chat::IncomingMessageResponse &message_response, chat::IncomingMessageResponse &incoming)
 {
-  std::lock_guard<std::mutex> lock(clients_mutex);
+  incoming.set_sender(message_response.sender());
+  incoming.set_type(message_response.type());
+  incoming.set_timestamp(message_response.timestamp());
+  incoming.set_room(message_response.room());
+}
+
+/**
+ * Wire id of the user on a socket, 0 when it has none. Messages carry it in compact mode and
+ * receipts use it to tell a session from a later one. Caller holds clients_mutex.
+ */
+uint32_t session_wire_id(int sock)
+{
+  UserId id = local_users.by_socket(sock);
+  return id == NO_USER ? 0 : local_users[id].wire_id;
+}
+
+/**
+ * Compact wire mode: whether a user can get messages of a sender without its name. The first
+ * message of each sender goes out in full and announces the id, the session remembers it from
+ * then on. Caller holds clients_mutex.
+ */
+bool sender_known(LocalUser &recipient, uint32_t sender_id)
+{
+  if (sender_id == 0 || !recipient.compact)
+    return false;
+  return !recipient.announced.insert(sender_id).second;
+}
+
+/**
+ * Queues a notification frame for a user, the outbox sends it once clients_mutex is released.
+ * Resumable sessions keep it until the client acknowledges its seq, a detached one only keeps
+ * it. Caller holds clients_mutex.
+ */
+void deliver(LocalUser &user, uint64_t seq, std::shared_ptr<const std::string> frame, Outbox &outbox)
+{
+  if (user.resume_token != 0)
+    user.resume.push(seq, frame, user.sock != DETACHED);
+  if (user.sock != DETACHED)
+    outbox.add(user.sock, std::move(frame));
+}
+
+/**
+ * Frames of one incoming message fan-out, with and without the sender name, each serialized
+ * the first time a recipient needs it. When content is set the response has none, the frames
+ * take it as a byte slice. Caller holds clients_mutex while using it, and sets the seq of the
+ * response first.
+ */
+struct IncomingFrames
+{
+  const chat::Response &response;
+  std::string_view content;
+  std::shared_ptr<std::string> full;
+  std::shared_ptr<std::string> compact;
+
+  explicit IncomingFrames(const chat::Response &response, std::string_view content = {}) : response(response), content(content) {}
 
-  for (const auto &session : client_sessions)
+  const std::shared_ptr<std::string> &for_user(LocalUser &user)
   {
-    if (session.first != client_sock)
-    { // Optionally avoid sending the message back to the sender
-      chat::Response response_to_recipient;
-      response_to_recipient.set_operation(chat::Operation::INCOMING_MESSAGE);
-      response_to_recipient.set_message("Broadcast message incoming.");
-      response_to_recipient.set_status_code(chat::StatusCode::OK);
-      response_to_recipient.mutable_incoming_message()->CopyFrom(message_response);
-      SPM(session.first, response_to_recipient);
+    static Metric &compact_frames = metric("wire.compact_frames");
+    static Metric &bytes_saved = metric("wire.compact_bytes_saved");
+
+    if (!sender_known(user, response.incoming_message().sender_id()))
+    {
+      if (!full)
+      {
+        full = std::make_shared<std::string>();
+        build_incoming_frame(response, content, *full);
+      }
+      return full;
     }
+    if (!compact)
+    {
+      compact = std::make_shared<std::string>();
+      chat::Response stripped = response;
+      stripped.mutable_incoming_message()->clear_sender();
+      build_incoming_frame(stripped, content, *compact);
+    }
+    compact_frames.add();
+    bytes_saved.add(response.incoming_message().sender().size());
+    return compact;
   }
+};
+
+/**
+ * SEND_MESSAGE auxiliary function
+ */
+void send_broadcast_message(chat::Response &response_to_sender, chat::IncomingMessageResponse &message_response, std::string_view content, int client_sock)
+{
+  message_history.append(BROADCAST_CONVERSATION, message_response);
+
+  // Serialize once, every recipient gets the same frame
+  chat::Response response_to_recipient;
+  response_to_recipient.set_operation(chat::Operation::INCOMING_MESSAGE);
+  response_to_recipient.set_message("Broadcast message incoming.");
+  response_to_recipient.set_status_code(chat::StatusCode::OK);
+  copy_without_content(message_response, *response_to_recipient.mutable_incoming_message());
+
+  // Users hosted by other nodes get it through their node
+  federation.forward_to_all(message_response);
+
+  Outbox outbox;
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex);
+
+    // The sender id only goes to local sessions, peers and the history keep the name alone
+    response_to_recipient.mutable_incoming_message()->set_sender_id(session_wire_id(client_sock));
+    response_to_recipient.set_seq(next_seq++);
+    IncomingFrames frames{response_to_recipient, content};
+    local_users.for_each([&](UserId, LocalUser &user)
+                         {
+                           if (user.sock != client_sock) // Optionally avoid sending the message back to the sender
+                             deliver(user, response_to_recipient.seq(), frames.for_user(user), outbox); });
+  }
+  outbox.send();
 
-  chat::Response response_to_sender;
   response_to_sender.set_message("Broadcast message sent successfully.");
   response_to_sender.set_status_code(chat::StatusCode::OK);
-  SPM(client_sock, response_to_sender);
 }
 
 /**
- * SEND_MESSAGE auxiliary function
+ * SEND_MESSAGE auxiliary function, false when the recipient is not a user of this node
  */
-int find_recipient_socket(const std::string &recipient)
+bool send_direct_message(chat::Response &response_to_sender, chat::Response &response_to_recipient, chat::IncomingMessageResponse &message_response, std::string_view content, int client_sock, const std::string &recipient)
 {
-  int recipient_sock = -1;
-  for (auto &session : client_sessions)
+  message_response.set_type(chat::MessageType::DIRECT);
+  response_to_recipient.set_message("Message incoming.");
+  response_to_recipient.set_status_code(chat::StatusCode::OK);
+  copy_without_content(message_response, *response_to_recipient.mutable_incoming_message());
+  Outbox outbox;
   {
-    if (session.second == recipient)
-    {
-      recipient_sock = session.first;
-      break;
-    }
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    UserId recipient_id = local_users.find(recipient);
+    if (recipient_id == NO_USER)
+      return false;
+
+    LocalUser &recipient_user = local_users[recipient_id];
+    uint32_t sender_wire = session_wire_id(client_sock);
+    uint64_t message_id = receipt_tracker.track(local_users.by_socket(client_sock), sender_wire, recipient_user.wire_id);
+    response_to_recipient.mutable_incoming_message()->set_sender_id(sender_wire);
+    response_to_recipient.mutable_incoming_message()->set_message_id(message_id);
+    response_to_recipient.set_seq(next_seq++);
+    response_to_sender.set_message_id(message_id);
+    IncomingFrames frames{response_to_recipient, content};
+    deliver(recipient_user, response_to_recipient.seq(), frames.for_user(recipient_user), outbox);
   }
-  return recipient_sock;
+  outbox.send();
+  message_history.append(MessageHistory::direct_conversation(message_response.sender(), recipient), message_response);
+
+  // Only says the frame was handed to the kernel, the RECEIPTS notifications tell when it arrived
+  response_to_sender.set_message("Message sent successfully.");
+  response_to_sender.set_status_code(chat::StatusCode::OK);
+  return true;
 }
 
 /**
  * SEND_MESSAGE auxiliary function
  */
-void send_direct_message(chat::Response &response_to_sender, chat::Response &response_to_recipient, chat::IncomingMessageResponse &message_response, int client_sock, int recipient_sock)
+bool send_remote_direct_message(chat::Response &response_to_sender, chat::IncomingMessageResponse &message_response, const std::string &recipient)
 {
   message_response.set_type(chat::MessageType::DIRECT);
-  response_to_recipient.set_message("Message incoming.");
-  response_to_recipient.set_status_code(chat::StatusCode::OK);
-  response_to_recipient.mutable_incoming_message()->CopyFrom(message_response);
-  SPM(recipient_sock, response_to_recipient);
+
+  // Presence tells whether the user exists somewhere, the hash ring tells where to send it
+  RemoteUser remote_user;
+  if (!federation.find_user(recipient, remote_user) || !federation.forward_direct(recipient, message_response))
+    return false;
+  message_history.append(MessageHistory::direct_conversation(message_response.sender(), recipient), message_response);
 
   response_to_sender.set_message("Message sent successfully.");
   response_to_sender.set_status_code(chat::StatusCode::OK);
-  SPM(client_sock, response_to_sender);
+  return true;
 }
 
 /**
- * SEND_MESSAGE main function
+ * SEND_MESSAGE main function. Recipient and content are views into the request, parsed or
+ * only peeked by the I/O thread.
  */
-void handle_send_message(const chat::Request &request, int client_sock, chat::Operation operation)
+chat::Response handle_send_message(std::string_view recipient, std::string_view content, int client_sock, chat::Operation operation)
 {
   chat::Response response_to_sender;
   response_to_sender.set_operation(operation);
 
   chat::Response response_to_recipient;
   response_to_recipient.set_operation(chat::Operation::INCOMING_MESSAGE);
-  chat::IncomingMessageResponse message_response = prepare_message_response(request, client_sock);
+  chat::IncomingMessageResponse message_response = prepare_message_response(content, client_sock);
 
-  if (request.send_message().recipient().empty())
+  if (recipient.empty())
   {
-    send_broadcast_message(message_response, client_sock);
+    send_broadcast_message(response_to_sender, message_response, content, client_sock);
   }
   else
   {
-    int recipient_sock = find_recipient_socket(request.send_message().recipient());
-    if (recipient_sock != -1)
+    const std::string recipient_name(recipient);
+    if (!send_direct_message(response_to_sender, response_to_recipient, message_response, content, client_sock, recipient_name) &&
+        !send_remote_direct_message(response_to_sender, message_response, recipient_name))
+    {
+      response_to_sender.set_message("Recipient not found.");
+      response_to_sender.set_status_code(chat::StatusCode::BAD_REQUEST);
+    }
+  }
+  return response_to_sender;
+}
+
+/**
+ * JOIN_ROOM and LEAVE_ROOM main function
+ */
+chat::Response handle_room_membership(const chat::Request &request, int client_sock, chat::Operation operation)
+{
+  const std::string &room = request.room().room();
+
+  chat::Response response;
+  response.set_operation(operation);
+
+  if (room.empty())
+  {
+    response.set_message("Room name is required.");
+    response.set_status_code(chat::StatusCode::BAD_REQUEST);
+  }
+  else if (operation == chat::Operation::JOIN_ROOM)
+  {
+    if (room_directory.join(room, client_sock))
     {
-      send_direct_message(response_to_sender, response_to_recipient, message_response, client_sock, recipient_sock);
+      response.set_message("Joined room " + room + ".");
+      response.set_status_code(chat::StatusCode::OK);
     }
     else
     {
-      response_to_sender.set_message("Recipient not found.");
-      response_to_sender.set_status_code(chat::StatusCode::BAD_REQUEST);
-      SPM(client_sock, response_to_sender);
+      response.set_message("Already a member of room " + room + ".");
+      response.set_status_code(chat::StatusCode::BAD_REQUEST);
+    }
+  }
+  else
+  {
+    if (room_directory.leave(room, client_sock))
+    {
+      response.set_message("Left room " + room + ".");
+      response.set_status_code(chat::StatusCode::OK);
+    }
+    else
+    {
+      response.set_message("Not a member of room " + room + ".");
+      response.set_status_code(chat::StatusCode::BAD_REQUEST);
+    }
+  }
+
+  return response;
+}
+
+/**
+ * Room fan-out to the members on this node but one, and to the detached users that were in the
+ * room (rooms are keyed by socket, they left them when their connection dropped). Caller holds
+ * clients_mutex.
+ */
+void deliver_to_room(const std::string &room, const std::vector<int> &members, int except_sock, IncomingFrames &frames, Outbox &outbox)
+{
+  uint64_t seq = frames.response.seq();
+  for (int member : members)
+  {
+    UserId id = local_users.by_socket(member);
+    if (member != except_sock && id != NO_USER)
+      deliver(local_users[id], seq, frames.for_user(local_users[id]), outbox);
+  }
+  for (UserId id : local_users.detached())
+  {
+    LocalUser &user = local_users[id];
+    if (std::find(user.rooms.begin(), user.rooms.end(), room) != user.rooms.end())
+      deliver(user, seq, frames.for_user(user), outbox);
+  }
+}
+
+/**
+ * SEND_ROOM_MESSAGE main function
+ */
+chat::Response handle_room_message(const chat::Request &request, int client_sock, chat::Operation operation)
+{
+  const std::string &room = request.room().room();
+
+  chat::Response response_to_sender;
+  response_to_sender.set_operation(operation);
+
+  std::vector<int> members = room_directory.members(room);
+  if (!std::binary_search(members.begin(), members.end(), client_sock))
+  {
+    response_to_sender.set_message("Not a member of room " + room + ".");
+    response_to_sender.set_status_code(chat::StatusCode::BAD_REQUEST);
+    return response_to_sender;
+  }
+
+  chat::IncomingMessageResponse message_response;
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    message_response.set_sender(local_users.name_by_socket(client_sock));
+  }
+  message_response.set_content(request.room().content());
+  message_response.set_type(chat::MessageType::ROOM);
+  message_response.set_room(room);
+  message_history.append("#" + room, message_response);
+
+  // One serialized payload for the whole room
+  chat::Response response_to_recipient;
+  response_to_recipient.set_operation(chat::Operation::INCOMING_MESSAGE);
+  response_to_recipient.set_message("Room message incoming.");
+  response_to_recipient.set_status_code(chat::StatusCode::OK);
+  *response_to_recipient.mutable_incoming_message() = message_response;
+
+  // Members on other nodes get it through their node
+  federation.forward_to_all(message_response);
+
+  Outbox outbox;
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    response_to_recipient.mutable_incoming_message()->set_sender_id(session_wire_id(client_sock));
+    response_to_recipient.set_seq(next_seq++);
+    IncomingFrames frames{response_to_recipient};
+    deliver_to_room(room, members, client_sock, frames, outbox);
+  }
+  outbox.send();
+
+  response_to_sender.set_message("Room message sent successfully.");
+  response_to_sender.set_status_code(chat::StatusCode::OK);
+  return response_to_sender;
+}
+
+/**
+ * GET_HISTORY main function, returns the pages of the reply in order
+ */
+std::vector<chat::Response> handle_get_history(const chat::Request &request, int client_sock, chat::Operation operation)
+{
+  const auto &history_request = request.get_history();
+
+  std::string requester;
+  int64_t registered_at = 0;
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    UserId id = local_users.by_socket(client_sock);
+    if (id != NO_USER)
+    {
+      requester = local_users.name(id);
+      registered_at = std::chrono::duration_cast<std::chrono::milliseconds>(local_users[id].registered_at.time_since_epoch()).count();
+    }
+  }
+
+  HistoryQuery range;
+  range.since = history_request.since();
+  range.until = history_request.until();
+  range.limit = history_request.limit() == 0 ? HISTORY_DEFAULT_LIMIT : std::min<size_t>(history_request.limit(), HISTORY_MAX_LIMIT);
+  range.sender = history_request.sender();
+
+  std::string conversation = BROADCAST_CONVERSATION;
+  if (!history_request.conversation().empty() && history_request.conversation()[0] == '#')
+  {
+    // Room history is only visible to members
+    if (!room_directory.is_member(history_request.conversation().substr(1), client_sock))
+    {
+      chat::Response response;
+      response.set_operation(operation);
+      response.set_message("Not a member of room " + history_request.conversation().substr(1) + ".");
+      response.set_status_code(chat::StatusCode::BAD_REQUEST);
+      return {response};
     }
+    conversation = history_request.conversation();
+  }
+  else if (!history_request.conversation().empty())
+  {
+    // Usernames are freed on unregister, the direct history of a previous owner of the name stays hidden
+    conversation = MessageHistory::direct_conversation(requester, history_request.conversation());
+    range.visible_from = registered_at;
   }
+
+  // Pages go back one frame each, the last one is flagged
+  std::vector<chat::Response> pages;
+  size_t total = 0;
+  message_history.query(conversation, range,
+                        [&](const std::vector<chat::IncomingMessageResponse> &page, bool last_page)
+                        {
+                          chat::Response &response = pages.emplace_back();
+                          response.set_operation(operation);
+                          response.set_status_code(chat::StatusCode::OK);
+                          response.set_message("History page fetched successfully.");
+                          chat::HistoryResponse *history = response.mutable_history();
+                          for (const auto &message : page)
+                          {
+                            *history->add_messages() = message;
+                          }
+                          history->set_page(pages.size() - 1);
+                          history->set_last_page(last_page);
+                          total += page.size();
+                          return true;
+                        });
+
+  std::cout << "History fetched for " << requester << ": " << total << " messages in " << pages.size() << " pages." << std::endl;
+  return pages;
 }
 
 /**
  * UPDATE_STATUS auxiliary function
  */
-void update_user_status_and_time(int client_sock, const chat::UpdateStatusRequest &status_request)
+std::string update_user_status_and_time(int client_sock, const chat::UpdateStatusRequest &status_request)
 {
   std::lock_guard<std::mutex> lock(clients_mutex);
-  user_status[client_sessions[client_sock]] = status_request.new_status();
-  // last_active[client_sessions[client_sock]] = std::chrono::system_clock::now(); TODO: Move this to any action retrieved on the general handling
+  UserId id = local_users.by_socket(client_sock);
+  if (id == NO_USER)
+    return std::string();
+  local_users[id].status = status_request.new_status();
+  return local_users.name(id);
+  // local_users[id].last_active = std::chrono::system_clock::now(); TODO: Move this to any action retrieved on the general handling
 }
 
 /**
  * UPDATE_STATUS main function
  */
-void update_status(const chat::Request &request, int client_sock, chat::Operation operation)
+chat::Response update_status(const chat::Request &request, int client_sock, chat::Operation operation)
 {
   auto status_request = request.update_status();
-  update_user_status_and_time(client_sock, status_request);
+  std::string username = update_user_status_and_time(client_sock, status_request);
 
   chat::Response response;
   response.set_operation(operation);
+  if (username.empty())
+  {
+    // The session moved to another connection meanwhile
+    response.set_message("User not registered.");
+    response.set_status_code(chat::StatusCode::BAD_REQUEST);
+    return response;
+  }
+  federation.publish_presence(username, status_request.new_status(), true);
+
   response.set_message("Status updated successfully."); // Consider replacing this with a constant or a configuration value
   response.set_status_code(chat::StatusCode::OK);
-  SPM(client_sock, response);
+  return response;
 }
 
 /**
- * UNREGISTER_USER main function
+ * UNREGISTER_USER main function, also used when a connection drops (its reply is then dropped)
  */
-void unregister_user(int client_sock, bool forced = false)
+chat::Response unregister_user(int client_sock)
 {
-  std::lock_guard<std::mutex> lock(clients_mutex);
+  std::unique_lock<std::mutex> lock(clients_mutex);
   chat::Response response;
+  std::string username;
 
-  if (client_sessions.find(client_sock) != client_sessions.end())
+  UserId id = local_users.by_socket(client_sock);
+  if (id != NO_USER)
   {
-    std::string username = client_sessions[client_sock];
-
-    // Erase user data from maps
-    client_sessions.erase(client_sock);
-
-    user_details.erase(username);
+    username = local_users.name(id);
 
-    user_status.erase(username);
+    // Release the id, a later registration may reuse it
+    local_users.remove(id);
 
-    last_active.erase(username);
+    room_directory.leave_all(client_sock);
 
     // Prepare a response message
     response.set_operation(chat::Operation::UNREGISTER_USER);
@@ -314,232 +800,1825 @@ void unregister_user(int client_sock, bool forced = false)
     response.set_message("User not found or already unregistered.");
     response.set_status_code(chat::StatusCode::BAD_REQUEST);
   }
+  lock.unlock();
+
+  // Peers are told without holding the clients lock, the link may block
+  if (!username.empty())
+  {
+    federation.publish_presence(username, chat::UserStatus::OFFLINE, false);
+    federation.publish_location(username, false);
+  }
+  return response;
+}
+
+/**
+ * Rate limiting: takes the IP bucket shared by every connection from the client's address
+ */
+std::shared_ptr<TokenBucket> acquire_ip_bucket(const std::string &ip_str)
+{
+  std::lock_guard<std::mutex> lock(ip_limits_mutex);
+  std::shared_ptr<TokenBucket> &bucket = ip_limits[ip_str];
+  if (!bucket)
+  {
+    bucket = std::make_shared<TokenBucket>(RateBudget{RATE_IP_PER_SECOND, RATE_IP_BURST});
+  }
+  return bucket;
+}
+
+/**
+ * Rate limiting: drops the IP bucket once its last connection is gone
+ */
+void release_ip_bucket(std::shared_ptr<TokenBucket> &bucket, const std::string &ip_str)
+{
+  std::lock_guard<std::mutex> lock(ip_limits_mutex);
+  bucket.reset();
+  auto it = ip_limits.find(ip_str);
+  if (it != ip_limits.end() && it->second.use_count() == 1)
+  {
+    ip_limits.erase(it);
+  }
+}
+
+/**
+ * Rate limiting: charges an operation to the user and IP buckets.
+ * With delay_ms, a request that gets a token within RATE_MAX_DELAY_MS is not charged yet: the
+ * wait goes in delay_ms and the caller asks again once it passed. The rest are rejected and
+ * rejection is filled with TOO_MANY_REQUESTS.
+ */
+bool admit_operation(ClientRateLimits &limits, chat::Operation operation, chat::Response &rejection, int64_t *delay_ms = nullptr)
+{
+  static Metric &delayed = metric("ratelimit.delayed");
+  static Metric &rejected_ip = metric("ratelimit.rejected.ip");
+
+  TokenBucket &user_bucket = limits.operations[chat::Operation_IsValid(operation) ? operation : 0];
+
+  int64_t wait_ms = user_bucket.take();
+  if (delay_ms != nullptr && wait_ms > 0 && wait_ms <= RATE_MAX_DELAY_MS)
+  {
+    delayed.add();
+    *delay_ms = wait_ms;
+    return false;
+  }
+  bool ip_limited = false;
+  if (wait_ms == 0 && limits.ip_bucket->take() > 0)
+  {
+    ip_limited = true;
+    rejected_ip.add();
+  }
+
+  if (wait_ms == 0 && !ip_limited)
+    return true;
 
-  if (!forced)
+  if (!ip_limited)
   {
-    SPM(client_sock, response);
+    metric("ratelimit.rejected." + chat::Operation_Name(operation)).add();
   }
+  rejection.set_operation(operation);
+  rejection.set_message("Rate limit exceeded, retry later.");
+  rejection.set_status_code(chat::StatusCode::TOO_MANY_REQUESTS);
+  return false;
+}
+
+/**
+ * Rate limiting of ACKNOWLEDGE: it has no reply, so it is neither delayed nor answered, and
+ * receiving messages does not eat the budget of the IP
+ */
+bool admit_acknowledge(ClientRateLimits &limits)
+{
+  static Metric &dropped = metric("ratelimit.dropped.ACKNOWLEDGE");
+  if (limits.operations[chat::Operation::ACKNOWLEDGE].take() == 0)
+    return true;
+  dropped.add();
+  return false;
 }
 
-void handle_client(int client_sock)
+/**
+ * BATCH main function. The SEND_MESSAGE requests of the batch are resolved under a single
+ * clients_mutex acquisition; every recipient then gets all its incoming messages in one frame
+ * and the sender one BatchResponse with a reply per request, in order.
+ */
+chat::Response handle_batch(const chat::Request &request, ClientRateLimits &limits, int client_sock)
 {
-  bool registered = false; // Flag to check if user is registered
-  std::string username;    // Store username after registration
-  bool running = true;
+  static Metric &batch_size = metric("batch.requests");
+  const auto &requests = request.batch().requests();
+  batch_size.observe(requests.size());
 
-  try
+  chat::Response replies;
+  replies.set_operation(chat::Operation::BATCH);
+  if (requests.size() > BATCH_MAX_REQUESTS)
+  {
+    replies.set_message("Batch too large.");
+    replies.set_status_code(chat::StatusCode::BAD_REQUEST);
+    return replies;
+  }
+  replies.set_status_code(chat::StatusCode::OK);
+
+  // Everything the batch needs from the shared maps, in one go
+  std::string sender;
+  UserId sender_user;
+  uint32_t sender_id;
+  using Recipient = std::pair<UserId, uint32_t>; // Wire id too, the slot may be someone else's by delivery time
+  std::vector<Recipient> recipients(requests.size(), {NO_USER, 0});
+  std::vector<Recipient> everyone; // Broadcast recipients
   {
-    while (running)
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    sender = local_users.name_by_socket(client_sock);
+    sender_user = local_users.by_socket(client_sock);
+    sender_id = session_wire_id(client_sock);
+    for (int i = 0; i < requests.size(); i++)
     {
-      chat::Request request;
-      if (RPM(client_sock, request) == false)
+      const auto &item = requests[i];
+      if (item.operation() != chat::Operation::SEND_MESSAGE)
+        continue;
+      if (!item.send_message().recipient().empty())
       {
-        std::cerr << "Failed to read message from client. Closing connection." << std::endl;
-
-        // Unregister user if registered
-        if (registered)
-        {
-          unregister_user(client_sock, true);
-        }
-        break;
+        UserId id = local_users.find(item.send_message().recipient());
+        if (id != NO_USER)
+          recipients[i] = {id, local_users[id].wire_id};
       }
-
-      // Update last active time for the user if registered
-      if (registered)
+      else if (everyone.empty())
       {
-        std::lock_guard<std::mutex> lock(clients_mutex);
-        last_active[username] = std::chrono::system_clock::now();
+        local_users.for_each([&](UserId id, const LocalUser &user)
+                             {
+                               if (user.sock != client_sock)
+                                 everyone.push_back({id, user.wire_id}); });
       }
+    }
+  }
 
-      // Handling different types of requests
-      switch (request.operation())
-      {
-      case chat::Operation::REGISTER_USER:
+  std::vector<chat::IncomingMessageResponse> messages;
+  messages.reserve(requests.size());
+  std::map<Recipient, std::vector<size_t>> deliveries; // Recipient to the messages it gets
+  for (int i = 0; i < requests.size(); i++)
+  {
+    const auto &item = requests[i];
+    chat::Response *reply = replies.mutable_batch()->add_responses();
+    reply->set_operation(item.operation());
 
-        if (!registered)
-        {
-          const bool got_registered = handle_registration(request, client_sock, chat::Operation::REGISTER_USER);
-          if (got_registered)
-          {
+    if (item.operation() != chat::Operation::SEND_MESSAGE)
+    {
+      reply->set_message("Only SEND_MESSAGE requests can be batched.");
+      reply->set_status_code(chat::StatusCode::BAD_REQUEST);
+      continue;
+    }
+    // Not delayed, a whole batch of waits would hold the worker
+    if (!admit_operation(limits, item.operation(), *reply))
+    {
+      continue;
+    }
+
+    chat::IncomingMessageResponse message;
+    message.set_sender(sender);
+    message.set_content(item.send_message().content());
+    const std::string &recipient = item.send_message().recipient();
+
+    if (recipient.empty())
+    {
+      message_history.append(BROADCAST_CONVERSATION, message);
+      federation.forward_to_all(message);
+      for (const Recipient &user : everyone)
+        deliveries[user].push_back(messages.size());
+      reply->set_message("Broadcast message sent successfully.");
+    }
+    else if (recipients[i].first != NO_USER)
+    {
+      message.set_type(chat::MessageType::DIRECT);
+      message_history.append(MessageHistory::direct_conversation(sender, recipient), message);
+      message.set_message_id(receipt_tracker.track(sender_user, sender_id, recipients[i].second));
+      reply->set_message_id(message.message_id());
+      deliveries[recipients[i]].push_back(messages.size());
+      reply->set_message("Message sent successfully.");
+    }
+    else
+    {
+      message.set_type(chat::MessageType::DIRECT);
+      RemoteUser remote_user;
+      if (!federation.find_user(recipient, remote_user) || !federation.forward_direct(recipient, message))
+      {
+        reply->set_message("Recipient not found.");
+        reply->set_status_code(chat::StatusCode::BAD_REQUEST);
+        continue;
+      }
+      message_history.append(MessageHistory::direct_conversation(sender, recipient), message);
+      reply->set_message("Message sent successfully.");
+    }
+    reply->set_status_code(chat::StatusCode::OK);
+    messages.push_back(std::move(message));
+  }
+
+  // Recipients getting the same messages (every broadcast recipient, usually) share one frame,
+  // one without the sender name for compact sessions that already know the sender
+  Outbox outbox;
+  {
+    std::map<std::pair<bool, std::vector<size_t>>, std::shared_ptr<std::string>> frames;
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    uint64_t seq = next_seq++;
+    for (const auto &delivery : deliveries)
+    {
+      LocalUser &user = local_users[delivery.first.first];
+      if (user.sock == -1 || user.wire_id != delivery.first.second)
+        continue; // Left since
+
+      bool compact = sender_known(user, sender_id);
+      std::shared_ptr<std::string> &frame = frames[{compact, delivery.second}];
+      if (!frame)
+      {
+        chat::Response incoming;
+        incoming.set_operation(chat::Operation::BATCH);
+        incoming.set_status_code(chat::StatusCode::OK);
+        incoming.set_seq(seq);
+        for (size_t index : delivery.second)
+        {
+          chat::Response *response = incoming.mutable_batch()->add_responses();
+          response->set_operation(chat::Operation::INCOMING_MESSAGE);
+          response->set_message("Message incoming.");
+          response->set_status_code(chat::StatusCode::OK);
+          response->set_seq(seq);
+          *response->mutable_incoming_message() = messages[index];
+          response->mutable_incoming_message()->set_sender_id(sender_id);
+          if (compact)
+            response->mutable_incoming_message()->clear_sender();
+        }
+
+        // A single message goes out unwrapped
+        frame = std::make_shared<std::string>();
+        BPF(incoming.batch().responses_size() == 1 ? incoming.batch().responses(0) : incoming, *frame);
+      }
+      deliver(user, seq, frame, outbox);
+    }
+  }
+  outbox.send();
+  return replies;
+}
+
+/**
+ * ACKNOWLEDGE main function. No reply, the senders hear of it in the next receipts round.
+ * received_seq lets the resume buffer of the session go.
+ */
+void handle_acknowledge(const chat::Request &request, int client_sock)
+{
+  uint32_t recipient_wire;
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    recipient_wire = session_wire_id(client_sock);
+  }
+  for (uint64_t id : request.acknowledge().delivered())
+    receipt_tracker.acknowledge(id, recipient_wire, false);
+  for (uint64_t id : request.acknowledge().read())
+    receipt_tracker.acknowledge(id, recipient_wire, true);
+
+  if (request.acknowledge().received_seq() != 0)
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    UserId id = local_users.by_socket(client_sock);
+    if (id != NO_USER)
+      local_users[id].resume.acknowledge(request.acknowledge().received_seq());
+  }
+}
+
+/**
+ * Admission control: counts a new connection, false if it must be shed
+ */
+bool admit_connection(const std::string &ip_str)
+{
+  static Metric &shed_global = metric("admission.shed.global");
+  static Metric &shed_ip = metric("admission.shed.ip");
+  static Metric &accepted = metric("admission.accepted");
+
+  std::lock_guard<std::mutex> lock(admission_mutex);
+  AdmissionCounts &ip_counts = admission_by_ip[ip_str];
+
+  if (admission_total.connections >= MAX_CONNECTIONS || admission_total.handshakes >= MAX_HANDSHAKES)
+  {
+    shed_global.add();
+  }
+  else if (ip_counts.connections >= MAX_CONNECTIONS_PER_IP || ip_counts.handshakes >= MAX_HANDSHAKES_PER_IP)
+  {
+    shed_ip.add();
+  }
+  else
+  {
+    admission_total.connections++;
+    admission_total.handshakes++;
+    ip_counts.connections++;
+    ip_counts.handshakes++;
+    accepted.add();
+    return true;
+  }
+
+  if (ip_counts.connections == 0)
+  {
+    admission_by_ip.erase(ip_str);
+  }
+  return false;
+}
+
+/**
+ * Admission control: the connection registered, it no longer counts as a handshake
+ */
+void finish_handshake(const std::string &ip_str)
+{
+  std::lock_guard<std::mutex> lock(admission_mutex);
+  admission_total.handshakes--;
+  admission_by_ip[ip_str].handshakes--;
+}
+
+/**
+ * Admission control: the connection closed
+ */
+void release_connection(const std::string &ip_str, bool in_handshake)
+{
+  std::lock_guard<std::mutex> lock(admission_mutex);
+  AdmissionCounts &ip_counts = admission_by_ip[ip_str];
+  admission_total.connections--;
+  ip_counts.connections--;
+  if (in_handshake)
+  {
+    admission_total.handshakes--;
+    ip_counts.handshakes--;
+  }
+  if (ip_counts.connections == 0)
+  {
+    admission_by_ip.erase(ip_str);
+  }
+}
+
+/**
+ * Admission control: rejects a connection with a frame serialized once at startup
+ */
+void shed_connection(int client_sock)
+{
+  static const std::string rejection_frame = []
+  {
+    chat::Response response;
+    response.set_operation(chat::Operation::REGISTER_USER);
+    response.set_message("Server busy, try again later.");
+    response.set_status_code(chat::StatusCode::SERVICE_UNAVAILABLE);
+    std::string frame;
+    BPF(response, frame);
+    return frame;
+  }();
+
+  // Best effort, the connection is dropped whether it fits in the socket buffer or not
+  send(client_sock, rejection_frame.data(), rejection_frame.size(), MSG_DONTWAIT | MSG_NOSIGNAL);
+  close(client_sock);
+}
+
+/**
+ * Resumable sessions: keeps the user of a dropped connection for RESUME_GRACE_MS, its name
+ * reserved and its notifications buffered. False when the session is not resumable.
+ */
+bool detach_user(int client_sock)
+{
+  static Metric &detached = metric("resume.detached");
+
+  if (draining)
+    return false; // Nothing would be left to resume
+  std::unique_lock<std::mutex> lock(clients_mutex);
+  UserId id = local_users.by_socket(client_sock);
+  if (id == NO_USER || local_users[id].resume_token == 0)
+    return false;
+
+  LocalUser &user = local_users[id];
+  user.rooms = room_directory.rooms_of(client_sock);
+  room_directory.leave_all(client_sock);
+  local_users.detach(id);
+  detached.add();
+  std::cout << "User " << user.name << " detached, its session is kept for a resume." << std::endl;
+  std::string username = user.name;
+  lock.unlock();
+
+  // Peers see it disconnected until it resumes, the name stays reserved here
+  federation.publish_presence(username, chat::UserStatus::OFFLINE, false);
+  return true;
+}
+
+/**
+ * RESUME main function: moves a resumable session to the connection asking for it and sends
+ * again the notifications after the last one the client got. Returns the id of the user or
+ * NO_USER.
+ */
+UserId handle_resume(const chat::Request &request, int client_sock, const std::string &ip_str)
+{
+  static Metric &resumed = metric("resume.resumed");
+  static Metric &replayed = metric("resume.replayed_frames");
+
+  const auto &resume = request.resume();
+  chat::Response response;
+  response.set_operation(chat::Operation::RESUME);
+
+  Outbox outbox; // The reply and the notifications sent again, once the lock is released
+  std::unique_lock<std::mutex> lock(clients_mutex);
+  UserId id = local_users.find(resume.username());
+  if (id == NO_USER || local_users[id].resume_token == 0 || local_users[id].resume_token != resume.token())
+  {
+    response.set_message("No session to resume.");
+    response.set_status_code(chat::StatusCode::BAD_REQUEST);
+    outbox.add_reply(client_sock, response);
+    return NO_USER;
+  }
+
+  // The client may see the drop before the server does, the old connection is then closed
+  LocalUser &user = local_users[id];
+  if (user.sock != DETACHED)
+  {
+    user.rooms = room_directory.rooms_of(user.sock);
+    room_directory.leave_all(user.sock);
+    shutdown(user.sock, SHUT_RDWR);
+    local_users.detach(id);
+  }
+  local_users.attach(id, client_sock);
+  for (const auto &room : user.rooms)
+    room_directory.join(room, client_sock);
+  user.rooms.clear();
+  user.ip = ip_str;
+  user.last_active = std::chrono::system_clock::now();
+
+  response.set_message("Session resumed.");
+  response.set_status_code(chat::StatusCode::OK);
+  response.set_resume_token(user.resume_token);
+  response.set_compact(user.compact);
+  bool compress = COMPRESSION_ENABLED && resume.compression() == chat::Compression::COMPRESSION_DEFLATE;
+  if (compress)
+    response.set_compression(chat::Compression::COMPRESSION_DEFLATE);
+  outbox.add_reply(client_sock, response);
+
+  user.resume.acknowledge(resume.last_seq());
+  user.resume.for_each_after(resume.last_seq(), [&](const std::shared_ptr<const std::string> &frame)
+                             { outbox.add(client_sock, frame); });
+  resumed.add();
+  replayed.add(user.resume.size());
+  std::cout << "User " << user.name << " resumed its session, " << user.resume.size() << " notifications sent again." << std::endl;
+  std::string username = user.name;
+  chat::UserStatus status = user.status;
+  lock.unlock();
+
+  outbox.send();
+  set_compression(client_sock, compress);
+  federation.publish_presence(username, status, true);
+  return id;
+}
+
+/**
+ * Ends a session, runs on its coroutine after every request received before the hang up
+ */
+void close_connection(const std::shared_ptr<Connection> &connection)
+{
+  // Unregister user if registered, a resumable session waits for its client instead
+  if (connection->registered && connection->open && !detach_user(connection->sock))
+  {
+    unregister_user(connection->sock);
+  }
+
+  release_ip_bucket(connection->limits.ip_bucket, connection->ip);
+  release_connection(connection->ip, !connection->registered && !connection->superseded);
+  forget_flush_policy(connection->sock);
+  set_compression(connection->sock, false);
+
+  if (close_socket(connection->sock) == -1)
+  {
+    std::cerr << "Failed to close socket: " << strerror(errno) << std::endl;
+  }
+  else
+  {
+    std::cout << "Socket closed successfully." << std::endl;
+  }
+  std::cout << "Session ended and socket closed for client." << std::endl;
+}
+
+/**
+ * Gives a user registering again after a restart the status and rooms it had in the snapshot,
+ * as long as it comes back from the same IP
+ */
+chat::UserStatus restore_user_state(const std::string &username, int client_sock)
+{
+  chat::SnapshotUser saved;
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    auto it = restored_users.find(username);
+    if (it == restored_users.end())
+      return chat::UserStatus::ONLINE;
+    saved = std::move(it->second);
+    restored_users.erase(it);
+
+    UserId id = local_users.find(username);
+    if (id == NO_USER || local_users[id].ip != saved.ip())
+      return chat::UserStatus::ONLINE;
+
+    // OFFLINE only meant idle, the user is back now
+    if (saved.status() == chat::UserStatus::BUSY)
+      local_users[id].status = chat::UserStatus::BUSY;
+  }
+
+  for (const auto &room : saved.rooms())
+  {
+    room_directory.join(room, client_sock);
+  }
+  std::cout << "Restored " << username << " from the snapshot, " << saved.rooms_size() << " rooms." << std::endl;
+  return saved.status() == chat::UserStatus::BUSY ? chat::UserStatus::BUSY : chat::UserStatus::ONLINE;
+}
+
+/**
+ * Writes the user directory, presence, last activity and rooms to disk. The state is captured
+ * by forking with the locks held, so requests only wait for the fork itself; the child
+ * serializes its copy-on-write view of the maps and writes the file.
+ */
+bool take_snapshot()
+{
+  static Metric &pause = metric("snapshot.pause_us");
+  static Metric &written = metric("snapshot.written");
+  static Metric &failed = metric("snapshot.failed");
+
+  auto started = std::chrono::steady_clock::now();
+  pid_t pid;
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    std::unique_lock<std::mutex> rooms_lock = room_directory.hold();
+    pid = fork();
+    if (pid == 0)
+    {
+      // Child: the forking thread is the only one left, the held locks are never released nor needed
+      chat::ServerSnapshot snapshot;
+      snapshot.set_taken_at(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+      local_users.for_each([&](UserId, const LocalUser &local)
+                           {
+                             chat::SnapshotUser *user = snapshot.add_users();
+                             user->set_username(local.name);
+                             user->set_ip(local.ip);
+                             user->set_status(local.status);
+                             user->set_last_active(std::chrono::duration_cast<std::chrono::milliseconds>(local.last_active.time_since_epoch()).count());
+                             for (const auto &room : local.sock == DETACHED ? local.rooms : room_directory.rooms_of_unlocked(local.sock))
+                               user->add_rooms(room); });
+
+      // Users restored from the previous snapshot that did not come back yet are kept
+      for (const auto &entry : restored_users)
+        *snapshot.add_users() = entry.second;
+
+      _exit(write_snapshot(snapshot_path, snapshot) ? 0 : 1);
+    }
+  }
+  pause.observe(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count());
+
+  if (pid == -1)
+  {
+    perror("Snapshot fork failed");
+    failed.add();
+    return false;
+  }
+
+  int status = 0;
+  while (waitpid(pid, &status, 0) == -1 && errno == EINTR)
+    ;
+  bool ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+  (ok ? written : failed).add();
+  return ok;
+}
+
+/**
+ * Periodic snapshots, also forgets restored users that did not come back in time
+ */
+void snapshot_loop()
+{
+  while (true)
+  {
+    std::this_thread::sleep_for(std::chrono::seconds(SNAPSHOT_INTERVAL_SECONDS));
+
+    {
+      std::lock_guard<std::mutex> lock(clients_mutex);
+      int64_t oldest = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count() - SNAPSHOT_MAX_AGE_SECONDS * 1000LL;
+      for (auto it = restored_users.begin(); it != restored_users.end();)
+      {
+        if (it->second.last_active() < oldest)
+          it = restored_users.erase(it);
+        else
+          ++it;
+      }
+    }
+
+    take_snapshot();
+  }
+}
+
+/**
+ * Warm start: remembers the users of the last snapshot so they get their status and rooms
+ * back when they register again
+ */
+void load_snapshot()
+{
+  auto started = std::chrono::steady_clock::now();
+  chat::ServerSnapshot snapshot;
+  if (!read_snapshot(snapshot_path, snapshot))
+  {
+    return;
+  }
+
+  int64_t oldest = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count() - SNAPSHOT_MAX_AGE_SECONDS * 1000LL;
+  std::lock_guard<std::mutex> lock(clients_mutex);
+  for (auto &user : *snapshot.mutable_users())
+  {
+    if (user.last_active() >= oldest)
+      restored_users[user.username()] = std::move(user);
+  }
+
+  auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
+  std::cout << "Snapshot loaded: " << restored_users.size() << " of " << snapshot.users_size() << " users in " << elapsed / 1000.0 << " ms." << std::endl;
+}
+
+/**
+ * Awaitable RPM: takes the next request the I/O thread queued for the connection.
+ * Completes with false once the client hung up and every earlier request was taken.
+ */
+struct RecvAwaiter
+{
+  std::shared_ptr<Connection> connection;
+  PendingRequest &request;
+
+  bool await_ready() { return false; }
+  bool await_suspend(std::coroutine_handle<> session)
+  {
+    // Once published the session may resume and finish elsewhere, keep the connection alive until the unlock
+    std::shared_ptr<Connection> keep = connection;
+    std::lock_guard<std::mutex> lock(keep->session_mutex);
+    if (!keep->pending.empty() || keep->closing)
+      return false;
+    keep->recv_waiter = session;
+    return true;
+  }
+  bool await_resume()
+  {
+    std::lock_guard<std::mutex> lock(connection->session_mutex);
+    if (connection->pending.empty())
+      return false;
+    request = std::move(connection->pending.front());
+    connection->pending.pop_front();
+    return true;
+  }
+};
+
+RecvAwaiter co_recv_message(const std::shared_ptr<Connection> &connection, PendingRequest &request)
+{
+  return {connection, request};
+}
+
+/**
+ * Parks a session until its I/O thread reports the socket writable, then pump runs on a
+ * worker. Returns false when the connection already hung up and nobody would report it.
+ */
+bool wait_writable(std::shared_ptr<Connection> connection, std::coroutine_handle<> session, std::function<PumpResult()> pump)
+{
+  std::lock_guard<std::mutex> lock(connection->session_mutex);
+  if (connection->closing)
+    return false;
+  connection->send_waiter = session;
+  connection->send_pump = std::move(pump);
+
+  epoll_event event = {};
+  event.events = EPOLLIN | EPOLLRDHUP | EPOLLOUT;
+  event.data.fd = connection->sock;
+  epoll_ctl(connection->epoll_fd, EPOLL_CTL_MOD, connection->sock, &event);
+  return true;
+}
+
+struct SendAwaiter
+{
+  std::shared_ptr<Connection> connection;
+  std::vector<std::string> frames; // In order, messages larger than BUFFER_SIZE as their chunks
+  size_t next = 0;                 // First frame not sent yet
+  int sent = -1;
+
+  // Sends what the socket takes now
+  PumpResult pump()
+  {
+    size_t first = next;
+    while (next < frames.size())
+    {
+      sent = TSF(connection->sock, frames[next]);
+      if (sent < 0)
+        return PumpResult::Done;
+      if (sent == 0)
+        return next > first ? PumpResult::Progress : PumpResult::Stalled;
+      next++;
+    }
+    return PumpResult::Done;
+  }
+
+  bool await_ready()
+  {
+    return frames.empty() || pump() == PumpResult::Done;
+  }
+  bool await_suspend(std::coroutine_handle<> session)
+  {
+    return wait_writable(connection, session, [this]
+                         { return pump(); });
+  }
+  bool await_resume()
+  {
+    // Woken by a hang up with frames left, the write side may still be open
+    if (sent == 0)
+    {
+      while (next < frames.size())
+        if (!SPF(connection->sock, frames[next++]))
+          return false;
+      return true;
+    }
+    return sent == 1;
+  }
+};
+
+/**
+ * Frames of a message, its chunks when it is larger than BUFFER_SIZE
+ */
+void add_frames(std::vector<std::string> &frames, const google::protobuf::Message &message)
+{
+  std::string frame;
+  std::vector<std::string> chunks;
+  if (!BPF(message, frame))
+    return;
+  if (!CPF(frame, chunks))
+  {
+    frames.push_back(std::move(frame));
+    return;
+  }
+  for (auto &chunk : chunks)
+    frames.push_back(std::move(chunk));
+}
+
+/**
+ * Awaitable SPM: sends without blocking the worker. When the socket buffer is full the
+ * session suspends until its I/O thread reports the socket writable.
+ */
+SendAwaiter co_send_message(const std::shared_ptr<Connection> &connection, const google::protobuf::Message &message)
+{
+  SendAwaiter awaiter{connection, {}};
+  add_frames(awaiter.frames, message);
+  return awaiter;
+}
+
+// Several replies in order, the pages of a history query for instance
+SendAwaiter co_send_message(const std::shared_ptr<Connection> &connection, const std::vector<chat::Response> &messages)
+{
+  SendAwaiter awaiter{connection, {}};
+  for (const auto &message : messages)
+    add_frames(awaiter.frames, message);
+  return awaiter;
+}
+
+// Hands the worker to other sessions, this one resumes once they had their turn
+struct YieldAwaiter
+{
+  bool await_ready() { return false; }
+  void await_suspend(std::coroutine_handle<> session)
+  {
+    worker_pool->submit([session]
+                        { session.resume(); },
+                        true);
+  }
+  void await_resume() {}
+};
+
+/**
+ * Schedules a suspended session on the worker pool
+ */
+void resume_session(std::coroutine_handle<> session)
+{
+  worker_pool->submit([session]
+                      { session.resume(); });
+}
+
+// Suspends a session for a while without holding its worker, it resumes on the pool
+struct SleepAwaiter
+{
+  std::chrono::milliseconds delay;
+
+  bool await_ready() { return delay.count() <= 0; }
+  void await_suspend(std::coroutine_handle<> session)
+  {
+    run_after(delay, [session]
+              { resume_session(session); });
+  }
+  void await_resume() {}
+};
+
+/**
+ * Reply to a request the session turns down before it reaches a handler
+ */
+chat::Response bad_request(chat::Operation operation, const std::string &message)
+{
+  chat::Response response;
+  response.set_operation(operation);
+  response.set_message(message);
+  response.set_status_code(chat::StatusCode::BAD_REQUEST);
+  return response;
+}
+
+/**
+ * Session of a connection. The sequential loop of the old per-client thread, but between
+ * requests it is a suspended coroutine frame instead of a parked thread with its own stack.
+ * It runs on one worker at a time, so the requests of a connection keep their order, and
+ * yields after STRAND_BATCH requests so a chatty connection can not hog a worker.
+ */
+DetachedTask run_session(std::shared_ptr<Connection> connection)
+{
+  int client_sock = connection->sock;
+  int processed = 0;
+  PendingRequest incoming;
+  const chat::Request &request = incoming.request;
+
+  while (co_await co_recv_message(connection, incoming))
+  {
+    if (!connection->open)
+      continue; // Unregistered, the rest of the requests are dropped
+
+    if (++processed % STRAND_BATCH == 0)
+      co_await YieldAwaiter();
+
+    try
+    {
+      // Update last active time for the user if registered
+      if (connection->registered)
+      {
+        std::lock_guard<std::mutex> lock(clients_mutex);
+        if (local_users.by_socket(client_sock) != connection->user_id)
+        {
+          // Taken over by a resume, the socket was shut down and its requests are dropped
+          connection->registered = false;
+          connection->superseded = true;
+          connection->open = false;
+          continue;
+        }
+        local_users[connection->user_id].last_active = std::chrono::system_clock::now();
+      }
+
+      // Only a SEND_MESSAGE the I/O thread peeked comes as wire bytes
+      bool peeked = !incoming.wire.empty();
+      chat::Operation operation = peeked ? chat::Operation::SEND_MESSAGE : request.operation();
+
+      // Replies to this client, sent once the handler returns without holding the worker
+      std::vector<chat::Response> replies;
+      bool hang_up = false;
+
+      int64_t delay_ms = 0;
+      chat::Response rejection;
+      if (operation == chat::Operation::ACKNOWLEDGE)
+      {
+        if (!admit_acknowledge(connection->limits))
+          continue;
+      }
+      else if (!admit_operation(connection->limits, operation, rejection, &delay_ms))
+      {
+        // The token is close, wait for it on the timer instead of the worker
+        if (delay_ms > 0)
+          co_await SleepAwaiter{std::chrono::milliseconds(delay_ms)};
+        if (delay_ms == 0 || !admit_operation(connection->limits, operation, rejection))
+        {
+          co_await co_send_message(connection, rejection);
+          continue;
+        }
+      }
+
+      // Handling different types of requests
+      switch (operation)
+      {
+      case chat::Operation::REGISTER_USER:
+
+        if (!connection->registered)
+        {
+          const UserId user_id = handle_registration(request, client_sock, chat::Operation::REGISTER_USER);
+          if (user_id != NO_USER)
+          {
             std::cout << "User registered successfully." << std::endl;
-            username = request.register_user().username();
-            registered = true;
+            const std::string &username = request.register_user().username();
+            connection->user_id = user_id;
+            connection->registered = true;
+            finish_handshake(connection->ip);
+            set_flush_policy(client_sock, request.register_user().flush_policy());
+
+            chat::UserStatus status = restore_user_state(username, client_sock);
+            federation.publish_presence(username, status, true);
+            federation.publish_location(username, true);
+          }
+        }
+        else
+        {
+          replies.push_back(bad_request(operation, "User already registered."));
+        }
+        break;
+      case chat::Operation::RESUME:
+        if (!connection->registered)
+        {
+          const UserId user_id = handle_resume(request, client_sock, connection->ip);
+          if (user_id != NO_USER)
+          {
+            connection->user_id = user_id;
+            connection->registered = true;
+            finish_handshake(connection->ip);
+            set_flush_policy(client_sock, request.resume().flush_policy());
+          }
+        }
+        else
+        {
+          replies.push_back(bad_request(operation, "User already registered."));
+        }
+        break;
+      case chat::Operation::SEND_MESSAGE:
+        if (!connection->registered)
+          replies.push_back(bad_request(operation, "User not registered."));
+        else if (peeked)
+          replies.push_back(handle_send_message(incoming.recipient(), incoming.content(), client_sock, chat::Operation::SEND_MESSAGE));
+        else
+          replies.push_back(handle_send_message(request.send_message().recipient(), request.send_message().content(), client_sock, chat::Operation::SEND_MESSAGE));
+        break;
+      case chat::Operation::UPDATE_STATUS:
+        if (connection->registered)
+          replies.push_back(update_status(request, client_sock, chat::Operation::UPDATE_STATUS));
+        else
+          replies.push_back(bad_request(operation, "User not registered."));
+        break;
+      case chat::Operation::GET_USERS:
+        if (connection->registered)
+          replies.push_back(handle_get_users(request, chat::Operation::GET_USERS));
+        else
+          replies.push_back(bad_request(operation, "User not registered."));
+        break;
+      case chat::Operation::GET_HISTORY:
+        if (connection->registered)
+          replies = handle_get_history(request, client_sock, chat::Operation::GET_HISTORY);
+        else
+          replies.push_back(bad_request(operation, "User not registered."));
+        break;
+      case chat::Operation::JOIN_ROOM:
+      case chat::Operation::LEAVE_ROOM:
+        if (connection->registered)
+          replies.push_back(handle_room_membership(request, client_sock, request.operation()));
+        else
+          replies.push_back(bad_request(operation, "User not registered."));
+        break;
+      case chat::Operation::SEND_ROOM_MESSAGE:
+        if (connection->registered)
+          replies.push_back(handle_room_message(request, client_sock, chat::Operation::SEND_ROOM_MESSAGE));
+        else
+          replies.push_back(bad_request(operation, "User not registered."));
+        break;
+      case chat::Operation::BATCH:
+        if (connection->registered)
+          replies.push_back(handle_batch(request, connection->limits, client_sock));
+        else
+          replies.push_back(bad_request(operation, "User not registered."));
+        break;
+      case chat::Operation::ACKNOWLEDGE:
+        if (connection->registered)
+        {
+          handle_acknowledge(request, client_sock);
+        }
+        break;
+      case chat::Operation::UNREGISTER_USER:
+        bool own_name;
+        {
+          std::lock_guard<std::mutex> lock(clients_mutex);
+          own_name = connection->registered && local_users.find(request.unregister_user().username()) == connection->user_id;
+        }
+        if (own_name)
+        {
+          replies.push_back(unregister_user(client_sock));
+          connection->open = false;
+          hang_up = true;
+        }
+        else
+        {
+          replies.push_back(bad_request(operation, "User not registered or username mismatch."));
+        }
+        break;
+      default:
+        replies.push_back(bad_request(operation, "Unknown request type."));
+        break;
+      }
+
+      if (!replies.empty())
+        co_await co_send_message(connection, replies);
+      if (hang_up)
+        shutdown(client_sock, SHUT_RDWR); // The I/O thread sees the hang up and ends the session
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << "Exception in client handler: " << e.what() << " - Cleaning up session." << std::endl;
+      shutdown(client_sock, SHUT_RDWR);
+    }
+  }
+
+  close_connection(connection);
+}
+
+/**
+ * Queues a request, or the hang up when request is null, and wakes the session if it waits for one
+ */
+void enqueue_request(const std::shared_ptr<Connection> &connection, PendingRequest *request)
+{
+  std::coroutine_handle<> session;
+  {
+    std::lock_guard<std::mutex> lock(connection->session_mutex);
+    if (request)
+    {
+      connection->pending.push_back(std::move(*request));
+    }
+    else
+    {
+      // A session suspended on a send would never be reported writable, wake it too
+      connection->closing = true;
+      std::swap(session, connection->send_waiter);
+      connection->send_pump = nullptr;
+    }
+    if (!session)
+      std::swap(session, connection->recv_waiter);
+  }
+  if (session)
+    resume_session(session);
+}
+
+/**
+ * Wakes a session suspended on a full socket buffer
+ */
+void socket_writable(const std::shared_ptr<Connection> &connection)
+{
+  std::coroutine_handle<> session;
+  std::function<PumpResult()> pump;
+  {
+    std::lock_guard<std::mutex> lock(connection->session_mutex);
+    std::swap(session, connection->send_waiter);
+    std::swap(pump, connection->send_pump);
+
+    epoll_event event = {};
+    event.events = EPOLLIN | EPOLLRDHUP;
+    event.data.fd = connection->sock;
+    epoll_ctl(connection->epoll_fd, EPOLL_CTL_MOD, connection->sock, &event);
+  }
+  if (!session)
+    return;
+
+  // A chunked message goes out as the socket drains, the session resumes after its last chunk
+  worker_pool->submit([connection, session, pump]
+                      {
+                        PumpResult result = pump();
+                        if (result == PumpResult::Stalled)
+                        {
+                          // Writable, yet the frame does not fit: EPOLLOUT would fire again at once
+                          run_after(std::chrono::milliseconds(SEND_STALL_RETRY_MS), [connection, session, pump]
+                                    {
+                                      if (!wait_writable(connection, session, pump))
+                                        resume_session(session); });
+                          return;
+                        }
+                        if (result == PumpResult::Done || !wait_writable(connection, session, pump))
+                          session.resume(); });
+}
+
+/**
+ * I/O thread: reads every ready connection, splits the bytes into frames and hands the
+ * requests to the sessions. Also drops connections that do not register in time.
+ */
+void io_loop(IoThread *io)
+{
+  static Metric &handshake_timeouts = metric("admission.handshake_timeouts");
+  static Metric &peeked = metric("dispatch.peeked");
+  static Metric &parsed_requests = metric("dispatch.parsed");
+  std::vector<epoll_event> events(IO_EVENTS_PER_WAIT);
+  std::vector<char> buffer(BUFFER_SIZE);
+
+  while (running)
+  {
+    int ready = epoll_wait(io->epoll_fd, events.data(), events.size(), 1000);
+    for (int i = 0; i < ready; i++)
+    {
+      std::shared_ptr<Connection> connection;
+      {
+        std::lock_guard<std::mutex> lock(io->connections_mutex);
+        auto it = io->connections.find(events[i].data.fd);
+        if (it == io->connections.end())
+          continue;
+        connection = it->second;
+      }
+
+      if (events[i].events & EPOLLOUT)
+      {
+        socket_writable(connection);
+      }
+
+      // Level triggered: read what is there now, the rest wakes us up again
+      bool hang_up = false;
+      ssize_t bytes_read = recv(connection->sock, buffer.data(), buffer.size(), 0);
+      if (bytes_read > 0)
+      {
+        connection->input.append(buffer.data(), bytes_read);
+      }
+      else if (bytes_read == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+      {
+        hang_up = true;
+      }
+
+      size_t offset = 0;
+      while (!hang_up)
+      {
+        PendingRequest request;
+        const char *data = connection->input.data() + offset;
+        size_t size = connection->input.size() - offset;
+        size_t consumed = 0;
+        int parsed;
+
+        // SEND_MESSAGE skips the full parse, the session routes it from the wire bytes
+        uint32_t length;
+        const char *payload = HEADER_PEEK_ENABLED ? PPF(data, size, length) : nullptr;
+        RequestPeek peek;
+        if (payload && peek_request(payload, length, peek) && peek.operation == chat::Operation::SEND_MESSAGE && peek.send_message)
+        {
+          request.keep_peek(payload, length, peek);
+          consumed = FRAME_HEADER_SIZE + length;
+          parsed = 1;
+          peeked.add();
+        }
+        else
+        {
+          // Only registered users may send chunked messages, a stranger can not make us buffer them
+          parsed = TPF(data, size, request.request, consumed, connection->registered ? &connection->reassembly : nullptr);
+          if (parsed == 1)
+            parsed_requests.add();
+        }
+        if (parsed == 0)
+          break;
+        if (parsed < 0)
+        {
+          hang_up = true; // A bad frame desynchronizes the stream, drop the client
+          break;
+        }
+        offset += consumed;
+        if (parsed == 1)
+          enqueue_request(connection, &request);
+      }
+      connection->input.erase(0, offset);
+
+      if (hang_up)
+      {
+        std::cerr << "Failed to read message from client. Closing connection." << std::endl;
+        epoll_ctl(io->epoll_fd, EPOLL_CTL_DEL, connection->sock, nullptr);
+        {
+          std::lock_guard<std::mutex> lock(io->connections_mutex);
+          io->connections.erase(connection->sock);
+        }
+        enqueue_request(connection, nullptr);
+      }
+    }
+
+    // Connections that did not register in time are hung up, the next wake up closes them
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(io->connections_mutex);
+    for (const auto &entry : io->connections)
+    {
+      const Connection &connection = *entry.second;
+      if (!connection.registered && !connection.timed_out && now - connection.accepted_at > std::chrono::seconds(HANDSHAKE_TIMEOUT_SECONDS))
+      {
+        entry.second->timed_out = true;
+        handshake_timeouts.add();
+        shutdown(connection.sock, SHUT_RDWR);
+      }
+    }
+  }
+  io->stopped = true;
+}
+
+/**
+ * Sends the receipts acknowledged in the last RECEIPT_FLUSH_MS to their senders, one
+ * notification per sender however many of its messages were acknowledged
+ */
+void deliver_receipts()
+{
+  std::vector<SenderReceipts> round;
+  while (true)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(RECEIPT_FLUSH_MS));
+
+    round.clear();
+    receipt_tracker.take_pending(round);
+    if (round.empty())
+      continue;
+
+    Outbox outbox;
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    for (const auto &receipts : round)
+    {
+      LocalUser &user = local_users[receipts.sender];
+      if (user.sock == -1 || user.wire_id != receipts.sender_wire)
+        continue; // The sender left, its receipts go with it
+
+      chat::Response response;
+      response.set_operation(chat::Operation::RECEIPTS);
+      response.set_status_code(chat::StatusCode::OK);
+      response.set_seq(next_seq++);
+      response.mutable_receipts()->mutable_delivered()->Add(receipts.delivered.begin(), receipts.delivered.end());
+      response.mutable_receipts()->mutable_read()->Add(receipts.read.begin(), receipts.read.end());
+      auto frame = std::make_shared<std::string>();
+      BPF(response, *frame);
+      deliver(user, response.seq(), frame, outbox);
+    }
+  }
+}
+
+void monitor_user_activity() // TODO: consider handling like discord, if the user set it, then is immutable, but if the previous state was online, the the auto set may work.
+{
+  while (true)
+  {
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    std::vector<std::string> went_offline;
+    std::unique_lock<std::mutex> lock(clients_mutex);
+    auto now = std::chrono::system_clock::now();
+
+    local_users.for_each([&](UserId, LocalUser &user)
+                         {
+                           if (std::chrono::duration_cast<std::chrono::seconds>(now - user.last_active).count() > AUTO_OFFLINE_SECONDS &&
+                               user.status != chat::UserStatus::OFFLINE)
+                           {
+                             user.status = chat::UserStatus::OFFLINE;
+                             went_offline.push_back(user.name);
+                             std::cout << "User " << user.name << " has been set to OFFLINE due to inactivity." << std::endl;
+                           } });
+
+    // Detached sessions whose client did not come back in time are unregistered for good
+    std::vector<std::string> expired;
+    auto steady_now = std::chrono::steady_clock::now();
+    for (size_t i = local_users.detached().size(); i-- > 0;)
+    {
+      UserId id = local_users.detached()[i];
+      if (steady_now - local_users[id].detached_at > std::chrono::milliseconds(RESUME_GRACE_MS))
+      {
+        expired.push_back(local_users.name(id));
+        local_users.remove(id);
+        std::cout << "Session of " << expired.back() << " expired without a resume." << std::endl;
+      }
+    }
+    lock.unlock();
+
+    for (const auto &username : went_offline)
+    {
+      federation.publish_presence(username, chat::UserStatus::OFFLINE, true);
+    }
+    for (const auto &username : expired)
+    {
+      federation.publish_presence(username, chat::UserStatus::OFFLINE, false);
+      federation.publish_location(username, false);
+    }
+  }
+}
+
+/**
+ * Federation: presence of every local user, sent to a peer when the link comes up
+ */
+std::vector<chat::PeerPresence> local_presence()
+{
+  std::lock_guard<std::mutex> lock(clients_mutex);
+  std::vector<chat::PeerPresence> presence;
+  local_users.for_each([&](UserId, const LocalUser &user)
+                       {
+                         chat::PeerPresence entry;
+                         entry.set_username(user.name);
+                         entry.set_status(user.status);
+                         entry.set_connected(user.sock != DETACHED); // Waiting for a resume, not reachable from other nodes
+                         presence.push_back(entry); });
+  return presence;
+}
+
+/**
+ * Federation: delivers a message forwarded by another node to the local recipients
+ */
+void deliver_forwarded_message(const chat::PeerMessage &peer_message)
+{
+  chat::IncomingMessageResponse message_response = peer_message.message();
+
+  chat::Response response_to_recipient;
+  response_to_recipient.set_operation(chat::Operation::INCOMING_MESSAGE);
+  response_to_recipient.set_status_code(chat::StatusCode::OK);
+  Outbox outbox; // Sends once the lock of the branch is released
+
+  if (message_response.type() == chat::MessageType::DIRECT)
+  {
+    message_history.append(MessageHistory::direct_conversation(message_response.sender(), peer_message.recipient()), message_response);
+    response_to_recipient.set_message("Message incoming.");
+    *response_to_recipient.mutable_incoming_message() = message_response;
+
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    UserId recipient_id = local_users.find(peer_message.recipient());
+    if (recipient_id != NO_USER)
+    {
+      response_to_recipient.set_seq(next_seq++);
+      IncomingFrames frames{response_to_recipient};
+      deliver(local_users[recipient_id], response_to_recipient.seq(), frames.for_user(local_users[recipient_id]), outbox);
+    }
+  }
+  else if (message_response.type() == chat::MessageType::ROOM)
+  {
+    message_history.append("#" + message_response.room(), message_response);
+    response_to_recipient.set_message("Room message incoming.");
+    *response_to_recipient.mutable_incoming_message() = message_response;
+    std::vector<int> members = room_directory.members(message_response.room());
+
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    response_to_recipient.set_seq(next_seq++);
+    IncomingFrames frames{response_to_recipient};
+    deliver_to_room(message_response.room(), members, -1, frames, outbox);
+  }
+  else
+  {
+    message_history.append(BROADCAST_CONVERSATION, message_response);
+    response_to_recipient.set_message("Broadcast message incoming.");
+    *response_to_recipient.mutable_incoming_message() = message_response;
+
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    response_to_recipient.set_seq(next_seq++);
+    IncomingFrames frames{response_to_recipient};
+    local_users.for_each([&](UserId, LocalUser &user)
+                         { deliver(user, response_to_recipient.seq(), frames.for_user(user), outbox); });
+  }
+}
+
+/**
+ * Hands a new connection to the next I/O thread and starts its session
+ */
+void start_session(const std::shared_ptr<Connection> &connection)
+{
+  IoThread *io = io_threads[next_io++ % io_threads.size()];
+  connection->epoll_fd = io->epoll_fd;
+  {
+    std::lock_guard<std::mutex> lock(io->connections_mutex);
+    io->connections[connection->sock] = connection;
+  }
+  resume_session(run_session(connection).handle);
+  epoll_event event = {};
+  event.events = EPOLLIN | EPOLLRDHUP;
+  event.data.fd = connection->sock;
+  epoll_ctl(io->epoll_fd, EPOLL_CTL_ADD, connection->sock, &event);
+}
 
-            // Initialize last active time for the new user
-            std::lock_guard<std::mutex> lock(clients_mutex);
-            last_active[username] = std::chrono::system_clock::now();
-          }
-        }
-        else
-        {
+void run_io_threads()
+{
+  running = true;
+  for (IoThread *io : io_threads)
+  {
+    io->stopped = false;
+    std::thread(io_loop, io).detach();
+  }
+}
 
-          chat::Response response;
-          response.set_message("User already registered.");
-          response.set_status_code(chat::StatusCode::BAD_REQUEST);
-          SPM(client_sock, response);
-        }
-        break;
-      case chat::Operation::SEND_MESSAGE:
-        if (registered)
-        {
-          handle_send_message(request, client_sock, chat::Operation::SEND_MESSAGE);
-        }
-        else
-        {
-          chat::Response response;
-          response.set_message("User not registered.");
-          response.set_status_code(chat::StatusCode::BAD_REQUEST);
-          SPM(client_sock, response);
-        }
-        break;
-      case chat::Operation::UPDATE_STATUS:
-        if (registered)
-        {
-          update_status(request, client_sock, chat::Operation::UPDATE_STATUS);
-        }
-        else
-        {
-          chat::Response response;
-          response.set_message("User not registered.");
-          response.set_status_code(chat::StatusCode::BAD_REQUEST);
-          SPM(client_sock, response);
-        }
-        break;
-      case chat::Operation::GET_USERS:
-        if (registered)
-        {
-          handle_get_users(request, client_sock, chat::Operation::GET_USERS);
-        }
-        else
-        {
-          chat::Response response;
-          response.set_message("User not registered.");
-          response.set_status_code(chat::StatusCode::BAD_REQUEST);
-          SPM(client_sock, response);
-        }
-        break;
-      case chat::Operation::UNREGISTER_USER:
-        if (registered && username == request.unregister_user().username())
-        {
-          unregister_user(client_sock);
-          running = false;
-        }
-        else
-        {
-          chat::Response response;
-          response.set_message("User not registered or username mismatch.");
-          response.set_status_code(chat::StatusCode::BAD_REQUEST);
-          SPM(client_sock, response);
-        }
-        break;
-      default:
-        chat::Response response;
-        response.set_message("Unknown request type.");
-        response.set_status_code(chat::StatusCode::BAD_REQUEST);
-        SPM(client_sock, response);
-        break;
-      }
+/**
+ * Waits for a replacement process, the accept loop notices it and hands the server over
+ */
+void handoff_listener(int listen_sock)
+{
+  while (true)
+  {
+    int sock = accept4(listen_sock, nullptr, nullptr, SOCK_CLOEXEC);
+    if (sock < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      perror("Handoff accept failed");
+      return;
+    }
+    int expected = -1;
+    if (!handoff_sock.compare_exchange_strong(expected, sock))
+    {
+      close(sock); // A handoff is already running
+    }
+  }
+}
+
+/**
+ * Hot restart: a notification a resumable session keeps, as the handoff carries it
+ */
+void add_buffered_frame(chat::BufferedFrame *buffered, const ResumeFrame &entry)
+{
+  buffered->set_seq(entry.seq);
+  buffered->set_frame(*entry.frame);
+}
+
+/**
+ * Hot restart, new side: the notifications kept for a session in the previous process
+ */
+void restore_resume_buffer(ResumeBuffer &resume, const google::protobuf::RepeatedPtrField<chat::BufferedFrame> &frames)
+{
+  for (const auto &buffered : frames)
+    resume.push(buffered.seq(), std::make_shared<const std::string>(buffered.frame()), false);
+}
+
+/**
+ * Hot restart, old side: stops reading the sockets, lets the sessions finish the requests
+ * they already have, then sends the listening socket, every connection and its session state
+ * to the replacement. From the snapshot on clients_mutex stays held, so no thread of this
+ * process writes to a connection the replacement owns, and the process leaves with _exit once
+ * the replacement acknowledges. Returns false, and keeps serving, when the handoff fails.
+ */
+bool hand_off_server(int sock)
+{
+  std::cout << "Handing the server over..." << std::endl;
+
+  running = false;
+  for (IoThread *io : io_threads)
+  {
+    while (!io->stopped)
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  std::vector<std::shared_ptr<Connection>> connections;
+  for (IoThread *io : io_threads)
+  {
+    std::lock_guard<std::mutex> lock(io->connections_mutex);
+    for (const auto &entry : io->connections)
+    {
+      if (entry.second->open)
+        connections.push_back(entry.second);
     }
   }
-  catch (const std::exception &e)
+
+  // A session waiting for its next request is idle, the others finish what they are doing
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(HANDOFF_QUIESCE_SECONDS);
+  size_t busy = 0;
+  while (true)
   {
-    std::cerr << "Exception in client thread: " << e.what() << " - Cleaning up session." << std::endl;
-    if (registered)
+    busy = 0;
+    for (const auto &connection : connections)
     {
-      unregister_user(client_sock, true);
+      std::lock_guard<std::mutex> lock(connection->session_mutex);
+      if (!connection->pending.empty() || !connection->recv_waiter)
+        busy++;
     }
+    if (busy == 0 || std::chrono::steady_clock::now() >= deadline)
+      break;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
   }
 
-  if (close(client_sock) == -1)
+  // Fan-outs picked before the lock below may still be sending, they finish first
+  std::unique_lock<std::mutex> lock(clients_mutex);
+  while (busy == 0 && outbox_frames_pending() > 0 && std::chrono::steady_clock::now() < deadline)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  if (busy > 0 || outbox_frames_pending() > 0)
   {
-    std::cerr << "Failed to close socket: " << strerror(errno) << std::endl;
+    // A session writing to its connection would race the replacement
+    std::cerr << "Handoff refused, " << busy << " sessions busy and " << outbox_frames_pending() << " notifications unsent." << std::endl;
+    lock.unlock();
+    close(sock);
+    handoff_sock = -1;
+    run_io_threads();
+    return false;
   }
-  else
+
+  std::vector<std::pair<chat::HandoffState, std::vector<int>>> chunks(1);
+  chunks[0].first.set_has_listener(true);
+  chunks[0].second.push_back(server_fd);
+  for (const auto &connection : connections)
   {
-    std::cout << "Socket closed successfully." << std::endl;
+    if (chunks.back().first.sessions_size() == HANDOFF_CHUNK_SESSIONS)
+      chunks.emplace_back();
+
+    chat::HandoffSession *session = chunks.back().first.add_sessions();
+    session->set_ip(connection->ip);
+    session->set_input(connection->input);
+    session->set_flush_policy(flush_policy(connection->sock));
+    if (compression_enabled(connection->sock))
+      session->set_compression(chat::Compression::COMPRESSION_DEFLATE);
+    for (const auto &transfer : connection->reassembly.transfers)
+    {
+      chat::PartialTransfer *partial = session->add_transfers();
+      partial->set_id(transfer.first);
+      partial->set_total(transfer.second.total);
+      partial->set_data(transfer.second.data);
+    }
+    if (connection->registered)
+    {
+      const LocalUser &user = local_users[connection->user_id];
+      session->set_username(user.name);
+      session->set_status(user.status);
+      session->set_last_active(std::chrono::duration_cast<std::chrono::milliseconds>(user.last_active.time_since_epoch()).count());
+      session->set_registered_at(std::chrono::duration_cast<std::chrono::milliseconds>(user.registered_at.time_since_epoch()).count());
+      session->set_compact(user.compact); // Ids restart in the new process, it announces every sender again
+      session->set_resume_token(user.resume_token);
+      for (const auto &room : room_directory.rooms_of(connection->sock))
+        session->add_rooms(room);
+      user.resume.for_each([&](const ResumeFrame &entry)
+                           { add_buffered_frame(session->add_resume(), entry); });
+    }
+    chunks.back().second.push_back(connection->sock);
   }
-  std::cout << "Session ended and socket closed for client." << std::endl;
+
+  // Sessions waiting for their client have no descriptor, they go with the last chunk
+  auto steady_now = std::chrono::steady_clock::now();
+  for (UserId id : local_users.detached())
+  {
+    const LocalUser &user = local_users[id];
+    chat::DetachedSession *session = chunks.back().first.add_detached();
+    session->set_ip(user.ip);
+    session->set_username(user.name);
+    session->set_status(user.status);
+    session->set_last_active(std::chrono::duration_cast<std::chrono::milliseconds>(user.last_active.time_since_epoch()).count());
+    session->set_registered_at(std::chrono::duration_cast<std::chrono::milliseconds>(user.registered_at.time_since_epoch()).count());
+    for (const auto &room : user.rooms)
+      session->add_rooms(room);
+    session->set_compact(user.compact);
+    session->set_resume_token(user.resume_token);
+    session->set_detached_ms(std::chrono::duration_cast<std::chrono::milliseconds>(steady_now - user.detached_at).count());
+    user.resume.for_each([&](const ResumeFrame &entry)
+                         { add_buffered_frame(session->add_resume(), entry); });
+  }
+  chunks.back().first.set_next_seq(next_seq);
+  chunks.back().first.set_last(true);
+
+  bool handed_over = true;
+  for (const auto &chunk : chunks)
+  {
+    if (!send_handoff(sock, chunk.first, chunk.second))
+    {
+      handed_over = false;
+      break;
+    }
+  }
+
+  // The replacement acknowledges once it holds every descriptor
+  char ack = 0;
+  if (handed_over && recv(sock, &ack, 1, MSG_WAITALL) != 1)
+    handed_over = false;
+
+  if (!handed_over)
+  {
+    std::cerr << "Handoff failed, serving on." << std::endl;
+    lock.unlock();
+    close(sock);
+    handoff_sock = -1;
+    run_io_threads();
+    return false;
+  }
+
+  // Peers reconnect to the replacement; threads waiting on clients_mutex never get it
+  federation.stop();
+  message_history.flush();
+  std::cout << "Server handed over " << connections.size() << " sessions and " << chunks.back().first.detached_size() << " detached ones." << std::endl;
+
+  // No destructors: the parked threads would run under them. Only this process' copies of the
+  // descriptors close, the connections stay open
+  _exit(0);
 }
 
-void monitor_user_activity() // TODO: consider handling like discord, if the user set it, then is immutable, but if the previous state was online, the the auto set may work.
+/**
+ * Hot restart, new side: receives the listening socket and the sessions of the running
+ * server. Returns once the old process is gone, so its history file and cluster port are free.
+ */
+bool take_over_server(const std::string &server_name, std::vector<chat::HandoffSession> &sessions, std::vector<int> &session_fds,
+                      std::vector<chat::DetachedSession> &detached)
 {
-  while (true)
+  int sock = connect_handoff(handoff_path(server_name));
+  if (sock == -1)
+    return false;
+
+  chat::HandoffState state;
+  std::vector<int> fds;
+  do
   {
-    std::this_thread::sleep_for(std::chrono::seconds(1));
+    if (!receive_handoff(sock, state, fds))
+    {
+      close(sock);
+      return false;
+    }
+    size_t first = 0;
+    if (state.has_listener() && !fds.empty())
+    {
+      server_fd = fds[0];
+      first = 1;
+    }
+    if (fds.size() - first != static_cast<size_t>(state.sessions_size()))
+    {
+      std::cerr << "Handoff chunk with " << state.sessions_size() << " sessions but " << fds.size() - first << " descriptors." << std::endl;
+      close(sock);
+      return false;
+    }
+    for (int i = 0; i < state.sessions_size(); i++)
+    {
+      sessions.push_back(state.sessions(i));
+      session_fds.push_back(fds[first + i]);
+    }
+  } while (!state.last());
+  detached.assign(state.detached().begin(), state.detached().end());
+  if (state.next_seq() > 0)
+    next_seq = state.next_seq(); // No session runs yet
 
-    std::lock_guard<std::mutex> lock(clients_mutex);
-    auto now = std::chrono::system_clock::now();
+  char ack = 1;
+  if (send(sock, &ack, 1, MSG_NOSIGNAL) != 1)
+  {
+    close(sock);
+    return false;
+  }
+
+  // The old process exits right after the ack, its end of the socket closing tells us
+  char ignored;
+  ssize_t received;
+  do
+  {
+    received = recv(sock, &ignored, 1, 0);
+  } while (received > 0 || (received < 0 && errno == EINTR));
+  close(sock);
+  std::cout << "Took over " << sessions.size() << " sessions and " << detached.size() << " detached ones." << std::endl;
+  return server_fd != -1;
+}
 
-    for (auto &entry : last_active)
+/**
+ * Rebuilds a connection received from the previous process
+ */
+void restore_session(const chat::HandoffSession &session, int sock)
+{
+  auto connection = std::allocate_shared<Connection>(PoolAllocator<Connection>());
+  connection->sock = sock;
+  connection->ip = session.ip();
+  connection->input = session.input();
+  for (const auto &partial : session.transfers())
+  {
+    ChunkedTransfer &transfer = connection->reassembly.transfers[partial.id()];
+    transfer.total = partial.total();
+    transfer.data = partial.data();
+    connection->reassembly.buffered += transfer.data.size();
+  }
+  connection->limits.ip_bucket = acquire_ip_bucket(session.ip());
+  set_flush_policy(sock, session.flush_policy());
+  set_compression(sock, session.compression() == chat::Compression::COMPRESSION_DEFLATE);
+
+  bool in_handshake = session.username().empty();
+  {
+    std::lock_guard<std::mutex> lock(admission_mutex);
+    AdmissionCounts &ip_counts = admission_by_ip[session.ip()];
+    admission_total.connections++;
+    ip_counts.connections++;
+    if (in_handshake)
     {
-      const std::string &username = entry.first;
-      auto last_activity = entry.second;
+      admission_total.handshakes++;
+      ip_counts.handshakes++;
+    }
+  }
 
-      if (std::chrono::duration_cast<std::chrono::seconds>(now - last_activity).count() > AUTO_OFFLINE_SECONDS)
-      {
-        if (user_status[username] != chat::UserStatus::OFFLINE)
-        {
-          user_status[username] = chat::UserStatus::OFFLINE;
-          std::cout << "User " << username << " has been set to OFFLINE due to inactivity." << std::endl;
-        }
-      }
+  if (!in_handshake)
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    connection->user_id = local_users.add(session.username(), session.ip(), sock);
+    if (connection->user_id != NO_USER)
+    {
+      connection->registered = true;
+      LocalUser &user = local_users[connection->user_id];
+      user.status = session.status();
+      user.last_active = std::chrono::system_clock::time_point(std::chrono::milliseconds(session.last_active()));
+      user.registered_at = std::chrono::system_clock::time_point(std::chrono::milliseconds(session.registered_at()));
+      user.compact = session.compact();
+      user.resume_token = session.resume_token();
+      restore_resume_buffer(user.resume, session.resume());
+      for (const auto &room : session.rooms())
+        room_directory.join(room, sock);
     }
+    else
+    {
+      std::cerr << "Handed over user " << session.username() << " is already registered." << std::endl;
+    }
+  }
+
+  start_session(connection);
+}
+
+/**
+ * Rebuilds a session the previous process kept for a resume, its grace period goes on
+ */
+void restore_detached(const chat::DetachedSession &session)
+{
+  std::lock_guard<std::mutex> lock(clients_mutex);
+  UserId id = local_users.add(session.username(), session.ip(), DETACHED);
+  if (id == NO_USER)
+  {
+    std::cerr << "Handed over user " << session.username() << " is already registered." << std::endl;
+    return;
   }
+  LocalUser &user = local_users[id];
+  user.status = session.status();
+  user.last_active = std::chrono::system_clock::time_point(std::chrono::milliseconds(session.last_active()));
+  user.registered_at = std::chrono::system_clock::time_point(std::chrono::milliseconds(session.registered_at()));
+  user.rooms.assign(session.rooms().begin(), session.rooms().end());
+  user.compact = session.compact();
+  user.resume_token = session.resume_token();
+  user.detached_at -= std::chrono::milliseconds(session.detached_ms());
+  restore_resume_buffer(user.resume, session.resume());
 }
 
 void terminationHandler()
 {
   std::string input;
-  while (true)
+  while (std::getline(std::cin, input))
   {
-    std::getline(std::cin, input);
     if (input == "exit")
     {
-      running = false;
-      break;
+      draining = true;
+      return;
+    }
+    else if (input == "stats")
+    {
+      report_metrics(std::cout);
+      report_pools(std::cout);
     }
   }
-
-  // Close the server socket
-  close(server_fd);
-  std::cout << "Server terminated." << std::endl;
-  exit(0); // Terminate the program
+  // Without a console (stdin closed) the server keeps running until a signal
 }
 
+/**
+ * SIGINT/SIGTERM: only flags the drain, the main thread does the work.
+ * A second signal exits right away.
+ */
 void signalHandler(int signum)
 {
-  std::cout << "\nInterrupt signal (" << signum << ") received.\n";
+  if (draining)
+    _exit(128 + signum);
+  draining = true;
+
+  // std::cout is not async-signal-safe
+  const char notice[] = "\nSignal received, draining. Send it again to exit now.\n";
+  ssize_t ignored = write(STDOUT_FILENO, notice, sizeof(notice) - 1);
+  (void)ignored;
+}
 
-  // Close the server socket
+/**
+ * Drain mode: stops accepting, tells every client to come back later (each one at a different
+ * time so a restart is not hit by all of them at once) and stops reading. The sessions finish
+ * the requests they already received and close cleanly; after DRAIN_TIMEOUT_SECONDS the rest
+ * are dropped. The history is flushed last.
+ */
+void drain_server()
+{
   close(server_fd);
-  running = false;
+  std::cout << "Draining connections..." << std::endl;
 
-  std::cout << "Server terminated due to signal." << std::endl;
-  exit(signum);
-}
+  // Before the sessions close and take their state with them
+  take_snapshot();
 
-int main(int argc, char *argv[])
-{
-  if (argc != 3)
+  std::vector<std::shared_ptr<Connection>> connections;
+  for (IoThread *io : io_threads)
   {
-    std::cerr << "Usage: " << argv[0] << " <port> <server_name>\n";
-    return 1;
+    std::lock_guard<std::mutex> lock(io->connections_mutex);
+    for (const auto &entry : io->connections)
+      connections.push_back(entry.second);
   }
-  int port = std::stoi(argv[1]);
-  std::string server_name = argv[2];
 
-  server_fd = socket(AF_INET, SOCK_STREAM, 0);
-  if (server_fd == 0)
+  std::mt19937 random(std::random_device{}());
+  std::uniform_int_distribution<uint32_t> reconnect_delay(0, DRAIN_RECONNECT_SPREAD_MS);
+  for (const auto &connection : connections)
+  {
+    uint32_t delay = reconnect_delay(random);
+    chat::Response notice;
+    notice.set_operation(chat::Operation::SERVER_SHUTDOWN);
+    notice.set_status_code(chat::StatusCode::SERVICE_UNAVAILABLE);
+    notice.set_message("Server shutting down, reconnect in " + std::to_string(delay) + " ms.");
+    notice.mutable_shutdown()->set_reconnect_after_ms(delay);
+
+    // Never block on a slow client here, it would eat the deadline of the others
+    std::string frame;
+    if (BPF(notice, frame))
+      TSF(connection->sock, frame);
+
+    // The I/O thread reads the end of stream, the session closes after its queued requests
+    shutdown(connection->sock, SHUT_RD);
+  }
+
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(DRAIN_TIMEOUT_SECONDS);
+  int remaining = 0;
+  while (true)
+  {
+    {
+      std::lock_guard<std::mutex> lock(admission_mutex);
+      remaining = admission_total.connections;
+    }
+    if (remaining == 0 || std::chrono::steady_clock::now() >= deadline)
+      break;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }
+  if (remaining > 0)
+    std::cout << "Drain deadline reached, dropping " << remaining << " connections." << std::endl;
+
+  running = false;
+  message_history.flush();
+  std::cout << "Server terminated." << std::endl;
+}
+
+/**
+ * Binds the client port
+ */
+int open_listener(int port)
+{
+  int listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (listen_fd == -1)
   {
     perror("Socket creation failed");
-    return 1;
+    return -1;
   }
 
   int opt = 1;
-  if (setsockopt(server_fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt)))
+  if (setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt)))
   {
     perror("setsockopt failed");
-    return 1;
+    return -1;
   }
 
   sockaddr_in address;
@@ -547,46 +2626,183 @@ int main(int argc, char *argv[])
   address.sin_addr.s_addr = INADDR_ANY;
   address.sin_port = htons(port);
 
-  if (bind(server_fd, (struct sockaddr *)&address, sizeof(address)) < 0)
+  if (bind(listen_fd, (struct sockaddr *)&address, sizeof(address)) < 0)
   {
     perror("Bind failed");
-    return 1;
+    return -1;
   }
 
-  if (listen(server_fd, 10) < 0)
+  if (listen(listen_fd, LISTEN_BACKLOG) < 0)
   {
     perror("Listen failed");
+    return -1;
+  }
+
+  return listen_fd;
+}
+
+int main(int argc, char *argv[])
+{
+  // --takeover: hot restart, take the sockets and sessions of the running server with this name
+  bool takeover = argc > 1 && std::string(argv[1]) == "--takeover";
+  if (takeover)
+  {
+    argc--;
+    argv++;
+  }
+
+  if (argc < 3)
+  {
+    std::cerr << "Usage: " << argv[0] << " [--takeover] <port> <server_name> [<cluster_port> [<peer_ip>:<peer_cluster_port> ...]]\n";
+    return 1;
+  }
+  int port = std::stoi(argv[1]);
+  std::string server_name = argv[2];
+
+  std::vector<chat::HandoffSession> handoff_sessions;
+  std::vector<int> handoff_fds;
+  std::vector<chat::DetachedSession> handoff_detached;
+  if (takeover)
+  {
+    if (!take_over_server(server_name, handoff_sessions, handoff_fds, handoff_detached))
+    {
+      std::cerr << "Takeover failed." << std::endl;
+      return 1;
+    }
+  }
+  else if ((server_fd = open_listener(port)) == -1)
+  {
     return 1;
   }
 
+  // Each server keeps its own log, several nodes may share a working directory
+  if (!message_history.open(server_name + "_" + HISTORY_FILE))
+  {
+    std::cerr << "History disabled, messages will not be persisted." << std::endl;
+  }
+
+  // A takeover gets the live sessions instead
+  snapshot_path = server_name + "_" + SNAPSHOT_FILE;
+  if (!takeover)
+  {
+    load_snapshot();
+  }
+
+  // Federation mode: join the cluster when a cluster port is given
+  if (argc >= 4)
+  {
+    std::vector<std::string> peers(argv + 4, argv + argc);
+    FederationHandlers handlers;
+    handlers.on_forward = deliver_forwarded_message;
+    handlers.local_presence = local_presence;
+    if (!federation.start(server_name, std::stoi(argv[3]), peers, handlers))
+    {
+      return 1;
+    }
+  }
+
   std::cout << server_name << " listening on port " << port << std::endl;
-  std::cout << "Write 'exit' to terminate the server." << std::endl;
+  std::cout << "Write 'exit' to terminate the server, 'stats' to print the metrics." << std::endl;
   // Start the user activity monitoring thread
   std::thread(monitor_user_activity).detach();
+  std::thread(deliver_receipts).detach();
+  std::thread(snapshot_loop).detach();
+  start_flush_control();
+
+  // Sessions kept for a resume hold their names before any connection is read
+  for (const auto &session : handoff_detached)
+    restore_detached(session);
+
+  // Handlers run on the worker pool, sockets are read by the I/O threads
+  worker_pool = new WorkerPool(WORKER_THREADS > 0 ? WORKER_THREADS : std::max(1u, std::thread::hardware_concurrency()));
+  for (int i = 0; i < IO_THREADS; i++)
+  {
+    IoThread *io = new IoThread();
+    io->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (io->epoll_fd == -1)
+    {
+      perror("epoll_create1 failed");
+      return 1;
+    }
+    io_threads.push_back(io);
+  }
+  run_io_threads();
+
+  // Sessions handed over by the previous process continue here, peers learn where they are
+  for (size_t i = 0; i < handoff_sessions.size(); i++)
+  {
+    restore_session(handoff_sessions[i], handoff_fds[i]);
+    if (!handoff_sessions[i].username().empty())
+    {
+      federation.publish_presence(handoff_sessions[i].username(), handoff_sessions[i].status(), true);
+      federation.publish_location(handoff_sessions[i].username(), true);
+    }
+  }
+
+  // A replacement process can take over through this socket
+  int handoff_listen = listen_handoff(handoff_path(server_name));
+  if (handoff_listen != -1)
+  {
+    std::thread(handoff_listener, handoff_listen).detach();
+  }
 
   // Start the termination handler thread
   std::thread terminator(terminationHandler);
   terminator.detach();
 
-  // Set up signal handler for SIGINT (Ctrl+C)
+  // SIGINT (Ctrl+C) and SIGTERM (service managers, rolling restarts) drain the server
   signal(SIGINT, signalHandler);
+  signal(SIGTERM, signalHandler);
 
-  while (running)
+  // The listening socket is non-blocking so each wake up drains up to ACCEPT_BATCH_SIZE connections
+  fcntl(server_fd, F_SETFL, fcntl(server_fd, F_GETFL, 0) | O_NONBLOCK);
+  static Metric &accept_batch = metric("admission.accept_batch");
+
+  while (!draining)
   {
-    int client_sock = accept(server_fd, NULL, NULL);
-    if (client_sock < 0)
+    int replacement = handoff_sock;
+    if (replacement != -1)
     {
-      if (!running)
-        break; // Exit if server is shutting down
-      perror("Accept failed");
-      continue;
+      hand_off_server(replacement); // Only returns when the handoff failed
     }
 
-    std::thread client_thread(handle_client, client_sock);
-    client_thread.detach();
+    struct pollfd listener = {server_fd, POLLIN, 0};
+    if (poll(&listener, 1, 1000) <= 0)
+      continue;
+
+    int batch = 0;
+    while (batch < ACCEPT_BATCH_SIZE)
+    {
+      sockaddr_in client_addr;
+      socklen_t client_addr_size = sizeof(client_addr);
+      int client_sock = accept4(server_fd, (struct sockaddr *)&client_addr, &client_addr_size, SOCK_NONBLOCK | SOCK_CLOEXEC);
+      if (client_sock < 0)
+      {
+        if (errno != EAGAIN && errno != EWOULDBLOCK && !draining)
+          perror("Accept failed");
+        break;
+      }
+      batch++;
+
+      // Shed before any session is created
+      std::string ip_str = inet_ntoa(client_addr.sin_addr);
+      if (!admit_connection(ip_str))
+      {
+        shed_connection(client_sock);
+        continue;
+      }
+
+      auto connection = std::allocate_shared<Connection>(PoolAllocator<Connection>());
+      connection->sock = client_sock;
+      connection->ip = ip_str;
+      connection->limits.ip_bucket = acquire_ip_bucket(ip_str);
+      set_flush_policy(client_sock, chat::FlushPolicy::FLUSH_ADAPTIVE);
+      start_session(connection);
+    }
+    if (batch > 0)
+      accept_batch.observe(batch);
   }
 
-  // Clean up
-  close(server_fd);
+  drain_server();
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,145 @@
+// batcher.cpp
+#include "batcher.h"
+#include "message.h"
+
+RequestBatcher::RequestBatcher(int sock, std::chrono::microseconds window, size_t max_requests, size_t max_offline)
+    : sock(sock), window(window), max_requests(max_requests), max_offline(max_offline), flusher(&RequestBatcher::run, this)
+{
+}
+
+RequestBatcher::~RequestBatcher()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  wake.notify_one();
+  flusher.join();
+}
+
+bool RequestBatcher::send(const chat::Request &request)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if (request.operation() != chat::Operation::SEND_MESSAGE)
+  {
+    bool sent = flush_locked() && sock != -1 && SPM(sock, request);
+    if (!sent)
+    {
+      keep_offline(chat::Request(request));
+      sock = -1;
+    }
+    return sent;
+  }
+
+  pending.push_back(request);
+  if (pending.size() == 1)
+  {
+    deadline = std::chrono::steady_clock::now() + window;
+    wake.notify_one();
+  }
+  if (pending.size() >= max_requests)
+  {
+    return flush_locked();
+  }
+  return true;
+}
+
+bool RequestBatcher::flush()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return flush_locked();
+}
+
+void RequestBatcher::disconnect()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  sock = -1;
+}
+
+void RequestBatcher::on_batch(std::function<void(size_t)> callback)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  batch_sent = std::move(callback);
+}
+
+/**
+ * Sends the requests kept while disconnected to the new connection, in order, then the held ones
+ */
+bool RequestBatcher::reconnect(int new_sock)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  sock = new_sock;
+  while (!offline.empty())
+  {
+    if (!SPM(sock, offline.front()))
+    {
+      sock = -1;
+      return false;
+    }
+    offline.pop_front();
+  }
+  return flush_locked();
+}
+
+/**
+ * Keeps a request for the next connection, the oldest one goes when too many are waiting
+ */
+void RequestBatcher::keep_offline(chat::Request &&request)
+{
+  if (offline.size() >= max_offline)
+    offline.pop_front();
+  offline.push_back(std::move(request));
+}
+
+/**
+ * Flusher thread: sends the held requests once the oldest one has waited a whole window
+ */
+void RequestBatcher::run()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  while (!stopping)
+  {
+    wake.wait(lock, [this]
+              { return stopping || !pending.empty(); });
+    if (wake.wait_until(lock, deadline, [this]
+                        { return stopping || pending.empty(); }))
+      continue;
+    flush_locked();
+  }
+  flush_locked();
+}
+
+bool RequestBatcher::flush_locked()
+{
+  if (pending.empty())
+    return true;
+
+  bool sent = false;
+  if (sock != -1 && pending.size() == 1)
+  {
+    sent = SPM(sock, pending[0]);
+  }
+  else if (sock != -1)
+  {
+    chat::Request batch;
+    batch.set_operation(chat::Operation::BATCH);
+    for (auto &request : pending)
+      *batch.mutable_batch()->add_requests() = std::move(request);
+    if (batch_sent)
+      batch_sent(pending.size()); // Before the send, the reply may come back first
+    sent = SPM(sock, batch);
+    if (!sent)
+    {
+      for (int i = 0; i < batch.batch().requests_size(); i++)
+        pending[i] = std::move(*batch.mutable_batch()->mutable_requests(i));
+    }
+  }
+  if (!sent)
+  {
+    for (auto &request : pending)
+      keep_offline(std::move(request));
+    sock = -1;
+  }
+  pending.clear();
+  return sent;
+}
@@ -0,0 +1,57 @@
+// batcher.h
+#ifndef BATCHER_H
+#define BATCHER_H
+
+#include "chat.pb.h"
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <deque>
+#include <condition_variable>
+#include <functional>
+
+/**
+ * Client side write coalescing. SEND_MESSAGE requests are held for up to a short window
+ * and go out together in one BATCH frame (a lone request goes out as is). Any other
+ * request first flushes the held ones, so the server sees them in the order they were sent.
+ *
+ * While the connection is down (disconnect, or a failed send) requests are kept instead, up
+ * to max_offline of them, and go out in order once reconnect gives it a new socket.
+ */
+class RequestBatcher
+{
+public:
+  RequestBatcher(int sock, std::chrono::microseconds window, size_t max_requests, size_t max_offline);
+  ~RequestBatcher();
+
+  // False when the request could not go out yet and was kept for the next connection
+  bool send(const chat::Request &request);
+  bool flush();
+
+  void disconnect();
+  bool reconnect(int new_sock);
+
+  // Told the number of requests of each BATCH frame, just before it goes out
+  void on_batch(std::function<void(size_t)> callback);
+
+private:
+  void run();
+  bool flush_locked();
+  void keep_offline(chat::Request &&request);
+
+  int sock; // -1 while disconnected
+  std::chrono::microseconds window;
+  size_t max_requests;
+  size_t max_offline;
+  std::vector<chat::Request> pending;
+  std::deque<chat::Request> offline; // Requests of a disconnected client, oldest first
+  std::function<void(size_t)> batch_sent;
+  std::chrono::steady_clock::time_point deadline; // When the oldest pending request must be out
+  bool stopping = false;
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::thread flusher;
+};
+
+#endif // BATCHER_H
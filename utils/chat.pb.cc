@@ -14,352 +14,961 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_chat_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_IncomingMessageResponse_chat_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_chat_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NewUserRequest_chat_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_chat_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_SendMessageRequest_chat_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_chat_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UpdateStatusRequest_chat_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_chat_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_User_chat_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_chat_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UserListRequest_chat_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_chat_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_UserListResponse_chat_2eproto;
-namespace chat {
-class UserDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<User> _instance;
-} _User_default_instance_;
-class NewUserRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<NewUserRequest> _instance;
-} _NewUserRequest_default_instance_;
-class SendMessageRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<SendMessageRequest> _instance;
-} _SendMessageRequest_default_instance_;
-class IncomingMessageResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<IncomingMessageResponse> _instance;
-} _IncomingMessageResponse_default_instance_;
-class UserListRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UserListRequest> _instance;
-} _UserListRequest_default_instance_;
-class UserListResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UserListResponse> _instance;
-} _UserListResponse_default_instance_;
-class UpdateStatusRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UpdateStatusRequest> _instance;
-} _UpdateStatusRequest_default_instance_;
-class RequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Request> _instance;
-  const ::chat::NewUserRequest* register_user_;
-  const ::chat::SendMessageRequest* send_message_;
-  const ::chat::UpdateStatusRequest* update_status_;
-  const ::chat::UserListRequest* get_users_;
-  const ::chat::User* unregister_user_;
-} _Request_default_instance_;
-class ResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Response> _instance;
-  const ::chat::UserListResponse* user_list_;
-  const ::chat::IncomingMessageResponse* incoming_message_;
-} _Response_default_instance_;
-}  // namespace chat
-static void InitDefaultsscc_info_IncomingMessageResponse_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_IncomingMessageResponse_default_instance_;
-    new (ptr) ::chat::IncomingMessageResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::IncomingMessageResponse::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_IncomingMessageResponse_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_IncomingMessageResponse_chat_2eproto}, {}};
-
-static void InitDefaultsscc_info_NewUserRequest_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_NewUserRequest_default_instance_;
-    new (ptr) ::chat::NewUserRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::NewUserRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NewUserRequest_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_NewUserRequest_chat_2eproto}, {}};
-
-static void InitDefaultsscc_info_Request_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_Request_default_instance_;
-    new (ptr) ::chat::Request();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::Request::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_Request_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 5, 0, InitDefaultsscc_info_Request_chat_2eproto}, {
-      &scc_info_NewUserRequest_chat_2eproto.base,
-      &scc_info_SendMessageRequest_chat_2eproto.base,
-      &scc_info_UpdateStatusRequest_chat_2eproto.base,
-      &scc_info_UserListRequest_chat_2eproto.base,
-      &scc_info_User_chat_2eproto.base,}};
-
-static void InitDefaultsscc_info_Response_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_Response_default_instance_;
-    new (ptr) ::chat::Response();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::Response::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_Response_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_Response_chat_2eproto}, {
-      &scc_info_UserListResponse_chat_2eproto.base,
-      &scc_info_IncomingMessageResponse_chat_2eproto.base,}};
-
-static void InitDefaultsscc_info_SendMessageRequest_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_SendMessageRequest_default_instance_;
-    new (ptr) ::chat::SendMessageRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::SendMessageRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_SendMessageRequest_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_SendMessageRequest_chat_2eproto}, {}};
-
-static void InitDefaultsscc_info_UpdateStatusRequest_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_UpdateStatusRequest_default_instance_;
-    new (ptr) ::chat::UpdateStatusRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::UpdateStatusRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UpdateStatusRequest_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_UpdateStatusRequest_chat_2eproto}, {}};
-
-static void InitDefaultsscc_info_User_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_User_default_instance_;
-    new (ptr) ::chat::User();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::User::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_User_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_User_chat_2eproto}, {}};
-
-static void InitDefaultsscc_info_UserListRequest_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_UserListRequest_default_instance_;
-    new (ptr) ::chat::UserListRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::UserListRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UserListRequest_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_UserListRequest_chat_2eproto}, {}};
 
-static void InitDefaultsscc_info_UserListResponse_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_UserListResponse_default_instance_;
-    new (ptr) ::chat::UserListResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::UserListResponse::InitAsDefaultInstance();
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_UserListResponse_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_UserListResponse_chat_2eproto}, {
-      &scc_info_User_chat_2eproto.base,}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_chat_2eproto[9];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_chat_2eproto[5];
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_chat_2eproto = nullptr;
+namespace chat {
+PROTOBUF_CONSTEXPR User::User(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UserDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UserDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UserDefaultTypeInternal() {}
+  union {
+    User _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UserDefaultTypeInternal _User_default_instance_;
+PROTOBUF_CONSTEXPR NewUserRequest::NewUserRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.flush_policy_)*/0
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_.compact_)*/false
+  , /*decltype(_impl_.resumable_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NewUserRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NewUserRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NewUserRequestDefaultTypeInternal() {}
+  union {
+    NewUserRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NewUserRequestDefaultTypeInternal _NewUserRequest_default_instance_;
+PROTOBUF_CONSTEXPR ResumeRequest::ResumeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.token_)*/uint64_t{0u}
+  , /*decltype(_impl_.last_seq_)*/uint64_t{0u}
+  , /*decltype(_impl_.flush_policy_)*/0
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ResumeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResumeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResumeRequestDefaultTypeInternal() {}
+  union {
+    ResumeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResumeRequestDefaultTypeInternal _ResumeRequest_default_instance_;
+PROTOBUF_CONSTEXPR SendMessageRequest::SendMessageRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.recipient_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SendMessageRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SendMessageRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SendMessageRequestDefaultTypeInternal() {}
+  union {
+    SendMessageRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SendMessageRequestDefaultTypeInternal _SendMessageRequest_default_instance_;
+PROTOBUF_CONSTEXPR IncomingMessageResponse::IncomingMessageResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sender_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.room_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.sender_id_)*/0u
+  , /*decltype(_impl_.message_id_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct IncomingMessageResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IncomingMessageResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IncomingMessageResponseDefaultTypeInternal() {}
+  union {
+    IncomingMessageResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IncomingMessageResponseDefaultTypeInternal _IncomingMessageResponse_default_instance_;
+PROTOBUF_CONSTEXPR UserListRequest::UserListRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UserListRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UserListRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UserListRequestDefaultTypeInternal() {}
+  union {
+    UserListRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UserListRequestDefaultTypeInternal _UserListRequest_default_instance_;
+PROTOBUF_CONSTEXPR UserListResponse::UserListResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.users_)*/{}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UserListResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UserListResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UserListResponseDefaultTypeInternal() {}
+  union {
+    UserListResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UserListResponseDefaultTypeInternal _UserListResponse_default_instance_;
+PROTOBUF_CONSTEXPR UpdateStatusRequest::UpdateStatusRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.new_status_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UpdateStatusRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpdateStatusRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpdateStatusRequestDefaultTypeInternal() {}
+  union {
+    UpdateStatusRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateStatusRequestDefaultTypeInternal _UpdateStatusRequest_default_instance_;
+PROTOBUF_CONSTEXPR RoomRequest::RoomRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.room_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoomRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomRequestDefaultTypeInternal() {}
+  union {
+    RoomRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomRequestDefaultTypeInternal _RoomRequest_default_instance_;
+PROTOBUF_CONSTEXPR HistoryRequest::HistoryRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.conversation_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sender_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.since_)*/int64_t{0}
+  , /*decltype(_impl_.until_)*/int64_t{0}
+  , /*decltype(_impl_.limit_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HistoryRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HistoryRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HistoryRequestDefaultTypeInternal() {}
+  union {
+    HistoryRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HistoryRequestDefaultTypeInternal _HistoryRequest_default_instance_;
+PROTOBUF_CONSTEXPR Receipts::Receipts(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.delivered_)*/{}
+  , /*decltype(_impl_._delivered_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.read_)*/{}
+  , /*decltype(_impl_._read_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.received_seq_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReceiptsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReceiptsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReceiptsDefaultTypeInternal() {}
+  union {
+    Receipts _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReceiptsDefaultTypeInternal _Receipts_default_instance_;
+PROTOBUF_CONSTEXPR BatchRequest::BatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.requests_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchRequestDefaultTypeInternal() {}
+  union {
+    BatchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchRequestDefaultTypeInternal _BatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR BatchResponse::BatchResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.responses_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchResponseDefaultTypeInternal() {}
+  union {
+    BatchResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchResponseDefaultTypeInternal _BatchResponse_default_instance_;
+PROTOBUF_CONSTEXPR HistoryResponse::HistoryResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_.page_)*/0u
+  , /*decltype(_impl_.last_page_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HistoryResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HistoryResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HistoryResponseDefaultTypeInternal() {}
+  union {
+    HistoryResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HistoryResponseDefaultTypeInternal _HistoryResponse_default_instance_;
+PROTOBUF_CONSTEXPR StoredMessage::StoredMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.conversation_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.message_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StoredMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StoredMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StoredMessageDefaultTypeInternal() {}
+  union {
+    StoredMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StoredMessageDefaultTypeInternal _StoredMessage_default_instance_;
+PROTOBUF_CONSTEXPR Request::Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.operation_)*/0
+  , /*decltype(_impl_.payload_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestDefaultTypeInternal() {}
+  union {
+    Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestDefaultTypeInternal _Request_default_instance_;
+PROTOBUF_CONSTEXPR ShutdownNotice::ShutdownNotice(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.reconnect_after_ms_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ShutdownNoticeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ShutdownNoticeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ShutdownNoticeDefaultTypeInternal() {}
+  union {
+    ShutdownNotice _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ShutdownNoticeDefaultTypeInternal _ShutdownNotice_default_instance_;
+PROTOBUF_CONSTEXPR Response::Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.operation_)*/0
+  , /*decltype(_impl_.status_code_)*/0
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_.compact_)*/false
+  , /*decltype(_impl_.message_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.seq_)*/uint64_t{0u}
+  , /*decltype(_impl_.resume_token_)*/uint64_t{0u}
+  , /*decltype(_impl_.result_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResponseDefaultTypeInternal() {}
+  union {
+    Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResponseDefaultTypeInternal _Response_default_instance_;
+PROTOBUF_CONSTEXPR PeerPresence::PeerPresence(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.node_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.connected_)*/false
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.changed_at_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PeerPresenceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PeerPresenceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PeerPresenceDefaultTypeInternal() {}
+  union {
+    PeerPresence _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PeerPresenceDefaultTypeInternal _PeerPresence_default_instance_;
+PROTOBUF_CONSTEXPR PresenceDigest::PresenceDigest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PresenceDigestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PresenceDigestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PresenceDigestDefaultTypeInternal() {}
+  union {
+    PresenceDigest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PresenceDigestDefaultTypeInternal _PresenceDigest_default_instance_;
+PROTOBUF_CONSTEXPR PeerMessage::PeerMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.presence_)*/{}
+  , /*decltype(_impl_.digest_)*/{}
+  , /*decltype(_impl_.wanted_)*/{}
+  , /*decltype(_impl_.node_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.recipient_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.message_)*/nullptr
+  , /*decltype(_impl_.operation_)*/0
+  , /*decltype(_impl_.routed_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PeerMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PeerMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PeerMessageDefaultTypeInternal() {}
+  union {
+    PeerMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PeerMessageDefaultTypeInternal _PeerMessage_default_instance_;
+PROTOBUF_CONSTEXPR HandoffSession::HandoffSession(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rooms_)*/{}
+  , /*decltype(_impl_.transfers_)*/{}
+  , /*decltype(_impl_.resume_)*/{}
+  , /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.input_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.last_active_)*/int64_t{0}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.flush_policy_)*/0
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_.compact_)*/false
+  , /*decltype(_impl_.resume_token_)*/uint64_t{0u}
+  , /*decltype(_impl_.registered_at_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HandoffSessionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HandoffSessionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HandoffSessionDefaultTypeInternal() {}
+  union {
+    HandoffSession _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HandoffSessionDefaultTypeInternal _HandoffSession_default_instance_;
+PROTOBUF_CONSTEXPR PartialTransfer::PartialTransfer(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.total_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PartialTransferDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PartialTransferDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PartialTransferDefaultTypeInternal() {}
+  union {
+    PartialTransfer _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PartialTransferDefaultTypeInternal _PartialTransfer_default_instance_;
+PROTOBUF_CONSTEXPR BufferedFrame::BufferedFrame(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.frame_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.seq_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BufferedFrameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BufferedFrameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BufferedFrameDefaultTypeInternal() {}
+  union {
+    BufferedFrame _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BufferedFrameDefaultTypeInternal _BufferedFrame_default_instance_;
+PROTOBUF_CONSTEXPR DetachedSession::DetachedSession(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rooms_)*/{}
+  , /*decltype(_impl_.resume_)*/{}
+  , /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.last_active_)*/int64_t{0}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.compact_)*/false
+  , /*decltype(_impl_.resume_token_)*/uint64_t{0u}
+  , /*decltype(_impl_.detached_ms_)*/int64_t{0}
+  , /*decltype(_impl_.registered_at_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DetachedSessionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DetachedSessionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DetachedSessionDefaultTypeInternal() {}
+  union {
+    DetachedSession _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DetachedSessionDefaultTypeInternal _DetachedSession_default_instance_;
+PROTOBUF_CONSTEXPR HandoffState::HandoffState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sessions_)*/{}
+  , /*decltype(_impl_.detached_)*/{}
+  , /*decltype(_impl_.next_seq_)*/uint64_t{0u}
+  , /*decltype(_impl_.has_listener_)*/false
+  , /*decltype(_impl_.last_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HandoffStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HandoffStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HandoffStateDefaultTypeInternal() {}
+  union {
+    HandoffState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HandoffStateDefaultTypeInternal _HandoffState_default_instance_;
+PROTOBUF_CONSTEXPR SnapshotUser::SnapshotUser(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rooms_)*/{}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.last_active_)*/int64_t{0}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SnapshotUserDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SnapshotUserDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SnapshotUserDefaultTypeInternal() {}
+  union {
+    SnapshotUser _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SnapshotUserDefaultTypeInternal _SnapshotUser_default_instance_;
+PROTOBUF_CONSTEXPR ServerSnapshot::ServerSnapshot(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.users_)*/{}
+  , /*decltype(_impl_.taken_at_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServerSnapshotDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerSnapshotDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerSnapshotDefaultTypeInternal() {}
+  union {
+    ServerSnapshot _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerSnapshotDefaultTypeInternal _ServerSnapshot_default_instance_;
+}  // namespace chat
+static ::_pb::Metadata file_level_metadata_chat_2eproto[28];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_chat_2eproto[8];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_chat_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_chat_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_chat_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::User, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::User, username_),
-  PROTOBUF_FIELD_OFFSET(::chat::User, status_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::User, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::User, _impl_.status_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, username_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, _impl_.flush_policy_),
+  PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, _impl_.compression_),
+  PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, _impl_.compact_),
+  PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, _impl_.resumable_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::ResumeRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ResumeRequest, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::ResumeRequest, _impl_.token_),
+  PROTOBUF_FIELD_OFFSET(::chat::ResumeRequest, _impl_.last_seq_),
+  PROTOBUF_FIELD_OFFSET(::chat::ResumeRequest, _impl_.flush_policy_),
+  PROTOBUF_FIELD_OFFSET(::chat::ResumeRequest, _impl_.compression_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, recipient_),
-  PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, content_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, _impl_.recipient_),
+  PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, _impl_.content_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, sender_),
-  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, content_),
-  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, type_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.sender_),
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.content_),
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.room_),
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.sender_id_),
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.message_id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::UserListRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::UserListRequest, username_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::UserListRequest, _impl_.username_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::UserListResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::UserListResponse, users_),
-  PROTOBUF_FIELD_OFFSET(::chat::UserListResponse, type_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::UserListResponse, _impl_.users_),
+  PROTOBUF_FIELD_OFFSET(::chat::UserListResponse, _impl_.type_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::UpdateStatusRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::UpdateStatusRequest, username_),
-  PROTOBUF_FIELD_OFFSET(::chat::UpdateStatusRequest, new_status_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::UpdateStatusRequest, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::UpdateStatusRequest, _impl_.new_status_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::RoomRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::RoomRequest, _impl_.room_),
+  PROTOBUF_FIELD_OFFSET(::chat::RoomRequest, _impl_.content_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryRequest, _impl_.conversation_),
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryRequest, _impl_.since_),
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryRequest, _impl_.until_),
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryRequest, _impl_.limit_),
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryRequest, _impl_.sender_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::Receipts, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::Receipts, _impl_.delivered_),
+  PROTOBUF_FIELD_OFFSET(::chat::Receipts, _impl_.read_),
+  PROTOBUF_FIELD_OFFSET(::chat::Receipts, _impl_.received_seq_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::BatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::BatchRequest, _impl_.requests_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::BatchResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::BatchResponse, _impl_.responses_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryResponse, _impl_.messages_),
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryResponse, _impl_.page_),
+  PROTOBUF_FIELD_OFFSET(::chat::HistoryResponse, _impl_.last_page_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::StoredMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::StoredMessage, _impl_.conversation_),
+  PROTOBUF_FIELD_OFFSET(::chat::StoredMessage, _impl_.message_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::Request, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::chat::Request, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::chat::Request, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::Request, _impl_.operation_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::chat::Request, _impl_.payload_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::ShutdownNotice, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::Request, operation_),
-  offsetof(::chat::RequestDefaultTypeInternal, register_user_),
-  offsetof(::chat::RequestDefaultTypeInternal, send_message_),
-  offsetof(::chat::RequestDefaultTypeInternal, update_status_),
-  offsetof(::chat::RequestDefaultTypeInternal, get_users_),
-  offsetof(::chat::RequestDefaultTypeInternal, unregister_user_),
-  PROTOBUF_FIELD_OFFSET(::chat::Request, payload_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ShutdownNotice, _impl_.reconnect_after_ms_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::Response, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::chat::Response, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_._oneof_case_[0]),
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::Response, operation_),
-  PROTOBUF_FIELD_OFFSET(::chat::Response, status_code_),
-  PROTOBUF_FIELD_OFFSET(::chat::Response, message_),
-  offsetof(::chat::ResponseDefaultTypeInternal, user_list_),
-  offsetof(::chat::ResponseDefaultTypeInternal, incoming_message_),
-  PROTOBUF_FIELD_OFFSET(::chat::Response, result_),
-};
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::chat::User)},
-  { 7, -1, sizeof(::chat::NewUserRequest)},
-  { 13, -1, sizeof(::chat::SendMessageRequest)},
-  { 20, -1, sizeof(::chat::IncomingMessageResponse)},
-  { 28, -1, sizeof(::chat::UserListRequest)},
-  { 34, -1, sizeof(::chat::UserListResponse)},
-  { 41, -1, sizeof(::chat::UpdateStatusRequest)},
-  { 48, -1, sizeof(::chat::Request)},
-  { 60, -1, sizeof(::chat::Response)},
-};
-
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_User_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_NewUserRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_SendMessageRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_IncomingMessageResponse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_UserListRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_UserListResponse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_UpdateStatusRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_Request_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_Response_default_instance_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.operation_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.status_code_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.message_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.compression_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.compact_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.message_id_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.seq_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.resume_token_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.result_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::PeerPresence, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::PeerPresence, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerPresence, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerPresence, _impl_.connected_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerPresence, _impl_.node_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerPresence, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerPresence, _impl_.changed_at_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceDigest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceDigest, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceDigest, _impl_.version_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::PeerMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::PeerMessage, _impl_.operation_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerMessage, _impl_.node_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerMessage, _impl_.presence_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerMessage, _impl_.recipient_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerMessage, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerMessage, _impl_.routed_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerMessage, _impl_.digest_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerMessage, _impl_.wanted_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffSession, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffSession, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffSession, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffSession, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffSession, _impl_.last_active_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffSession, _impl_.rooms_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffSession, _impl_.input_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffSession, _impl_.flush_policy_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffSession, _impl_.compression_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffSession, _impl_.transfers_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffSession, _impl_.compact_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffSession, _impl_.resume_token_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffSession, _impl_.resume_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffSession, _impl_.registered_at_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::PartialTransfer, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::PartialTransfer, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::chat::PartialTransfer, _impl_.total_),
+  PROTOBUF_FIELD_OFFSET(::chat::PartialTransfer, _impl_.data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::BufferedFrame, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::BufferedFrame, _impl_.seq_),
+  PROTOBUF_FIELD_OFFSET(::chat::BufferedFrame, _impl_.frame_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::DetachedSession, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::DetachedSession, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::chat::DetachedSession, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::DetachedSession, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::chat::DetachedSession, _impl_.last_active_),
+  PROTOBUF_FIELD_OFFSET(::chat::DetachedSession, _impl_.rooms_),
+  PROTOBUF_FIELD_OFFSET(::chat::DetachedSession, _impl_.compact_),
+  PROTOBUF_FIELD_OFFSET(::chat::DetachedSession, _impl_.resume_token_),
+  PROTOBUF_FIELD_OFFSET(::chat::DetachedSession, _impl_.detached_ms_),
+  PROTOBUF_FIELD_OFFSET(::chat::DetachedSession, _impl_.resume_),
+  PROTOBUF_FIELD_OFFSET(::chat::DetachedSession, _impl_.registered_at_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffState, _impl_.has_listener_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffState, _impl_.sessions_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffState, _impl_.last_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffState, _impl_.next_seq_),
+  PROTOBUF_FIELD_OFFSET(::chat::HandoffState, _impl_.detached_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::SnapshotUser, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::SnapshotUser, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::SnapshotUser, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::chat::SnapshotUser, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::chat::SnapshotUser, _impl_.last_active_),
+  PROTOBUF_FIELD_OFFSET(::chat::SnapshotUser, _impl_.rooms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::ServerSnapshot, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ServerSnapshot, _impl_.taken_at_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerSnapshot, _impl_.users_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::chat::User)},
+  { 8, -1, -1, sizeof(::chat::NewUserRequest)},
+  { 19, -1, -1, sizeof(::chat::ResumeRequest)},
+  { 30, -1, -1, sizeof(::chat::SendMessageRequest)},
+  { 38, -1, -1, sizeof(::chat::IncomingMessageResponse)},
+  { 51, -1, -1, sizeof(::chat::UserListRequest)},
+  { 58, -1, -1, sizeof(::chat::UserListResponse)},
+  { 66, -1, -1, sizeof(::chat::UpdateStatusRequest)},
+  { 74, -1, -1, sizeof(::chat::RoomRequest)},
+  { 82, -1, -1, sizeof(::chat::HistoryRequest)},
+  { 93, -1, -1, sizeof(::chat::Receipts)},
+  { 102, -1, -1, sizeof(::chat::BatchRequest)},
+  { 109, -1, -1, sizeof(::chat::BatchResponse)},
+  { 116, -1, -1, sizeof(::chat::HistoryResponse)},
+  { 125, -1, -1, sizeof(::chat::StoredMessage)},
+  { 133, -1, -1, sizeof(::chat::Request)},
+  { 151, -1, -1, sizeof(::chat::ShutdownNotice)},
+  { 158, -1, -1, sizeof(::chat::Response)},
+  { 179, -1, -1, sizeof(::chat::PeerPresence)},
+  { 191, -1, -1, sizeof(::chat::PresenceDigest)},
+  { 199, -1, -1, sizeof(::chat::PeerMessage)},
+  { 213, -1, -1, sizeof(::chat::HandoffSession)},
+  { 232, -1, -1, sizeof(::chat::PartialTransfer)},
+  { 241, -1, -1, sizeof(::chat::BufferedFrame)},
+  { 249, -1, -1, sizeof(::chat::DetachedSession)},
+  { 265, -1, -1, sizeof(::chat::HandoffState)},
+  { 276, -1, -1, sizeof(::chat::SnapshotUser)},
+  { 287, -1, -1, sizeof(::chat::ServerSnapshot)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::chat::_User_default_instance_._instance,
+  &::chat::_NewUserRequest_default_instance_._instance,
+  &::chat::_ResumeRequest_default_instance_._instance,
+  &::chat::_SendMessageRequest_default_instance_._instance,
+  &::chat::_IncomingMessageResponse_default_instance_._instance,
+  &::chat::_UserListRequest_default_instance_._instance,
+  &::chat::_UserListResponse_default_instance_._instance,
+  &::chat::_UpdateStatusRequest_default_instance_._instance,
+  &::chat::_RoomRequest_default_instance_._instance,
+  &::chat::_HistoryRequest_default_instance_._instance,
+  &::chat::_Receipts_default_instance_._instance,
+  &::chat::_BatchRequest_default_instance_._instance,
+  &::chat::_BatchResponse_default_instance_._instance,
+  &::chat::_HistoryResponse_default_instance_._instance,
+  &::chat::_StoredMessage_default_instance_._instance,
+  &::chat::_Request_default_instance_._instance,
+  &::chat::_ShutdownNotice_default_instance_._instance,
+  &::chat::_Response_default_instance_._instance,
+  &::chat::_PeerPresence_default_instance_._instance,
+  &::chat::_PresenceDigest_default_instance_._instance,
+  &::chat::_PeerMessage_default_instance_._instance,
+  &::chat::_HandoffSession_default_instance_._instance,
+  &::chat::_PartialTransfer_default_instance_._instance,
+  &::chat::_BufferedFrame_default_instance_._instance,
+  &::chat::_DetachedSession_default_instance_._instance,
+  &::chat::_HandoffState_default_instance_._instance,
+  &::chat::_SnapshotUser_default_instance_._instance,
+  &::chat::_ServerSnapshot_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_chat_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\nchat.proto\022\004chat\":\n\004User\022\020\n\010username\030\001"
-  " \001(\t\022 \n\006status\030\002 \001(\0162\020.chat.UserStatus\"\""
-  "\n\016NewUserRequest\022\020\n\010username\030\001 \001(\t\"8\n\022Se"
-  "ndMessageRequest\022\021\n\trecipient\030\001 \001(\t\022\017\n\007c"
-  "ontent\030\002 \001(\t\"[\n\027IncomingMessageResponse\022"
-  "\016\n\006sender\030\001 \001(\t\022\017\n\007content\030\002 \001(\t\022\037\n\004type"
-  "\030\003 \001(\0162\021.chat.MessageType\"#\n\017UserListReq"
-  "uest\022\020\n\010username\030\001 \001(\t\"O\n\020UserListRespon"
-  "se\022\031\n\005users\030\001 \003(\0132\n.chat.User\022 \n\004type\030\002 "
-  "\001(\0162\022.chat.UserListType\"M\n\023UpdateStatusR"
-  "equest\022\020\n\010username\030\001 \001(\t\022$\n\nnew_status\030\002"
-  " \001(\0162\020.chat.UserStatus\"\240\002\n\007Request\022\"\n\top"
-  "eration\030\001 \001(\0162\017.chat.Operation\022-\n\rregist"
-  "er_user\030\002 \001(\0132\024.chat.NewUserRequestH\000\0220\n"
-  "\014send_message\030\003 \001(\0132\030.chat.SendMessageRe"
-  "questH\000\0222\n\rupdate_status\030\004 \001(\0132\031.chat.Up"
-  "dateStatusRequestH\000\022*\n\tget_users\030\005 \001(\0132\025"
-  ".chat.UserListRequestH\000\022%\n\017unregister_us"
-  "er\030\006 \001(\0132\n.chat.UserH\000B\t\n\007payload\"\330\001\n\010Re"
-  "sponse\022\"\n\toperation\030\001 \001(\0162\017.chat.Operati"
-  "on\022%\n\013status_code\030\002 \001(\0162\020.chat.StatusCod"
-  "e\022\017\n\007message\030\003 \001(\t\022+\n\tuser_list\030\004 \001(\0132\026."
-  "chat.UserListResponseH\000\0229\n\020incoming_mess"
-  "age\030\005 \001(\0132\035.chat.IncomingMessageResponse"
-  "H\000B\010\n\006result*/\n\nUserStatus\022\n\n\006ONLINE\020\000\022\010"
-  "\n\004BUSY\020\001\022\013\n\007OFFLINE\020\002*(\n\013MessageType\022\r\n\t"
-  "BROADCAST\020\000\022\n\n\006DIRECT\020\001*#\n\014UserListType\022"
-  "\007\n\003ALL\020\000\022\n\n\006SINGLE\020\001*}\n\tOperation\022\021\n\rREG"
-  "ISTER_USER\020\000\022\020\n\014SEND_MESSAGE\020\001\022\021\n\rUPDATE"
-  "_STATUS\020\002\022\r\n\tGET_USERS\020\003\022\023\n\017UNREGISTER_U"
-  "SER\020\004\022\024\n\020INCOMING_MESSAGE\020\005*W\n\nStatusCod"
-  "e\022\022\n\016UNKNOWN_STATUS\020\000\022\007\n\002OK\020\310\001\022\020\n\013BAD_RE"
-  "QUEST\020\220\003\022\032\n\025INTERNAL_SERVER_ERROR\020\364\003b\006pr"
-  "oto3"
+  " \001(\t\022 \n\006status\030\002 \001(\0162\020.chat.UserStatus\"\227"
+  "\001\n\016NewUserRequest\022\020\n\010username\030\001 \001(\t\022\'\n\014f"
+  "lush_policy\030\002 \001(\0162\021.chat.FlushPolicy\022&\n\013"
+  "compression\030\003 \001(\0162\021.chat.Compression\022\017\n\007"
+  "compact\030\004 \001(\010\022\021\n\tresumable\030\005 \001(\010\"\223\001\n\rRes"
+  "umeRequest\022\020\n\010username\030\001 \001(\t\022\r\n\005token\030\002 "
+  "\001(\004\022\020\n\010last_seq\030\003 \001(\004\022\'\n\014flush_policy\030\004 "
+  "\001(\0162\021.chat.FlushPolicy\022&\n\013compression\030\005 "
+  "\001(\0162\021.chat.Compression\"8\n\022SendMessageReq"
+  "uest\022\021\n\trecipient\030\001 \001(\t\022\017\n\007content\030\002 \001(\t"
+  "\"\243\001\n\027IncomingMessageResponse\022\016\n\006sender\030\001"
+  " \001(\t\022\017\n\007content\030\002 \001(\t\022\037\n\004type\030\003 \001(\0162\021.ch"
+  "at.MessageType\022\021\n\ttimestamp\030\004 \001(\003\022\014\n\004roo"
+  "m\030\005 \001(\t\022\021\n\tsender_id\030\006 \001(\r\022\022\n\nmessage_id"
+  "\030\007 \001(\004\"#\n\017UserListRequest\022\020\n\010username\030\001 "
+  "\001(\t\"O\n\020UserListResponse\022\031\n\005users\030\001 \003(\0132\n"
+  ".chat.User\022 \n\004type\030\002 \001(\0162\022.chat.UserList"
+  "Type\"M\n\023UpdateStatusRequest\022\020\n\010username\030"
+  "\001 \001(\t\022$\n\nnew_status\030\002 \001(\0162\020.chat.UserSta"
+  "tus\",\n\013RoomRequest\022\014\n\004room\030\001 \001(\t\022\017\n\007cont"
+  "ent\030\002 \001(\t\"c\n\016HistoryRequest\022\024\n\014conversat"
+  "ion\030\001 \001(\t\022\r\n\005since\030\002 \001(\003\022\r\n\005until\030\003 \001(\003\022"
+  "\r\n\005limit\030\004 \001(\r\022\016\n\006sender\030\005 \001(\t\"A\n\010Receip"
+  "ts\022\021\n\tdelivered\030\001 \003(\004\022\014\n\004read\030\002 \003(\004\022\024\n\014r"
+  "eceived_seq\030\003 \001(\004\"/\n\014BatchRequest\022\037\n\010req"
+  "uests\030\001 \003(\0132\r.chat.Request\"2\n\rBatchRespo"
+  "nse\022!\n\tresponses\030\001 \003(\0132\016.chat.Response\"c"
+  "\n\017HistoryResponse\022/\n\010messages\030\001 \003(\0132\035.ch"
+  "at.IncomingMessageResponse\022\014\n\004page\030\002 \001(\r"
+  "\022\021\n\tlast_page\030\003 \001(\010\"U\n\rStoredMessage\022\024\n\014"
+  "conversation\030\001 \001(\t\022.\n\007message\030\002 \001(\0132\035.ch"
+  "at.IncomingMessageResponse\"\343\003\n\007Request\022\""
+  "\n\toperation\030\001 \001(\0162\017.chat.Operation\022-\n\rre"
+  "gister_user\030\002 \001(\0132\024.chat.NewUserRequestH"
+  "\000\0220\n\014send_message\030\003 \001(\0132\030.chat.SendMessa"
+  "geRequestH\000\0222\n\rupdate_status\030\004 \001(\0132\031.cha"
+  "t.UpdateStatusRequestH\000\022*\n\tget_users\030\005 \001"
+  "(\0132\025.chat.UserListRequestH\000\022%\n\017unregiste"
+  "r_user\030\006 \001(\0132\n.chat.UserH\000\022+\n\013get_histor"
+  "y\030\007 \001(\0132\024.chat.HistoryRequestH\000\022!\n\004room\030"
+  "\010 \001(\0132\021.chat.RoomRequestH\000\022#\n\005batch\030\t \001("
+  "\0132\022.chat.BatchRequestH\000\022%\n\013acknowledge\030\n"
+  " \001(\0132\016.chat.ReceiptsH\000\022%\n\006resume\030\013 \001(\0132\023"
+  ".chat.ResumeRequestH\000B\t\n\007payload\",\n\016Shut"
+  "downNotice\022\032\n\022reconnect_after_ms\030\001 \001(\r\"\346"
+  "\003\n\010Response\022\"\n\toperation\030\001 \001(\0162\017.chat.Op"
+  "eration\022%\n\013status_code\030\002 \001(\0162\020.chat.Stat"
+  "usCode\022\017\n\007message\030\003 \001(\t\022+\n\tuser_list\030\004 \001"
+  "(\0132\026.chat.UserListResponseH\000\0229\n\020incoming"
+  "_message\030\005 \001(\0132\035.chat.IncomingMessageRes"
+  "ponseH\000\022(\n\007history\030\006 \001(\0132\025.chat.HistoryR"
+  "esponseH\000\022(\n\010shutdown\030\007 \001(\0132\024.chat.Shutd"
+  "ownNoticeH\000\022$\n\005batch\030\010 \001(\0132\023.chat.BatchR"
+  "esponseH\000\022\"\n\010receipts\030\013 \001(\0132\016.chat.Recei"
+  "ptsH\000\022&\n\013compression\030\t \001(\0162\021.chat.Compre"
+  "ssion\022\017\n\007compact\030\n \001(\010\022\022\n\nmessage_id\030\014 \001"
+  "(\004\022\013\n\003seq\030\r \001(\004\022\024\n\014resume_token\030\016 \001(\004B\010\n"
+  "\006result\"\210\001\n\014PeerPresence\022\020\n\010username\030\001 \001"
+  "(\t\022 \n\006status\030\002 \001(\0162\020.chat.UserStatus\022\021\n\t"
+  "connected\030\003 \001(\010\022\014\n\004node\030\004 \001(\t\022\017\n\007version"
+  "\030\005 \001(\004\022\022\n\nchanged_at\030\006 \001(\003\"3\n\016PresenceDi"
+  "gest\022\020\n\010username\030\001 \001(\t\022\017\n\007version\030\002 \001(\004\""
+  "\362\001\n\013PeerMessage\022&\n\toperation\030\001 \001(\0162\023.cha"
+  "t.PeerOperation\022\014\n\004node\030\002 \001(\t\022$\n\010presenc"
+  "e\030\003 \003(\0132\022.chat.PeerPresence\022\021\n\trecipient"
+  "\030\004 \001(\t\022.\n\007message\030\005 \001(\0132\035.chat.IncomingM"
+  "essageResponse\022\016\n\006routed\030\006 \001(\010\022$\n\006digest"
+  "\030\007 \003(\0132\024.chat.PresenceDigest\022\016\n\006wanted\030\010"
+  " \003(\t\"\341\002\n\016HandoffSession\022\n\n\002ip\030\001 \001(\t\022\020\n\010u"
+  "sername\030\002 \001(\t\022 \n\006status\030\003 \001(\0162\020.chat.Use"
+  "rStatus\022\023\n\013last_active\030\004 \001(\003\022\r\n\005rooms\030\005 "
+  "\003(\t\022\r\n\005input\030\006 \001(\014\022\'\n\014flush_policy\030\007 \001(\016"
+  "2\021.chat.FlushPolicy\022&\n\013compression\030\010 \001(\016"
+  "2\021.chat.Compression\022(\n\ttransfers\030\t \003(\0132\025"
+  ".chat.PartialTransfer\022\017\n\007compact\030\n \001(\010\022\024"
+  "\n\014resume_token\030\013 \001(\004\022#\n\006resume\030\014 \003(\0132\023.c"
+  "hat.BufferedFrame\022\025\n\rregistered_at\030\r \001(\003"
+  "\":\n\017PartialTransfer\022\n\n\002id\030\001 \001(\r\022\r\n\005total"
+  "\030\002 \001(\r\022\014\n\004data\030\003 \001(\014\"+\n\rBufferedFrame\022\013\n"
+  "\003seq\030\001 \001(\004\022\r\n\005frame\030\002 \001(\014\"\355\001\n\017DetachedSe"
+  "ssion\022\n\n\002ip\030\001 \001(\t\022\020\n\010username\030\002 \001(\t\022 \n\006s"
+  "tatus\030\003 \001(\0162\020.chat.UserStatus\022\023\n\013last_ac"
+  "tive\030\004 \001(\003\022\r\n\005rooms\030\005 \003(\t\022\017\n\007compact\030\006 \001"
+  "(\010\022\024\n\014resume_token\030\007 \001(\004\022\023\n\013detached_ms\030"
+  "\010 \001(\003\022#\n\006resume\030\t \003(\0132\023.chat.BufferedFra"
+  "me\022\025\n\rregistered_at\030\n \001(\003\"\225\001\n\014HandoffSta"
+  "te\022\024\n\014has_listener\030\001 \001(\010\022&\n\010sessions\030\002 \003"
+  "(\0132\024.chat.HandoffSession\022\014\n\004last\030\003 \001(\010\022\020"
+  "\n\010next_seq\030\004 \001(\004\022\'\n\010detached\030\005 \003(\0132\025.cha"
+  "t.DetachedSession\"r\n\014SnapshotUser\022\020\n\010use"
+  "rname\030\001 \001(\t\022\n\n\002ip\030\002 \001(\t\022 \n\006status\030\003 \001(\0162"
+  "\020.chat.UserStatus\022\023\n\013last_active\030\004 \001(\003\022\r"
+  "\n\005rooms\030\005 \003(\t\"E\n\016ServerSnapshot\022\020\n\010taken"
+  "_at\030\001 \001(\003\022!\n\005users\030\002 \003(\0132\022.chat.Snapshot"
+  "User*/\n\nUserStatus\022\n\n\006ONLINE\020\000\022\010\n\004BUSY\020\001"
+  "\022\013\n\007OFFLINE\020\002*J\n\013FlushPolicy\022\022\n\016FLUSH_AD"
+  "APTIVE\020\000\022\023\n\017FLUSH_IMMEDIATE\020\001\022\022\n\016FLUSH_C"
+  "OALESCE\020\002*<\n\013Compression\022\024\n\020COMPRESSION_"
+  "NONE\020\000\022\027\n\023COMPRESSION_DEFLATE\020\001*2\n\013Messa"
+  "geType\022\r\n\tBROADCAST\020\000\022\n\n\006DIRECT\020\001\022\010\n\004ROO"
+  "M\020\002*#\n\014UserListType\022\007\n\003ALL\020\000\022\n\n\006SINGLE\020\001"
+  "*\217\002\n\tOperation\022\021\n\rREGISTER_USER\020\000\022\020\n\014SEN"
+  "D_MESSAGE\020\001\022\021\n\rUPDATE_STATUS\020\002\022\r\n\tGET_US"
+  "ERS\020\003\022\023\n\017UNREGISTER_USER\020\004\022\024\n\020INCOMING_M"
+  "ESSAGE\020\005\022\017\n\013GET_HISTORY\020\006\022\r\n\tJOIN_ROOM\020\007"
+  "\022\016\n\nLEAVE_ROOM\020\010\022\025\n\021SEND_ROOM_MESSAGE\020\t\022"
+  "\023\n\017SERVER_SHUTDOWN\020\n\022\t\n\005BATCH\020\013\022\017\n\013ACKNO"
+  "WLEDGE\020\014\022\014\n\010RECEIPTS\020\r\022\n\n\006RESUME\020\016*\211\001\n\nS"
+  "tatusCode\022\022\n\016UNKNOWN_STATUS\020\000\022\007\n\002OK\020\310\001\022\020"
+  "\n\013BAD_REQUEST\020\220\003\022\026\n\021TOO_MANY_REQUESTS\020\255\003"
+  "\022\032\n\025INTERNAL_SERVER_ERROR\020\364\003\022\030\n\023SERVICE_"
+  "UNAVAILABLE\020\367\003*f\n\rPeerOperation\022\016\n\nPEER_"
+  "HELLO\020\000\022\017\n\013PEER_DIGEST\020\001\022\020\n\014PEER_FORWARD"
+  "\020\002\022\021\n\rPEER_LOCATION\020\003\022\017\n\013PEER_GOSSIP\020\004b\006"
+  "proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_chat_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_chat_2eproto_sccs[9] = {
-  &scc_info_IncomingMessageResponse_chat_2eproto.base,
-  &scc_info_NewUserRequest_chat_2eproto.base,
-  &scc_info_Request_chat_2eproto.base,
-  &scc_info_Response_chat_2eproto.base,
-  &scc_info_SendMessageRequest_chat_2eproto.base,
-  &scc_info_UpdateStatusRequest_chat_2eproto.base,
-  &scc_info_User_chat_2eproto.base,
-  &scc_info_UserListRequest_chat_2eproto.base,
-  &scc_info_UserListResponse_chat_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_chat_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_chat_2eproto = {
-  false, false, descriptor_table_protodef_chat_2eproto, "chat.proto", 1324,
-  &descriptor_table_chat_2eproto_once, descriptor_table_chat_2eproto_sccs, descriptor_table_chat_2eproto_deps, 9, 0,
-  schemas, file_default_instances, TableStruct_chat_2eproto::offsets,
-  file_level_metadata_chat_2eproto, 9, file_level_enum_descriptors_chat_2eproto, file_level_service_descriptors_chat_2eproto,
+static ::_pbi::once_flag descriptor_table_chat_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_chat_2eproto = {
+    false, false, 4606, descriptor_table_protodef_chat_2eproto,
+    "chat.proto",
+    &descriptor_table_chat_2eproto_once, nullptr, 0, 28,
+    schemas, file_default_instances, TableStruct_chat_2eproto::offsets,
+    file_level_metadata_chat_2eproto, file_level_enum_descriptors_chat_2eproto,
+    file_level_service_descriptors_chat_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_chat_2eproto_getter() {
+  return &descriptor_table_chat_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_chat_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_chat_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_chat_2eproto(&descriptor_table_chat_2eproto);
 namespace chat {
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UserStatus_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
@@ -376,14 +985,44 @@ bool UserStatus_IsValid(int value) {
   }
 }
 
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor() {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FlushPolicy_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
   return file_level_enum_descriptors_chat_2eproto[1];
 }
+bool FlushPolicy_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Compression_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
+  return file_level_enum_descriptors_chat_2eproto[2];
+}
+bool Compression_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
+  return file_level_enum_descriptors_chat_2eproto[3];
+}
 bool MessageType_IsValid(int value) {
   switch (value) {
     case 0:
     case 1:
+    case 2:
       return true;
     default:
       return false;
@@ -392,7 +1031,7 @@ bool MessageType_IsValid(int value) {
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UserListType_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
-  return file_level_enum_descriptors_chat_2eproto[2];
+  return file_level_enum_descriptors_chat_2eproto[4];
 }
 bool UserListType_IsValid(int value) {
   switch (value) {
@@ -406,7 +1045,7 @@ bool UserListType_IsValid(int value) {
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Operation_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
-  return file_level_enum_descriptors_chat_2eproto[3];
+  return file_level_enum_descriptors_chat_2eproto[5];
 }
 bool Operation_IsValid(int value) {
   switch (value) {
@@ -416,6 +1055,15 @@ bool Operation_IsValid(int value) {
     case 3:
     case 4:
     case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
       return true;
     default:
       return false;
@@ -424,14 +1072,33 @@ bool Operation_IsValid(int value) {
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatusCode_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
-  return file_level_enum_descriptors_chat_2eproto[4];
+  return file_level_enum_descriptors_chat_2eproto[6];
 }
 bool StatusCode_IsValid(int value) {
   switch (value) {
     case 0:
     case 200:
     case 400:
+    case 429:
     case 500:
+    case 503:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PeerOperation_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
+  return file_level_enum_descriptors_chat_2eproto[7];
+}
+bool PeerOperation_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
       return true;
     default:
       return false;
@@ -441,128 +1108,137 @@ bool StatusCode_IsValid(int value) {
 
 // ===================================================================
 
-void User::InitAsDefaultInstance() {
-}
 class User::_Internal {
  public:
 };
 
-User::User(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+User::User(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:chat.User)
 }
 User::User(const User& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  User* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.status_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_username().empty()) {
-    username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_username(),
-      GetArena());
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
   }
-  status_ = from.status_;
+  _this->_impl_.status_ = from._impl_.status_;
   // @@protoc_insertion_point(copy_constructor:chat.User)
 }
 
-void User::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_User_chat_2eproto.base);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  status_ = 0;
+inline void User::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.status_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 User::~User() {
   // @@protoc_insertion_point(destructor:chat.User)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void User::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  username_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void User::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
 }
 
-void User::ArenaDtor(void* object) {
-  User* _this = reinterpret_cast< User* >(object);
-  (void)_this;
-}
-void User::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void User::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const User& User::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_User_chat_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void User::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.User)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  status_ = 0;
+  _impl_.username_.ClearToEmpty();
+  _impl_.status_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* User::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* User::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string username = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_username();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.User.username"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "chat.User.username"));
+        } else
+          goto handle_unusual;
         continue;
       // .chat.UserStatus status = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_status(static_cast<::chat::UserStatus>(val));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* User::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* User::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.User)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string username = 1;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -572,14 +1248,14 @@ failure:
   }
 
   // .chat.UserStatus status = 2;
-  if (this->status() != 0) {
+  if (this->_internal_status() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       2, this->_internal_status(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.User)
@@ -590,67 +1266,48 @@ size_t User::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.User)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string username = 1;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_username());
   }
 
   // .chat.UserStatus status = 2;
-  if (this->status() != 0) {
+  if (this->_internal_status() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_status());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void User::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.User)
-  GOOGLE_DCHECK_NE(&from, this);
-  const User* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<User>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.User)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.User)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData User::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    User::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*User::GetClassData() const { return &_class_data_; }
 
-void User::MergeFrom(const User& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.User)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void User::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<User*>(&to_msg);
+  auto& from = static_cast<const User&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.User)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.username().size() > 0) {
-    _internal_set_username(from._internal_username());
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
   }
-  if (from.status() != 0) {
-    _internal_set_status(from._internal_status());
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
   }
-}
-
-void User::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.User)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void User::CopyFrom(const User& from) {
@@ -666,129 +1323,190 @@ bool User::IsInitialized() const {
 
 void User::InternalSwap(User* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  username_.Swap(&other->username_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(status_, other->status_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  swap(_impl_.status_, other->_impl_.status_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata User::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void NewUserRequest::InitAsDefaultInstance() {
-}
 class NewUserRequest::_Internal {
  public:
 };
 
-NewUserRequest::NewUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+NewUserRequest::NewUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:chat.NewUserRequest)
 }
 NewUserRequest::NewUserRequest(const NewUserRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NewUserRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.flush_policy_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.compact_){}
+    , decltype(_impl_.resumable_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_username().empty()) {
-    username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_username(),
-      GetArena());
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
   }
+  ::memcpy(&_impl_.flush_policy_, &from._impl_.flush_policy_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.resumable_) -
+    reinterpret_cast<char*>(&_impl_.flush_policy_)) + sizeof(_impl_.resumable_));
   // @@protoc_insertion_point(copy_constructor:chat.NewUserRequest)
 }
 
-void NewUserRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_NewUserRequest_chat_2eproto.base);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void NewUserRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.flush_policy_){0}
+    , decltype(_impl_.compression_){0}
+    , decltype(_impl_.compact_){false}
+    , decltype(_impl_.resumable_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 NewUserRequest::~NewUserRequest() {
   // @@protoc_insertion_point(destructor:chat.NewUserRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void NewUserRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  username_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void NewUserRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
 }
 
-void NewUserRequest::ArenaDtor(void* object) {
-  NewUserRequest* _this = reinterpret_cast< NewUserRequest* >(object);
-  (void)_this;
-}
-void NewUserRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void NewUserRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const NewUserRequest& NewUserRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_NewUserRequest_chat_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void NewUserRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.NewUserRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.username_.ClearToEmpty();
+  ::memset(&_impl_.flush_policy_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.resumable_) -
+      reinterpret_cast<char*>(&_impl_.flush_policy_)) + sizeof(_impl_.resumable_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* NewUserRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* NewUserRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string username = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_username();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.NewUserRequest.username"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.NewUserRequest.username"));
+        } else
+          goto handle_unusual;
         continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
+      // .chat.FlushPolicy flush_policy = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_flush_policy(static_cast<::chat::FlushPolicy>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.Compression compression = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::chat::Compression>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool compact = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.compact_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool resumable = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.resumable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* NewUserRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* NewUserRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.NewUserRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string username = 1;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -797,8 +1515,34 @@ failure:
         1, this->_internal_username(), target);
   }
 
+  // .chat.FlushPolicy flush_policy = 2;
+  if (this->_internal_flush_policy() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_flush_policy(), target);
+  }
+
+  // .chat.Compression compression = 3;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_compression(), target);
+  }
+
+  // bool compact = 4;
+  if (this->_internal_compact() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_compact(), target);
+  }
+
+  // bool resumable = 5;
+  if (this->_internal_resumable() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_resumable(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.NewUserRequest)
@@ -809,58 +1553,73 @@ size_t NewUserRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.NewUserRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string username = 1;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_username());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // .chat.FlushPolicy flush_policy = 2;
+  if (this->_internal_flush_policy() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_flush_policy());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void NewUserRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.NewUserRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const NewUserRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<NewUserRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.NewUserRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.NewUserRequest)
-    MergeFrom(*source);
+  // .chat.Compression compression = 3;
+  if (this->_internal_compression() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
   }
-}
 
-void NewUserRequest::MergeFrom(const NewUserRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.NewUserRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // bool compact = 4;
+  if (this->_internal_compact() != 0) {
+    total_size += 1 + 1;
+  }
 
-  if (from.username().size() > 0) {
-    _internal_set_username(from._internal_username());
+  // bool resumable = 5;
+  if (this->_internal_resumable() != 0) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void NewUserRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.NewUserRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NewUserRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NewUserRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NewUserRequest::GetClassData() const { return &_class_data_; }
+
+
+void NewUserRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NewUserRequest*>(&to_msg);
+  auto& from = static_cast<const NewUserRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.NewUserRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (from._internal_flush_policy() != 0) {
+    _this->_internal_set_flush_policy(from._internal_flush_policy());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  if (from._internal_compact() != 0) {
+    _this->_internal_set_compact(from._internal_compact());
+  }
+  if (from._internal_resumable() != 0) {
+    _this->_internal_set_resumable(from._internal_resumable());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void NewUserRequest::CopyFrom(const NewUserRequest& from) {
@@ -876,145 +1635,490 @@ bool NewUserRequest::IsInitialized() const {
 
 void NewUserRequest::InternalSwap(NewUserRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  username_.Swap(&other->username_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NewUserRequest, _impl_.resumable_)
+      + sizeof(NewUserRequest::_impl_.resumable_)
+      - PROTOBUF_FIELD_OFFSET(NewUserRequest, _impl_.flush_policy_)>(
+          reinterpret_cast<char*>(&_impl_.flush_policy_),
+          reinterpret_cast<char*>(&other->_impl_.flush_policy_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata NewUserRequest::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void SendMessageRequest::InitAsDefaultInstance() {
+class ResumeRequest::_Internal {
+ public:
+};
+
+ResumeRequest::ResumeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ResumeRequest)
+}
+ResumeRequest::ResumeRequest(const ResumeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResumeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.token_){}
+    , decltype(_impl_.last_seq_){}
+    , decltype(_impl_.flush_policy_){}
+    , decltype(_impl_.compression_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.token_, &from._impl_.token_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.compression_) -
+    reinterpret_cast<char*>(&_impl_.token_)) + sizeof(_impl_.compression_));
+  // @@protoc_insertion_point(copy_constructor:chat.ResumeRequest)
+}
+
+inline void ResumeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.token_){uint64_t{0u}}
+    , decltype(_impl_.last_seq_){uint64_t{0u}}
+    , decltype(_impl_.flush_policy_){0}
+    , decltype(_impl_.compression_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ResumeRequest::~ResumeRequest() {
+  // @@protoc_insertion_point(destructor:chat.ResumeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResumeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+}
+
+void ResumeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResumeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ResumeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.username_.ClearToEmpty();
+  ::memset(&_impl_.token_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.compression_) -
+      reinterpret_cast<char*>(&_impl_.token_)) + sizeof(_impl_.compression_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResumeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string username = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.ResumeRequest.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 token = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.token_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 last_seq = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.last_seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.FlushPolicy flush_policy = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_flush_policy(static_cast<::chat::FlushPolicy>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.Compression compression = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::chat::Compression>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResumeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ResumeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.ResumeRequest.username");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
+  }
+
+  // uint64 token = 2;
+  if (this->_internal_token() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_token(), target);
+  }
+
+  // uint64 last_seq = 3;
+  if (this->_internal_last_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_last_seq(), target);
+  }
+
+  // .chat.FlushPolicy flush_policy = 4;
+  if (this->_internal_flush_policy() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_flush_policy(), target);
+  }
+
+  // .chat.Compression compression = 5;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_compression(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ResumeRequest)
+  return target;
+}
+
+size_t ResumeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ResumeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // uint64 token = 2;
+  if (this->_internal_token() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_token());
+  }
+
+  // uint64 last_seq = 3;
+  if (this->_internal_last_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_seq());
+  }
+
+  // .chat.FlushPolicy flush_policy = 4;
+  if (this->_internal_flush_policy() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_flush_policy());
+  }
+
+  // .chat.Compression compression = 5;
+  if (this->_internal_compression() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResumeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResumeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResumeRequest::GetClassData() const { return &_class_data_; }
+
+
+void ResumeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResumeRequest*>(&to_msg);
+  auto& from = static_cast<const ResumeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ResumeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (from._internal_token() != 0) {
+    _this->_internal_set_token(from._internal_token());
+  }
+  if (from._internal_last_seq() != 0) {
+    _this->_internal_set_last_seq(from._internal_last_seq());
+  }
+  if (from._internal_flush_policy() != 0) {
+    _this->_internal_set_flush_policy(from._internal_flush_policy());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResumeRequest::CopyFrom(const ResumeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ResumeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResumeRequest::IsInitialized() const {
+  return true;
+}
+
+void ResumeRequest::InternalSwap(ResumeRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ResumeRequest, _impl_.compression_)
+      + sizeof(ResumeRequest::_impl_.compression_)
+      - PROTOBUF_FIELD_OFFSET(ResumeRequest, _impl_.token_)>(
+          reinterpret_cast<char*>(&_impl_.token_),
+          reinterpret_cast<char*>(&other->_impl_.token_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResumeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[2]);
 }
+
+// ===================================================================
+
 class SendMessageRequest::_Internal {
  public:
 };
 
-SendMessageRequest::SendMessageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+SendMessageRequest::SendMessageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:chat.SendMessageRequest)
 }
 SendMessageRequest::SendMessageRequest(const SendMessageRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SendMessageRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.recipient_){}
+    , decltype(_impl_.content_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  recipient_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.recipient_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_recipient().empty()) {
-    recipient_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_recipient(),
-      GetArena());
+    _this->_impl_.recipient_.Set(from._internal_recipient(), 
+      _this->GetArenaForAllocation());
   }
-  content_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_content().empty()) {
-    content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_content(),
-      GetArena());
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:chat.SendMessageRequest)
 }
 
-void SendMessageRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SendMessageRequest_chat_2eproto.base);
-  recipient_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  content_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void SendMessageRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.recipient_){}
+    , decltype(_impl_.content_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.recipient_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 SendMessageRequest::~SendMessageRequest() {
   // @@protoc_insertion_point(destructor:chat.SendMessageRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void SendMessageRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  recipient_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  content_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void SendMessageRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.recipient_.Destroy();
+  _impl_.content_.Destroy();
 }
 
-void SendMessageRequest::ArenaDtor(void* object) {
-  SendMessageRequest* _this = reinterpret_cast< SendMessageRequest* >(object);
-  (void)_this;
-}
-void SendMessageRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void SendMessageRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const SendMessageRequest& SendMessageRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_SendMessageRequest_chat_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void SendMessageRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.SendMessageRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  recipient_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  content_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.recipient_.ClearToEmpty();
+  _impl_.content_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SendMessageRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* SendMessageRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string recipient = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_recipient();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.SendMessageRequest.recipient"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "chat.SendMessageRequest.recipient"));
+        } else
+          goto handle_unusual;
         continue;
       // string content = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_content();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.SendMessageRequest.content"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.SendMessageRequest.content"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* SendMessageRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* SendMessageRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.SendMessageRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string recipient = 1;
-  if (this->recipient().size() > 0) {
+  if (!this->_internal_recipient().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_recipient().data(), static_cast<int>(this->_internal_recipient().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1024,7 +2128,7 @@ failure:
   }
 
   // string content = 2;
-  if (this->content().size() > 0) {
+  if (!this->_internal_content().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_content().data(), static_cast<int>(this->_internal_content().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1034,7 +2138,7 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.SendMessageRequest)
@@ -1045,68 +2149,49 @@ size_t SendMessageRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.SendMessageRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string recipient = 1;
-  if (this->recipient().size() > 0) {
+  if (!this->_internal_recipient().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_recipient());
   }
 
   // string content = 2;
-  if (this->content().size() > 0) {
+  if (!this->_internal_content().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_content());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SendMessageRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.SendMessageRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SendMessageRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SendMessageRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.SendMessageRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.SendMessageRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SendMessageRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SendMessageRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SendMessageRequest::GetClassData() const { return &_class_data_; }
 
-void SendMessageRequest::MergeFrom(const SendMessageRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.SendMessageRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void SendMessageRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SendMessageRequest*>(&to_msg);
+  auto& from = static_cast<const SendMessageRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.SendMessageRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.recipient().size() > 0) {
-    _internal_set_recipient(from._internal_recipient());
+  if (!from._internal_recipient().empty()) {
+    _this->_internal_set_recipient(from._internal_recipient());
   }
-  if (from.content().size() > 0) {
-    _internal_set_content(from._internal_content());
+  if (!from._internal_content().empty()) {
+    _this->_internal_set_content(from._internal_content());
   }
-}
-
-void SendMessageRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.SendMessageRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SendMessageRequest::CopyFrom(const SendMessageRequest& from) {
@@ -1122,157 +2207,244 @@ bool SendMessageRequest::IsInitialized() const {
 
 void SendMessageRequest::InternalSwap(SendMessageRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  recipient_.Swap(&other->recipient_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  content_.Swap(&other->content_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.recipient_, lhs_arena,
+      &other->_impl_.recipient_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata SendMessageRequest::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[3]);
 }
 
-
 // ===================================================================
 
-void IncomingMessageResponse::InitAsDefaultInstance() {
-}
 class IncomingMessageResponse::_Internal {
  public:
 };
 
-IncomingMessageResponse::IncomingMessageResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+IncomingMessageResponse::IncomingMessageResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:chat.IncomingMessageResponse)
 }
 IncomingMessageResponse::IncomingMessageResponse(const IncomingMessageResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IncomingMessageResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sender_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.room_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.sender_id_){}
+    , decltype(_impl_.message_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  sender_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_sender().empty()) {
-    sender_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_sender(),
-      GetArena());
+    _this->_impl_.sender_.Set(from._internal_sender(), 
+      _this->GetArenaForAllocation());
   }
-  content_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_content().empty()) {
-    content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_content(),
-      GetArena());
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.room_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.room_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_room().empty()) {
+    _this->_impl_.room_.Set(from._internal_room(), 
+      _this->GetArenaForAllocation());
   }
-  type_ = from.type_;
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.message_id_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.message_id_));
   // @@protoc_insertion_point(copy_constructor:chat.IncomingMessageResponse)
 }
 
-void IncomingMessageResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_IncomingMessageResponse_chat_2eproto.base);
-  sender_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  content_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  type_ = 0;
+inline void IncomingMessageResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sender_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.room_){}
+    , decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.sender_id_){0u}
+    , decltype(_impl_.message_id_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.room_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.room_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 IncomingMessageResponse::~IncomingMessageResponse() {
   // @@protoc_insertion_point(destructor:chat.IncomingMessageResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void IncomingMessageResponse::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  sender_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  content_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void IncomingMessageResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sender_.Destroy();
+  _impl_.content_.Destroy();
+  _impl_.room_.Destroy();
 }
 
-void IncomingMessageResponse::ArenaDtor(void* object) {
-  IncomingMessageResponse* _this = reinterpret_cast< IncomingMessageResponse* >(object);
-  (void)_this;
-}
-void IncomingMessageResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void IncomingMessageResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const IncomingMessageResponse& IncomingMessageResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_IncomingMessageResponse_chat_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void IncomingMessageResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.IncomingMessageResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  sender_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  content_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  type_ = 0;
+  _impl_.sender_.ClearToEmpty();
+  _impl_.content_.ClearToEmpty();
+  _impl_.room_.ClearToEmpty();
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.message_id_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.message_id_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* IncomingMessageResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* IncomingMessageResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string sender = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_sender();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.IncomingMessageResponse.sender"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "chat.IncomingMessageResponse.sender"));
+        } else
+          goto handle_unusual;
         continue;
       // string content = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_content();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.IncomingMessageResponse.content"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "chat.IncomingMessageResponse.content"));
+        } else
+          goto handle_unusual;
         continue;
       // .chat.MessageType type = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_type(static_cast<::chat::MessageType>(val));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // int64 timestamp = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string room = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_room();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.IncomingMessageResponse.room"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 sender_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.sender_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 message_id = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.message_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* IncomingMessageResponse::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* IncomingMessageResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.IncomingMessageResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string sender = 1;
-  if (this->sender().size() > 0) {
+  if (!this->_internal_sender().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_sender().data(), static_cast<int>(this->_internal_sender().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1282,7 +2454,7 @@ failure:
   }
 
   // string content = 2;
-  if (this->content().size() > 0) {
+  if (!this->_internal_content().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_content().data(), static_cast<int>(this->_internal_content().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1292,14 +2464,42 @@ failure:
   }
 
   // .chat.MessageType type = 3;
-  if (this->type() != 0) {
+  if (this->_internal_type() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       3, this->_internal_type(), target);
   }
 
+  // int64 timestamp = 4;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_timestamp(), target);
+  }
+
+  // string room = 5;
+  if (!this->_internal_room().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_room().data(), static_cast<int>(this->_internal_room().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.IncomingMessageResponse.room");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_room(), target);
+  }
+
+  // uint32 sender_id = 6;
+  if (this->_internal_sender_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_sender_id(), target);
+  }
+
+  // uint64 message_id = 7;
+  if (this->_internal_message_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_message_id(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.IncomingMessageResponse)
@@ -1310,77 +2510,92 @@ size_t IncomingMessageResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.IncomingMessageResponse)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string sender = 1;
-  if (this->sender().size() > 0) {
+  if (!this->_internal_sender().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_sender());
   }
 
   // string content = 2;
-  if (this->content().size() > 0) {
+  if (!this->_internal_content().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_content());
   }
 
-  // .chat.MessageType type = 3;
-  if (this->type() != 0) {
+  // string room = 5;
+  if (!this->_internal_room().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_type());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_room());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int64 timestamp = 4;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void IncomingMessageResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.IncomingMessageResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const IncomingMessageResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<IncomingMessageResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.IncomingMessageResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.IncomingMessageResponse)
-    MergeFrom(*source);
+  // .chat.MessageType type = 3;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
-}
 
-void IncomingMessageResponse::MergeFrom(const IncomingMessageResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.IncomingMessageResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // uint32 sender_id = 6;
+  if (this->_internal_sender_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sender_id());
+  }
 
-  if (from.sender().size() > 0) {
-    _internal_set_sender(from._internal_sender());
-  }
-  if (from.content().size() > 0) {
-    _internal_set_content(from._internal_content());
-  }
-  if (from.type() != 0) {
-    _internal_set_type(from._internal_type());
+  // uint64 message_id = 7;
+  if (this->_internal_message_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_message_id());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void IncomingMessageResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.IncomingMessageResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IncomingMessageResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    IncomingMessageResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IncomingMessageResponse::GetClassData() const { return &_class_data_; }
+
+
+void IncomingMessageResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IncomingMessageResponse*>(&to_msg);
+  auto& from = static_cast<const IncomingMessageResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.IncomingMessageResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_sender().empty()) {
+    _this->_internal_set_sender(from._internal_sender());
+  }
+  if (!from._internal_content().empty()) {
+    _this->_internal_set_content(from._internal_content());
+  }
+  if (!from._internal_room().empty()) {
+    _this->_internal_set_room(from._internal_room());
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_sender_id() != 0) {
+    _this->_internal_set_sender_id(from._internal_sender_id());
+  }
+  if (from._internal_message_id() != 0) {
+    _this->_internal_set_message_id(from._internal_message_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void IncomingMessageResponse::CopyFrom(const IncomingMessageResponse& from) {
@@ -1396,130 +2611,155 @@ bool IncomingMessageResponse::IsInitialized() const {
 
 void IncomingMessageResponse::InternalSwap(IncomingMessageResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  sender_.Swap(&other->sender_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  content_.Swap(&other->content_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(type_, other->type_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sender_, lhs_arena,
+      &other->_impl_.sender_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.room_, lhs_arena,
+      &other->_impl_.room_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(IncomingMessageResponse, _impl_.message_id_)
+      + sizeof(IncomingMessageResponse::_impl_.message_id_)
+      - PROTOBUF_FIELD_OFFSET(IncomingMessageResponse, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata IncomingMessageResponse::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[4]);
 }
 
-
 // ===================================================================
 
-void UserListRequest::InitAsDefaultInstance() {
-}
 class UserListRequest::_Internal {
  public:
 };
 
-UserListRequest::UserListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+UserListRequest::UserListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:chat.UserListRequest)
 }
 UserListRequest::UserListRequest(const UserListRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UserListRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_username().empty()) {
-    username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_username(),
-      GetArena());
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:chat.UserListRequest)
 }
 
-void UserListRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_UserListRequest_chat_2eproto.base);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void UserListRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 UserListRequest::~UserListRequest() {
   // @@protoc_insertion_point(destructor:chat.UserListRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void UserListRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  username_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void UserListRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
 }
 
-void UserListRequest::ArenaDtor(void* object) {
-  UserListRequest* _this = reinterpret_cast< UserListRequest* >(object);
-  (void)_this;
-}
-void UserListRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void UserListRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const UserListRequest& UserListRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UserListRequest_chat_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void UserListRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.UserListRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.username_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* UserListRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* UserListRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string username = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_username();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.UserListRequest.username"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.UserListRequest.username"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* UserListRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* UserListRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.UserListRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string username = 1;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1529,7 +2769,7 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.UserListRequest)
@@ -1540,58 +2780,39 @@ size_t UserListRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.UserListRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string username = 1;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_username());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UserListRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.UserListRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UserListRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UserListRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.UserListRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.UserListRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UserListRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UserListRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UserListRequest::GetClassData() const { return &_class_data_; }
 
-void UserListRequest::MergeFrom(const UserListRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.UserListRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void UserListRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UserListRequest*>(&to_msg);
+  auto& from = static_cast<const UserListRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.UserListRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.username().size() > 0) {
-    _internal_set_username(from._internal_username());
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
   }
-}
-
-void UserListRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.UserListRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void UserListRequest::CopyFrom(const UserListRequest& from) {
@@ -1607,90 +2828,95 @@ bool UserListRequest::IsInitialized() const {
 
 void UserListRequest::InternalSwap(UserListRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  username_.Swap(&other->username_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata UserListRequest::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[5]);
 }
 
-
 // ===================================================================
 
-void UserListResponse::InitAsDefaultInstance() {
-}
 class UserListResponse::_Internal {
  public:
 };
 
-UserListResponse::UserListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  users_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+UserListResponse::UserListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:chat.UserListResponse)
 }
 UserListResponse::UserListResponse(const UserListResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      users_(from.users_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UserListResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.users_){from._impl_.users_}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  type_ = from.type_;
+  _this->_impl_.type_ = from._impl_.type_;
   // @@protoc_insertion_point(copy_constructor:chat.UserListResponse)
 }
 
-void UserListResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_UserListResponse_chat_2eproto.base);
-  type_ = 0;
+inline void UserListResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.users_){arena}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 UserListResponse::~UserListResponse() {
   // @@protoc_insertion_point(destructor:chat.UserListResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void UserListResponse::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void UserListResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.users_.~RepeatedPtrField();
 }
 
-void UserListResponse::ArenaDtor(void* object) {
-  UserListResponse* _this = reinterpret_cast< UserListResponse* >(object);
-  (void)_this;
-}
-void UserListResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void UserListResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const UserListResponse& UserListResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UserListResponse_chat_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void UserListResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.UserListResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  users_.Clear();
-  type_ = 0;
+  _impl_.users_.Clear();
+  _impl_.type_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* UserListResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* UserListResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .chat.User users = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -1698,61 +2924,64 @@ const char* UserListResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPA
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .chat.UserListType type = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_type(static_cast<::chat::UserListType>(val));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* UserListResponse::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* UserListResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.UserListResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .chat.User users = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_users_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_users_size()); i < n; i++) {
+    const auto& repfield = this->_internal_users(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_users(i), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // .chat.UserListType type = 2;
-  if (this->type() != 0) {
+  if (this->_internal_type() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       2, this->_internal_type(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.UserListResponse)
@@ -1763,65 +2992,46 @@ size_t UserListResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.UserListResponse)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .chat.User users = 1;
   total_size += 1UL * this->_internal_users_size();
-  for (const auto& msg : this->users_) {
+  for (const auto& msg : this->_impl_.users_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // .chat.UserListType type = 2;
-  if (this->type() != 0) {
+  if (this->_internal_type() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UserListResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.UserListResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UserListResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UserListResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.UserListResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.UserListResponse)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UserListResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UserListResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UserListResponse::GetClassData() const { return &_class_data_; }
 
-void UserListResponse::MergeFrom(const UserListResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.UserListResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void UserListResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UserListResponse*>(&to_msg);
+  auto& from = static_cast<const UserListResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.UserListResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  users_.MergeFrom(from.users_);
-  if (from.type() != 0) {
-    _internal_set_type(from._internal_type());
+  _this->_impl_.users_.MergeFrom(from._impl_.users_);
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
   }
-}
-
-void UserListResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.UserListResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void UserListResponse::CopyFrom(const UserListResponse& from) {
@@ -1837,140 +3047,150 @@ bool UserListResponse::IsInitialized() const {
 
 void UserListResponse::InternalSwap(UserListResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  users_.InternalSwap(&other->users_);
-  swap(type_, other->type_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.users_.InternalSwap(&other->_impl_.users_);
+  swap(_impl_.type_, other->_impl_.type_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata UserListResponse::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[6]);
 }
 
-
 // ===================================================================
 
-void UpdateStatusRequest::InitAsDefaultInstance() {
-}
 class UpdateStatusRequest::_Internal {
  public:
 };
 
-UpdateStatusRequest::UpdateStatusRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+UpdateStatusRequest::UpdateStatusRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:chat.UpdateStatusRequest)
 }
 UpdateStatusRequest::UpdateStatusRequest(const UpdateStatusRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UpdateStatusRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.new_status_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_username().empty()) {
-    username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_username(),
-      GetArena());
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
   }
-  new_status_ = from.new_status_;
+  _this->_impl_.new_status_ = from._impl_.new_status_;
   // @@protoc_insertion_point(copy_constructor:chat.UpdateStatusRequest)
 }
 
-void UpdateStatusRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_UpdateStatusRequest_chat_2eproto.base);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  new_status_ = 0;
+inline void UpdateStatusRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.new_status_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 UpdateStatusRequest::~UpdateStatusRequest() {
   // @@protoc_insertion_point(destructor:chat.UpdateStatusRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void UpdateStatusRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  username_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void UpdateStatusRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
 }
 
-void UpdateStatusRequest::ArenaDtor(void* object) {
-  UpdateStatusRequest* _this = reinterpret_cast< UpdateStatusRequest* >(object);
-  (void)_this;
-}
-void UpdateStatusRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void UpdateStatusRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const UpdateStatusRequest& UpdateStatusRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UpdateStatusRequest_chat_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void UpdateStatusRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.UpdateStatusRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  new_status_ = 0;
+  _impl_.username_.ClearToEmpty();
+  _impl_.new_status_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* UpdateStatusRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* UpdateStatusRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string username = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_username();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.UpdateStatusRequest.username"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "chat.UpdateStatusRequest.username"));
+        } else
+          goto handle_unusual;
         continue;
       // .chat.UserStatus new_status = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_new_status(static_cast<::chat::UserStatus>(val));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* UpdateStatusRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* UpdateStatusRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.UpdateStatusRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string username = 1;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1980,14 +3200,14 @@ failure:
   }
 
   // .chat.UserStatus new_status = 2;
-  if (this->new_status() != 0) {
+  if (this->_internal_new_status() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       2, this->_internal_new_status(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.UpdateStatusRequest)
@@ -1998,67 +3218,48 @@ size_t UpdateStatusRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.UpdateStatusRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string username = 1;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_username());
   }
 
   // .chat.UserStatus new_status = 2;
-  if (this->new_status() != 0) {
+  if (this->_internal_new_status() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_new_status());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_new_status());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UpdateStatusRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.UpdateStatusRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UpdateStatusRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UpdateStatusRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.UpdateStatusRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.UpdateStatusRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UpdateStatusRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UpdateStatusRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UpdateStatusRequest::GetClassData() const { return &_class_data_; }
 
-void UpdateStatusRequest::MergeFrom(const UpdateStatusRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.UpdateStatusRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void UpdateStatusRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UpdateStatusRequest*>(&to_msg);
+  auto& from = static_cast<const UpdateStatusRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.UpdateStatusRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.username().size() > 0) {
-    _internal_set_username(from._internal_username());
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
   }
-  if (from.new_status() != 0) {
-    _internal_set_new_status(from._internal_new_status());
+  if (from._internal_new_status() != 0) {
+    _this->_internal_set_new_status(from._internal_new_status());
   }
-}
-
-void UpdateStatusRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.UpdateStatusRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void UpdateStatusRequest::CopyFrom(const UpdateStatusRequest& from) {
@@ -2074,991 +3275,7094 @@ bool UpdateStatusRequest::IsInitialized() const {
 
 void UpdateStatusRequest::InternalSwap(UpdateStatusRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  username_.Swap(&other->username_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(new_status_, other->new_status_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  swap(_impl_.new_status_, other->_impl_.new_status_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata UpdateStatusRequest::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[7]);
 }
 
-
 // ===================================================================
 
-void Request::InitAsDefaultInstance() {
-  ::chat::_Request_default_instance_.register_user_ = const_cast< ::chat::NewUserRequest*>(
-      ::chat::NewUserRequest::internal_default_instance());
-  ::chat::_Request_default_instance_.send_message_ = const_cast< ::chat::SendMessageRequest*>(
-      ::chat::SendMessageRequest::internal_default_instance());
-  ::chat::_Request_default_instance_.update_status_ = const_cast< ::chat::UpdateStatusRequest*>(
-      ::chat::UpdateStatusRequest::internal_default_instance());
-  ::chat::_Request_default_instance_.get_users_ = const_cast< ::chat::UserListRequest*>(
-      ::chat::UserListRequest::internal_default_instance());
-  ::chat::_Request_default_instance_.unregister_user_ = const_cast< ::chat::User*>(
-      ::chat::User::internal_default_instance());
-}
-class Request::_Internal {
+class RoomRequest::_Internal {
  public:
-  static const ::chat::NewUserRequest& register_user(const Request* msg);
-  static const ::chat::SendMessageRequest& send_message(const Request* msg);
-  static const ::chat::UpdateStatusRequest& update_status(const Request* msg);
-  static const ::chat::UserListRequest& get_users(const Request* msg);
-  static const ::chat::User& unregister_user(const Request* msg);
 };
 
-const ::chat::NewUserRequest&
-Request::_Internal::register_user(const Request* msg) {
-  return *msg->payload_.register_user_;
-}
-const ::chat::SendMessageRequest&
-Request::_Internal::send_message(const Request* msg) {
-  return *msg->payload_.send_message_;
-}
-const ::chat::UpdateStatusRequest&
-Request::_Internal::update_status(const Request* msg) {
-  return *msg->payload_.update_status_;
-}
-const ::chat::UserListRequest&
-Request::_Internal::get_users(const Request* msg) {
-  return *msg->payload_.get_users_;
-}
-const ::chat::User&
-Request::_Internal::unregister_user(const Request* msg) {
-  return *msg->payload_.unregister_user_;
-}
-void Request::set_allocated_register_user(::chat::NewUserRequest* register_user) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  clear_payload();
-  if (register_user) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(register_user);
-    if (message_arena != submessage_arena) {
-      register_user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, register_user, submessage_arena);
-    }
-    set_has_register_user();
-    payload_.register_user_ = register_user;
-  }
-  // @@protoc_insertion_point(field_set_allocated:chat.Request.register_user)
-}
-void Request::set_allocated_send_message(::chat::SendMessageRequest* send_message) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  clear_payload();
-  if (send_message) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(send_message);
-    if (message_arena != submessage_arena) {
-      send_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, send_message, submessage_arena);
-    }
-    set_has_send_message();
-    payload_.send_message_ = send_message;
-  }
-  // @@protoc_insertion_point(field_set_allocated:chat.Request.send_message)
-}
-void Request::set_allocated_update_status(::chat::UpdateStatusRequest* update_status) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  clear_payload();
-  if (update_status) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(update_status);
-    if (message_arena != submessage_arena) {
-      update_status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, update_status, submessage_arena);
-    }
-    set_has_update_status();
-    payload_.update_status_ = update_status;
-  }
-  // @@protoc_insertion_point(field_set_allocated:chat.Request.update_status)
-}
-void Request::set_allocated_get_users(::chat::UserListRequest* get_users) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  clear_payload();
-  if (get_users) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(get_users);
-    if (message_arena != submessage_arena) {
-      get_users = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, get_users, submessage_arena);
-    }
-    set_has_get_users();
-    payload_.get_users_ = get_users;
-  }
-  // @@protoc_insertion_point(field_set_allocated:chat.Request.get_users)
-}
-void Request::set_allocated_unregister_user(::chat::User* unregister_user) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  clear_payload();
-  if (unregister_user) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(unregister_user);
-    if (message_arena != submessage_arena) {
-      unregister_user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, unregister_user, submessage_arena);
-    }
-    set_has_unregister_user();
-    payload_.unregister_user_ = unregister_user;
-  }
-  // @@protoc_insertion_point(field_set_allocated:chat.Request.unregister_user)
-}
-Request::Request(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:chat.Request)
+RoomRequest::RoomRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.RoomRequest)
 }
-Request::Request(const Request& from)
+RoomRequest::RoomRequest(const RoomRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoomRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.room_){}
+    , decltype(_impl_.content_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  operation_ = from.operation_;
-  clear_has_payload();
-  switch (from.payload_case()) {
-    case kRegisterUser: {
-      _internal_mutable_register_user()->::chat::NewUserRequest::MergeFrom(from._internal_register_user());
-      break;
-    }
-    case kSendMessage: {
-      _internal_mutable_send_message()->::chat::SendMessageRequest::MergeFrom(from._internal_send_message());
-      break;
-    }
-    case kUpdateStatus: {
-      _internal_mutable_update_status()->::chat::UpdateStatusRequest::MergeFrom(from._internal_update_status());
-      break;
-    }
-    case kGetUsers: {
-      _internal_mutable_get_users()->::chat::UserListRequest::MergeFrom(from._internal_get_users());
-      break;
-    }
-    case kUnregisterUser: {
-      _internal_mutable_unregister_user()->::chat::User::MergeFrom(from._internal_unregister_user());
-      break;
-    }
-    case PAYLOAD_NOT_SET: {
-      break;
-    }
+  _impl_.room_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.room_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_room().empty()) {
+    _this->_impl_.room_.Set(from._internal_room(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:chat.Request)
-}
-
-void Request::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Request_chat_2eproto.base);
-  operation_ = 0;
-  clear_has_payload();
-}
-
-Request::~Request() {
-  // @@protoc_insertion_point(destructor:chat.Request)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void Request::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (has_payload()) {
-    clear_payload();
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_content().empty()) {
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
   }
+  // @@protoc_insertion_point(copy_constructor:chat.RoomRequest)
+}
+
+inline void RoomRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.room_){}
+    , decltype(_impl_.content_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.room_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.room_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RoomRequest::~RoomRequest() {
+  // @@protoc_insertion_point(destructor:chat.RoomRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-void Request::ArenaDtor(void* object) {
-  Request* _this = reinterpret_cast< Request* >(object);
-  (void)_this;
-}
-void Request::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void Request::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Request& Request::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Request_chat_2eproto.base);
-  return *internal_default_instance();
+inline void RoomRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.room_.Destroy();
+  _impl_.content_.Destroy();
 }
 
-
-void Request::clear_payload() {
-// @@protoc_insertion_point(one_of_clear_start:chat.Request)
-  switch (payload_case()) {
-    case kRegisterUser: {
-      if (GetArena() == nullptr) {
-        delete payload_.register_user_;
-      }
-      break;
-    }
-    case kSendMessage: {
-      if (GetArena() == nullptr) {
-        delete payload_.send_message_;
-      }
-      break;
-    }
-    case kUpdateStatus: {
-      if (GetArena() == nullptr) {
-        delete payload_.update_status_;
-      }
-      break;
-    }
-    case kGetUsers: {
-      if (GetArena() == nullptr) {
-        delete payload_.get_users_;
-      }
-      break;
-    }
-    case kUnregisterUser: {
-      if (GetArena() == nullptr) {
-        delete payload_.unregister_user_;
-      }
-      break;
-    }
-    case PAYLOAD_NOT_SET: {
-      break;
-    }
-  }
-  _oneof_case_[0] = PAYLOAD_NOT_SET;
+void RoomRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void Request::Clear() {
-// @@protoc_insertion_point(message_clear_start:chat.Request)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void RoomRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.RoomRequest)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  operation_ = 0;
-  clear_payload();
+  _impl_.room_.ClearToEmpty();
+  _impl_.content_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Request::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* RoomRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .chat.Operation operation = 1;
+      // string room = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_room();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          _internal_set_operation(static_cast<::chat::Operation>(val));
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "chat.RoomRequest.room"));
+        } else
+          goto handle_unusual;
         continue;
-      // .chat.NewUserRequest register_user = 2;
+      // string content = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_register_user(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "chat.RoomRequest.content"));
+        } else
+          goto handle_unusual;
         continue;
-      // .chat.SendMessageRequest send_message = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_send_message(), ptr);
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RoomRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.RoomRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string room = 1;
+  if (!this->_internal_room().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_room().data(), static_cast<int>(this->_internal_room().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.RoomRequest.room");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_room(), target);
+  }
+
+  // string content = 2;
+  if (!this->_internal_content().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_content().data(), static_cast<int>(this->_internal_content().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.RoomRequest.content");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_content(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.RoomRequest)
+  return target;
+}
+
+size_t RoomRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.RoomRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string room = 1;
+  if (!this->_internal_room().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_room());
+  }
+
+  // string content = 2;
+  if (!this->_internal_content().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_content());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoomRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomRequest::GetClassData() const { return &_class_data_; }
+
+
+void RoomRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoomRequest*>(&to_msg);
+  auto& from = static_cast<const RoomRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.RoomRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_room().empty()) {
+    _this->_internal_set_room(from._internal_room());
+  }
+  if (!from._internal_content().empty()) {
+    _this->_internal_set_content(from._internal_content());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RoomRequest::CopyFrom(const RoomRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.RoomRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RoomRequest::IsInitialized() const {
+  return true;
+}
+
+void RoomRequest::InternalSwap(RoomRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.room_, lhs_arena,
+      &other->_impl_.room_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoomRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[8]);
+}
+
+// ===================================================================
+
+class HistoryRequest::_Internal {
+ public:
+};
+
+HistoryRequest::HistoryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.HistoryRequest)
+}
+HistoryRequest::HistoryRequest(const HistoryRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HistoryRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.conversation_){}
+    , decltype(_impl_.sender_){}
+    , decltype(_impl_.since_){}
+    , decltype(_impl_.until_){}
+    , decltype(_impl_.limit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.conversation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.conversation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_conversation().empty()) {
+    _this->_impl_.conversation_.Set(from._internal_conversation(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_sender().empty()) {
+    _this->_impl_.sender_.Set(from._internal_sender(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.since_, &from._impl_.since_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.limit_) -
+    reinterpret_cast<char*>(&_impl_.since_)) + sizeof(_impl_.limit_));
+  // @@protoc_insertion_point(copy_constructor:chat.HistoryRequest)
+}
+
+inline void HistoryRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.conversation_){}
+    , decltype(_impl_.sender_){}
+    , decltype(_impl_.since_){int64_t{0}}
+    , decltype(_impl_.until_){int64_t{0}}
+    , decltype(_impl_.limit_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.conversation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.conversation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+HistoryRequest::~HistoryRequest() {
+  // @@protoc_insertion_point(destructor:chat.HistoryRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HistoryRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.conversation_.Destroy();
+  _impl_.sender_.Destroy();
+}
+
+void HistoryRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HistoryRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.HistoryRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.conversation_.ClearToEmpty();
+  _impl_.sender_.ClearToEmpty();
+  ::memset(&_impl_.since_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.limit_) -
+      reinterpret_cast<char*>(&_impl_.since_)) + sizeof(_impl_.limit_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HistoryRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string conversation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_conversation();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "chat.HistoryRequest.conversation"));
+        } else
+          goto handle_unusual;
         continue;
-      // .chat.UpdateStatusRequest update_status = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_update_status(), ptr);
+      // int64 since = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.since_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // .chat.UserListRequest get_users = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          ptr = ctx->ParseMessage(_internal_mutable_get_users(), ptr);
+      // int64 until = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.until_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // .chat.User unregister_user = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
-          ptr = ctx->ParseMessage(_internal_mutable_unregister_user(), ptr);
+      // uint32 limit = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // string sender = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_sender();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.HistoryRequest.sender"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Request::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:chat.Request)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* HistoryRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.HistoryRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .chat.Operation operation = 1;
-  if (this->operation() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_operation(), target);
-  }
-
-  // .chat.NewUserRequest register_user = 2;
-  if (_internal_has_register_user()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::register_user(this), target, stream);
+  // string conversation = 1;
+  if (!this->_internal_conversation().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_conversation().data(), static_cast<int>(this->_internal_conversation().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.HistoryRequest.conversation");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_conversation(), target);
   }
 
-  // .chat.SendMessageRequest send_message = 3;
-  if (_internal_has_send_message()) {
+  // int64 since = 2;
+  if (this->_internal_since() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::send_message(this), target, stream);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_since(), target);
   }
 
-  // .chat.UpdateStatusRequest update_status = 4;
-  if (_internal_has_update_status()) {
+  // int64 until = 3;
+  if (this->_internal_until() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::update_status(this), target, stream);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_until(), target);
   }
 
-  // .chat.UserListRequest get_users = 5;
-  if (_internal_has_get_users()) {
+  // uint32 limit = 4;
+  if (this->_internal_limit() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        5, _Internal::get_users(this), target, stream);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_limit(), target);
   }
 
-  // .chat.User unregister_user = 6;
-  if (_internal_has_unregister_user()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        6, _Internal::unregister_user(this), target, stream);
+  // string sender = 5;
+  if (!this->_internal_sender().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_sender().data(), static_cast<int>(this->_internal_sender().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.HistoryRequest.sender");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_sender(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:chat.Request)
+  // @@protoc_insertion_point(serialize_to_array_end:chat.HistoryRequest)
   return target;
 }
 
-size_t Request::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:chat.Request)
+size_t HistoryRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.HistoryRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .chat.Operation operation = 1;
-  if (this->operation() != 0) {
+  // string conversation = 1;
+  if (!this->_internal_conversation().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_operation());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_conversation());
   }
 
-  switch (payload_case()) {
-    // .chat.NewUserRequest register_user = 2;
-    case kRegisterUser: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *payload_.register_user_);
-      break;
-    }
-    // .chat.SendMessageRequest send_message = 3;
-    case kSendMessage: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *payload_.send_message_);
-      break;
-    }
-    // .chat.UpdateStatusRequest update_status = 4;
-    case kUpdateStatus: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *payload_.update_status_);
-      break;
-    }
-    // .chat.UserListRequest get_users = 5;
-    case kGetUsers: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *payload_.get_users_);
-      break;
-    }
-    // .chat.User unregister_user = 6;
-    case kUnregisterUser: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *payload_.unregister_user_);
-      break;
-    }
-    case PAYLOAD_NOT_SET: {
-      break;
-    }
+  // string sender = 5;
+  if (!this->_internal_sender().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_sender());
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+
+  // int64 since = 2;
+  if (this->_internal_since() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_since());
+  }
+
+  // int64 until = 3;
+  if (this->_internal_until() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_until());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void Request::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.Request)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Request* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Request>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.Request)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.Request)
-    MergeFrom(*source);
+  // uint32 limit = 4;
+  if (this->_internal_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_limit());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Request::MergeFrom(const Request& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.Request)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HistoryRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HistoryRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HistoryRequest::GetClassData() const { return &_class_data_; }
+
+
+void HistoryRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HistoryRequest*>(&to_msg);
+  auto& from = static_cast<const HistoryRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.HistoryRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.operation() != 0) {
-    _internal_set_operation(from._internal_operation());
+  if (!from._internal_conversation().empty()) {
+    _this->_internal_set_conversation(from._internal_conversation());
   }
-  switch (from.payload_case()) {
-    case kRegisterUser: {
-      _internal_mutable_register_user()->::chat::NewUserRequest::MergeFrom(from._internal_register_user());
-      break;
-    }
-    case kSendMessage: {
-      _internal_mutable_send_message()->::chat::SendMessageRequest::MergeFrom(from._internal_send_message());
-      break;
-    }
-    case kUpdateStatus: {
-      _internal_mutable_update_status()->::chat::UpdateStatusRequest::MergeFrom(from._internal_update_status());
-      break;
-    }
-    case kGetUsers: {
-      _internal_mutable_get_users()->::chat::UserListRequest::MergeFrom(from._internal_get_users());
-      break;
-    }
-    case kUnregisterUser: {
-      _internal_mutable_unregister_user()->::chat::User::MergeFrom(from._internal_unregister_user());
-      break;
-    }
-    case PAYLOAD_NOT_SET: {
-      break;
-    }
+  if (!from._internal_sender().empty()) {
+    _this->_internal_set_sender(from._internal_sender());
   }
+  if (from._internal_since() != 0) {
+    _this->_internal_set_since(from._internal_since());
+  }
+  if (from._internal_until() != 0) {
+    _this->_internal_set_until(from._internal_until());
+  }
+  if (from._internal_limit() != 0) {
+    _this->_internal_set_limit(from._internal_limit());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Request::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.Request)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Request::CopyFrom(const Request& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:chat.Request)
+void HistoryRequest::CopyFrom(const HistoryRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.HistoryRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Request::IsInitialized() const {
+bool HistoryRequest::IsInitialized() const {
   return true;
 }
 
-void Request::InternalSwap(Request* other) {
+void HistoryRequest::InternalSwap(HistoryRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(operation_, other->operation_);
-  swap(payload_, other->payload_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.conversation_, lhs_arena,
+      &other->_impl_.conversation_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sender_, lhs_arena,
+      &other->_impl_.sender_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HistoryRequest, _impl_.limit_)
+      + sizeof(HistoryRequest::_impl_.limit_)
+      - PROTOBUF_FIELD_OFFSET(HistoryRequest, _impl_.since_)>(
+          reinterpret_cast<char*>(&_impl_.since_),
+          reinterpret_cast<char*>(&other->_impl_.since_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Request::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata HistoryRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[9]);
 }
 
-
 // ===================================================================
 
-void Response::InitAsDefaultInstance() {
-  ::chat::_Response_default_instance_.user_list_ = const_cast< ::chat::UserListResponse*>(
-      ::chat::UserListResponse::internal_default_instance());
-  ::chat::_Response_default_instance_.incoming_message_ = const_cast< ::chat::IncomingMessageResponse*>(
-      ::chat::IncomingMessageResponse::internal_default_instance());
-}
-class Response::_Internal {
+class Receipts::_Internal {
  public:
-  static const ::chat::UserListResponse& user_list(const Response* msg);
-  static const ::chat::IncomingMessageResponse& incoming_message(const Response* msg);
 };
 
-const ::chat::UserListResponse&
-Response::_Internal::user_list(const Response* msg) {
-  return *msg->result_.user_list_;
+Receipts::Receipts(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.Receipts)
 }
-const ::chat::IncomingMessageResponse&
-Response::_Internal::incoming_message(const Response* msg) {
-  return *msg->result_.incoming_message_;
+Receipts::Receipts(const Receipts& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Receipts* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.delivered_){from._impl_.delivered_}
+    , /*decltype(_impl_._delivered_cached_byte_size_)*/{0}
+    , decltype(_impl_.read_){from._impl_.read_}
+    , /*decltype(_impl_._read_cached_byte_size_)*/{0}
+    , decltype(_impl_.received_seq_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.received_seq_ = from._impl_.received_seq_;
+  // @@protoc_insertion_point(copy_constructor:chat.Receipts)
+}
+
+inline void Receipts::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.delivered_){arena}
+    , /*decltype(_impl_._delivered_cached_byte_size_)*/{0}
+    , decltype(_impl_.read_){arena}
+    , /*decltype(_impl_._read_cached_byte_size_)*/{0}
+    , decltype(_impl_.received_seq_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Receipts::~Receipts() {
+  // @@protoc_insertion_point(destructor:chat.Receipts)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-void Response::set_allocated_user_list(::chat::UserListResponse* user_list) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  clear_result();
-  if (user_list) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(user_list);
-    if (message_arena != submessage_arena) {
-      user_list = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, user_list, submessage_arena);
+
+inline void Receipts::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.delivered_.~RepeatedField();
+  _impl_.read_.~RepeatedField();
+}
+
+void Receipts::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Receipts::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.Receipts)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.delivered_.Clear();
+  _impl_.read_.Clear();
+  _impl_.received_seq_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Receipts::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint64 delivered = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_delivered(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_delivered(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 read = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_read(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_read(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 received_seq = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.received_seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Receipts::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.Receipts)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint64 delivered = 1;
+  {
+    int byte_size = _impl_._delivered_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          1, _internal_delivered(), byte_size, target);
     }
-    set_has_user_list();
-    result_.user_list_ = user_list;
   }
-  // @@protoc_insertion_point(field_set_allocated:chat.Response.user_list)
+
+  // repeated uint64 read = 2;
+  {
+    int byte_size = _impl_._read_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          2, _internal_read(), byte_size, target);
+    }
+  }
+
+  // uint64 received_seq = 3;
+  if (this->_internal_received_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_received_seq(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.Receipts)
+  return target;
 }
-void Response::set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  clear_result();
-  if (incoming_message) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(incoming_message);
-    if (message_arena != submessage_arena) {
-      incoming_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, incoming_message, submessage_arena);
+
+size_t Receipts::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.Receipts)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 delivered = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.delivered_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    set_has_incoming_message();
-    result_.incoming_message_ = incoming_message;
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._delivered_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
-  // @@protoc_insertion_point(field_set_allocated:chat.Response.incoming_message)
+
+  // repeated uint64 read = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.read_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._read_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // uint64 received_seq = 3;
+  if (this->_internal_received_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_received_seq());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
-Response::Response(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:chat.Response)
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Receipts::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Receipts::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Receipts::GetClassData() const { return &_class_data_; }
+
+
+void Receipts::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Receipts*>(&to_msg);
+  auto& from = static_cast<const Receipts&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.Receipts)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.delivered_.MergeFrom(from._impl_.delivered_);
+  _this->_impl_.read_.MergeFrom(from._impl_.read_);
+  if (from._internal_received_seq() != 0) {
+    _this->_internal_set_received_seq(from._internal_received_seq());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-Response::Response(const Response& from)
+
+void Receipts::CopyFrom(const Receipts& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.Receipts)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Receipts::IsInitialized() const {
+  return true;
+}
+
+void Receipts::InternalSwap(Receipts* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.delivered_.InternalSwap(&other->_impl_.delivered_);
+  _impl_.read_.InternalSwap(&other->_impl_.read_);
+  swap(_impl_.received_seq_, other->_impl_.received_seq_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Receipts::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[10]);
+}
+
+// ===================================================================
+
+class BatchRequest::_Internal {
+ public:
+};
+
+BatchRequest::BatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.BatchRequest)
+}
+BatchRequest::BatchRequest(const BatchRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.requests_){from._impl_.requests_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  message_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_message().empty()) {
-    message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_message(),
-      GetArena());
+  // @@protoc_insertion_point(copy_constructor:chat.BatchRequest)
+}
+
+inline void BatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.requests_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BatchRequest::~BatchRequest() {
+  // @@protoc_insertion_point(destructor:chat.BatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  ::memcpy(&operation_, &from.operation_,
-    static_cast<size_t>(reinterpret_cast<char*>(&status_code_) -
-    reinterpret_cast<char*>(&operation_)) + sizeof(status_code_));
-  clear_has_result();
-  switch (from.result_case()) {
-    case kUserList: {
-      _internal_mutable_user_list()->::chat::UserListResponse::MergeFrom(from._internal_user_list());
-      break;
-    }
-    case kIncomingMessage: {
-      _internal_mutable_incoming_message()->::chat::IncomingMessageResponse::MergeFrom(from._internal_incoming_message());
-      break;
+  SharedDtor();
+}
+
+inline void BatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.requests_.~RepeatedPtrField();
+}
+
+void BatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.BatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.requests_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chat.Request requests = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_requests(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-    case RESULT_NOT_SET: {
-      break;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.BatchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chat.Request requests = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_requests_size()); i < n; i++) {
+    const auto& repfield = this->_internal_requests(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.BatchRequest)
+  return target;
+}
+
+size_t BatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.BatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.Request requests = 1;
+  total_size += 1UL * this->_internal_requests_size();
+  for (const auto& msg : this->_impl_.requests_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchRequest::GetClassData() const { return &_class_data_; }
+
+
+void BatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchRequest*>(&to_msg);
+  auto& from = static_cast<const BatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.BatchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.requests_.MergeFrom(from._impl_.requests_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchRequest::CopyFrom(const BatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.BatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchRequest::IsInitialized() const {
+  return true;
+}
+
+void BatchRequest::InternalSwap(BatchRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.requests_.InternalSwap(&other->_impl_.requests_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[11]);
+}
+
+// ===================================================================
+
+class BatchResponse::_Internal {
+ public:
+};
+
+BatchResponse::BatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.BatchResponse)
+}
+BatchResponse::BatchResponse(const BatchResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.responses_){from._impl_.responses_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chat.BatchResponse)
+}
+
+inline void BatchResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.responses_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BatchResponse::~BatchResponse() {
+  // @@protoc_insertion_point(destructor:chat.BatchResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.responses_.~RepeatedPtrField();
+}
+
+void BatchResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.BatchResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.responses_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chat.Response responses = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_responses(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.BatchResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chat.Response responses = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_responses_size()); i < n; i++) {
+    const auto& repfield = this->_internal_responses(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
-  // @@protoc_insertion_point(copy_constructor:chat.Response)
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.BatchResponse)
+  return target;
+}
+
+size_t BatchResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.BatchResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.Response responses = 1;
+  total_size += 1UL * this->_internal_responses_size();
+  for (const auto& msg : this->_impl_.responses_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchResponse::GetClassData() const { return &_class_data_; }
+
+
+void BatchResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchResponse*>(&to_msg);
+  auto& from = static_cast<const BatchResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.BatchResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.responses_.MergeFrom(from._impl_.responses_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchResponse::CopyFrom(const BatchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.BatchResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchResponse::IsInitialized() const {
+  return true;
+}
+
+void BatchResponse::InternalSwap(BatchResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.responses_.InternalSwap(&other->_impl_.responses_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[12]);
+}
+
+// ===================================================================
+
+class HistoryResponse::_Internal {
+ public:
+};
+
+HistoryResponse::HistoryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.HistoryResponse)
+}
+HistoryResponse::HistoryResponse(const HistoryResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HistoryResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){from._impl_.messages_}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.last_page_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.page_, &from._impl_.page_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.last_page_) -
+    reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.last_page_));
+  // @@protoc_insertion_point(copy_constructor:chat.HistoryResponse)
+}
+
+inline void HistoryResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){arena}
+    , decltype(_impl_.page_){0u}
+    , decltype(_impl_.last_page_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+HistoryResponse::~HistoryResponse() {
+  // @@protoc_insertion_point(destructor:chat.HistoryResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HistoryResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messages_.~RepeatedPtrField();
+}
+
+void HistoryResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HistoryResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.HistoryResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.messages_.Clear();
+  ::memset(&_impl_.page_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.last_page_) -
+      reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.last_page_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HistoryResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chat.IncomingMessageResponse messages = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_messages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 page = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.page_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool last_page = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.last_page_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HistoryResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.HistoryResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chat.IncomingMessageResponse messages = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_messages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_messages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint32 page = 2;
+  if (this->_internal_page() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_page(), target);
+  }
+
+  // bool last_page = 3;
+  if (this->_internal_last_page() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_last_page(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.HistoryResponse)
+  return target;
+}
+
+size_t HistoryResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.HistoryResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.IncomingMessageResponse messages = 1;
+  total_size += 1UL * this->_internal_messages_size();
+  for (const auto& msg : this->_impl_.messages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint32 page = 2;
+  if (this->_internal_page() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_page());
+  }
+
+  // bool last_page = 3;
+  if (this->_internal_last_page() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HistoryResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HistoryResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HistoryResponse::GetClassData() const { return &_class_data_; }
+
+
+void HistoryResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HistoryResponse*>(&to_msg);
+  auto& from = static_cast<const HistoryResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.HistoryResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
+  if (from._internal_page() != 0) {
+    _this->_internal_set_page(from._internal_page());
+  }
+  if (from._internal_last_page() != 0) {
+    _this->_internal_set_last_page(from._internal_last_page());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HistoryResponse::CopyFrom(const HistoryResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.HistoryResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HistoryResponse::IsInitialized() const {
+  return true;
+}
+
+void HistoryResponse::InternalSwap(HistoryResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HistoryResponse, _impl_.last_page_)
+      + sizeof(HistoryResponse::_impl_.last_page_)
+      - PROTOBUF_FIELD_OFFSET(HistoryResponse, _impl_.page_)>(
+          reinterpret_cast<char*>(&_impl_.page_),
+          reinterpret_cast<char*>(&other->_impl_.page_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HistoryResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[13]);
+}
+
+// ===================================================================
+
+class StoredMessage::_Internal {
+ public:
+  static const ::chat::IncomingMessageResponse& message(const StoredMessage* msg);
+};
+
+const ::chat::IncomingMessageResponse&
+StoredMessage::_Internal::message(const StoredMessage* msg) {
+  return *msg->_impl_.message_;
+}
+StoredMessage::StoredMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.StoredMessage)
+}
+StoredMessage::StoredMessage(const StoredMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StoredMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.conversation_){}
+    , decltype(_impl_.message_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.conversation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.conversation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_conversation().empty()) {
+    _this->_impl_.conversation_.Set(from._internal_conversation(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::chat::IncomingMessageResponse(*from._impl_.message_);
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.StoredMessage)
+}
+
+inline void StoredMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.conversation_){}
+    , decltype(_impl_.message_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.conversation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.conversation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+StoredMessage::~StoredMessage() {
+  // @@protoc_insertion_point(destructor:chat.StoredMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StoredMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.conversation_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.message_;
+}
+
+void StoredMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StoredMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.StoredMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.conversation_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.message_ != nullptr) {
+    delete _impl_.message_;
+  }
+  _impl_.message_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StoredMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string conversation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_conversation();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.StoredMessage.conversation"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.IncomingMessageResponse message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StoredMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.StoredMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string conversation = 1;
+  if (!this->_internal_conversation().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_conversation().data(), static_cast<int>(this->_internal_conversation().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.StoredMessage.conversation");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_conversation(), target);
+  }
+
+  // .chat.IncomingMessageResponse message = 2;
+  if (this->_internal_has_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.StoredMessage)
+  return target;
+}
+
+size_t StoredMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.StoredMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string conversation = 1;
+  if (!this->_internal_conversation().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_conversation());
+  }
+
+  // .chat.IncomingMessageResponse message = 2;
+  if (this->_internal_has_message()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.message_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StoredMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StoredMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StoredMessage::GetClassData() const { return &_class_data_; }
+
+
+void StoredMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StoredMessage*>(&to_msg);
+  auto& from = static_cast<const StoredMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.StoredMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_conversation().empty()) {
+    _this->_internal_set_conversation(from._internal_conversation());
+  }
+  if (from._internal_has_message()) {
+    _this->_internal_mutable_message()->::chat::IncomingMessageResponse::MergeFrom(
+        from._internal_message());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StoredMessage::CopyFrom(const StoredMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.StoredMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StoredMessage::IsInitialized() const {
+  return true;
+}
+
+void StoredMessage::InternalSwap(StoredMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.conversation_, lhs_arena,
+      &other->_impl_.conversation_, rhs_arena
+  );
+  swap(_impl_.message_, other->_impl_.message_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StoredMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[14]);
+}
+
+// ===================================================================
+
+class Request::_Internal {
+ public:
+  static const ::chat::NewUserRequest& register_user(const Request* msg);
+  static const ::chat::SendMessageRequest& send_message(const Request* msg);
+  static const ::chat::UpdateStatusRequest& update_status(const Request* msg);
+  static const ::chat::UserListRequest& get_users(const Request* msg);
+  static const ::chat::User& unregister_user(const Request* msg);
+  static const ::chat::HistoryRequest& get_history(const Request* msg);
+  static const ::chat::RoomRequest& room(const Request* msg);
+  static const ::chat::BatchRequest& batch(const Request* msg);
+  static const ::chat::Receipts& acknowledge(const Request* msg);
+  static const ::chat::ResumeRequest& resume(const Request* msg);
+};
+
+const ::chat::NewUserRequest&
+Request::_Internal::register_user(const Request* msg) {
+  return *msg->_impl_.payload_.register_user_;
+}
+const ::chat::SendMessageRequest&
+Request::_Internal::send_message(const Request* msg) {
+  return *msg->_impl_.payload_.send_message_;
+}
+const ::chat::UpdateStatusRequest&
+Request::_Internal::update_status(const Request* msg) {
+  return *msg->_impl_.payload_.update_status_;
+}
+const ::chat::UserListRequest&
+Request::_Internal::get_users(const Request* msg) {
+  return *msg->_impl_.payload_.get_users_;
+}
+const ::chat::User&
+Request::_Internal::unregister_user(const Request* msg) {
+  return *msg->_impl_.payload_.unregister_user_;
+}
+const ::chat::HistoryRequest&
+Request::_Internal::get_history(const Request* msg) {
+  return *msg->_impl_.payload_.get_history_;
+}
+const ::chat::RoomRequest&
+Request::_Internal::room(const Request* msg) {
+  return *msg->_impl_.payload_.room_;
+}
+const ::chat::BatchRequest&
+Request::_Internal::batch(const Request* msg) {
+  return *msg->_impl_.payload_.batch_;
+}
+const ::chat::Receipts&
+Request::_Internal::acknowledge(const Request* msg) {
+  return *msg->_impl_.payload_.acknowledge_;
+}
+const ::chat::ResumeRequest&
+Request::_Internal::resume(const Request* msg) {
+  return *msg->_impl_.payload_.resume_;
+}
+void Request::set_allocated_register_user(::chat::NewUserRequest* register_user) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (register_user) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(register_user);
+    if (message_arena != submessage_arena) {
+      register_user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, register_user, submessage_arena);
+    }
+    set_has_register_user();
+    _impl_.payload_.register_user_ = register_user;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.register_user)
+}
+void Request::set_allocated_send_message(::chat::SendMessageRequest* send_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (send_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(send_message);
+    if (message_arena != submessage_arena) {
+      send_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, send_message, submessage_arena);
+    }
+    set_has_send_message();
+    _impl_.payload_.send_message_ = send_message;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.send_message)
+}
+void Request::set_allocated_update_status(::chat::UpdateStatusRequest* update_status) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (update_status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(update_status);
+    if (message_arena != submessage_arena) {
+      update_status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, update_status, submessage_arena);
+    }
+    set_has_update_status();
+    _impl_.payload_.update_status_ = update_status;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.update_status)
+}
+void Request::set_allocated_get_users(::chat::UserListRequest* get_users) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (get_users) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(get_users);
+    if (message_arena != submessage_arena) {
+      get_users = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, get_users, submessage_arena);
+    }
+    set_has_get_users();
+    _impl_.payload_.get_users_ = get_users;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.get_users)
+}
+void Request::set_allocated_unregister_user(::chat::User* unregister_user) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (unregister_user) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(unregister_user);
+    if (message_arena != submessage_arena) {
+      unregister_user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, unregister_user, submessage_arena);
+    }
+    set_has_unregister_user();
+    _impl_.payload_.unregister_user_ = unregister_user;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.unregister_user)
+}
+void Request::set_allocated_get_history(::chat::HistoryRequest* get_history) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (get_history) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(get_history);
+    if (message_arena != submessage_arena) {
+      get_history = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, get_history, submessage_arena);
+    }
+    set_has_get_history();
+    _impl_.payload_.get_history_ = get_history;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.get_history)
+}
+void Request::set_allocated_room(::chat::RoomRequest* room) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (room) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(room);
+    if (message_arena != submessage_arena) {
+      room = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, room, submessage_arena);
+    }
+    set_has_room();
+    _impl_.payload_.room_ = room;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.room)
+}
+void Request::set_allocated_batch(::chat::BatchRequest* batch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (batch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(batch);
+    if (message_arena != submessage_arena) {
+      batch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, batch, submessage_arena);
+    }
+    set_has_batch();
+    _impl_.payload_.batch_ = batch;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.batch)
+}
+void Request::set_allocated_acknowledge(::chat::Receipts* acknowledge) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (acknowledge) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(acknowledge);
+    if (message_arena != submessage_arena) {
+      acknowledge = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, acknowledge, submessage_arena);
+    }
+    set_has_acknowledge();
+    _impl_.payload_.acknowledge_ = acknowledge;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.acknowledge)
+}
+void Request::set_allocated_resume(::chat::ResumeRequest* resume) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (resume) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(resume);
+    if (message_arena != submessage_arena) {
+      resume = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, resume, submessage_arena);
+    }
+    set_has_resume();
+    _impl_.payload_.resume_ = resume;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.resume)
+}
+Request::Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.Request)
+}
+Request::Request(const Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operation_){}
+    , decltype(_impl_.payload_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.operation_ = from._impl_.operation_;
+  clear_has_payload();
+  switch (from.payload_case()) {
+    case kRegisterUser: {
+      _this->_internal_mutable_register_user()->::chat::NewUserRequest::MergeFrom(
+          from._internal_register_user());
+      break;
+    }
+    case kSendMessage: {
+      _this->_internal_mutable_send_message()->::chat::SendMessageRequest::MergeFrom(
+          from._internal_send_message());
+      break;
+    }
+    case kUpdateStatus: {
+      _this->_internal_mutable_update_status()->::chat::UpdateStatusRequest::MergeFrom(
+          from._internal_update_status());
+      break;
+    }
+    case kGetUsers: {
+      _this->_internal_mutable_get_users()->::chat::UserListRequest::MergeFrom(
+          from._internal_get_users());
+      break;
+    }
+    case kUnregisterUser: {
+      _this->_internal_mutable_unregister_user()->::chat::User::MergeFrom(
+          from._internal_unregister_user());
+      break;
+    }
+    case kGetHistory: {
+      _this->_internal_mutable_get_history()->::chat::HistoryRequest::MergeFrom(
+          from._internal_get_history());
+      break;
+    }
+    case kRoom: {
+      _this->_internal_mutable_room()->::chat::RoomRequest::MergeFrom(
+          from._internal_room());
+      break;
+    }
+    case kBatch: {
+      _this->_internal_mutable_batch()->::chat::BatchRequest::MergeFrom(
+          from._internal_batch());
+      break;
+    }
+    case kAcknowledge: {
+      _this->_internal_mutable_acknowledge()->::chat::Receipts::MergeFrom(
+          from._internal_acknowledge());
+      break;
+    }
+    case kResume: {
+      _this->_internal_mutable_resume()->::chat::ResumeRequest::MergeFrom(
+          from._internal_resume());
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.Request)
+}
+
+inline void Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operation_){0}
+    , decltype(_impl_.payload_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_payload();
+}
+
+Request::~Request() {
+  // @@protoc_insertion_point(destructor:chat.Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_payload()) {
+    clear_payload();
+  }
+}
+
+void Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Request::clear_payload() {
+// @@protoc_insertion_point(one_of_clear_start:chat.Request)
+  switch (payload_case()) {
+    case kRegisterUser: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.register_user_;
+      }
+      break;
+    }
+    case kSendMessage: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.send_message_;
+      }
+      break;
+    }
+    case kUpdateStatus: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.update_status_;
+      }
+      break;
+    }
+    case kGetUsers: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.get_users_;
+      }
+      break;
+    }
+    case kUnregisterUser: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.unregister_user_;
+      }
+      break;
+    }
+    case kGetHistory: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.get_history_;
+      }
+      break;
+    }
+    case kRoom: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.room_;
+      }
+      break;
+    }
+    case kBatch: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.batch_;
+      }
+      break;
+    }
+    case kAcknowledge: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.acknowledge_;
+      }
+      break;
+    }
+    case kResume: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.resume_;
+      }
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = PAYLOAD_NOT_SET;
+}
+
+
+void Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.operation_ = 0;
+  clear_payload();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .chat.Operation operation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_operation(static_cast<::chat::Operation>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.NewUserRequest register_user = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_register_user(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.SendMessageRequest send_message = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_send_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UpdateStatusRequest update_status = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_update_status(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserListRequest get_users = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_get_users(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.User unregister_user = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_unregister_user(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.HistoryRequest get_history = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_get_history(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.RoomRequest room = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_room(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.BatchRequest batch = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_batch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.Receipts acknowledge = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_acknowledge(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.ResumeRequest resume = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_resume(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .chat.Operation operation = 1;
+  if (this->_internal_operation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_operation(), target);
+  }
+
+  // .chat.NewUserRequest register_user = 2;
+  if (_internal_has_register_user()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::register_user(this),
+        _Internal::register_user(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.SendMessageRequest send_message = 3;
+  if (_internal_has_send_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::send_message(this),
+        _Internal::send_message(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.UpdateStatusRequest update_status = 4;
+  if (_internal_has_update_status()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::update_status(this),
+        _Internal::update_status(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.UserListRequest get_users = 5;
+  if (_internal_has_get_users()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::get_users(this),
+        _Internal::get_users(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.User unregister_user = 6;
+  if (_internal_has_unregister_user()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::unregister_user(this),
+        _Internal::unregister_user(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.HistoryRequest get_history = 7;
+  if (_internal_has_get_history()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::get_history(this),
+        _Internal::get_history(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.RoomRequest room = 8;
+  if (_internal_has_room()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::room(this),
+        _Internal::room(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.BatchRequest batch = 9;
+  if (_internal_has_batch()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::batch(this),
+        _Internal::batch(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.Receipts acknowledge = 10;
+  if (_internal_has_acknowledge()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::acknowledge(this),
+        _Internal::acknowledge(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.ResumeRequest resume = 11;
+  if (_internal_has_resume()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::resume(this),
+        _Internal::resume(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.Request)
+  return target;
+}
+
+size_t Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .chat.Operation operation = 1;
+  if (this->_internal_operation() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_operation());
+  }
+
+  switch (payload_case()) {
+    // .chat.NewUserRequest register_user = 2;
+    case kRegisterUser: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.register_user_);
+      break;
+    }
+    // .chat.SendMessageRequest send_message = 3;
+    case kSendMessage: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.send_message_);
+      break;
+    }
+    // .chat.UpdateStatusRequest update_status = 4;
+    case kUpdateStatus: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.update_status_);
+      break;
+    }
+    // .chat.UserListRequest get_users = 5;
+    case kGetUsers: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.get_users_);
+      break;
+    }
+    // .chat.User unregister_user = 6;
+    case kUnregisterUser: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.unregister_user_);
+      break;
+    }
+    // .chat.HistoryRequest get_history = 7;
+    case kGetHistory: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.get_history_);
+      break;
+    }
+    // .chat.RoomRequest room = 8;
+    case kRoom: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.room_);
+      break;
+    }
+    // .chat.BatchRequest batch = 9;
+    case kBatch: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.batch_);
+      break;
+    }
+    // .chat.Receipts acknowledge = 10;
+    case kAcknowledge: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.acknowledge_);
+      break;
+    }
+    // .chat.ResumeRequest resume = 11;
+    case kResume: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.resume_);
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Request::GetClassData() const { return &_class_data_; }
+
+
+void Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Request*>(&to_msg);
+  auto& from = static_cast<const Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_operation() != 0) {
+    _this->_internal_set_operation(from._internal_operation());
+  }
+  switch (from.payload_case()) {
+    case kRegisterUser: {
+      _this->_internal_mutable_register_user()->::chat::NewUserRequest::MergeFrom(
+          from._internal_register_user());
+      break;
+    }
+    case kSendMessage: {
+      _this->_internal_mutable_send_message()->::chat::SendMessageRequest::MergeFrom(
+          from._internal_send_message());
+      break;
+    }
+    case kUpdateStatus: {
+      _this->_internal_mutable_update_status()->::chat::UpdateStatusRequest::MergeFrom(
+          from._internal_update_status());
+      break;
+    }
+    case kGetUsers: {
+      _this->_internal_mutable_get_users()->::chat::UserListRequest::MergeFrom(
+          from._internal_get_users());
+      break;
+    }
+    case kUnregisterUser: {
+      _this->_internal_mutable_unregister_user()->::chat::User::MergeFrom(
+          from._internal_unregister_user());
+      break;
+    }
+    case kGetHistory: {
+      _this->_internal_mutable_get_history()->::chat::HistoryRequest::MergeFrom(
+          from._internal_get_history());
+      break;
+    }
+    case kRoom: {
+      _this->_internal_mutable_room()->::chat::RoomRequest::MergeFrom(
+          from._internal_room());
+      break;
+    }
+    case kBatch: {
+      _this->_internal_mutable_batch()->::chat::BatchRequest::MergeFrom(
+          from._internal_batch());
+      break;
+    }
+    case kAcknowledge: {
+      _this->_internal_mutable_acknowledge()->::chat::Receipts::MergeFrom(
+          from._internal_acknowledge());
+      break;
+    }
+    case kResume: {
+      _this->_internal_mutable_resume()->::chat::ResumeRequest::MergeFrom(
+          from._internal_resume());
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Request::CopyFrom(const Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Request::IsInitialized() const {
+  return true;
+}
+
+void Request::InternalSwap(Request* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.operation_, other->_impl_.operation_);
+  swap(_impl_.payload_, other->_impl_.payload_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[15]);
+}
+
+// ===================================================================
+
+class ShutdownNotice::_Internal {
+ public:
+};
+
+ShutdownNotice::ShutdownNotice(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ShutdownNotice)
+}
+ShutdownNotice::ShutdownNotice(const ShutdownNotice& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ShutdownNotice* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.reconnect_after_ms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.reconnect_after_ms_ = from._impl_.reconnect_after_ms_;
+  // @@protoc_insertion_point(copy_constructor:chat.ShutdownNotice)
+}
+
+inline void ShutdownNotice::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.reconnect_after_ms_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ShutdownNotice::~ShutdownNotice() {
+  // @@protoc_insertion_point(destructor:chat.ShutdownNotice)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ShutdownNotice::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ShutdownNotice::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ShutdownNotice::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ShutdownNotice)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.reconnect_after_ms_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ShutdownNotice::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 reconnect_after_ms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.reconnect_after_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ShutdownNotice::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ShutdownNotice)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 reconnect_after_ms = 1;
+  if (this->_internal_reconnect_after_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_reconnect_after_ms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ShutdownNotice)
+  return target;
+}
+
+size_t ShutdownNotice::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ShutdownNotice)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 reconnect_after_ms = 1;
+  if (this->_internal_reconnect_after_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_reconnect_after_ms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ShutdownNotice::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ShutdownNotice::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ShutdownNotice::GetClassData() const { return &_class_data_; }
+
+
+void ShutdownNotice::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ShutdownNotice*>(&to_msg);
+  auto& from = static_cast<const ShutdownNotice&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ShutdownNotice)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_reconnect_after_ms() != 0) {
+    _this->_internal_set_reconnect_after_ms(from._internal_reconnect_after_ms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ShutdownNotice::CopyFrom(const ShutdownNotice& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ShutdownNotice)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ShutdownNotice::IsInitialized() const {
+  return true;
+}
+
+void ShutdownNotice::InternalSwap(ShutdownNotice* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.reconnect_after_ms_, other->_impl_.reconnect_after_ms_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ShutdownNotice::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[16]);
+}
+
+// ===================================================================
+
+class Response::_Internal {
+ public:
+  static const ::chat::UserListResponse& user_list(const Response* msg);
+  static const ::chat::IncomingMessageResponse& incoming_message(const Response* msg);
+  static const ::chat::HistoryResponse& history(const Response* msg);
+  static const ::chat::ShutdownNotice& shutdown(const Response* msg);
+  static const ::chat::BatchResponse& batch(const Response* msg);
+  static const ::chat::Receipts& receipts(const Response* msg);
+};
+
+const ::chat::UserListResponse&
+Response::_Internal::user_list(const Response* msg) {
+  return *msg->_impl_.result_.user_list_;
+}
+const ::chat::IncomingMessageResponse&
+Response::_Internal::incoming_message(const Response* msg) {
+  return *msg->_impl_.result_.incoming_message_;
+}
+const ::chat::HistoryResponse&
+Response::_Internal::history(const Response* msg) {
+  return *msg->_impl_.result_.history_;
+}
+const ::chat::ShutdownNotice&
+Response::_Internal::shutdown(const Response* msg) {
+  return *msg->_impl_.result_.shutdown_;
+}
+const ::chat::BatchResponse&
+Response::_Internal::batch(const Response* msg) {
+  return *msg->_impl_.result_.batch_;
+}
+const ::chat::Receipts&
+Response::_Internal::receipts(const Response* msg) {
+  return *msg->_impl_.result_.receipts_;
+}
+void Response::set_allocated_user_list(::chat::UserListResponse* user_list) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (user_list) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(user_list);
+    if (message_arena != submessage_arena) {
+      user_list = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, user_list, submessage_arena);
+    }
+    set_has_user_list();
+    _impl_.result_.user_list_ = user_list;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.user_list)
+}
+void Response::set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (incoming_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(incoming_message);
+    if (message_arena != submessage_arena) {
+      incoming_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, incoming_message, submessage_arena);
+    }
+    set_has_incoming_message();
+    _impl_.result_.incoming_message_ = incoming_message;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.incoming_message)
+}
+void Response::set_allocated_history(::chat::HistoryResponse* history) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (history) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(history);
+    if (message_arena != submessage_arena) {
+      history = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, history, submessage_arena);
+    }
+    set_has_history();
+    _impl_.result_.history_ = history;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.history)
+}
+void Response::set_allocated_shutdown(::chat::ShutdownNotice* shutdown) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (shutdown) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(shutdown);
+    if (message_arena != submessage_arena) {
+      shutdown = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, shutdown, submessage_arena);
+    }
+    set_has_shutdown();
+    _impl_.result_.shutdown_ = shutdown;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.shutdown)
+}
+void Response::set_allocated_batch(::chat::BatchResponse* batch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (batch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(batch);
+    if (message_arena != submessage_arena) {
+      batch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, batch, submessage_arena);
+    }
+    set_has_batch();
+    _impl_.result_.batch_ = batch;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.batch)
+}
+void Response::set_allocated_receipts(::chat::Receipts* receipts) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (receipts) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(receipts);
+    if (message_arena != submessage_arena) {
+      receipts = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, receipts, submessage_arena);
+    }
+    set_has_receipts();
+    _impl_.result_.receipts_ = receipts;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.receipts)
+}
+Response::Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.Response)
+}
+Response::Response(const Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , decltype(_impl_.operation_){}
+    , decltype(_impl_.status_code_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.compact_){}
+    , decltype(_impl_.message_id_){}
+    , decltype(_impl_.seq_){}
+    , decltype(_impl_.resume_token_){}
+    , decltype(_impl_.result_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_message().empty()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.operation_, &from._impl_.operation_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.resume_token_) -
+    reinterpret_cast<char*>(&_impl_.operation_)) + sizeof(_impl_.resume_token_));
+  clear_has_result();
+  switch (from.result_case()) {
+    case kUserList: {
+      _this->_internal_mutable_user_list()->::chat::UserListResponse::MergeFrom(
+          from._internal_user_list());
+      break;
+    }
+    case kIncomingMessage: {
+      _this->_internal_mutable_incoming_message()->::chat::IncomingMessageResponse::MergeFrom(
+          from._internal_incoming_message());
+      break;
+    }
+    case kHistory: {
+      _this->_internal_mutable_history()->::chat::HistoryResponse::MergeFrom(
+          from._internal_history());
+      break;
+    }
+    case kShutdown: {
+      _this->_internal_mutable_shutdown()->::chat::ShutdownNotice::MergeFrom(
+          from._internal_shutdown());
+      break;
+    }
+    case kBatch: {
+      _this->_internal_mutable_batch()->::chat::BatchResponse::MergeFrom(
+          from._internal_batch());
+      break;
+    }
+    case kReceipts: {
+      _this->_internal_mutable_receipts()->::chat::Receipts::MergeFrom(
+          from._internal_receipts());
+      break;
+    }
+    case RESULT_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.Response)
+}
+
+inline void Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , decltype(_impl_.operation_){0}
+    , decltype(_impl_.status_code_){0}
+    , decltype(_impl_.compression_){0}
+    , decltype(_impl_.compact_){false}
+    , decltype(_impl_.message_id_){uint64_t{0u}}
+    , decltype(_impl_.seq_){uint64_t{0u}}
+    , decltype(_impl_.resume_token_){uint64_t{0u}}
+    , decltype(_impl_.result_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  clear_has_result();
+}
+
+Response::~Response() {
+  // @@protoc_insertion_point(destructor:chat.Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
+  if (has_result()) {
+    clear_result();
+  }
+}
+
+void Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Response::clear_result() {
+// @@protoc_insertion_point(one_of_clear_start:chat.Response)
+  switch (result_case()) {
+    case kUserList: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.user_list_;
+      }
+      break;
+    }
+    case kIncomingMessage: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.incoming_message_;
+      }
+      break;
+    }
+    case kHistory: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.history_;
+      }
+      break;
+    }
+    case kShutdown: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.shutdown_;
+      }
+      break;
+    }
+    case kBatch: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.batch_;
+      }
+      break;
+    }
+    case kReceipts: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.receipts_;
+      }
+      break;
+    }
+    case RESULT_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = RESULT_NOT_SET;
+}
+
+
+void Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.message_.ClearToEmpty();
+  ::memset(&_impl_.operation_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.resume_token_) -
+      reinterpret_cast<char*>(&_impl_.operation_)) + sizeof(_impl_.resume_token_));
+  clear_result();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .chat.Operation operation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_operation(static_cast<::chat::Operation>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.StatusCode status_code = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status_code(static_cast<::chat::StatusCode>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string message = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.Response.message"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserListResponse user_list = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_user_list(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.IncomingMessageResponse incoming_message = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_incoming_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.HistoryResponse history = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_history(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.ShutdownNotice shutdown = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_shutdown(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.BatchResponse batch = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_batch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.Compression compression = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::chat::Compression>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool compact = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.compact_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.Receipts receipts = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_receipts(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 message_id = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.message_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 seq = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 resume_token = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _impl_.resume_token_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .chat.Operation operation = 1;
+  if (this->_internal_operation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_operation(), target);
+  }
+
+  // .chat.StatusCode status_code = 2;
+  if (this->_internal_status_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_status_code(), target);
+  }
+
+  // string message = 3;
+  if (!this->_internal_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.Response.message");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_message(), target);
+  }
+
+  // .chat.UserListResponse user_list = 4;
+  if (_internal_has_user_list()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::user_list(this),
+        _Internal::user_list(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.IncomingMessageResponse incoming_message = 5;
+  if (_internal_has_incoming_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::incoming_message(this),
+        _Internal::incoming_message(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.HistoryResponse history = 6;
+  if (_internal_has_history()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::history(this),
+        _Internal::history(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.ShutdownNotice shutdown = 7;
+  if (_internal_has_shutdown()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::shutdown(this),
+        _Internal::shutdown(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.BatchResponse batch = 8;
+  if (_internal_has_batch()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::batch(this),
+        _Internal::batch(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.Compression compression = 9;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      9, this->_internal_compression(), target);
+  }
+
+  // bool compact = 10;
+  if (this->_internal_compact() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_compact(), target);
+  }
+
+  // .chat.Receipts receipts = 11;
+  if (_internal_has_receipts()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::receipts(this),
+        _Internal::receipts(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 message_id = 12;
+  if (this->_internal_message_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(12, this->_internal_message_id(), target);
+  }
+
+  // uint64 seq = 13;
+  if (this->_internal_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(13, this->_internal_seq(), target);
+  }
+
+  // uint64 resume_token = 14;
+  if (this->_internal_resume_token() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(14, this->_internal_resume_token(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.Response)
+  return target;
+}
+
+size_t Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.Response)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string message = 3;
+  if (!this->_internal_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+
+  // .chat.Operation operation = 1;
+  if (this->_internal_operation() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_operation());
+  }
+
+  // .chat.StatusCode status_code = 2;
+  if (this->_internal_status_code() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status_code());
+  }
+
+  // .chat.Compression compression = 9;
+  if (this->_internal_compression() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
+  }
+
+  // bool compact = 10;
+  if (this->_internal_compact() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 message_id = 12;
+  if (this->_internal_message_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_message_id());
+  }
+
+  // uint64 seq = 13;
+  if (this->_internal_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seq());
+  }
+
+  // uint64 resume_token = 14;
+  if (this->_internal_resume_token() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_resume_token());
+  }
+
+  switch (result_case()) {
+    // .chat.UserListResponse user_list = 4;
+    case kUserList: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.user_list_);
+      break;
+    }
+    // .chat.IncomingMessageResponse incoming_message = 5;
+    case kIncomingMessage: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.incoming_message_);
+      break;
+    }
+    // .chat.HistoryResponse history = 6;
+    case kHistory: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.history_);
+      break;
+    }
+    // .chat.ShutdownNotice shutdown = 7;
+    case kShutdown: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.shutdown_);
+      break;
+    }
+    // .chat.BatchResponse batch = 8;
+    case kBatch: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.batch_);
+      break;
+    }
+    // .chat.Receipts receipts = 11;
+    case kReceipts: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.receipts_);
+      break;
+    }
+    case RESULT_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Response::GetClassData() const { return &_class_data_; }
+
+
+void Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Response*>(&to_msg);
+  auto& from = static_cast<const Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_message().empty()) {
+    _this->_internal_set_message(from._internal_message());
+  }
+  if (from._internal_operation() != 0) {
+    _this->_internal_set_operation(from._internal_operation());
+  }
+  if (from._internal_status_code() != 0) {
+    _this->_internal_set_status_code(from._internal_status_code());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  if (from._internal_compact() != 0) {
+    _this->_internal_set_compact(from._internal_compact());
+  }
+  if (from._internal_message_id() != 0) {
+    _this->_internal_set_message_id(from._internal_message_id());
+  }
+  if (from._internal_seq() != 0) {
+    _this->_internal_set_seq(from._internal_seq());
+  }
+  if (from._internal_resume_token() != 0) {
+    _this->_internal_set_resume_token(from._internal_resume_token());
+  }
+  switch (from.result_case()) {
+    case kUserList: {
+      _this->_internal_mutable_user_list()->::chat::UserListResponse::MergeFrom(
+          from._internal_user_list());
+      break;
+    }
+    case kIncomingMessage: {
+      _this->_internal_mutable_incoming_message()->::chat::IncomingMessageResponse::MergeFrom(
+          from._internal_incoming_message());
+      break;
+    }
+    case kHistory: {
+      _this->_internal_mutable_history()->::chat::HistoryResponse::MergeFrom(
+          from._internal_history());
+      break;
+    }
+    case kShutdown: {
+      _this->_internal_mutable_shutdown()->::chat::ShutdownNotice::MergeFrom(
+          from._internal_shutdown());
+      break;
+    }
+    case kBatch: {
+      _this->_internal_mutable_batch()->::chat::BatchResponse::MergeFrom(
+          from._internal_batch());
+      break;
+    }
+    case kReceipts: {
+      _this->_internal_mutable_receipts()->::chat::Receipts::MergeFrom(
+          from._internal_receipts());
+      break;
+    }
+    case RESULT_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Response::CopyFrom(const Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Response::IsInitialized() const {
+  return true;
+}
+
+void Response::InternalSwap(Response* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Response, _impl_.resume_token_)
+      + sizeof(Response::_impl_.resume_token_)
+      - PROTOBUF_FIELD_OFFSET(Response, _impl_.operation_)>(
+          reinterpret_cast<char*>(&_impl_.operation_),
+          reinterpret_cast<char*>(&other->_impl_.operation_));
+  swap(_impl_.result_, other->_impl_.result_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[17]);
+}
+
+// ===================================================================
+
+class PeerPresence::_Internal {
+ public:
+};
+
+PeerPresence::PeerPresence(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.PeerPresence)
+}
+PeerPresence::PeerPresence(const PeerPresence& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PeerPresence* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.node_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.connected_){}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.changed_at_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.node_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_node().empty()) {
+    _this->_impl_.node_.Set(from._internal_node(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.status_, &from._impl_.status_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.changed_at_) -
+    reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.changed_at_));
+  // @@protoc_insertion_point(copy_constructor:chat.PeerPresence)
+}
+
+inline void PeerPresence::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.node_){}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.connected_){false}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.changed_at_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.node_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PeerPresence::~PeerPresence() {
+  // @@protoc_insertion_point(destructor:chat.PeerPresence)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PeerPresence::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+  _impl_.node_.Destroy();
+}
+
+void PeerPresence::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PeerPresence::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.PeerPresence)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.username_.ClearToEmpty();
+  _impl_.node_.ClearToEmpty();
+  ::memset(&_impl_.status_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.changed_at_) -
+      reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.changed_at_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PeerPresence::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string username = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.PeerPresence.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserStatus status = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::chat::UserStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool connected = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.connected_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string node = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_node();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.PeerPresence.node"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 changed_at = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.changed_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PeerPresence::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.PeerPresence)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.PeerPresence.username");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
+  }
+
+  // .chat.UserStatus status = 2;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_status(), target);
+  }
+
+  // bool connected = 3;
+  if (this->_internal_connected() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_connected(), target);
+  }
+
+  // string node = 4;
+  if (!this->_internal_node().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_node().data(), static_cast<int>(this->_internal_node().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.PeerPresence.node");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_node(), target);
+  }
+
+  // uint64 version = 5;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_version(), target);
+  }
+
+  // int64 changed_at = 6;
+  if (this->_internal_changed_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_changed_at(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.PeerPresence)
+  return target;
+}
+
+size_t PeerPresence::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.PeerPresence)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // string node = 4;
+  if (!this->_internal_node().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_node());
+  }
+
+  // .chat.UserStatus status = 2;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  // bool connected = 3;
+  if (this->_internal_connected() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 version = 5;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  // int64 changed_at = 6;
+  if (this->_internal_changed_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_changed_at());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PeerPresence::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PeerPresence::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PeerPresence::GetClassData() const { return &_class_data_; }
+
+
+void PeerPresence::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PeerPresence*>(&to_msg);
+  auto& from = static_cast<const PeerPresence&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.PeerPresence)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (!from._internal_node().empty()) {
+    _this->_internal_set_node(from._internal_node());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  if (from._internal_connected() != 0) {
+    _this->_internal_set_connected(from._internal_connected());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_changed_at() != 0) {
+    _this->_internal_set_changed_at(from._internal_changed_at());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PeerPresence::CopyFrom(const PeerPresence& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.PeerPresence)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PeerPresence::IsInitialized() const {
+  return true;
+}
+
+void PeerPresence::InternalSwap(PeerPresence* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.node_, lhs_arena,
+      &other->_impl_.node_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PeerPresence, _impl_.changed_at_)
+      + sizeof(PeerPresence::_impl_.changed_at_)
+      - PROTOBUF_FIELD_OFFSET(PeerPresence, _impl_.status_)>(
+          reinterpret_cast<char*>(&_impl_.status_),
+          reinterpret_cast<char*>(&other->_impl_.status_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PeerPresence::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[18]);
+}
+
+// ===================================================================
+
+class PresenceDigest::_Internal {
+ public:
+};
+
+PresenceDigest::PresenceDigest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.PresenceDigest)
+}
+PresenceDigest::PresenceDigest(const PresenceDigest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PresenceDigest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.version_ = from._impl_.version_;
+  // @@protoc_insertion_point(copy_constructor:chat.PresenceDigest)
+}
+
+inline void PresenceDigest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PresenceDigest::~PresenceDigest() {
+  // @@protoc_insertion_point(destructor:chat.PresenceDigest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PresenceDigest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+}
+
+void PresenceDigest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PresenceDigest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.PresenceDigest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.username_.ClearToEmpty();
+  _impl_.version_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PresenceDigest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string username = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.PresenceDigest.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PresenceDigest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.PresenceDigest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.PresenceDigest.username");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
+  }
+
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.PresenceDigest)
+  return target;
+}
+
+size_t PresenceDigest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.PresenceDigest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PresenceDigest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PresenceDigest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PresenceDigest::GetClassData() const { return &_class_data_; }
+
+
+void PresenceDigest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PresenceDigest*>(&to_msg);
+  auto& from = static_cast<const PresenceDigest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.PresenceDigest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PresenceDigest::CopyFrom(const PresenceDigest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.PresenceDigest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PresenceDigest::IsInitialized() const {
+  return true;
+}
+
+void PresenceDigest::InternalSwap(PresenceDigest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  swap(_impl_.version_, other->_impl_.version_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PresenceDigest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[19]);
+}
+
+// ===================================================================
+
+class PeerMessage::_Internal {
+ public:
+  static const ::chat::IncomingMessageResponse& message(const PeerMessage* msg);
+};
+
+const ::chat::IncomingMessageResponse&
+PeerMessage::_Internal::message(const PeerMessage* msg) {
+  return *msg->_impl_.message_;
+}
+PeerMessage::PeerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.PeerMessage)
+}
+PeerMessage::PeerMessage(const PeerMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PeerMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.presence_){from._impl_.presence_}
+    , decltype(_impl_.digest_){from._impl_.digest_}
+    , decltype(_impl_.wanted_){from._impl_.wanted_}
+    , decltype(_impl_.node_){}
+    , decltype(_impl_.recipient_){}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.operation_){}
+    , decltype(_impl_.routed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.node_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_node().empty()) {
+    _this->_impl_.node_.Set(from._internal_node(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.recipient_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_recipient().empty()) {
+    _this->_impl_.recipient_.Set(from._internal_recipient(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::chat::IncomingMessageResponse(*from._impl_.message_);
+  }
+  ::memcpy(&_impl_.operation_, &from._impl_.operation_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.routed_) -
+    reinterpret_cast<char*>(&_impl_.operation_)) + sizeof(_impl_.routed_));
+  // @@protoc_insertion_point(copy_constructor:chat.PeerMessage)
+}
+
+inline void PeerMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.presence_){arena}
+    , decltype(_impl_.digest_){arena}
+    , decltype(_impl_.wanted_){arena}
+    , decltype(_impl_.node_){}
+    , decltype(_impl_.recipient_){}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.operation_){0}
+    , decltype(_impl_.routed_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.node_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.recipient_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PeerMessage::~PeerMessage() {
+  // @@protoc_insertion_point(destructor:chat.PeerMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PeerMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.presence_.~RepeatedPtrField();
+  _impl_.digest_.~RepeatedPtrField();
+  _impl_.wanted_.~RepeatedPtrField();
+  _impl_.node_.Destroy();
+  _impl_.recipient_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.message_;
+}
+
+void PeerMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PeerMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.PeerMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.presence_.Clear();
+  _impl_.digest_.Clear();
+  _impl_.wanted_.Clear();
+  _impl_.node_.ClearToEmpty();
+  _impl_.recipient_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.message_ != nullptr) {
+    delete _impl_.message_;
+  }
+  _impl_.message_ = nullptr;
+  ::memset(&_impl_.operation_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.routed_) -
+      reinterpret_cast<char*>(&_impl_.operation_)) + sizeof(_impl_.routed_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PeerMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .chat.PeerOperation operation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_operation(static_cast<::chat::PeerOperation>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string node = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_node();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.PeerMessage.node"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.PeerPresence presence = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_presence(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string recipient = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_recipient();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.PeerMessage.recipient"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.IncomingMessageResponse message = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool routed = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.routed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.PresenceDigest digest = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_digest(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string wanted = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_wanted();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "chat.PeerMessage.wanted"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PeerMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.PeerMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .chat.PeerOperation operation = 1;
+  if (this->_internal_operation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_operation(), target);
+  }
+
+  // string node = 2;
+  if (!this->_internal_node().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_node().data(), static_cast<int>(this->_internal_node().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.PeerMessage.node");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_node(), target);
+  }
+
+  // repeated .chat.PeerPresence presence = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_presence_size()); i < n; i++) {
+    const auto& repfield = this->_internal_presence(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string recipient = 4;
+  if (!this->_internal_recipient().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_recipient().data(), static_cast<int>(this->_internal_recipient().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.PeerMessage.recipient");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_recipient(), target);
+  }
+
+  // .chat.IncomingMessageResponse message = 5;
+  if (this->_internal_has_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  // bool routed = 6;
+  if (this->_internal_routed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_routed(), target);
+  }
+
+  // repeated .chat.PresenceDigest digest = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_digest_size()); i < n; i++) {
+    const auto& repfield = this->_internal_digest(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated string wanted = 8;
+  for (int i = 0, n = this->_internal_wanted_size(); i < n; i++) {
+    const auto& s = this->_internal_wanted(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.PeerMessage.wanted");
+    target = stream->WriteString(8, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.PeerMessage)
+  return target;
+}
+
+size_t PeerMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.PeerMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.PeerPresence presence = 3;
+  total_size += 1UL * this->_internal_presence_size();
+  for (const auto& msg : this->_impl_.presence_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .chat.PresenceDigest digest = 7;
+  total_size += 1UL * this->_internal_digest_size();
+  for (const auto& msg : this->_impl_.digest_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated string wanted = 8;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.wanted_.size());
+  for (int i = 0, n = _impl_.wanted_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.wanted_.Get(i));
+  }
+
+  // string node = 2;
+  if (!this->_internal_node().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_node());
+  }
+
+  // string recipient = 4;
+  if (!this->_internal_recipient().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_recipient());
+  }
+
+  // .chat.IncomingMessageResponse message = 5;
+  if (this->_internal_has_message()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.message_);
+  }
+
+  // .chat.PeerOperation operation = 1;
+  if (this->_internal_operation() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_operation());
+  }
+
+  // bool routed = 6;
+  if (this->_internal_routed() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PeerMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PeerMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PeerMessage::GetClassData() const { return &_class_data_; }
+
+
+void PeerMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PeerMessage*>(&to_msg);
+  auto& from = static_cast<const PeerMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.PeerMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.presence_.MergeFrom(from._impl_.presence_);
+  _this->_impl_.digest_.MergeFrom(from._impl_.digest_);
+  _this->_impl_.wanted_.MergeFrom(from._impl_.wanted_);
+  if (!from._internal_node().empty()) {
+    _this->_internal_set_node(from._internal_node());
+  }
+  if (!from._internal_recipient().empty()) {
+    _this->_internal_set_recipient(from._internal_recipient());
+  }
+  if (from._internal_has_message()) {
+    _this->_internal_mutable_message()->::chat::IncomingMessageResponse::MergeFrom(
+        from._internal_message());
+  }
+  if (from._internal_operation() != 0) {
+    _this->_internal_set_operation(from._internal_operation());
+  }
+  if (from._internal_routed() != 0) {
+    _this->_internal_set_routed(from._internal_routed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PeerMessage::CopyFrom(const PeerMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.PeerMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PeerMessage::IsInitialized() const {
+  return true;
+}
+
+void PeerMessage::InternalSwap(PeerMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.presence_.InternalSwap(&other->_impl_.presence_);
+  _impl_.digest_.InternalSwap(&other->_impl_.digest_);
+  _impl_.wanted_.InternalSwap(&other->_impl_.wanted_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.node_, lhs_arena,
+      &other->_impl_.node_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.recipient_, lhs_arena,
+      &other->_impl_.recipient_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PeerMessage, _impl_.routed_)
+      + sizeof(PeerMessage::_impl_.routed_)
+      - PROTOBUF_FIELD_OFFSET(PeerMessage, _impl_.message_)>(
+          reinterpret_cast<char*>(&_impl_.message_),
+          reinterpret_cast<char*>(&other->_impl_.message_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PeerMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[20]);
+}
+
+// ===================================================================
+
+class HandoffSession::_Internal {
+ public:
+};
+
+HandoffSession::HandoffSession(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.HandoffSession)
+}
+HandoffSession::HandoffSession(const HandoffSession& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HandoffSession* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rooms_){from._impl_.rooms_}
+    , decltype(_impl_.transfers_){from._impl_.transfers_}
+    , decltype(_impl_.resume_){from._impl_.resume_}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.input_){}
+    , decltype(_impl_.last_active_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.flush_policy_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.compact_){}
+    , decltype(_impl_.resume_token_){}
+    , decltype(_impl_.registered_at_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_ip().empty()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.input_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.input_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_input().empty()) {
+    _this->_impl_.input_.Set(from._internal_input(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.last_active_, &from._impl_.last_active_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.registered_at_) -
+    reinterpret_cast<char*>(&_impl_.last_active_)) + sizeof(_impl_.registered_at_));
+  // @@protoc_insertion_point(copy_constructor:chat.HandoffSession)
+}
+
+inline void HandoffSession::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rooms_){arena}
+    , decltype(_impl_.transfers_){arena}
+    , decltype(_impl_.resume_){arena}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.input_){}
+    , decltype(_impl_.last_active_){int64_t{0}}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.flush_policy_){0}
+    , decltype(_impl_.compression_){0}
+    , decltype(_impl_.compact_){false}
+    , decltype(_impl_.resume_token_){uint64_t{0u}}
+    , decltype(_impl_.registered_at_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.input_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.input_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+HandoffSession::~HandoffSession() {
+  // @@protoc_insertion_point(destructor:chat.HandoffSession)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HandoffSession::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rooms_.~RepeatedPtrField();
+  _impl_.transfers_.~RepeatedPtrField();
+  _impl_.resume_.~RepeatedPtrField();
+  _impl_.ip_.Destroy();
+  _impl_.username_.Destroy();
+  _impl_.input_.Destroy();
+}
+
+void HandoffSession::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HandoffSession::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.HandoffSession)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rooms_.Clear();
+  _impl_.transfers_.Clear();
+  _impl_.resume_.Clear();
+  _impl_.ip_.ClearToEmpty();
+  _impl_.username_.ClearToEmpty();
+  _impl_.input_.ClearToEmpty();
+  ::memset(&_impl_.last_active_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.registered_at_) -
+      reinterpret_cast<char*>(&_impl_.last_active_)) + sizeof(_impl_.registered_at_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HandoffSession::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string ip = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.HandoffSession.ip"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string username = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.HandoffSession.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserStatus status = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::chat::UserStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 last_active = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.last_active_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string rooms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_rooms();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "chat.HandoffSession.rooms"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes input = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_input();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.FlushPolicy flush_policy = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_flush_policy(static_cast<::chat::FlushPolicy>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.Compression compression = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::chat::Compression>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.PartialTransfer transfers = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_transfers(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool compact = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.compact_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 resume_token = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.resume_token_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.BufferedFrame resume = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_resume(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 registered_at = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.registered_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HandoffSession::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.HandoffSession)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string ip = 1;
+  if (!this->_internal_ip().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_ip().data(), static_cast<int>(this->_internal_ip().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.HandoffSession.ip");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_ip(), target);
+  }
+
+  // string username = 2;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.HandoffSession.username");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_username(), target);
+  }
+
+  // .chat.UserStatus status = 3;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_status(), target);
+  }
+
+  // int64 last_active = 4;
+  if (this->_internal_last_active() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_last_active(), target);
+  }
+
+  // repeated string rooms = 5;
+  for (int i = 0, n = this->_internal_rooms_size(); i < n; i++) {
+    const auto& s = this->_internal_rooms(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.HandoffSession.rooms");
+    target = stream->WriteString(5, s, target);
+  }
+
+  // bytes input = 6;
+  if (!this->_internal_input().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_input(), target);
+  }
+
+  // .chat.FlushPolicy flush_policy = 7;
+  if (this->_internal_flush_policy() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      7, this->_internal_flush_policy(), target);
+  }
+
+  // .chat.Compression compression = 8;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      8, this->_internal_compression(), target);
+  }
+
+  // repeated .chat.PartialTransfer transfers = 9;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_transfers_size()); i < n; i++) {
+    const auto& repfield = this->_internal_transfers(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bool compact = 10;
+  if (this->_internal_compact() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_compact(), target);
+  }
+
+  // uint64 resume_token = 11;
+  if (this->_internal_resume_token() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(11, this->_internal_resume_token(), target);
+  }
+
+  // repeated .chat.BufferedFrame resume = 12;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_resume_size()); i < n; i++) {
+    const auto& repfield = this->_internal_resume(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int64 registered_at = 13;
+  if (this->_internal_registered_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(13, this->_internal_registered_at(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.HandoffSession)
+  return target;
+}
+
+size_t HandoffSession::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.HandoffSession)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string rooms = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.rooms_.size());
+  for (int i = 0, n = _impl_.rooms_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.rooms_.Get(i));
+  }
+
+  // repeated .chat.PartialTransfer transfers = 9;
+  total_size += 1UL * this->_internal_transfers_size();
+  for (const auto& msg : this->_impl_.transfers_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .chat.BufferedFrame resume = 12;
+  total_size += 1UL * this->_internal_resume_size();
+  for (const auto& msg : this->_impl_.resume_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string ip = 1;
+  if (!this->_internal_ip().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ip());
+  }
+
+  // string username = 2;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // bytes input = 6;
+  if (!this->_internal_input().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_input());
+  }
+
+  // int64 last_active = 4;
+  if (this->_internal_last_active() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_last_active());
+  }
+
+  // .chat.UserStatus status = 3;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  // .chat.FlushPolicy flush_policy = 7;
+  if (this->_internal_flush_policy() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_flush_policy());
+  }
+
+  // .chat.Compression compression = 8;
+  if (this->_internal_compression() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
+  }
+
+  // bool compact = 10;
+  if (this->_internal_compact() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 resume_token = 11;
+  if (this->_internal_resume_token() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_resume_token());
+  }
+
+  // int64 registered_at = 13;
+  if (this->_internal_registered_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_registered_at());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HandoffSession::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HandoffSession::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HandoffSession::GetClassData() const { return &_class_data_; }
+
+
+void HandoffSession::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HandoffSession*>(&to_msg);
+  auto& from = static_cast<const HandoffSession&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.HandoffSession)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rooms_.MergeFrom(from._impl_.rooms_);
+  _this->_impl_.transfers_.MergeFrom(from._impl_.transfers_);
+  _this->_impl_.resume_.MergeFrom(from._impl_.resume_);
+  if (!from._internal_ip().empty()) {
+    _this->_internal_set_ip(from._internal_ip());
+  }
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (!from._internal_input().empty()) {
+    _this->_internal_set_input(from._internal_input());
+  }
+  if (from._internal_last_active() != 0) {
+    _this->_internal_set_last_active(from._internal_last_active());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  if (from._internal_flush_policy() != 0) {
+    _this->_internal_set_flush_policy(from._internal_flush_policy());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  if (from._internal_compact() != 0) {
+    _this->_internal_set_compact(from._internal_compact());
+  }
+  if (from._internal_resume_token() != 0) {
+    _this->_internal_set_resume_token(from._internal_resume_token());
+  }
+  if (from._internal_registered_at() != 0) {
+    _this->_internal_set_registered_at(from._internal_registered_at());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HandoffSession::CopyFrom(const HandoffSession& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.HandoffSession)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HandoffSession::IsInitialized() const {
+  return true;
+}
+
+void HandoffSession::InternalSwap(HandoffSession* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.rooms_.InternalSwap(&other->_impl_.rooms_);
+  _impl_.transfers_.InternalSwap(&other->_impl_.transfers_);
+  _impl_.resume_.InternalSwap(&other->_impl_.resume_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.input_, lhs_arena,
+      &other->_impl_.input_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HandoffSession, _impl_.registered_at_)
+      + sizeof(HandoffSession::_impl_.registered_at_)
+      - PROTOBUF_FIELD_OFFSET(HandoffSession, _impl_.last_active_)>(
+          reinterpret_cast<char*>(&_impl_.last_active_),
+          reinterpret_cast<char*>(&other->_impl_.last_active_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HandoffSession::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[21]);
+}
+
+// ===================================================================
+
+class PartialTransfer::_Internal {
+ public:
+};
+
+PartialTransfer::PartialTransfer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.PartialTransfer)
+}
+PartialTransfer::PartialTransfer(const PartialTransfer& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PartialTransfer* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.total_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.total_));
+  // @@protoc_insertion_point(copy_constructor:chat.PartialTransfer)
+}
+
+inline void PartialTransfer::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.id_){0u}
+    , decltype(_impl_.total_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PartialTransfer::~PartialTransfer() {
+  // @@protoc_insertion_point(destructor:chat.PartialTransfer)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PartialTransfer::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+}
+
+void PartialTransfer::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PartialTransfer::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.PartialTransfer)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.total_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.total_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PartialTransfer::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 total = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.total_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PartialTransfer::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.PartialTransfer)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // uint32 total = 2;
+  if (this->_internal_total() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_total(), target);
+  }
+
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.PartialTransfer)
+  return target;
+}
+
+size_t PartialTransfer::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.PartialTransfer)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
+  // uint32 total = 2;
+  if (this->_internal_total() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_total());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PartialTransfer::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PartialTransfer::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PartialTransfer::GetClassData() const { return &_class_data_; }
+
+
+void PartialTransfer::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PartialTransfer*>(&to_msg);
+  auto& from = static_cast<const PartialTransfer&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.PartialTransfer)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_total() != 0) {
+    _this->_internal_set_total(from._internal_total());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PartialTransfer::CopyFrom(const PartialTransfer& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.PartialTransfer)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PartialTransfer::IsInitialized() const {
+  return true;
+}
+
+void PartialTransfer::InternalSwap(PartialTransfer* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PartialTransfer, _impl_.total_)
+      + sizeof(PartialTransfer::_impl_.total_)
+      - PROTOBUF_FIELD_OFFSET(PartialTransfer, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PartialTransfer::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[22]);
+}
+
+// ===================================================================
+
+class BufferedFrame::_Internal {
+ public:
+};
+
+BufferedFrame::BufferedFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.BufferedFrame)
+}
+BufferedFrame::BufferedFrame(const BufferedFrame& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BufferedFrame* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_){}
+    , decltype(_impl_.seq_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.frame_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.frame_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_frame().empty()) {
+    _this->_impl_.frame_.Set(from._internal_frame(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.seq_ = from._impl_.seq_;
+  // @@protoc_insertion_point(copy_constructor:chat.BufferedFrame)
+}
+
+inline void BufferedFrame::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_){}
+    , decltype(_impl_.seq_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.frame_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.frame_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BufferedFrame::~BufferedFrame() {
+  // @@protoc_insertion_point(destructor:chat.BufferedFrame)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BufferedFrame::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.frame_.Destroy();
+}
+
+void BufferedFrame::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BufferedFrame::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.BufferedFrame)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.frame_.ClearToEmpty();
+  _impl_.seq_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BufferedFrame::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 seq = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes frame = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_frame();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BufferedFrame::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.BufferedFrame)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 seq = 1;
+  if (this->_internal_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_seq(), target);
+  }
+
+  // bytes frame = 2;
+  if (!this->_internal_frame().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_frame(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.BufferedFrame)
+  return target;
+}
+
+size_t BufferedFrame::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.BufferedFrame)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes frame = 2;
+  if (!this->_internal_frame().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_frame());
+  }
+
+  // uint64 seq = 1;
+  if (this->_internal_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seq());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BufferedFrame::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BufferedFrame::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BufferedFrame::GetClassData() const { return &_class_data_; }
+
+
+void BufferedFrame::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BufferedFrame*>(&to_msg);
+  auto& from = static_cast<const BufferedFrame&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.BufferedFrame)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_frame().empty()) {
+    _this->_internal_set_frame(from._internal_frame());
+  }
+  if (from._internal_seq() != 0) {
+    _this->_internal_set_seq(from._internal_seq());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BufferedFrame::CopyFrom(const BufferedFrame& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.BufferedFrame)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BufferedFrame::IsInitialized() const {
+  return true;
+}
+
+void BufferedFrame::InternalSwap(BufferedFrame* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.frame_, lhs_arena,
+      &other->_impl_.frame_, rhs_arena
+  );
+  swap(_impl_.seq_, other->_impl_.seq_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BufferedFrame::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[23]);
+}
+
+// ===================================================================
+
+class DetachedSession::_Internal {
+ public:
+};
+
+DetachedSession::DetachedSession(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.DetachedSession)
+}
+DetachedSession::DetachedSession(const DetachedSession& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DetachedSession* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rooms_){from._impl_.rooms_}
+    , decltype(_impl_.resume_){from._impl_.resume_}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.last_active_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.compact_){}
+    , decltype(_impl_.resume_token_){}
+    , decltype(_impl_.detached_ms_){}
+    , decltype(_impl_.registered_at_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_ip().empty()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.last_active_, &from._impl_.last_active_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.registered_at_) -
+    reinterpret_cast<char*>(&_impl_.last_active_)) + sizeof(_impl_.registered_at_));
+  // @@protoc_insertion_point(copy_constructor:chat.DetachedSession)
+}
+
+inline void DetachedSession::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rooms_){arena}
+    , decltype(_impl_.resume_){arena}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.last_active_){int64_t{0}}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.compact_){false}
+    , decltype(_impl_.resume_token_){uint64_t{0u}}
+    , decltype(_impl_.detached_ms_){int64_t{0}}
+    , decltype(_impl_.registered_at_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DetachedSession::~DetachedSession() {
+  // @@protoc_insertion_point(destructor:chat.DetachedSession)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DetachedSession::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rooms_.~RepeatedPtrField();
+  _impl_.resume_.~RepeatedPtrField();
+  _impl_.ip_.Destroy();
+  _impl_.username_.Destroy();
+}
+
+void DetachedSession::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DetachedSession::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.DetachedSession)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rooms_.Clear();
+  _impl_.resume_.Clear();
+  _impl_.ip_.ClearToEmpty();
+  _impl_.username_.ClearToEmpty();
+  ::memset(&_impl_.last_active_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.registered_at_) -
+      reinterpret_cast<char*>(&_impl_.last_active_)) + sizeof(_impl_.registered_at_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DetachedSession::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string ip = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.DetachedSession.ip"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string username = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.DetachedSession.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserStatus status = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::chat::UserStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 last_active = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.last_active_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string rooms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_rooms();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "chat.DetachedSession.rooms"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool compact = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.compact_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 resume_token = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.resume_token_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 detached_ms = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.detached_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.BufferedFrame resume = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_resume(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 registered_at = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.registered_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DetachedSession::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.DetachedSession)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string ip = 1;
+  if (!this->_internal_ip().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_ip().data(), static_cast<int>(this->_internal_ip().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.DetachedSession.ip");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_ip(), target);
+  }
+
+  // string username = 2;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.DetachedSession.username");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_username(), target);
+  }
+
+  // .chat.UserStatus status = 3;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_status(), target);
+  }
+
+  // int64 last_active = 4;
+  if (this->_internal_last_active() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_last_active(), target);
+  }
+
+  // repeated string rooms = 5;
+  for (int i = 0, n = this->_internal_rooms_size(); i < n; i++) {
+    const auto& s = this->_internal_rooms(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.DetachedSession.rooms");
+    target = stream->WriteString(5, s, target);
+  }
+
+  // bool compact = 6;
+  if (this->_internal_compact() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_compact(), target);
+  }
+
+  // uint64 resume_token = 7;
+  if (this->_internal_resume_token() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_resume_token(), target);
+  }
+
+  // int64 detached_ms = 8;
+  if (this->_internal_detached_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_detached_ms(), target);
+  }
+
+  // repeated .chat.BufferedFrame resume = 9;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_resume_size()); i < n; i++) {
+    const auto& repfield = this->_internal_resume(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int64 registered_at = 10;
+  if (this->_internal_registered_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(10, this->_internal_registered_at(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.DetachedSession)
+  return target;
+}
+
+size_t DetachedSession::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.DetachedSession)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string rooms = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.rooms_.size());
+  for (int i = 0, n = _impl_.rooms_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.rooms_.Get(i));
+  }
+
+  // repeated .chat.BufferedFrame resume = 9;
+  total_size += 1UL * this->_internal_resume_size();
+  for (const auto& msg : this->_impl_.resume_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string ip = 1;
+  if (!this->_internal_ip().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ip());
+  }
+
+  // string username = 2;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // int64 last_active = 4;
+  if (this->_internal_last_active() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_last_active());
+  }
+
+  // .chat.UserStatus status = 3;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  // bool compact = 6;
+  if (this->_internal_compact() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 resume_token = 7;
+  if (this->_internal_resume_token() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_resume_token());
+  }
+
+  // int64 detached_ms = 8;
+  if (this->_internal_detached_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_detached_ms());
+  }
+
+  // int64 registered_at = 10;
+  if (this->_internal_registered_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_registered_at());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DetachedSession::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DetachedSession::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DetachedSession::GetClassData() const { return &_class_data_; }
+
+
+void DetachedSession::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DetachedSession*>(&to_msg);
+  auto& from = static_cast<const DetachedSession&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.DetachedSession)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rooms_.MergeFrom(from._impl_.rooms_);
+  _this->_impl_.resume_.MergeFrom(from._impl_.resume_);
+  if (!from._internal_ip().empty()) {
+    _this->_internal_set_ip(from._internal_ip());
+  }
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (from._internal_last_active() != 0) {
+    _this->_internal_set_last_active(from._internal_last_active());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  if (from._internal_compact() != 0) {
+    _this->_internal_set_compact(from._internal_compact());
+  }
+  if (from._internal_resume_token() != 0) {
+    _this->_internal_set_resume_token(from._internal_resume_token());
+  }
+  if (from._internal_detached_ms() != 0) {
+    _this->_internal_set_detached_ms(from._internal_detached_ms());
+  }
+  if (from._internal_registered_at() != 0) {
+    _this->_internal_set_registered_at(from._internal_registered_at());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DetachedSession::CopyFrom(const DetachedSession& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.DetachedSession)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DetachedSession::IsInitialized() const {
+  return true;
+}
+
+void DetachedSession::InternalSwap(DetachedSession* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.rooms_.InternalSwap(&other->_impl_.rooms_);
+  _impl_.resume_.InternalSwap(&other->_impl_.resume_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DetachedSession, _impl_.registered_at_)
+      + sizeof(DetachedSession::_impl_.registered_at_)
+      - PROTOBUF_FIELD_OFFSET(DetachedSession, _impl_.last_active_)>(
+          reinterpret_cast<char*>(&_impl_.last_active_),
+          reinterpret_cast<char*>(&other->_impl_.last_active_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DetachedSession::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[24]);
+}
+
+// ===================================================================
+
+class HandoffState::_Internal {
+ public:
+};
+
+HandoffState::HandoffState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.HandoffState)
+}
+HandoffState::HandoffState(const HandoffState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HandoffState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sessions_){from._impl_.sessions_}
+    , decltype(_impl_.detached_){from._impl_.detached_}
+    , decltype(_impl_.next_seq_){}
+    , decltype(_impl_.has_listener_){}
+    , decltype(_impl_.last_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.next_seq_, &from._impl_.next_seq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.last_) -
+    reinterpret_cast<char*>(&_impl_.next_seq_)) + sizeof(_impl_.last_));
+  // @@protoc_insertion_point(copy_constructor:chat.HandoffState)
+}
+
+inline void HandoffState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sessions_){arena}
+    , decltype(_impl_.detached_){arena}
+    , decltype(_impl_.next_seq_){uint64_t{0u}}
+    , decltype(_impl_.has_listener_){false}
+    , decltype(_impl_.last_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+HandoffState::~HandoffState() {
+  // @@protoc_insertion_point(destructor:chat.HandoffState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HandoffState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sessions_.~RepeatedPtrField();
+  _impl_.detached_.~RepeatedPtrField();
+}
+
+void HandoffState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HandoffState::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.HandoffState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sessions_.Clear();
+  _impl_.detached_.Clear();
+  ::memset(&_impl_.next_seq_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.last_) -
+      reinterpret_cast<char*>(&_impl_.next_seq_)) + sizeof(_impl_.last_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HandoffState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool has_listener = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.has_listener_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.HandoffSession sessions = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_sessions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool last = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.last_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 next_seq = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.next_seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.DetachedSession detached = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_detached(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HandoffState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.HandoffState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool has_listener = 1;
+  if (this->_internal_has_listener() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_has_listener(), target);
+  }
+
+  // repeated .chat.HandoffSession sessions = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sessions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sessions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bool last = 3;
+  if (this->_internal_last() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_last(), target);
+  }
+
+  // uint64 next_seq = 4;
+  if (this->_internal_next_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_next_seq(), target);
+  }
+
+  // repeated .chat.DetachedSession detached = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_detached_size()); i < n; i++) {
+    const auto& repfield = this->_internal_detached(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.HandoffState)
+  return target;
+}
+
+size_t HandoffState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.HandoffState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.HandoffSession sessions = 2;
+  total_size += 1UL * this->_internal_sessions_size();
+  for (const auto& msg : this->_impl_.sessions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .chat.DetachedSession detached = 5;
+  total_size += 1UL * this->_internal_detached_size();
+  for (const auto& msg : this->_impl_.detached_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 next_seq = 4;
+  if (this->_internal_next_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_next_seq());
+  }
+
+  // bool has_listener = 1;
+  if (this->_internal_has_listener() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool last = 3;
+  if (this->_internal_last() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HandoffState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HandoffState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HandoffState::GetClassData() const { return &_class_data_; }
+
+
+void HandoffState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HandoffState*>(&to_msg);
+  auto& from = static_cast<const HandoffState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.HandoffState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.sessions_.MergeFrom(from._impl_.sessions_);
+  _this->_impl_.detached_.MergeFrom(from._impl_.detached_);
+  if (from._internal_next_seq() != 0) {
+    _this->_internal_set_next_seq(from._internal_next_seq());
+  }
+  if (from._internal_has_listener() != 0) {
+    _this->_internal_set_has_listener(from._internal_has_listener());
+  }
+  if (from._internal_last() != 0) {
+    _this->_internal_set_last(from._internal_last());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HandoffState::CopyFrom(const HandoffState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.HandoffState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HandoffState::IsInitialized() const {
+  return true;
+}
+
+void HandoffState::InternalSwap(HandoffState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.sessions_.InternalSwap(&other->_impl_.sessions_);
+  _impl_.detached_.InternalSwap(&other->_impl_.detached_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HandoffState, _impl_.last_)
+      + sizeof(HandoffState::_impl_.last_)
+      - PROTOBUF_FIELD_OFFSET(HandoffState, _impl_.next_seq_)>(
+          reinterpret_cast<char*>(&_impl_.next_seq_),
+          reinterpret_cast<char*>(&other->_impl_.next_seq_));
 }
 
-void Response::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Response_chat_2eproto.base);
-  message_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&operation_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&status_code_) -
-      reinterpret_cast<char*>(&operation_)) + sizeof(status_code_));
-  clear_has_result();
+::PROTOBUF_NAMESPACE_ID::Metadata HandoffState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[25]);
 }
 
-Response::~Response() {
-  // @@protoc_insertion_point(destructor:chat.Response)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+// ===================================================================
+
+class SnapshotUser::_Internal {
+ public:
+};
+
+SnapshotUser::SnapshotUser(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.SnapshotUser)
 }
+SnapshotUser::SnapshotUser(const SnapshotUser& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SnapshotUser* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rooms_){from._impl_.rooms_}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.last_active_){}
+    , decltype(_impl_.status_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-void Response::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  message_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (has_result()) {
-    clear_result();
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_ip().empty()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.last_active_, &from._impl_.last_active_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_) -
+    reinterpret_cast<char*>(&_impl_.last_active_)) + sizeof(_impl_.status_));
+  // @@protoc_insertion_point(copy_constructor:chat.SnapshotUser)
+}
+
+inline void SnapshotUser::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rooms_){arena}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.last_active_){int64_t{0}}
+    , decltype(_impl_.status_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SnapshotUser::~SnapshotUser() {
+  // @@protoc_insertion_point(destructor:chat.SnapshotUser)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-void Response::ArenaDtor(void* object) {
-  Response* _this = reinterpret_cast< Response* >(object);
-  (void)_this;
-}
-void Response::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void Response::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+inline void SnapshotUser::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rooms_.~RepeatedPtrField();
+  _impl_.username_.Destroy();
+  _impl_.ip_.Destroy();
 }
-const Response& Response::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Response_chat_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void Response::clear_result() {
-// @@protoc_insertion_point(one_of_clear_start:chat.Response)
-  switch (result_case()) {
-    case kUserList: {
-      if (GetArena() == nullptr) {
-        delete result_.user_list_;
-      }
-      break;
-    }
-    case kIncomingMessage: {
-      if (GetArena() == nullptr) {
-        delete result_.incoming_message_;
-      }
-      break;
-    }
-    case RESULT_NOT_SET: {
-      break;
-    }
-  }
-  _oneof_case_[0] = RESULT_NOT_SET;
+void SnapshotUser::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void Response::Clear() {
-// @@protoc_insertion_point(message_clear_start:chat.Response)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void SnapshotUser::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.SnapshotUser)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::memset(&operation_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&status_code_) -
-      reinterpret_cast<char*>(&operation_)) + sizeof(status_code_));
-  clear_result();
+  _impl_.rooms_.Clear();
+  _impl_.username_.ClearToEmpty();
+  _impl_.ip_.ClearToEmpty();
+  ::memset(&_impl_.last_active_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.status_) -
+      reinterpret_cast<char*>(&_impl_.last_active_)) + sizeof(_impl_.status_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Response::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* SnapshotUser::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .chat.Operation operation = 1;
+      // string username = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          _internal_set_operation(static_cast<::chat::Operation>(val));
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "chat.SnapshotUser.username"));
+        } else
+          goto handle_unusual;
         continue;
-      // .chat.StatusCode status_code = 2;
+      // string ip = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          _internal_set_status_code(static_cast<::chat::StatusCode>(val));
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "chat.SnapshotUser.ip"));
+        } else
+          goto handle_unusual;
         continue;
-      // string message = 3;
+      // .chat.UserStatus status = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          auto str = _internal_mutable_message();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.Response.message"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+          _internal_set_status(static_cast<::chat::UserStatus>(val));
+        } else
+          goto handle_unusual;
         continue;
-      // .chat.UserListResponse user_list = 4;
+      // int64 last_active = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_user_list(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.last_active_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // .chat.IncomingMessageResponse incoming_message = 5;
+      // repeated string rooms = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          ptr = ctx->ParseMessage(_internal_mutable_incoming_message(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_rooms();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "chat.SnapshotUser.rooms"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Response::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:chat.Response)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* SnapshotUser::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.SnapshotUser)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .chat.Operation operation = 1;
-  if (this->operation() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_operation(), target);
-  }
-
-  // .chat.StatusCode status_code = 2;
-  if (this->status_code() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      2, this->_internal_status_code(), target);
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.SnapshotUser.username");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
   }
 
-  // string message = 3;
-  if (this->message().size() > 0) {
+  // string ip = 2;
+  if (!this->_internal_ip().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      this->_internal_ip().data(), static_cast<int>(this->_internal_ip().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "chat.Response.message");
+      "chat.SnapshotUser.ip");
     target = stream->WriteStringMaybeAliased(
-        3, this->_internal_message(), target);
+        2, this->_internal_ip(), target);
   }
 
-  // .chat.UserListResponse user_list = 4;
-  if (_internal_has_user_list()) {
+  // .chat.UserStatus status = 3;
+  if (this->_internal_status() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::user_list(this), target, stream);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_status(), target);
   }
 
-  // .chat.IncomingMessageResponse incoming_message = 5;
-  if (_internal_has_incoming_message()) {
+  // int64 last_active = 4;
+  if (this->_internal_last_active() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        5, _Internal::incoming_message(this), target, stream);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_last_active(), target);
+  }
+
+  // repeated string rooms = 5;
+  for (int i = 0, n = this->_internal_rooms_size(); i < n; i++) {
+    const auto& s = this->_internal_rooms(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.SnapshotUser.rooms");
+    target = stream->WriteString(5, s, target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:chat.Response)
+  // @@protoc_insertion_point(serialize_to_array_end:chat.SnapshotUser)
   return target;
 }
 
-size_t Response::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:chat.Response)
+size_t SnapshotUser::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.SnapshotUser)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string message = 3;
-  if (this->message().size() > 0) {
+  // repeated string rooms = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.rooms_.size());
+  for (int i = 0, n = _impl_.rooms_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.rooms_.Get(i));
+  }
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_message());
+        this->_internal_username());
   }
 
-  // .chat.Operation operation = 1;
-  if (this->operation() != 0) {
+  // string ip = 2;
+  if (!this->_internal_ip().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_operation());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ip());
   }
 
-  // .chat.StatusCode status_code = 2;
-  if (this->status_code() != 0) {
+  // int64 last_active = 4;
+  if (this->_internal_last_active() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_last_active());
+  }
+
+  // .chat.UserStatus status = 3;
+  if (this->_internal_status() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_status_code());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
   }
 
-  switch (result_case()) {
-    // .chat.UserListResponse user_list = 4;
-    case kUserList: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *result_.user_list_);
-      break;
-    }
-    // .chat.IncomingMessageResponse incoming_message = 5;
-    case kIncomingMessage: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *result_.incoming_message_);
-      break;
-    }
-    case RESULT_NOT_SET: {
-      break;
-    }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SnapshotUser::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SnapshotUser::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SnapshotUser::GetClassData() const { return &_class_data_; }
+
+
+void SnapshotUser::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SnapshotUser*>(&to_msg);
+  auto& from = static_cast<const SnapshotUser&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.SnapshotUser)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rooms_.MergeFrom(from._impl_.rooms_);
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  if (!from._internal_ip().empty()) {
+    _this->_internal_set_ip(from._internal_ip());
+  }
+  if (from._internal_last_active() != 0) {
+    _this->_internal_set_last_active(from._internal_last_active());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Response::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.Response)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Response* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Response>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.Response)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.Response)
-    MergeFrom(*source);
-  }
+void SnapshotUser::CopyFrom(const SnapshotUser& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.SnapshotUser)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SnapshotUser::IsInitialized() const {
+  return true;
+}
+
+void SnapshotUser::InternalSwap(SnapshotUser* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.rooms_.InternalSwap(&other->_impl_.rooms_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SnapshotUser, _impl_.status_)
+      + sizeof(SnapshotUser::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(SnapshotUser, _impl_.last_active_)>(
+          reinterpret_cast<char*>(&_impl_.last_active_),
+          reinterpret_cast<char*>(&other->_impl_.last_active_));
 }
 
-void Response::MergeFrom(const Response& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.Response)
-  GOOGLE_DCHECK_NE(&from, this);
+::PROTOBUF_NAMESPACE_ID::Metadata SnapshotUser::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[26]);
+}
+
+// ===================================================================
+
+class ServerSnapshot::_Internal {
+ public:
+};
+
+ServerSnapshot::ServerSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ServerSnapshot)
+}
+ServerSnapshot::ServerSnapshot(const ServerSnapshot& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerSnapshot* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.users_){from._impl_.users_}
+    , decltype(_impl_.taken_at_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  _this->_impl_.taken_at_ = from._impl_.taken_at_;
+  // @@protoc_insertion_point(copy_constructor:chat.ServerSnapshot)
+}
+
+inline void ServerSnapshot::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.users_){arena}
+    , decltype(_impl_.taken_at_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ServerSnapshot::~ServerSnapshot() {
+  // @@protoc_insertion_point(destructor:chat.ServerSnapshot)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerSnapshot::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.users_.~RepeatedPtrField();
+}
+
+void ServerSnapshot::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerSnapshot::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ServerSnapshot)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.users_.Clear();
+  _impl_.taken_at_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerSnapshot::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 taken_at = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.taken_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.SnapshotUser users = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_users(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerSnapshot::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ServerSnapshot)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.message().size() > 0) {
-    _internal_set_message(from._internal_message());
+  // int64 taken_at = 1;
+  if (this->_internal_taken_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_taken_at(), target);
+  }
+
+  // repeated .chat.SnapshotUser users = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_users_size()); i < n; i++) {
+    const auto& repfield = this->_internal_users(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
-  if (from.operation() != 0) {
-    _internal_set_operation(from._internal_operation());
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  if (from.status_code() != 0) {
-    _internal_set_status_code(from._internal_status_code());
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ServerSnapshot)
+  return target;
+}
+
+size_t ServerSnapshot::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ServerSnapshot)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.SnapshotUser users = 2;
+  total_size += 1UL * this->_internal_users_size();
+  for (const auto& msg : this->_impl_.users_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  switch (from.result_case()) {
-    case kUserList: {
-      _internal_mutable_user_list()->::chat::UserListResponse::MergeFrom(from._internal_user_list());
-      break;
-    }
-    case kIncomingMessage: {
-      _internal_mutable_incoming_message()->::chat::IncomingMessageResponse::MergeFrom(from._internal_incoming_message());
-      break;
-    }
-    case RESULT_NOT_SET: {
-      break;
-    }
+
+  // int64 taken_at = 1;
+  if (this->_internal_taken_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_taken_at());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Response::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.Response)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerSnapshot::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerSnapshot::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerSnapshot::GetClassData() const { return &_class_data_; }
+
+
+void ServerSnapshot::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerSnapshot*>(&to_msg);
+  auto& from = static_cast<const ServerSnapshot&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ServerSnapshot)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.users_.MergeFrom(from._impl_.users_);
+  if (from._internal_taken_at() != 0) {
+    _this->_internal_set_taken_at(from._internal_taken_at());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Response::CopyFrom(const Response& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:chat.Response)
+void ServerSnapshot::CopyFrom(const ServerSnapshot& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ServerSnapshot)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Response::IsInitialized() const {
+bool ServerSnapshot::IsInitialized() const {
   return true;
 }
 
-void Response::InternalSwap(Response* other) {
+void ServerSnapshot::InternalSwap(ServerSnapshot* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  message_.Swap(&other->message_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Response, status_code_)
-      + sizeof(Response::status_code_)
-      - PROTOBUF_FIELD_OFFSET(Response, operation_)>(
-          reinterpret_cast<char*>(&operation_),
-          reinterpret_cast<char*>(&other->operation_));
-  swap(result_, other->result_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.users_.InternalSwap(&other->_impl_.users_);
+  swap(_impl_.taken_at_, other->_impl_.taken_at_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Response::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata ServerSnapshot::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[27]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace chat
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::chat::User* Arena::CreateMaybeMessage< ::chat::User >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::User*
+Arena::CreateMaybeMessage< ::chat::User >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::User >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::NewUserRequest* Arena::CreateMaybeMessage< ::chat::NewUserRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::NewUserRequest*
+Arena::CreateMaybeMessage< ::chat::NewUserRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::NewUserRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::SendMessageRequest* Arena::CreateMaybeMessage< ::chat::SendMessageRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::ResumeRequest*
+Arena::CreateMaybeMessage< ::chat::ResumeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ResumeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::SendMessageRequest*
+Arena::CreateMaybeMessage< ::chat::SendMessageRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::SendMessageRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::IncomingMessageResponse* Arena::CreateMaybeMessage< ::chat::IncomingMessageResponse >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::IncomingMessageResponse*
+Arena::CreateMaybeMessage< ::chat::IncomingMessageResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::IncomingMessageResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::UserListRequest* Arena::CreateMaybeMessage< ::chat::UserListRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::UserListRequest*
+Arena::CreateMaybeMessage< ::chat::UserListRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::UserListRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::UserListResponse* Arena::CreateMaybeMessage< ::chat::UserListResponse >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::UserListResponse*
+Arena::CreateMaybeMessage< ::chat::UserListResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::UserListResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::UpdateStatusRequest* Arena::CreateMaybeMessage< ::chat::UpdateStatusRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::UpdateStatusRequest*
+Arena::CreateMaybeMessage< ::chat::UpdateStatusRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::UpdateStatusRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::Request* Arena::CreateMaybeMessage< ::chat::Request >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::RoomRequest*
+Arena::CreateMaybeMessage< ::chat::RoomRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::RoomRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::HistoryRequest*
+Arena::CreateMaybeMessage< ::chat::HistoryRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::HistoryRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::Receipts*
+Arena::CreateMaybeMessage< ::chat::Receipts >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::Receipts >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::BatchRequest*
+Arena::CreateMaybeMessage< ::chat::BatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::BatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::BatchResponse*
+Arena::CreateMaybeMessage< ::chat::BatchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::BatchResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::HistoryResponse*
+Arena::CreateMaybeMessage< ::chat::HistoryResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::HistoryResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::StoredMessage*
+Arena::CreateMaybeMessage< ::chat::StoredMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::StoredMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::Request*
+Arena::CreateMaybeMessage< ::chat::Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::Request >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::Response* Arena::CreateMaybeMessage< ::chat::Response >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::ShutdownNotice*
+Arena::CreateMaybeMessage< ::chat::ShutdownNotice >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ShutdownNotice >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::Response*
+Arena::CreateMaybeMessage< ::chat::Response >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::Response >(arena);
 }
+template<> PROTOBUF_NOINLINE ::chat::PeerPresence*
+Arena::CreateMaybeMessage< ::chat::PeerPresence >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::PeerPresence >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::PresenceDigest*
+Arena::CreateMaybeMessage< ::chat::PresenceDigest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::PresenceDigest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::PeerMessage*
+Arena::CreateMaybeMessage< ::chat::PeerMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::PeerMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::HandoffSession*
+Arena::CreateMaybeMessage< ::chat::HandoffSession >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::HandoffSession >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::PartialTransfer*
+Arena::CreateMaybeMessage< ::chat::PartialTransfer >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::PartialTransfer >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::BufferedFrame*
+Arena::CreateMaybeMessage< ::chat::BufferedFrame >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::BufferedFrame >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::DetachedSession*
+Arena::CreateMaybeMessage< ::chat::DetachedSession >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::DetachedSession >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::HandoffState*
+Arena::CreateMaybeMessage< ::chat::HandoffState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::HandoffState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::SnapshotUser*
+Arena::CreateMaybeMessage< ::chat::SnapshotUser >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::SnapshotUser >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ServerSnapshot*
+Arena::CreateMaybeMessage< ::chat::ServerSnapshot >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ServerSnapshot >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
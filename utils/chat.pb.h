@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,9 +23,7 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
@@ -44,52 +42,120 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_chat_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[9]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_chat_2eproto;
 namespace chat {
+class BatchRequest;
+struct BatchRequestDefaultTypeInternal;
+extern BatchRequestDefaultTypeInternal _BatchRequest_default_instance_;
+class BatchResponse;
+struct BatchResponseDefaultTypeInternal;
+extern BatchResponseDefaultTypeInternal _BatchResponse_default_instance_;
+class BufferedFrame;
+struct BufferedFrameDefaultTypeInternal;
+extern BufferedFrameDefaultTypeInternal _BufferedFrame_default_instance_;
+class DetachedSession;
+struct DetachedSessionDefaultTypeInternal;
+extern DetachedSessionDefaultTypeInternal _DetachedSession_default_instance_;
+class HandoffSession;
+struct HandoffSessionDefaultTypeInternal;
+extern HandoffSessionDefaultTypeInternal _HandoffSession_default_instance_;
+class HandoffState;
+struct HandoffStateDefaultTypeInternal;
+extern HandoffStateDefaultTypeInternal _HandoffState_default_instance_;
+class HistoryRequest;
+struct HistoryRequestDefaultTypeInternal;
+extern HistoryRequestDefaultTypeInternal _HistoryRequest_default_instance_;
+class HistoryResponse;
+struct HistoryResponseDefaultTypeInternal;
+extern HistoryResponseDefaultTypeInternal _HistoryResponse_default_instance_;
 class IncomingMessageResponse;
-class IncomingMessageResponseDefaultTypeInternal;
+struct IncomingMessageResponseDefaultTypeInternal;
 extern IncomingMessageResponseDefaultTypeInternal _IncomingMessageResponse_default_instance_;
 class NewUserRequest;
-class NewUserRequestDefaultTypeInternal;
+struct NewUserRequestDefaultTypeInternal;
 extern NewUserRequestDefaultTypeInternal _NewUserRequest_default_instance_;
+class PartialTransfer;
+struct PartialTransferDefaultTypeInternal;
+extern PartialTransferDefaultTypeInternal _PartialTransfer_default_instance_;
+class PeerMessage;
+struct PeerMessageDefaultTypeInternal;
+extern PeerMessageDefaultTypeInternal _PeerMessage_default_instance_;
+class PeerPresence;
+struct PeerPresenceDefaultTypeInternal;
+extern PeerPresenceDefaultTypeInternal _PeerPresence_default_instance_;
+class PresenceDigest;
+struct PresenceDigestDefaultTypeInternal;
+extern PresenceDigestDefaultTypeInternal _PresenceDigest_default_instance_;
+class Receipts;
+struct ReceiptsDefaultTypeInternal;
+extern ReceiptsDefaultTypeInternal _Receipts_default_instance_;
 class Request;
-class RequestDefaultTypeInternal;
+struct RequestDefaultTypeInternal;
 extern RequestDefaultTypeInternal _Request_default_instance_;
 class Response;
-class ResponseDefaultTypeInternal;
+struct ResponseDefaultTypeInternal;
 extern ResponseDefaultTypeInternal _Response_default_instance_;
+class ResumeRequest;
+struct ResumeRequestDefaultTypeInternal;
+extern ResumeRequestDefaultTypeInternal _ResumeRequest_default_instance_;
+class RoomRequest;
+struct RoomRequestDefaultTypeInternal;
+extern RoomRequestDefaultTypeInternal _RoomRequest_default_instance_;
 class SendMessageRequest;
-class SendMessageRequestDefaultTypeInternal;
+struct SendMessageRequestDefaultTypeInternal;
 extern SendMessageRequestDefaultTypeInternal _SendMessageRequest_default_instance_;
+class ServerSnapshot;
+struct ServerSnapshotDefaultTypeInternal;
+extern ServerSnapshotDefaultTypeInternal _ServerSnapshot_default_instance_;
+class ShutdownNotice;
+struct ShutdownNoticeDefaultTypeInternal;
+extern ShutdownNoticeDefaultTypeInternal _ShutdownNotice_default_instance_;
+class SnapshotUser;
+struct SnapshotUserDefaultTypeInternal;
+extern SnapshotUserDefaultTypeInternal _SnapshotUser_default_instance_;
+class StoredMessage;
+struct StoredMessageDefaultTypeInternal;
+extern StoredMessageDefaultTypeInternal _StoredMessage_default_instance_;
 class UpdateStatusRequest;
-class UpdateStatusRequestDefaultTypeInternal;
+struct UpdateStatusRequestDefaultTypeInternal;
 extern UpdateStatusRequestDefaultTypeInternal _UpdateStatusRequest_default_instance_;
 class User;
-class UserDefaultTypeInternal;
+struct UserDefaultTypeInternal;
 extern UserDefaultTypeInternal _User_default_instance_;
 class UserListRequest;
-class UserListRequestDefaultTypeInternal;
+struct UserListRequestDefaultTypeInternal;
 extern UserListRequestDefaultTypeInternal _UserListRequest_default_instance_;
 class UserListResponse;
-class UserListResponseDefaultTypeInternal;
+struct UserListResponseDefaultTypeInternal;
 extern UserListResponseDefaultTypeInternal _UserListResponse_default_instance_;
 }  // namespace chat
 PROTOBUF_NAMESPACE_OPEN
+template<> ::chat::BatchRequest* Arena::CreateMaybeMessage<::chat::BatchRequest>(Arena*);
+template<> ::chat::BatchResponse* Arena::CreateMaybeMessage<::chat::BatchResponse>(Arena*);
+template<> ::chat::BufferedFrame* Arena::CreateMaybeMessage<::chat::BufferedFrame>(Arena*);
+template<> ::chat::DetachedSession* Arena::CreateMaybeMessage<::chat::DetachedSession>(Arena*);
+template<> ::chat::HandoffSession* Arena::CreateMaybeMessage<::chat::HandoffSession>(Arena*);
+template<> ::chat::HandoffState* Arena::CreateMaybeMessage<::chat::HandoffState>(Arena*);
+template<> ::chat::HistoryRequest* Arena::CreateMaybeMessage<::chat::HistoryRequest>(Arena*);
+template<> ::chat::HistoryResponse* Arena::CreateMaybeMessage<::chat::HistoryResponse>(Arena*);
 template<> ::chat::IncomingMessageResponse* Arena::CreateMaybeMessage<::chat::IncomingMessageResponse>(Arena*);
 template<> ::chat::NewUserRequest* Arena::CreateMaybeMessage<::chat::NewUserRequest>(Arena*);
+template<> ::chat::PartialTransfer* Arena::CreateMaybeMessage<::chat::PartialTransfer>(Arena*);
+template<> ::chat::PeerMessage* Arena::CreateMaybeMessage<::chat::PeerMessage>(Arena*);
+template<> ::chat::PeerPresence* Arena::CreateMaybeMessage<::chat::PeerPresence>(Arena*);
+template<> ::chat::PresenceDigest* Arena::CreateMaybeMessage<::chat::PresenceDigest>(Arena*);
+template<> ::chat::Receipts* Arena::CreateMaybeMessage<::chat::Receipts>(Arena*);
 template<> ::chat::Request* Arena::CreateMaybeMessage<::chat::Request>(Arena*);
 template<> ::chat::Response* Arena::CreateMaybeMessage<::chat::Response>(Arena*);
+template<> ::chat::ResumeRequest* Arena::CreateMaybeMessage<::chat::ResumeRequest>(Arena*);
+template<> ::chat::RoomRequest* Arena::CreateMaybeMessage<::chat::RoomRequest>(Arena*);
 template<> ::chat::SendMessageRequest* Arena::CreateMaybeMessage<::chat::SendMessageRequest>(Arena*);
+template<> ::chat::ServerSnapshot* Arena::CreateMaybeMessage<::chat::ServerSnapshot>(Arena*);
+template<> ::chat::ShutdownNotice* Arena::CreateMaybeMessage<::chat::ShutdownNotice>(Arena*);
+template<> ::chat::SnapshotUser* Arena::CreateMaybeMessage<::chat::SnapshotUser>(Arena*);
+template<> ::chat::StoredMessage* Arena::CreateMaybeMessage<::chat::StoredMessage>(Arena*);
 template<> ::chat::UpdateStatusRequest* Arena::CreateMaybeMessage<::chat::UpdateStatusRequest>(Arena*);
 template<> ::chat::User* Arena::CreateMaybeMessage<::chat::User>(Arena*);
 template<> ::chat::UserListRequest* Arena::CreateMaybeMessage<::chat::UserListRequest>(Arena*);
@@ -101,8 +167,8 @@ enum UserStatus : int {
   ONLINE = 0,
   BUSY = 1,
   OFFLINE = 2,
-  UserStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  UserStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  UserStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  UserStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool UserStatus_IsValid(int value);
 constexpr UserStatus UserStatus_MIN = ONLINE;
@@ -119,19 +185,71 @@ inline const std::string& UserStatus_Name(T enum_t_value) {
     UserStatus_descriptor(), enum_t_value);
 }
 inline bool UserStatus_Parse(
-    const std::string& name, UserStatus* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, UserStatus* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<UserStatus>(
     UserStatus_descriptor(), name, value);
 }
+enum FlushPolicy : int {
+  FLUSH_ADAPTIVE = 0,
+  FLUSH_IMMEDIATE = 1,
+  FLUSH_COALESCE = 2,
+  FlushPolicy_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  FlushPolicy_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool FlushPolicy_IsValid(int value);
+constexpr FlushPolicy FlushPolicy_MIN = FLUSH_ADAPTIVE;
+constexpr FlushPolicy FlushPolicy_MAX = FLUSH_COALESCE;
+constexpr int FlushPolicy_ARRAYSIZE = FlushPolicy_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FlushPolicy_descriptor();
+template<typename T>
+inline const std::string& FlushPolicy_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, FlushPolicy>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function FlushPolicy_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    FlushPolicy_descriptor(), enum_t_value);
+}
+inline bool FlushPolicy_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, FlushPolicy* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<FlushPolicy>(
+    FlushPolicy_descriptor(), name, value);
+}
+enum Compression : int {
+  COMPRESSION_NONE = 0,
+  COMPRESSION_DEFLATE = 1,
+  Compression_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Compression_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Compression_IsValid(int value);
+constexpr Compression Compression_MIN = COMPRESSION_NONE;
+constexpr Compression Compression_MAX = COMPRESSION_DEFLATE;
+constexpr int Compression_ARRAYSIZE = Compression_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Compression_descriptor();
+template<typename T>
+inline const std::string& Compression_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Compression>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Compression_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Compression_descriptor(), enum_t_value);
+}
+inline bool Compression_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Compression* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Compression>(
+    Compression_descriptor(), name, value);
+}
 enum MessageType : int {
   BROADCAST = 0,
   DIRECT = 1,
-  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  ROOM = 2,
+  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool MessageType_IsValid(int value);
 constexpr MessageType MessageType_MIN = BROADCAST;
-constexpr MessageType MessageType_MAX = DIRECT;
+constexpr MessageType MessageType_MAX = ROOM;
 constexpr int MessageType_ARRAYSIZE = MessageType_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor();
@@ -144,15 +262,15 @@ inline const std::string& MessageType_Name(T enum_t_value) {
     MessageType_descriptor(), enum_t_value);
 }
 inline bool MessageType_Parse(
-    const std::string& name, MessageType* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MessageType* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageType>(
     MessageType_descriptor(), name, value);
 }
 enum UserListType : int {
   ALL = 0,
   SINGLE = 1,
-  UserListType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  UserListType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  UserListType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  UserListType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool UserListType_IsValid(int value);
 constexpr UserListType UserListType_MIN = ALL;
@@ -169,7 +287,7 @@ inline const std::string& UserListType_Name(T enum_t_value) {
     UserListType_descriptor(), enum_t_value);
 }
 inline bool UserListType_Parse(
-    const std::string& name, UserListType* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, UserListType* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<UserListType>(
     UserListType_descriptor(), name, value);
 }
@@ -180,12 +298,21 @@ enum Operation : int {
   GET_USERS = 3,
   UNREGISTER_USER = 4,
   INCOMING_MESSAGE = 5,
-  Operation_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  Operation_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  GET_HISTORY = 6,
+  JOIN_ROOM = 7,
+  LEAVE_ROOM = 8,
+  SEND_ROOM_MESSAGE = 9,
+  SERVER_SHUTDOWN = 10,
+  BATCH = 11,
+  ACKNOWLEDGE = 12,
+  RECEIPTS = 13,
+  RESUME = 14,
+  Operation_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Operation_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool Operation_IsValid(int value);
 constexpr Operation Operation_MIN = REGISTER_USER;
-constexpr Operation Operation_MAX = INCOMING_MESSAGE;
+constexpr Operation Operation_MAX = RESUME;
 constexpr int Operation_ARRAYSIZE = Operation_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Operation_descriptor();
@@ -198,7 +325,7 @@ inline const std::string& Operation_Name(T enum_t_value) {
     Operation_descriptor(), enum_t_value);
 }
 inline bool Operation_Parse(
-    const std::string& name, Operation* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Operation* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Operation>(
     Operation_descriptor(), name, value);
 }
@@ -206,13 +333,15 @@ enum StatusCode : int {
   UNKNOWN_STATUS = 0,
   OK = 200,
   BAD_REQUEST = 400,
+  TOO_MANY_REQUESTS = 429,
   INTERNAL_SERVER_ERROR = 500,
-  StatusCode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  StatusCode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  SERVICE_UNAVAILABLE = 503,
+  StatusCode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  StatusCode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool StatusCode_IsValid(int value);
 constexpr StatusCode StatusCode_MIN = UNKNOWN_STATUS;
-constexpr StatusCode StatusCode_MAX = INTERNAL_SERVER_ERROR;
+constexpr StatusCode StatusCode_MAX = SERVICE_UNAVAILABLE;
 constexpr int StatusCode_ARRAYSIZE = StatusCode_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatusCode_descriptor();
@@ -225,17 +354,46 @@ inline const std::string& StatusCode_Name(T enum_t_value) {
     StatusCode_descriptor(), enum_t_value);
 }
 inline bool StatusCode_Parse(
-    const std::string& name, StatusCode* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, StatusCode* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StatusCode>(
     StatusCode_descriptor(), name, value);
 }
+enum PeerOperation : int {
+  PEER_HELLO = 0,
+  PEER_DIGEST = 1,
+  PEER_FORWARD = 2,
+  PEER_LOCATION = 3,
+  PEER_GOSSIP = 4,
+  PeerOperation_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  PeerOperation_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool PeerOperation_IsValid(int value);
+constexpr PeerOperation PeerOperation_MIN = PEER_HELLO;
+constexpr PeerOperation PeerOperation_MAX = PEER_GOSSIP;
+constexpr int PeerOperation_ARRAYSIZE = PeerOperation_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PeerOperation_descriptor();
+template<typename T>
+inline const std::string& PeerOperation_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PeerOperation>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PeerOperation_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PeerOperation_descriptor(), enum_t_value);
+}
+inline bool PeerOperation_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PeerOperation* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PeerOperation>(
+    PeerOperation_descriptor(), name, value);
+}
 // ===================================================================
 
-class User PROTOBUF_FINAL :
+class User final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.User) */ {
  public:
-  inline User() : User(nullptr) {};
-  virtual ~User();
+  inline User() : User(nullptr) {}
+  ~User() override;
+  explicit PROTOBUF_CONSTEXPR User(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   User(const User& from);
   User(User&& from) noexcept
@@ -248,8 +406,13 @@ class User PROTOBUF_FINAL :
     return *this;
   }
   inline User& operator=(User&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -260,14 +423,14 @@ class User PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const User& default_instance() {
+    return *internal_default_instance();
   }
-  static const User& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const User* internal_default_instance() {
     return reinterpret_cast<const User*>(
                &_User_default_instance_);
@@ -280,7 +443,12 @@ class User PROTOBUF_FINAL :
   }
   inline void Swap(User* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -288,56 +456,53 @@ class User PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(User* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline User* New() const final {
-    return CreateMaybeMessage<User>(nullptr);
-  }
-
-  User* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  User* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<User>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const User& from);
-  void MergeFrom(const User& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const User& from) {
+    User::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(User* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "chat.User";
   }
   protected:
-  explicit User(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit User(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -350,25 +515,14 @@ class User PROTOBUF_FINAL :
   // string username = 1;
   void clear_username();
   const std::string& username() const;
-  void set_username(const std::string& value);
-  void set_username(std::string&& value);
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
   std::string* mutable_username();
-  std::string* release_username();
+  PROTOBUF_NODISCARD std::string* release_username();
   void set_allocated_username(std::string* username);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_username();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_username(
-      std::string* username);
   private:
   const std::string& _internal_username() const;
-  void _internal_set_username(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
   std::string* _internal_mutable_username();
   public:
 
@@ -388,18 +542,22 @@ class User PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
-  int status_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NewUserRequest PROTOBUF_FINAL :
+class NewUserRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.NewUserRequest) */ {
  public:
-  inline NewUserRequest() : NewUserRequest(nullptr) {};
-  virtual ~NewUserRequest();
+  inline NewUserRequest() : NewUserRequest(nullptr) {}
+  ~NewUserRequest() override;
+  explicit PROTOBUF_CONSTEXPR NewUserRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NewUserRequest(const NewUserRequest& from);
   NewUserRequest(NewUserRequest&& from) noexcept
@@ -412,8 +570,13 @@ class NewUserRequest PROTOBUF_FINAL :
     return *this;
   }
   inline NewUserRequest& operator=(NewUserRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -424,14 +587,14 @@ class NewUserRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NewUserRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const NewUserRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const NewUserRequest* internal_default_instance() {
     return reinterpret_cast<const NewUserRequest*>(
                &_NewUserRequest_default_instance_);
@@ -444,7 +607,12 @@ class NewUserRequest PROTOBUF_FINAL :
   }
   inline void Swap(NewUserRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -452,107 +620,338 @@ class NewUserRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(NewUserRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline NewUserRequest* New() const final {
-    return CreateMaybeMessage<NewUserRequest>(nullptr);
-  }
-
-  NewUserRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  NewUserRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<NewUserRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NewUserRequest& from);
-  void MergeFrom(const NewUserRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NewUserRequest& from) {
+    NewUserRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(NewUserRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "chat.NewUserRequest";
   }
   protected:
-  explicit NewUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit NewUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
   ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kFlushPolicyFieldNumber = 2,
+    kCompressionFieldNumber = 3,
+    kCompactFieldNumber = 4,
+    kResumableFieldNumber = 5,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // .chat.FlushPolicy flush_policy = 2;
+  void clear_flush_policy();
+  ::chat::FlushPolicy flush_policy() const;
+  void set_flush_policy(::chat::FlushPolicy value);
   private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
+  ::chat::FlushPolicy _internal_flush_policy() const;
+  void _internal_set_flush_policy(::chat::FlushPolicy value);
+  public:
+
+  // .chat.Compression compression = 3;
+  void clear_compression();
+  ::chat::Compression compression() const;
+  void set_compression(::chat::Compression value);
+  private:
+  ::chat::Compression _internal_compression() const;
+  void _internal_set_compression(::chat::Compression value);
+  public:
+
+  // bool compact = 4;
+  void clear_compact();
+  bool compact() const;
+  void set_compact(bool value);
+  private:
+  bool _internal_compact() const;
+  void _internal_set_compact(bool value);
+  public:
+
+  // bool resumable = 5;
+  void clear_resumable();
+  bool resumable() const;
+  void set_resumable(bool value);
+  private:
+  bool _internal_resumable() const;
+  void _internal_set_resumable(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.NewUserRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    int flush_policy_;
+    int compression_;
+    bool compact_;
+    bool resumable_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ResumeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ResumeRequest) */ {
+ public:
+  inline ResumeRequest() : ResumeRequest(nullptr) {}
+  ~ResumeRequest() override;
+  explicit PROTOBUF_CONSTEXPR ResumeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResumeRequest(const ResumeRequest& from);
+  ResumeRequest(ResumeRequest&& from) noexcept
+    : ResumeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ResumeRequest& operator=(const ResumeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResumeRequest& operator=(ResumeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResumeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResumeRequest* internal_default_instance() {
+    return reinterpret_cast<const ResumeRequest*>(
+               &_ResumeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ResumeRequest& a, ResumeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResumeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResumeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResumeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResumeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResumeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResumeRequest& from) {
+    ResumeRequest::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResumeRequest* other);
 
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ResumeRequest";
+  }
+  protected:
+  explicit ResumeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
     kUsernameFieldNumber = 1,
+    kTokenFieldNumber = 2,
+    kLastSeqFieldNumber = 3,
+    kFlushPolicyFieldNumber = 4,
+    kCompressionFieldNumber = 5,
   };
   // string username = 1;
   void clear_username();
   const std::string& username() const;
-  void set_username(const std::string& value);
-  void set_username(std::string&& value);
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
   std::string* mutable_username();
-  std::string* release_username();
+  PROTOBUF_NODISCARD std::string* release_username();
   void set_allocated_username(std::string* username);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_username();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_username(
-      std::string* username);
   private:
   const std::string& _internal_username() const;
-  void _internal_set_username(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
   std::string* _internal_mutable_username();
   public:
 
-  // @@protoc_insertion_point(class_scope:chat.NewUserRequest)
+  // uint64 token = 2;
+  void clear_token();
+  uint64_t token() const;
+  void set_token(uint64_t value);
+  private:
+  uint64_t _internal_token() const;
+  void _internal_set_token(uint64_t value);
+  public:
+
+  // uint64 last_seq = 3;
+  void clear_last_seq();
+  uint64_t last_seq() const;
+  void set_last_seq(uint64_t value);
+  private:
+  uint64_t _internal_last_seq() const;
+  void _internal_set_last_seq(uint64_t value);
+  public:
+
+  // .chat.FlushPolicy flush_policy = 4;
+  void clear_flush_policy();
+  ::chat::FlushPolicy flush_policy() const;
+  void set_flush_policy(::chat::FlushPolicy value);
+  private:
+  ::chat::FlushPolicy _internal_flush_policy() const;
+  void _internal_set_flush_policy(::chat::FlushPolicy value);
+  public:
+
+  // .chat.Compression compression = 5;
+  void clear_compression();
+  ::chat::Compression compression() const;
+  void set_compression(::chat::Compression value);
+  private:
+  ::chat::Compression _internal_compression() const;
+  void _internal_set_compression(::chat::Compression value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ResumeRequest)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    uint64_t token_;
+    uint64_t last_seq_;
+    int flush_policy_;
+    int compression_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SendMessageRequest PROTOBUF_FINAL :
+class SendMessageRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.SendMessageRequest) */ {
  public:
-  inline SendMessageRequest() : SendMessageRequest(nullptr) {};
-  virtual ~SendMessageRequest();
+  inline SendMessageRequest() : SendMessageRequest(nullptr) {}
+  ~SendMessageRequest() override;
+  explicit PROTOBUF_CONSTEXPR SendMessageRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SendMessageRequest(const SendMessageRequest& from);
   SendMessageRequest(SendMessageRequest&& from) noexcept
@@ -565,8 +964,13 @@ class SendMessageRequest PROTOBUF_FINAL :
     return *this;
   }
   inline SendMessageRequest& operator=(SendMessageRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -577,27 +981,32 @@ class SendMessageRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SendMessageRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const SendMessageRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const SendMessageRequest* internal_default_instance() {
     return reinterpret_cast<const SendMessageRequest*>(
                &_SendMessageRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
   friend void swap(SendMessageRequest& a, SendMessageRequest& b) {
     a.Swap(&b);
   }
   inline void Swap(SendMessageRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -605,56 +1014,53 @@ class SendMessageRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(SendMessageRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SendMessageRequest* New() const final {
-    return CreateMaybeMessage<SendMessageRequest>(nullptr);
-  }
-
-  SendMessageRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  SendMessageRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SendMessageRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SendMessageRequest& from);
-  void MergeFrom(const SendMessageRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SendMessageRequest& from) {
+    SendMessageRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SendMessageRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "chat.SendMessageRequest";
   }
   protected:
-  explicit SendMessageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit SendMessageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -667,50 +1073,28 @@ class SendMessageRequest PROTOBUF_FINAL :
   // string recipient = 1;
   void clear_recipient();
   const std::string& recipient() const;
-  void set_recipient(const std::string& value);
-  void set_recipient(std::string&& value);
-  void set_recipient(const char* value);
-  void set_recipient(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_recipient(ArgT0&& arg0, ArgT... args);
   std::string* mutable_recipient();
-  std::string* release_recipient();
+  PROTOBUF_NODISCARD std::string* release_recipient();
   void set_allocated_recipient(std::string* recipient);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_recipient();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_recipient(
-      std::string* recipient);
   private:
   const std::string& _internal_recipient() const;
-  void _internal_set_recipient(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_recipient(const std::string& value);
   std::string* _internal_mutable_recipient();
   public:
 
   // string content = 2;
   void clear_content();
   const std::string& content() const;
-  void set_content(const std::string& value);
-  void set_content(std::string&& value);
-  void set_content(const char* value);
-  void set_content(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
   std::string* mutable_content();
-  std::string* release_content();
+  PROTOBUF_NODISCARD std::string* release_content();
   void set_allocated_content(std::string* content);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_content();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_content(
-      std::string* content);
   private:
   const std::string& _internal_content() const;
-  void _internal_set_content(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
   std::string* _internal_mutable_content();
   public:
 
@@ -721,18 +1105,22 @@ class SendMessageRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr recipient_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr recipient_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class IncomingMessageResponse PROTOBUF_FINAL :
+class IncomingMessageResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.IncomingMessageResponse) */ {
  public:
-  inline IncomingMessageResponse() : IncomingMessageResponse(nullptr) {};
-  virtual ~IncomingMessageResponse();
+  inline IncomingMessageResponse() : IncomingMessageResponse(nullptr) {}
+  ~IncomingMessageResponse() override;
+  explicit PROTOBUF_CONSTEXPR IncomingMessageResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   IncomingMessageResponse(const IncomingMessageResponse& from);
   IncomingMessageResponse(IncomingMessageResponse&& from) noexcept
@@ -745,8 +1133,13 @@ class IncomingMessageResponse PROTOBUF_FINAL :
     return *this;
   }
   inline IncomingMessageResponse& operator=(IncomingMessageResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -757,27 +1150,32 @@ class IncomingMessageResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IncomingMessageResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const IncomingMessageResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const IncomingMessageResponse* internal_default_instance() {
     return reinterpret_cast<const IncomingMessageResponse*>(
                &_IncomingMessageResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
   friend void swap(IncomingMessageResponse& a, IncomingMessageResponse& b) {
     a.Swap(&b);
   }
   inline void Swap(IncomingMessageResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -785,56 +1183,53 @@ class IncomingMessageResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(IncomingMessageResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline IncomingMessageResponse* New() const final {
-    return CreateMaybeMessage<IncomingMessageResponse>(nullptr);
-  }
-
-  IncomingMessageResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  IncomingMessageResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<IncomingMessageResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const IncomingMessageResponse& from);
-  void MergeFrom(const IncomingMessageResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IncomingMessageResponse& from) {
+    IncomingMessageResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(IncomingMessageResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "chat.IncomingMessageResponse";
   }
   protected:
-  explicit IncomingMessageResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit IncomingMessageResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -843,58 +1238,63 @@ class IncomingMessageResponse PROTOBUF_FINAL :
   enum : int {
     kSenderFieldNumber = 1,
     kContentFieldNumber = 2,
+    kRoomFieldNumber = 5,
+    kTimestampFieldNumber = 4,
     kTypeFieldNumber = 3,
+    kSenderIdFieldNumber = 6,
+    kMessageIdFieldNumber = 7,
   };
   // string sender = 1;
   void clear_sender();
   const std::string& sender() const;
-  void set_sender(const std::string& value);
-  void set_sender(std::string&& value);
-  void set_sender(const char* value);
-  void set_sender(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sender(ArgT0&& arg0, ArgT... args);
   std::string* mutable_sender();
-  std::string* release_sender();
+  PROTOBUF_NODISCARD std::string* release_sender();
   void set_allocated_sender(std::string* sender);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_sender();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_sender(
-      std::string* sender);
   private:
   const std::string& _internal_sender() const;
-  void _internal_set_sender(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sender(const std::string& value);
   std::string* _internal_mutable_sender();
   public:
 
   // string content = 2;
   void clear_content();
   const std::string& content() const;
-  void set_content(const std::string& value);
-  void set_content(std::string&& value);
-  void set_content(const char* value);
-  void set_content(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
   std::string* mutable_content();
-  std::string* release_content();
+  PROTOBUF_NODISCARD std::string* release_content();
   void set_allocated_content(std::string* content);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_content();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_content(
-      std::string* content);
   private:
   const std::string& _internal_content() const;
-  void _internal_set_content(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
   std::string* _internal_mutable_content();
   public:
 
+  // string room = 5;
+  void clear_room();
+  const std::string& room() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_room(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_room();
+  PROTOBUF_NODISCARD std::string* release_room();
+  void set_allocated_room(std::string* room);
+  private:
+  const std::string& _internal_room() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_room(const std::string& value);
+  std::string* _internal_mutable_room();
+  public:
+
+  // int64 timestamp = 4;
+  void clear_timestamp();
+  int64_t timestamp() const;
+  void set_timestamp(int64_t value);
+  private:
+  int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(int64_t value);
+  public:
+
   // .chat.MessageType type = 3;
   void clear_type();
   ::chat::MessageType type() const;
@@ -904,6 +1304,24 @@ class IncomingMessageResponse PROTOBUF_FINAL :
   void _internal_set_type(::chat::MessageType value);
   public:
 
+  // uint32 sender_id = 6;
+  void clear_sender_id();
+  uint32_t sender_id() const;
+  void set_sender_id(uint32_t value);
+  private:
+  uint32_t _internal_sender_id() const;
+  void _internal_set_sender_id(uint32_t value);
+  public:
+
+  // uint64 message_id = 7;
+  void clear_message_id();
+  uint64_t message_id() const;
+  void set_message_id(uint64_t value);
+  private:
+  uint64_t _internal_message_id() const;
+  void _internal_set_message_id(uint64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:chat.IncomingMessageResponse)
  private:
   class _Internal;
@@ -911,19 +1329,27 @@ class IncomingMessageResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sender_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
-  int type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sender_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr room_;
+    int64_t timestamp_;
+    int type_;
+    uint32_t sender_id_;
+    uint64_t message_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UserListRequest PROTOBUF_FINAL :
+class UserListRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UserListRequest) */ {
  public:
-  inline UserListRequest() : UserListRequest(nullptr) {};
-  virtual ~UserListRequest();
+  inline UserListRequest() : UserListRequest(nullptr) {}
+  ~UserListRequest() override;
+  explicit PROTOBUF_CONSTEXPR UserListRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   UserListRequest(const UserListRequest& from);
   UserListRequest(UserListRequest&& from) noexcept
@@ -936,8 +1362,13 @@ class UserListRequest PROTOBUF_FINAL :
     return *this;
   }
   inline UserListRequest& operator=(UserListRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -948,27 +1379,32 @@ class UserListRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UserListRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const UserListRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const UserListRequest* internal_default_instance() {
     return reinterpret_cast<const UserListRequest*>(
                &_UserListRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
   friend void swap(UserListRequest& a, UserListRequest& b) {
     a.Swap(&b);
   }
   inline void Swap(UserListRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -976,56 +1412,53 @@ class UserListRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(UserListRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline UserListRequest* New() const final {
-    return CreateMaybeMessage<UserListRequest>(nullptr);
-  }
-
-  UserListRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  UserListRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<UserListRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const UserListRequest& from);
-  void MergeFrom(const UserListRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UserListRequest& from) {
+    UserListRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(UserListRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "chat.UserListRequest";
   }
   protected:
-  explicit UserListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit UserListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1037,25 +1470,14 @@ class UserListRequest PROTOBUF_FINAL :
   // string username = 1;
   void clear_username();
   const std::string& username() const;
-  void set_username(const std::string& value);
-  void set_username(std::string&& value);
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
   std::string* mutable_username();
-  std::string* release_username();
+  PROTOBUF_NODISCARD std::string* release_username();
   void set_allocated_username(std::string* username);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_username();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_username(
-      std::string* username);
   private:
   const std::string& _internal_username() const;
-  void _internal_set_username(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
   std::string* _internal_mutable_username();
   public:
 
@@ -1066,17 +1488,21 @@ class UserListRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UserListResponse PROTOBUF_FINAL :
+class UserListResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UserListResponse) */ {
  public:
-  inline UserListResponse() : UserListResponse(nullptr) {};
-  virtual ~UserListResponse();
+  inline UserListResponse() : UserListResponse(nullptr) {}
+  ~UserListResponse() override;
+  explicit PROTOBUF_CONSTEXPR UserListResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   UserListResponse(const UserListResponse& from);
   UserListResponse(UserListResponse&& from) noexcept
@@ -1089,8 +1515,13 @@ class UserListResponse PROTOBUF_FINAL :
     return *this;
   }
   inline UserListResponse& operator=(UserListResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1101,27 +1532,32 @@ class UserListResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UserListResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const UserListResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const UserListResponse* internal_default_instance() {
     return reinterpret_cast<const UserListResponse*>(
                &_UserListResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    6;
 
   friend void swap(UserListResponse& a, UserListResponse& b) {
     a.Swap(&b);
   }
   inline void Swap(UserListResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1129,56 +1565,53 @@ class UserListResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(UserListResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline UserListResponse* New() const final {
-    return CreateMaybeMessage<UserListResponse>(nullptr);
-  }
-
-  UserListResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  UserListResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<UserListResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const UserListResponse& from);
-  void MergeFrom(const UserListResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UserListResponse& from) {
+    UserListResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(UserListResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "chat.UserListResponse";
   }
   protected:
-  explicit UserListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit UserListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1222,18 +1655,22 @@ class UserListResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User > users_;
-  int type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User > users_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UpdateStatusRequest PROTOBUF_FINAL :
+class UpdateStatusRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UpdateStatusRequest) */ {
  public:
-  inline UpdateStatusRequest() : UpdateStatusRequest(nullptr) {};
-  virtual ~UpdateStatusRequest();
+  inline UpdateStatusRequest() : UpdateStatusRequest(nullptr) {}
+  ~UpdateStatusRequest() override;
+  explicit PROTOBUF_CONSTEXPR UpdateStatusRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   UpdateStatusRequest(const UpdateStatusRequest& from);
   UpdateStatusRequest(UpdateStatusRequest&& from) noexcept
@@ -1246,8 +1683,13 @@ class UpdateStatusRequest PROTOBUF_FINAL :
     return *this;
   }
   inline UpdateStatusRequest& operator=(UpdateStatusRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1258,27 +1700,32 @@ class UpdateStatusRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpdateStatusRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const UpdateStatusRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const UpdateStatusRequest* internal_default_instance() {
     return reinterpret_cast<const UpdateStatusRequest*>(
                &_UpdateStatusRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    7;
 
   friend void swap(UpdateStatusRequest& a, UpdateStatusRequest& b) {
     a.Swap(&b);
   }
   inline void Swap(UpdateStatusRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1286,56 +1733,53 @@ class UpdateStatusRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(UpdateStatusRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline UpdateStatusRequest* New() const final {
-    return CreateMaybeMessage<UpdateStatusRequest>(nullptr);
-  }
-
-  UpdateStatusRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  UpdateStatusRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<UpdateStatusRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const UpdateStatusRequest& from);
-  void MergeFrom(const UpdateStatusRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpdateStatusRequest& from) {
+    UpdateStatusRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(UpdateStatusRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "chat.UpdateStatusRequest";
   }
   protected:
-  explicit UpdateStatusRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit UpdateStatusRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1348,25 +1792,14 @@ class UpdateStatusRequest PROTOBUF_FINAL :
   // string username = 1;
   void clear_username();
   const std::string& username() const;
-  void set_username(const std::string& value);
-  void set_username(std::string&& value);
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
   std::string* mutable_username();
-  std::string* release_username();
+  PROTOBUF_NODISCARD std::string* release_username();
   void set_allocated_username(std::string* username);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_username();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_username(
-      std::string* username);
   private:
   const std::string& _internal_username() const;
-  void _internal_set_username(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
   std::string* _internal_mutable_username();
   public:
 
@@ -1386,32 +1819,41 @@ class UpdateStatusRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
-  int new_status_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    int new_status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Request PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.Request) */ {
+class RoomRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.RoomRequest) */ {
  public:
-  inline Request() : Request(nullptr) {};
-  virtual ~Request();
+  inline RoomRequest() : RoomRequest(nullptr) {}
+  ~RoomRequest() override;
+  explicit PROTOBUF_CONSTEXPR RoomRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Request(const Request& from);
-  Request(Request&& from) noexcept
-    : Request() {
+  RoomRequest(const RoomRequest& from);
+  RoomRequest(RoomRequest&& from) noexcept
+    : RoomRequest() {
     *this = ::std::move(from);
   }
 
-  inline Request& operator=(const Request& from) {
+  inline RoomRequest& operator=(const RoomRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Request& operator=(Request&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline RoomRequest& operator=(RoomRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1422,257 +1864,165 @@ class Request PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const Request& default_instance();
-
-  enum PayloadCase {
-    kRegisterUser = 2,
-    kSendMessage = 3,
-    kUpdateStatus = 4,
-    kGetUsers = 5,
-    kUnregisterUser = 6,
-    PAYLOAD_NOT_SET = 0,
-  };
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Request* internal_default_instance() {
-    return reinterpret_cast<const Request*>(
-               &_Request_default_instance_);
+  static const RoomRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoomRequest* internal_default_instance() {
+    return reinterpret_cast<const RoomRequest*>(
+               &_RoomRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    8;
 
-  friend void swap(Request& a, Request& b) {
+  friend void swap(RoomRequest& a, RoomRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(Request* other) {
+  inline void Swap(RoomRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Request* other) {
+  void UnsafeArenaSwap(RoomRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Request* New() const final {
-    return CreateMaybeMessage<Request>(nullptr);
+  RoomRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoomRequest>(arena);
   }
-
-  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Request>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoomRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomRequest& from) {
+    RoomRequest::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Request& from);
-  void MergeFrom(const Request& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Request* other);
+  void InternalSwap(RoomRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "chat.Request";
+    return "chat.RoomRequest";
   }
   protected:
-  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RoomRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kOperationFieldNumber = 1,
-    kRegisterUserFieldNumber = 2,
-    kSendMessageFieldNumber = 3,
-    kUpdateStatusFieldNumber = 4,
-    kGetUsersFieldNumber = 5,
-    kUnregisterUserFieldNumber = 6,
+    kRoomFieldNumber = 1,
+    kContentFieldNumber = 2,
   };
-  // .chat.Operation operation = 1;
-  void clear_operation();
-  ::chat::Operation operation() const;
-  void set_operation(::chat::Operation value);
-  private:
-  ::chat::Operation _internal_operation() const;
-  void _internal_set_operation(::chat::Operation value);
-  public:
-
-  // .chat.NewUserRequest register_user = 2;
-  bool has_register_user() const;
+  // string room = 1;
+  void clear_room();
+  const std::string& room() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_room(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_room();
+  PROTOBUF_NODISCARD std::string* release_room();
+  void set_allocated_room(std::string* room);
   private:
-  bool _internal_has_register_user() const;
-  public:
-  void clear_register_user();
-  const ::chat::NewUserRequest& register_user() const;
-  ::chat::NewUserRequest* release_register_user();
-  ::chat::NewUserRequest* mutable_register_user();
-  void set_allocated_register_user(::chat::NewUserRequest* register_user);
-  private:
-  const ::chat::NewUserRequest& _internal_register_user() const;
-  ::chat::NewUserRequest* _internal_mutable_register_user();
-  public:
-  void unsafe_arena_set_allocated_register_user(
-      ::chat::NewUserRequest* register_user);
-  ::chat::NewUserRequest* unsafe_arena_release_register_user();
-
-  // .chat.SendMessageRequest send_message = 3;
-  bool has_send_message() const;
-  private:
-  bool _internal_has_send_message() const;
-  public:
-  void clear_send_message();
-  const ::chat::SendMessageRequest& send_message() const;
-  ::chat::SendMessageRequest* release_send_message();
-  ::chat::SendMessageRequest* mutable_send_message();
-  void set_allocated_send_message(::chat::SendMessageRequest* send_message);
-  private:
-  const ::chat::SendMessageRequest& _internal_send_message() const;
-  ::chat::SendMessageRequest* _internal_mutable_send_message();
-  public:
-  void unsafe_arena_set_allocated_send_message(
-      ::chat::SendMessageRequest* send_message);
-  ::chat::SendMessageRequest* unsafe_arena_release_send_message();
-
-  // .chat.UpdateStatusRequest update_status = 4;
-  bool has_update_status() const;
-  private:
-  bool _internal_has_update_status() const;
-  public:
-  void clear_update_status();
-  const ::chat::UpdateStatusRequest& update_status() const;
-  ::chat::UpdateStatusRequest* release_update_status();
-  ::chat::UpdateStatusRequest* mutable_update_status();
-  void set_allocated_update_status(::chat::UpdateStatusRequest* update_status);
-  private:
-  const ::chat::UpdateStatusRequest& _internal_update_status() const;
-  ::chat::UpdateStatusRequest* _internal_mutable_update_status();
-  public:
-  void unsafe_arena_set_allocated_update_status(
-      ::chat::UpdateStatusRequest* update_status);
-  ::chat::UpdateStatusRequest* unsafe_arena_release_update_status();
-
-  // .chat.UserListRequest get_users = 5;
-  bool has_get_users() const;
-  private:
-  bool _internal_has_get_users() const;
-  public:
-  void clear_get_users();
-  const ::chat::UserListRequest& get_users() const;
-  ::chat::UserListRequest* release_get_users();
-  ::chat::UserListRequest* mutable_get_users();
-  void set_allocated_get_users(::chat::UserListRequest* get_users);
-  private:
-  const ::chat::UserListRequest& _internal_get_users() const;
-  ::chat::UserListRequest* _internal_mutable_get_users();
+  const std::string& _internal_room() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_room(const std::string& value);
+  std::string* _internal_mutable_room();
   public:
-  void unsafe_arena_set_allocated_get_users(
-      ::chat::UserListRequest* get_users);
-  ::chat::UserListRequest* unsafe_arena_release_get_users();
 
-  // .chat.User unregister_user = 6;
-  bool has_unregister_user() const;
-  private:
-  bool _internal_has_unregister_user() const;
-  public:
-  void clear_unregister_user();
-  const ::chat::User& unregister_user() const;
-  ::chat::User* release_unregister_user();
-  ::chat::User* mutable_unregister_user();
-  void set_allocated_unregister_user(::chat::User* unregister_user);
+  // string content = 2;
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
   private:
-  const ::chat::User& _internal_unregister_user() const;
-  ::chat::User* _internal_mutable_unregister_user();
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
   public:
-  void unsafe_arena_set_allocated_unregister_user(
-      ::chat::User* unregister_user);
-  ::chat::User* unsafe_arena_release_unregister_user();
 
-  void clear_payload();
-  PayloadCase payload_case() const;
-  // @@protoc_insertion_point(class_scope:chat.Request)
+  // @@protoc_insertion_point(class_scope:chat.RoomRequest)
  private:
   class _Internal;
-  void set_has_register_user();
-  void set_has_send_message();
-  void set_has_update_status();
-  void set_has_get_users();
-  void set_has_unregister_user();
-
-  inline bool has_payload() const;
-  inline void clear_has_payload();
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  int operation_;
-  union PayloadUnion {
-    PayloadUnion() {}
-    ::chat::NewUserRequest* register_user_;
-    ::chat::SendMessageRequest* send_message_;
-    ::chat::UpdateStatusRequest* update_status_;
-    ::chat::UserListRequest* get_users_;
-    ::chat::User* unregister_user_;
-  } payload_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
-
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr room_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Response PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.Response) */ {
+class HistoryRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.HistoryRequest) */ {
  public:
-  inline Response() : Response(nullptr) {};
-  virtual ~Response();
+  inline HistoryRequest() : HistoryRequest(nullptr) {}
+  ~HistoryRequest() override;
+  explicit PROTOBUF_CONSTEXPR HistoryRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Response(const Response& from);
-  Response(Response&& from) noexcept
-    : Response() {
+  HistoryRequest(const HistoryRequest& from);
+  HistoryRequest(HistoryRequest&& from) noexcept
+    : HistoryRequest() {
     *this = ::std::move(from);
   }
 
-  inline Response& operator=(const Response& from) {
+  inline HistoryRequest& operator=(const HistoryRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Response& operator=(Response&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline HistoryRequest& operator=(HistoryRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1683,1688 +2033,9195 @@ class Response PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const Response& default_instance();
-
-  enum ResultCase {
-    kUserList = 4,
-    kIncomingMessage = 5,
-    RESULT_NOT_SET = 0,
-  };
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Response* internal_default_instance() {
-    return reinterpret_cast<const Response*>(
-               &_Response_default_instance_);
+  static const HistoryRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HistoryRequest* internal_default_instance() {
+    return reinterpret_cast<const HistoryRequest*>(
+               &_HistoryRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    9;
 
-  friend void swap(Response& a, Response& b) {
+  friend void swap(HistoryRequest& a, HistoryRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(Response* other) {
+  inline void Swap(HistoryRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Response* other) {
+  void UnsafeArenaSwap(HistoryRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Response* New() const final {
-    return CreateMaybeMessage<Response>(nullptr);
+  HistoryRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HistoryRequest>(arena);
   }
-
-  Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Response>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HistoryRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HistoryRequest& from) {
+    HistoryRequest::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Response& from);
-  void MergeFrom(const Response& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Response* other);
+  void InternalSwap(HistoryRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "chat.Response";
+    return "chat.HistoryRequest";
   }
   protected:
-  explicit Response(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit HistoryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kMessageFieldNumber = 3,
-    kOperationFieldNumber = 1,
-    kStatusCodeFieldNumber = 2,
-    kUserListFieldNumber = 4,
-    kIncomingMessageFieldNumber = 5,
+    kConversationFieldNumber = 1,
+    kSenderFieldNumber = 5,
+    kSinceFieldNumber = 2,
+    kUntilFieldNumber = 3,
+    kLimitFieldNumber = 4,
   };
-  // string message = 3;
-  void clear_message();
-  const std::string& message() const;
-  void set_message(const std::string& value);
-  void set_message(std::string&& value);
-  void set_message(const char* value);
-  void set_message(const char* value, size_t size);
-  std::string* mutable_message();
-  std::string* release_message();
-  void set_allocated_message(std::string* message);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_message();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_message(
-      std::string* message);
+  // string conversation = 1;
+  void clear_conversation();
+  const std::string& conversation() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_conversation(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_conversation();
+  PROTOBUF_NODISCARD std::string* release_conversation();
+  void set_allocated_conversation(std::string* conversation);
   private:
-  const std::string& _internal_message() const;
-  void _internal_set_message(const std::string& value);
-  std::string* _internal_mutable_message();
+  const std::string& _internal_conversation() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_conversation(const std::string& value);
+  std::string* _internal_mutable_conversation();
   public:
 
-  // .chat.Operation operation = 1;
-  void clear_operation();
-  ::chat::Operation operation() const;
-  void set_operation(::chat::Operation value);
+  // string sender = 5;
+  void clear_sender();
+  const std::string& sender() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sender(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sender();
+  PROTOBUF_NODISCARD std::string* release_sender();
+  void set_allocated_sender(std::string* sender);
   private:
-  ::chat::Operation _internal_operation() const;
-  void _internal_set_operation(::chat::Operation value);
+  const std::string& _internal_sender() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sender(const std::string& value);
+  std::string* _internal_mutable_sender();
   public:
 
-  // .chat.StatusCode status_code = 2;
-  void clear_status_code();
-  ::chat::StatusCode status_code() const;
-  void set_status_code(::chat::StatusCode value);
+  // int64 since = 2;
+  void clear_since();
+  int64_t since() const;
+  void set_since(int64_t value);
   private:
-  ::chat::StatusCode _internal_status_code() const;
-  void _internal_set_status_code(::chat::StatusCode value);
+  int64_t _internal_since() const;
+  void _internal_set_since(int64_t value);
   public:
 
-  // .chat.UserListResponse user_list = 4;
-  bool has_user_list() const;
-  private:
-  bool _internal_has_user_list() const;
-  public:
-  void clear_user_list();
-  const ::chat::UserListResponse& user_list() const;
-  ::chat::UserListResponse* release_user_list();
-  ::chat::UserListResponse* mutable_user_list();
-  void set_allocated_user_list(::chat::UserListResponse* user_list);
+  // int64 until = 3;
+  void clear_until();
+  int64_t until() const;
+  void set_until(int64_t value);
   private:
-  const ::chat::UserListResponse& _internal_user_list() const;
-  ::chat::UserListResponse* _internal_mutable_user_list();
+  int64_t _internal_until() const;
+  void _internal_set_until(int64_t value);
   public:
-  void unsafe_arena_set_allocated_user_list(
-      ::chat::UserListResponse* user_list);
-  ::chat::UserListResponse* unsafe_arena_release_user_list();
 
-  // .chat.IncomingMessageResponse incoming_message = 5;
-  bool has_incoming_message() const;
-  private:
-  bool _internal_has_incoming_message() const;
-  public:
-  void clear_incoming_message();
-  const ::chat::IncomingMessageResponse& incoming_message() const;
-  ::chat::IncomingMessageResponse* release_incoming_message();
-  ::chat::IncomingMessageResponse* mutable_incoming_message();
-  void set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message);
+  // uint32 limit = 4;
+  void clear_limit();
+  uint32_t limit() const;
+  void set_limit(uint32_t value);
   private:
-  const ::chat::IncomingMessageResponse& _internal_incoming_message() const;
-  ::chat::IncomingMessageResponse* _internal_mutable_incoming_message();
+  uint32_t _internal_limit() const;
+  void _internal_set_limit(uint32_t value);
   public:
-  void unsafe_arena_set_allocated_incoming_message(
-      ::chat::IncomingMessageResponse* incoming_message);
-  ::chat::IncomingMessageResponse* unsafe_arena_release_incoming_message();
 
-  void clear_result();
-  ResultCase result_case() const;
-  // @@protoc_insertion_point(class_scope:chat.Response)
+  // @@protoc_insertion_point(class_scope:chat.HistoryRequest)
  private:
   class _Internal;
-  void set_has_user_list();
-  void set_has_incoming_message();
 
-  inline bool has_result() const;
-  inline void clear_has_result();
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr conversation_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sender_;
+    int64_t since_;
+    int64_t until_;
+    uint32_t limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Receipts final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.Receipts) */ {
+ public:
+  inline Receipts() : Receipts(nullptr) {}
+  ~Receipts() override;
+  explicit PROTOBUF_CONSTEXPR Receipts(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Receipts(const Receipts& from);
+  Receipts(Receipts&& from) noexcept
+    : Receipts() {
+    *this = ::std::move(from);
+  }
+
+  inline Receipts& operator=(const Receipts& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Receipts& operator=(Receipts&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Receipts& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Receipts* internal_default_instance() {
+    return reinterpret_cast<const Receipts*>(
+               &_Receipts_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(Receipts& a, Receipts& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Receipts* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Receipts* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Receipts* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Receipts>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Receipts& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Receipts& from) {
+    Receipts::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Receipts* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.Receipts";
+  }
+  protected:
+  explicit Receipts(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDeliveredFieldNumber = 1,
+    kReadFieldNumber = 2,
+    kReceivedSeqFieldNumber = 3,
+  };
+  // repeated uint64 delivered = 1;
+  int delivered_size() const;
+  private:
+  int _internal_delivered_size() const;
+  public:
+  void clear_delivered();
+  private:
+  uint64_t _internal_delivered(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_delivered() const;
+  void _internal_add_delivered(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_delivered();
+  public:
+  uint64_t delivered(int index) const;
+  void set_delivered(int index, uint64_t value);
+  void add_delivered(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      delivered() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_delivered();
+
+  // repeated uint64 read = 2;
+  int read_size() const;
+  private:
+  int _internal_read_size() const;
+  public:
+  void clear_read();
+  private:
+  uint64_t _internal_read(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_read() const;
+  void _internal_add_read(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_read();
+  public:
+  uint64_t read(int index) const;
+  void set_read(int index, uint64_t value);
+  void add_read(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      read() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_read();
+
+  // uint64 received_seq = 3;
+  void clear_received_seq();
+  uint64_t received_seq() const;
+  void set_received_seq(uint64_t value);
+  private:
+  uint64_t _internal_received_seq() const;
+  void _internal_set_received_seq(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.Receipts)
+ private:
+  class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
-  int operation_;
-  int status_code_;
-  union ResultUnion {
-    ResultUnion() {}
-    ::chat::UserListResponse* user_list_;
-    ::chat::IncomingMessageResponse* incoming_message_;
-  } result_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > delivered_;
+    mutable std::atomic<int> _delivered_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > read_;
+    mutable std::atomic<int> _read_cached_byte_size_;
+    uint64_t received_seq_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.BatchRequest) */ {
+ public:
+  inline BatchRequest() : BatchRequest(nullptr) {}
+  ~BatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR BatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchRequest(const BatchRequest& from);
+  BatchRequest(BatchRequest&& from) noexcept
+    : BatchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchRequest& operator=(const BatchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchRequest& operator=(BatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchRequest* internal_default_instance() {
+    return reinterpret_cast<const BatchRequest*>(
+               &_BatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(BatchRequest& a, BatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchRequest& from) {
+    BatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.BatchRequest";
+  }
+  protected:
+  explicit BatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestsFieldNumber = 1,
+  };
+  // repeated .chat.Request requests = 1;
+  int requests_size() const;
+  private:
+  int _internal_requests_size() const;
+  public:
+  void clear_requests();
+  ::chat::Request* mutable_requests(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Request >*
+      mutable_requests();
+  private:
+  const ::chat::Request& _internal_requests(int index) const;
+  ::chat::Request* _internal_add_requests();
+  public:
+  const ::chat::Request& requests(int index) const;
+  ::chat::Request* add_requests();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Request >&
+      requests() const;
+
+  // @@protoc_insertion_point(class_scope:chat.BatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Request > requests_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class BatchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.BatchResponse) */ {
+ public:
+  inline BatchResponse() : BatchResponse(nullptr) {}
+  ~BatchResponse() override;
+  explicit PROTOBUF_CONSTEXPR BatchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  BatchResponse(const BatchResponse& from);
+  BatchResponse(BatchResponse&& from) noexcept
+    : BatchResponse() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// User
+  inline BatchResponse& operator=(const BatchResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchResponse& operator=(BatchResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchResponse* internal_default_instance() {
+    return reinterpret_cast<const BatchResponse*>(
+               &_BatchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(BatchResponse& a, BatchResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchResponse& from) {
+    BatchResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.BatchResponse";
+  }
+  protected:
+  explicit BatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResponsesFieldNumber = 1,
+  };
+  // repeated .chat.Response responses = 1;
+  int responses_size() const;
+  private:
+  int _internal_responses_size() const;
+  public:
+  void clear_responses();
+  ::chat::Response* mutable_responses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Response >*
+      mutable_responses();
+  private:
+  const ::chat::Response& _internal_responses(int index) const;
+  ::chat::Response* _internal_add_responses();
+  public:
+  const ::chat::Response& responses(int index) const;
+  ::chat::Response* add_responses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Response >&
+      responses() const;
+
+  // @@protoc_insertion_point(class_scope:chat.BatchResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Response > responses_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HistoryResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.HistoryResponse) */ {
+ public:
+  inline HistoryResponse() : HistoryResponse(nullptr) {}
+  ~HistoryResponse() override;
+  explicit PROTOBUF_CONSTEXPR HistoryResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HistoryResponse(const HistoryResponse& from);
+  HistoryResponse(HistoryResponse&& from) noexcept
+    : HistoryResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline HistoryResponse& operator=(const HistoryResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HistoryResponse& operator=(HistoryResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HistoryResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HistoryResponse* internal_default_instance() {
+    return reinterpret_cast<const HistoryResponse*>(
+               &_HistoryResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(HistoryResponse& a, HistoryResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HistoryResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HistoryResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HistoryResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HistoryResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HistoryResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HistoryResponse& from) {
+    HistoryResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HistoryResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.HistoryResponse";
+  }
+  protected:
+  explicit HistoryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessagesFieldNumber = 1,
+    kPageFieldNumber = 2,
+    kLastPageFieldNumber = 3,
+  };
+  // repeated .chat.IncomingMessageResponse messages = 1;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  ::chat::IncomingMessageResponse* mutable_messages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::IncomingMessageResponse >*
+      mutable_messages();
+  private:
+  const ::chat::IncomingMessageResponse& _internal_messages(int index) const;
+  ::chat::IncomingMessageResponse* _internal_add_messages();
+  public:
+  const ::chat::IncomingMessageResponse& messages(int index) const;
+  ::chat::IncomingMessageResponse* add_messages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::IncomingMessageResponse >&
+      messages() const;
+
+  // uint32 page = 2;
+  void clear_page();
+  uint32_t page() const;
+  void set_page(uint32_t value);
+  private:
+  uint32_t _internal_page() const;
+  void _internal_set_page(uint32_t value);
+  public:
+
+  // bool last_page = 3;
+  void clear_last_page();
+  bool last_page() const;
+  void set_last_page(bool value);
+  private:
+  bool _internal_last_page() const;
+  void _internal_set_last_page(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.HistoryResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::IncomingMessageResponse > messages_;
+    uint32_t page_;
+    bool last_page_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StoredMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.StoredMessage) */ {
+ public:
+  inline StoredMessage() : StoredMessage(nullptr) {}
+  ~StoredMessage() override;
+  explicit PROTOBUF_CONSTEXPR StoredMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StoredMessage(const StoredMessage& from);
+  StoredMessage(StoredMessage&& from) noexcept
+    : StoredMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline StoredMessage& operator=(const StoredMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StoredMessage& operator=(StoredMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StoredMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StoredMessage* internal_default_instance() {
+    return reinterpret_cast<const StoredMessage*>(
+               &_StoredMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(StoredMessage& a, StoredMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StoredMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StoredMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StoredMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StoredMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StoredMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StoredMessage& from) {
+    StoredMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StoredMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.StoredMessage";
+  }
+  protected:
+  explicit StoredMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kConversationFieldNumber = 1,
+    kMessageFieldNumber = 2,
+  };
+  // string conversation = 1;
+  void clear_conversation();
+  const std::string& conversation() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_conversation(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_conversation();
+  PROTOBUF_NODISCARD std::string* release_conversation();
+  void set_allocated_conversation(std::string* conversation);
+  private:
+  const std::string& _internal_conversation() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_conversation(const std::string& value);
+  std::string* _internal_mutable_conversation();
+  public:
+
+  // .chat.IncomingMessageResponse message = 2;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::chat::IncomingMessageResponse& message() const;
+  PROTOBUF_NODISCARD ::chat::IncomingMessageResponse* release_message();
+  ::chat::IncomingMessageResponse* mutable_message();
+  void set_allocated_message(::chat::IncomingMessageResponse* message);
+  private:
+  const ::chat::IncomingMessageResponse& _internal_message() const;
+  ::chat::IncomingMessageResponse* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::chat::IncomingMessageResponse* message);
+  ::chat::IncomingMessageResponse* unsafe_arena_release_message();
+
+  // @@protoc_insertion_point(class_scope:chat.StoredMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr conversation_;
+    ::chat::IncomingMessageResponse* message_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.Request) */ {
+ public:
+  inline Request() : Request(nullptr) {}
+  ~Request() override;
+  explicit PROTOBUF_CONSTEXPR Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Request(const Request& from);
+  Request(Request&& from) noexcept
+    : Request() {
+    *this = ::std::move(from);
+  }
+
+  inline Request& operator=(const Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Request& operator=(Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Request& default_instance() {
+    return *internal_default_instance();
+  }
+  enum PayloadCase {
+    kRegisterUser = 2,
+    kSendMessage = 3,
+    kUpdateStatus = 4,
+    kGetUsers = 5,
+    kUnregisterUser = 6,
+    kGetHistory = 7,
+    kRoom = 8,
+    kBatch = 9,
+    kAcknowledge = 10,
+    kResume = 11,
+    PAYLOAD_NOT_SET = 0,
+  };
+
+  static inline const Request* internal_default_instance() {
+    return reinterpret_cast<const Request*>(
+               &_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(Request& a, Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Request& from) {
+    Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.Request";
+  }
+  protected:
+  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOperationFieldNumber = 1,
+    kRegisterUserFieldNumber = 2,
+    kSendMessageFieldNumber = 3,
+    kUpdateStatusFieldNumber = 4,
+    kGetUsersFieldNumber = 5,
+    kUnregisterUserFieldNumber = 6,
+    kGetHistoryFieldNumber = 7,
+    kRoomFieldNumber = 8,
+    kBatchFieldNumber = 9,
+    kAcknowledgeFieldNumber = 10,
+    kResumeFieldNumber = 11,
+  };
+  // .chat.Operation operation = 1;
+  void clear_operation();
+  ::chat::Operation operation() const;
+  void set_operation(::chat::Operation value);
+  private:
+  ::chat::Operation _internal_operation() const;
+  void _internal_set_operation(::chat::Operation value);
+  public:
+
+  // .chat.NewUserRequest register_user = 2;
+  bool has_register_user() const;
+  private:
+  bool _internal_has_register_user() const;
+  public:
+  void clear_register_user();
+  const ::chat::NewUserRequest& register_user() const;
+  PROTOBUF_NODISCARD ::chat::NewUserRequest* release_register_user();
+  ::chat::NewUserRequest* mutable_register_user();
+  void set_allocated_register_user(::chat::NewUserRequest* register_user);
+  private:
+  const ::chat::NewUserRequest& _internal_register_user() const;
+  ::chat::NewUserRequest* _internal_mutable_register_user();
+  public:
+  void unsafe_arena_set_allocated_register_user(
+      ::chat::NewUserRequest* register_user);
+  ::chat::NewUserRequest* unsafe_arena_release_register_user();
+
+  // .chat.SendMessageRequest send_message = 3;
+  bool has_send_message() const;
+  private:
+  bool _internal_has_send_message() const;
+  public:
+  void clear_send_message();
+  const ::chat::SendMessageRequest& send_message() const;
+  PROTOBUF_NODISCARD ::chat::SendMessageRequest* release_send_message();
+  ::chat::SendMessageRequest* mutable_send_message();
+  void set_allocated_send_message(::chat::SendMessageRequest* send_message);
+  private:
+  const ::chat::SendMessageRequest& _internal_send_message() const;
+  ::chat::SendMessageRequest* _internal_mutable_send_message();
+  public:
+  void unsafe_arena_set_allocated_send_message(
+      ::chat::SendMessageRequest* send_message);
+  ::chat::SendMessageRequest* unsafe_arena_release_send_message();
+
+  // .chat.UpdateStatusRequest update_status = 4;
+  bool has_update_status() const;
+  private:
+  bool _internal_has_update_status() const;
+  public:
+  void clear_update_status();
+  const ::chat::UpdateStatusRequest& update_status() const;
+  PROTOBUF_NODISCARD ::chat::UpdateStatusRequest* release_update_status();
+  ::chat::UpdateStatusRequest* mutable_update_status();
+  void set_allocated_update_status(::chat::UpdateStatusRequest* update_status);
+  private:
+  const ::chat::UpdateStatusRequest& _internal_update_status() const;
+  ::chat::UpdateStatusRequest* _internal_mutable_update_status();
+  public:
+  void unsafe_arena_set_allocated_update_status(
+      ::chat::UpdateStatusRequest* update_status);
+  ::chat::UpdateStatusRequest* unsafe_arena_release_update_status();
+
+  // .chat.UserListRequest get_users = 5;
+  bool has_get_users() const;
+  private:
+  bool _internal_has_get_users() const;
+  public:
+  void clear_get_users();
+  const ::chat::UserListRequest& get_users() const;
+  PROTOBUF_NODISCARD ::chat::UserListRequest* release_get_users();
+  ::chat::UserListRequest* mutable_get_users();
+  void set_allocated_get_users(::chat::UserListRequest* get_users);
+  private:
+  const ::chat::UserListRequest& _internal_get_users() const;
+  ::chat::UserListRequest* _internal_mutable_get_users();
+  public:
+  void unsafe_arena_set_allocated_get_users(
+      ::chat::UserListRequest* get_users);
+  ::chat::UserListRequest* unsafe_arena_release_get_users();
+
+  // .chat.User unregister_user = 6;
+  bool has_unregister_user() const;
+  private:
+  bool _internal_has_unregister_user() const;
+  public:
+  void clear_unregister_user();
+  const ::chat::User& unregister_user() const;
+  PROTOBUF_NODISCARD ::chat::User* release_unregister_user();
+  ::chat::User* mutable_unregister_user();
+  void set_allocated_unregister_user(::chat::User* unregister_user);
+  private:
+  const ::chat::User& _internal_unregister_user() const;
+  ::chat::User* _internal_mutable_unregister_user();
+  public:
+  void unsafe_arena_set_allocated_unregister_user(
+      ::chat::User* unregister_user);
+  ::chat::User* unsafe_arena_release_unregister_user();
+
+  // .chat.HistoryRequest get_history = 7;
+  bool has_get_history() const;
+  private:
+  bool _internal_has_get_history() const;
+  public:
+  void clear_get_history();
+  const ::chat::HistoryRequest& get_history() const;
+  PROTOBUF_NODISCARD ::chat::HistoryRequest* release_get_history();
+  ::chat::HistoryRequest* mutable_get_history();
+  void set_allocated_get_history(::chat::HistoryRequest* get_history);
+  private:
+  const ::chat::HistoryRequest& _internal_get_history() const;
+  ::chat::HistoryRequest* _internal_mutable_get_history();
+  public:
+  void unsafe_arena_set_allocated_get_history(
+      ::chat::HistoryRequest* get_history);
+  ::chat::HistoryRequest* unsafe_arena_release_get_history();
+
+  // .chat.RoomRequest room = 8;
+  bool has_room() const;
+  private:
+  bool _internal_has_room() const;
+  public:
+  void clear_room();
+  const ::chat::RoomRequest& room() const;
+  PROTOBUF_NODISCARD ::chat::RoomRequest* release_room();
+  ::chat::RoomRequest* mutable_room();
+  void set_allocated_room(::chat::RoomRequest* room);
+  private:
+  const ::chat::RoomRequest& _internal_room() const;
+  ::chat::RoomRequest* _internal_mutable_room();
+  public:
+  void unsafe_arena_set_allocated_room(
+      ::chat::RoomRequest* room);
+  ::chat::RoomRequest* unsafe_arena_release_room();
+
+  // .chat.BatchRequest batch = 9;
+  bool has_batch() const;
+  private:
+  bool _internal_has_batch() const;
+  public:
+  void clear_batch();
+  const ::chat::BatchRequest& batch() const;
+  PROTOBUF_NODISCARD ::chat::BatchRequest* release_batch();
+  ::chat::BatchRequest* mutable_batch();
+  void set_allocated_batch(::chat::BatchRequest* batch);
+  private:
+  const ::chat::BatchRequest& _internal_batch() const;
+  ::chat::BatchRequest* _internal_mutable_batch();
+  public:
+  void unsafe_arena_set_allocated_batch(
+      ::chat::BatchRequest* batch);
+  ::chat::BatchRequest* unsafe_arena_release_batch();
+
+  // .chat.Receipts acknowledge = 10;
+  bool has_acknowledge() const;
+  private:
+  bool _internal_has_acknowledge() const;
+  public:
+  void clear_acknowledge();
+  const ::chat::Receipts& acknowledge() const;
+  PROTOBUF_NODISCARD ::chat::Receipts* release_acknowledge();
+  ::chat::Receipts* mutable_acknowledge();
+  void set_allocated_acknowledge(::chat::Receipts* acknowledge);
+  private:
+  const ::chat::Receipts& _internal_acknowledge() const;
+  ::chat::Receipts* _internal_mutable_acknowledge();
+  public:
+  void unsafe_arena_set_allocated_acknowledge(
+      ::chat::Receipts* acknowledge);
+  ::chat::Receipts* unsafe_arena_release_acknowledge();
+
+  // .chat.ResumeRequest resume = 11;
+  bool has_resume() const;
+  private:
+  bool _internal_has_resume() const;
+  public:
+  void clear_resume();
+  const ::chat::ResumeRequest& resume() const;
+  PROTOBUF_NODISCARD ::chat::ResumeRequest* release_resume();
+  ::chat::ResumeRequest* mutable_resume();
+  void set_allocated_resume(::chat::ResumeRequest* resume);
+  private:
+  const ::chat::ResumeRequest& _internal_resume() const;
+  ::chat::ResumeRequest* _internal_mutable_resume();
+  public:
+  void unsafe_arena_set_allocated_resume(
+      ::chat::ResumeRequest* resume);
+  ::chat::ResumeRequest* unsafe_arena_release_resume();
+
+  void clear_payload();
+  PayloadCase payload_case() const;
+  // @@protoc_insertion_point(class_scope:chat.Request)
+ private:
+  class _Internal;
+  void set_has_register_user();
+  void set_has_send_message();
+  void set_has_update_status();
+  void set_has_get_users();
+  void set_has_unregister_user();
+  void set_has_get_history();
+  void set_has_room();
+  void set_has_batch();
+  void set_has_acknowledge();
+  void set_has_resume();
+
+  inline bool has_payload() const;
+  inline void clear_has_payload();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int operation_;
+    union PayloadUnion {
+      constexpr PayloadUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::chat::NewUserRequest* register_user_;
+      ::chat::SendMessageRequest* send_message_;
+      ::chat::UpdateStatusRequest* update_status_;
+      ::chat::UserListRequest* get_users_;
+      ::chat::User* unregister_user_;
+      ::chat::HistoryRequest* get_history_;
+      ::chat::RoomRequest* room_;
+      ::chat::BatchRequest* batch_;
+      ::chat::Receipts* acknowledge_;
+      ::chat::ResumeRequest* resume_;
+    } payload_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ShutdownNotice final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ShutdownNotice) */ {
+ public:
+  inline ShutdownNotice() : ShutdownNotice(nullptr) {}
+  ~ShutdownNotice() override;
+  explicit PROTOBUF_CONSTEXPR ShutdownNotice(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ShutdownNotice(const ShutdownNotice& from);
+  ShutdownNotice(ShutdownNotice&& from) noexcept
+    : ShutdownNotice() {
+    *this = ::std::move(from);
+  }
+
+  inline ShutdownNotice& operator=(const ShutdownNotice& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ShutdownNotice& operator=(ShutdownNotice&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ShutdownNotice& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ShutdownNotice* internal_default_instance() {
+    return reinterpret_cast<const ShutdownNotice*>(
+               &_ShutdownNotice_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(ShutdownNotice& a, ShutdownNotice& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ShutdownNotice* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ShutdownNotice* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ShutdownNotice* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ShutdownNotice>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ShutdownNotice& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ShutdownNotice& from) {
+    ShutdownNotice::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ShutdownNotice* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ShutdownNotice";
+  }
+  protected:
+  explicit ShutdownNotice(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReconnectAfterMsFieldNumber = 1,
+  };
+  // uint32 reconnect_after_ms = 1;
+  void clear_reconnect_after_ms();
+  uint32_t reconnect_after_ms() const;
+  void set_reconnect_after_ms(uint32_t value);
+  private:
+  uint32_t _internal_reconnect_after_ms() const;
+  void _internal_set_reconnect_after_ms(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ShutdownNotice)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t reconnect_after_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.Response) */ {
+ public:
+  inline Response() : Response(nullptr) {}
+  ~Response() override;
+  explicit PROTOBUF_CONSTEXPR Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Response(const Response& from);
+  Response(Response&& from) noexcept
+    : Response() {
+    *this = ::std::move(from);
+  }
+
+  inline Response& operator=(const Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Response& operator=(Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Response& default_instance() {
+    return *internal_default_instance();
+  }
+  enum ResultCase {
+    kUserList = 4,
+    kIncomingMessage = 5,
+    kHistory = 6,
+    kShutdown = 7,
+    kBatch = 8,
+    kReceipts = 11,
+    RESULT_NOT_SET = 0,
+  };
+
+  static inline const Response* internal_default_instance() {
+    return reinterpret_cast<const Response*>(
+               &_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(Response& a, Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Response& from) {
+    Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.Response";
+  }
+  protected:
+  explicit Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 3,
+    kOperationFieldNumber = 1,
+    kStatusCodeFieldNumber = 2,
+    kCompressionFieldNumber = 9,
+    kCompactFieldNumber = 10,
+    kMessageIdFieldNumber = 12,
+    kSeqFieldNumber = 13,
+    kResumeTokenFieldNumber = 14,
+    kUserListFieldNumber = 4,
+    kIncomingMessageFieldNumber = 5,
+    kHistoryFieldNumber = 6,
+    kShutdownFieldNumber = 7,
+    kBatchFieldNumber = 8,
+    kReceiptsFieldNumber = 11,
+  };
+  // string message = 3;
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // .chat.Operation operation = 1;
+  void clear_operation();
+  ::chat::Operation operation() const;
+  void set_operation(::chat::Operation value);
+  private:
+  ::chat::Operation _internal_operation() const;
+  void _internal_set_operation(::chat::Operation value);
+  public:
+
+  // .chat.StatusCode status_code = 2;
+  void clear_status_code();
+  ::chat::StatusCode status_code() const;
+  void set_status_code(::chat::StatusCode value);
+  private:
+  ::chat::StatusCode _internal_status_code() const;
+  void _internal_set_status_code(::chat::StatusCode value);
+  public:
+
+  // .chat.Compression compression = 9;
+  void clear_compression();
+  ::chat::Compression compression() const;
+  void set_compression(::chat::Compression value);
+  private:
+  ::chat::Compression _internal_compression() const;
+  void _internal_set_compression(::chat::Compression value);
+  public:
+
+  // bool compact = 10;
+  void clear_compact();
+  bool compact() const;
+  void set_compact(bool value);
+  private:
+  bool _internal_compact() const;
+  void _internal_set_compact(bool value);
+  public:
+
+  // uint64 message_id = 12;
+  void clear_message_id();
+  uint64_t message_id() const;
+  void set_message_id(uint64_t value);
+  private:
+  uint64_t _internal_message_id() const;
+  void _internal_set_message_id(uint64_t value);
+  public:
+
+  // uint64 seq = 13;
+  void clear_seq();
+  uint64_t seq() const;
+  void set_seq(uint64_t value);
+  private:
+  uint64_t _internal_seq() const;
+  void _internal_set_seq(uint64_t value);
+  public:
+
+  // uint64 resume_token = 14;
+  void clear_resume_token();
+  uint64_t resume_token() const;
+  void set_resume_token(uint64_t value);
+  private:
+  uint64_t _internal_resume_token() const;
+  void _internal_set_resume_token(uint64_t value);
+  public:
+
+  // .chat.UserListResponse user_list = 4;
+  bool has_user_list() const;
+  private:
+  bool _internal_has_user_list() const;
+  public:
+  void clear_user_list();
+  const ::chat::UserListResponse& user_list() const;
+  PROTOBUF_NODISCARD ::chat::UserListResponse* release_user_list();
+  ::chat::UserListResponse* mutable_user_list();
+  void set_allocated_user_list(::chat::UserListResponse* user_list);
+  private:
+  const ::chat::UserListResponse& _internal_user_list() const;
+  ::chat::UserListResponse* _internal_mutable_user_list();
+  public:
+  void unsafe_arena_set_allocated_user_list(
+      ::chat::UserListResponse* user_list);
+  ::chat::UserListResponse* unsafe_arena_release_user_list();
+
+  // .chat.IncomingMessageResponse incoming_message = 5;
+  bool has_incoming_message() const;
+  private:
+  bool _internal_has_incoming_message() const;
+  public:
+  void clear_incoming_message();
+  const ::chat::IncomingMessageResponse& incoming_message() const;
+  PROTOBUF_NODISCARD ::chat::IncomingMessageResponse* release_incoming_message();
+  ::chat::IncomingMessageResponse* mutable_incoming_message();
+  void set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message);
+  private:
+  const ::chat::IncomingMessageResponse& _internal_incoming_message() const;
+  ::chat::IncomingMessageResponse* _internal_mutable_incoming_message();
+  public:
+  void unsafe_arena_set_allocated_incoming_message(
+      ::chat::IncomingMessageResponse* incoming_message);
+  ::chat::IncomingMessageResponse* unsafe_arena_release_incoming_message();
+
+  // .chat.HistoryResponse history = 6;
+  bool has_history() const;
+  private:
+  bool _internal_has_history() const;
+  public:
+  void clear_history();
+  const ::chat::HistoryResponse& history() const;
+  PROTOBUF_NODISCARD ::chat::HistoryResponse* release_history();
+  ::chat::HistoryResponse* mutable_history();
+  void set_allocated_history(::chat::HistoryResponse* history);
+  private:
+  const ::chat::HistoryResponse& _internal_history() const;
+  ::chat::HistoryResponse* _internal_mutable_history();
+  public:
+  void unsafe_arena_set_allocated_history(
+      ::chat::HistoryResponse* history);
+  ::chat::HistoryResponse* unsafe_arena_release_history();
+
+  // .chat.ShutdownNotice shutdown = 7;
+  bool has_shutdown() const;
+  private:
+  bool _internal_has_shutdown() const;
+  public:
+  void clear_shutdown();
+  const ::chat::ShutdownNotice& shutdown() const;
+  PROTOBUF_NODISCARD ::chat::ShutdownNotice* release_shutdown();
+  ::chat::ShutdownNotice* mutable_shutdown();
+  void set_allocated_shutdown(::chat::ShutdownNotice* shutdown);
+  private:
+  const ::chat::ShutdownNotice& _internal_shutdown() const;
+  ::chat::ShutdownNotice* _internal_mutable_shutdown();
+  public:
+  void unsafe_arena_set_allocated_shutdown(
+      ::chat::ShutdownNotice* shutdown);
+  ::chat::ShutdownNotice* unsafe_arena_release_shutdown();
+
+  // .chat.BatchResponse batch = 8;
+  bool has_batch() const;
+  private:
+  bool _internal_has_batch() const;
+  public:
+  void clear_batch();
+  const ::chat::BatchResponse& batch() const;
+  PROTOBUF_NODISCARD ::chat::BatchResponse* release_batch();
+  ::chat::BatchResponse* mutable_batch();
+  void set_allocated_batch(::chat::BatchResponse* batch);
+  private:
+  const ::chat::BatchResponse& _internal_batch() const;
+  ::chat::BatchResponse* _internal_mutable_batch();
+  public:
+  void unsafe_arena_set_allocated_batch(
+      ::chat::BatchResponse* batch);
+  ::chat::BatchResponse* unsafe_arena_release_batch();
+
+  // .chat.Receipts receipts = 11;
+  bool has_receipts() const;
+  private:
+  bool _internal_has_receipts() const;
+  public:
+  void clear_receipts();
+  const ::chat::Receipts& receipts() const;
+  PROTOBUF_NODISCARD ::chat::Receipts* release_receipts();
+  ::chat::Receipts* mutable_receipts();
+  void set_allocated_receipts(::chat::Receipts* receipts);
+  private:
+  const ::chat::Receipts& _internal_receipts() const;
+  ::chat::Receipts* _internal_mutable_receipts();
+  public:
+  void unsafe_arena_set_allocated_receipts(
+      ::chat::Receipts* receipts);
+  ::chat::Receipts* unsafe_arena_release_receipts();
+
+  void clear_result();
+  ResultCase result_case() const;
+  // @@protoc_insertion_point(class_scope:chat.Response)
+ private:
+  class _Internal;
+  void set_has_user_list();
+  void set_has_incoming_message();
+  void set_has_history();
+  void set_has_shutdown();
+  void set_has_batch();
+  void set_has_receipts();
+
+  inline bool has_result() const;
+  inline void clear_has_result();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    int operation_;
+    int status_code_;
+    int compression_;
+    bool compact_;
+    uint64_t message_id_;
+    uint64_t seq_;
+    uint64_t resume_token_;
+    union ResultUnion {
+      constexpr ResultUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::chat::UserListResponse* user_list_;
+      ::chat::IncomingMessageResponse* incoming_message_;
+      ::chat::HistoryResponse* history_;
+      ::chat::ShutdownNotice* shutdown_;
+      ::chat::BatchResponse* batch_;
+      ::chat::Receipts* receipts_;
+    } result_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PeerPresence final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PeerPresence) */ {
+ public:
+  inline PeerPresence() : PeerPresence(nullptr) {}
+  ~PeerPresence() override;
+  explicit PROTOBUF_CONSTEXPR PeerPresence(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PeerPresence(const PeerPresence& from);
+  PeerPresence(PeerPresence&& from) noexcept
+    : PeerPresence() {
+    *this = ::std::move(from);
+  }
+
+  inline PeerPresence& operator=(const PeerPresence& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PeerPresence& operator=(PeerPresence&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PeerPresence& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PeerPresence* internal_default_instance() {
+    return reinterpret_cast<const PeerPresence*>(
+               &_PeerPresence_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(PeerPresence& a, PeerPresence& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PeerPresence* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PeerPresence* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PeerPresence* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PeerPresence>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PeerPresence& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PeerPresence& from) {
+    PeerPresence::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PeerPresence* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PeerPresence";
+  }
+  protected:
+  explicit PeerPresence(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kNodeFieldNumber = 4,
+    kStatusFieldNumber = 2,
+    kConnectedFieldNumber = 3,
+    kVersionFieldNumber = 5,
+    kChangedAtFieldNumber = 6,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // string node = 4;
+  void clear_node();
+  const std::string& node() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node();
+  PROTOBUF_NODISCARD std::string* release_node();
+  void set_allocated_node(std::string* node);
+  private:
+  const std::string& _internal_node() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node(const std::string& value);
+  std::string* _internal_mutable_node();
+  public:
+
+  // .chat.UserStatus status = 2;
+  void clear_status();
+  ::chat::UserStatus status() const;
+  void set_status(::chat::UserStatus value);
+  private:
+  ::chat::UserStatus _internal_status() const;
+  void _internal_set_status(::chat::UserStatus value);
+  public:
+
+  // bool connected = 3;
+  void clear_connected();
+  bool connected() const;
+  void set_connected(bool value);
+  private:
+  bool _internal_connected() const;
+  void _internal_set_connected(bool value);
+  public:
+
+  // uint64 version = 5;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // int64 changed_at = 6;
+  void clear_changed_at();
+  int64_t changed_at() const;
+  void set_changed_at(int64_t value);
+  private:
+  int64_t _internal_changed_at() const;
+  void _internal_set_changed_at(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PeerPresence)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_;
+    int status_;
+    bool connected_;
+    uint64_t version_;
+    int64_t changed_at_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PresenceDigest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PresenceDigest) */ {
+ public:
+  inline PresenceDigest() : PresenceDigest(nullptr) {}
+  ~PresenceDigest() override;
+  explicit PROTOBUF_CONSTEXPR PresenceDigest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PresenceDigest(const PresenceDigest& from);
+  PresenceDigest(PresenceDigest&& from) noexcept
+    : PresenceDigest() {
+    *this = ::std::move(from);
+  }
+
+  inline PresenceDigest& operator=(const PresenceDigest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PresenceDigest& operator=(PresenceDigest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PresenceDigest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PresenceDigest* internal_default_instance() {
+    return reinterpret_cast<const PresenceDigest*>(
+               &_PresenceDigest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(PresenceDigest& a, PresenceDigest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PresenceDigest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PresenceDigest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PresenceDigest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PresenceDigest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PresenceDigest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PresenceDigest& from) {
+    PresenceDigest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PresenceDigest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PresenceDigest";
+  }
+  protected:
+  explicit PresenceDigest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kVersionFieldNumber = 2,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // uint64 version = 2;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PresenceDigest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    uint64_t version_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PeerMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PeerMessage) */ {
+ public:
+  inline PeerMessage() : PeerMessage(nullptr) {}
+  ~PeerMessage() override;
+  explicit PROTOBUF_CONSTEXPR PeerMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PeerMessage(const PeerMessage& from);
+  PeerMessage(PeerMessage&& from) noexcept
+    : PeerMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PeerMessage& operator=(const PeerMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PeerMessage& operator=(PeerMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PeerMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PeerMessage* internal_default_instance() {
+    return reinterpret_cast<const PeerMessage*>(
+               &_PeerMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(PeerMessage& a, PeerMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PeerMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PeerMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PeerMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PeerMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PeerMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PeerMessage& from) {
+    PeerMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PeerMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PeerMessage";
+  }
+  protected:
+  explicit PeerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPresenceFieldNumber = 3,
+    kDigestFieldNumber = 7,
+    kWantedFieldNumber = 8,
+    kNodeFieldNumber = 2,
+    kRecipientFieldNumber = 4,
+    kMessageFieldNumber = 5,
+    kOperationFieldNumber = 1,
+    kRoutedFieldNumber = 6,
+  };
+  // repeated .chat.PeerPresence presence = 3;
+  int presence_size() const;
+  private:
+  int _internal_presence_size() const;
+  public:
+  void clear_presence();
+  ::chat::PeerPresence* mutable_presence(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PeerPresence >*
+      mutable_presence();
+  private:
+  const ::chat::PeerPresence& _internal_presence(int index) const;
+  ::chat::PeerPresence* _internal_add_presence();
+  public:
+  const ::chat::PeerPresence& presence(int index) const;
+  ::chat::PeerPresence* add_presence();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PeerPresence >&
+      presence() const;
+
+  // repeated .chat.PresenceDigest digest = 7;
+  int digest_size() const;
+  private:
+  int _internal_digest_size() const;
+  public:
+  void clear_digest();
+  ::chat::PresenceDigest* mutable_digest(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceDigest >*
+      mutable_digest();
+  private:
+  const ::chat::PresenceDigest& _internal_digest(int index) const;
+  ::chat::PresenceDigest* _internal_add_digest();
+  public:
+  const ::chat::PresenceDigest& digest(int index) const;
+  ::chat::PresenceDigest* add_digest();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceDigest >&
+      digest() const;
+
+  // repeated string wanted = 8;
+  int wanted_size() const;
+  private:
+  int _internal_wanted_size() const;
+  public:
+  void clear_wanted();
+  const std::string& wanted(int index) const;
+  std::string* mutable_wanted(int index);
+  void set_wanted(int index, const std::string& value);
+  void set_wanted(int index, std::string&& value);
+  void set_wanted(int index, const char* value);
+  void set_wanted(int index, const char* value, size_t size);
+  std::string* add_wanted();
+  void add_wanted(const std::string& value);
+  void add_wanted(std::string&& value);
+  void add_wanted(const char* value);
+  void add_wanted(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& wanted() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_wanted();
+  private:
+  const std::string& _internal_wanted(int index) const;
+  std::string* _internal_add_wanted();
+  public:
+
+  // string node = 2;
+  void clear_node();
+  const std::string& node() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node();
+  PROTOBUF_NODISCARD std::string* release_node();
+  void set_allocated_node(std::string* node);
+  private:
+  const std::string& _internal_node() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node(const std::string& value);
+  std::string* _internal_mutable_node();
+  public:
+
+  // string recipient = 4;
+  void clear_recipient();
+  const std::string& recipient() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_recipient(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_recipient();
+  PROTOBUF_NODISCARD std::string* release_recipient();
+  void set_allocated_recipient(std::string* recipient);
+  private:
+  const std::string& _internal_recipient() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_recipient(const std::string& value);
+  std::string* _internal_mutable_recipient();
+  public:
+
+  // .chat.IncomingMessageResponse message = 5;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::chat::IncomingMessageResponse& message() const;
+  PROTOBUF_NODISCARD ::chat::IncomingMessageResponse* release_message();
+  ::chat::IncomingMessageResponse* mutable_message();
+  void set_allocated_message(::chat::IncomingMessageResponse* message);
+  private:
+  const ::chat::IncomingMessageResponse& _internal_message() const;
+  ::chat::IncomingMessageResponse* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::chat::IncomingMessageResponse* message);
+  ::chat::IncomingMessageResponse* unsafe_arena_release_message();
+
+  // .chat.PeerOperation operation = 1;
+  void clear_operation();
+  ::chat::PeerOperation operation() const;
+  void set_operation(::chat::PeerOperation value);
+  private:
+  ::chat::PeerOperation _internal_operation() const;
+  void _internal_set_operation(::chat::PeerOperation value);
+  public:
+
+  // bool routed = 6;
+  void clear_routed();
+  bool routed() const;
+  void set_routed(bool value);
+  private:
+  bool _internal_routed() const;
+  void _internal_set_routed(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PeerMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PeerPresence > presence_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceDigest > digest_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> wanted_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr recipient_;
+    ::chat::IncomingMessageResponse* message_;
+    int operation_;
+    bool routed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HandoffSession final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.HandoffSession) */ {
+ public:
+  inline HandoffSession() : HandoffSession(nullptr) {}
+  ~HandoffSession() override;
+  explicit PROTOBUF_CONSTEXPR HandoffSession(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HandoffSession(const HandoffSession& from);
+  HandoffSession(HandoffSession&& from) noexcept
+    : HandoffSession() {
+    *this = ::std::move(from);
+  }
+
+  inline HandoffSession& operator=(const HandoffSession& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HandoffSession& operator=(HandoffSession&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HandoffSession& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HandoffSession* internal_default_instance() {
+    return reinterpret_cast<const HandoffSession*>(
+               &_HandoffSession_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(HandoffSession& a, HandoffSession& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HandoffSession* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HandoffSession* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HandoffSession* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HandoffSession>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HandoffSession& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HandoffSession& from) {
+    HandoffSession::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HandoffSession* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.HandoffSession";
+  }
+  protected:
+  explicit HandoffSession(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomsFieldNumber = 5,
+    kTransfersFieldNumber = 9,
+    kResumeFieldNumber = 12,
+    kIpFieldNumber = 1,
+    kUsernameFieldNumber = 2,
+    kInputFieldNumber = 6,
+    kLastActiveFieldNumber = 4,
+    kStatusFieldNumber = 3,
+    kFlushPolicyFieldNumber = 7,
+    kCompressionFieldNumber = 8,
+    kCompactFieldNumber = 10,
+    kResumeTokenFieldNumber = 11,
+    kRegisteredAtFieldNumber = 13,
+  };
+  // repeated string rooms = 5;
+  int rooms_size() const;
+  private:
+  int _internal_rooms_size() const;
+  public:
+  void clear_rooms();
+  const std::string& rooms(int index) const;
+  std::string* mutable_rooms(int index);
+  void set_rooms(int index, const std::string& value);
+  void set_rooms(int index, std::string&& value);
+  void set_rooms(int index, const char* value);
+  void set_rooms(int index, const char* value, size_t size);
+  std::string* add_rooms();
+  void add_rooms(const std::string& value);
+  void add_rooms(std::string&& value);
+  void add_rooms(const char* value);
+  void add_rooms(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& rooms() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_rooms();
+  private:
+  const std::string& _internal_rooms(int index) const;
+  std::string* _internal_add_rooms();
+  public:
+
+  // repeated .chat.PartialTransfer transfers = 9;
+  int transfers_size() const;
+  private:
+  int _internal_transfers_size() const;
+  public:
+  void clear_transfers();
+  ::chat::PartialTransfer* mutable_transfers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PartialTransfer >*
+      mutable_transfers();
+  private:
+  const ::chat::PartialTransfer& _internal_transfers(int index) const;
+  ::chat::PartialTransfer* _internal_add_transfers();
+  public:
+  const ::chat::PartialTransfer& transfers(int index) const;
+  ::chat::PartialTransfer* add_transfers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PartialTransfer >&
+      transfers() const;
+
+  // repeated .chat.BufferedFrame resume = 12;
+  int resume_size() const;
+  private:
+  int _internal_resume_size() const;
+  public:
+  void clear_resume();
+  ::chat::BufferedFrame* mutable_resume(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::BufferedFrame >*
+      mutable_resume();
+  private:
+  const ::chat::BufferedFrame& _internal_resume(int index) const;
+  ::chat::BufferedFrame* _internal_add_resume();
+  public:
+  const ::chat::BufferedFrame& resume(int index) const;
+  ::chat::BufferedFrame* add_resume();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::BufferedFrame >&
+      resume() const;
+
+  // string ip = 1;
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
+
+  // string username = 2;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // bytes input = 6;
+  void clear_input();
+  const std::string& input() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_input(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_input();
+  PROTOBUF_NODISCARD std::string* release_input();
+  void set_allocated_input(std::string* input);
+  private:
+  const std::string& _internal_input() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_input(const std::string& value);
+  std::string* _internal_mutable_input();
+  public:
+
+  // int64 last_active = 4;
+  void clear_last_active();
+  int64_t last_active() const;
+  void set_last_active(int64_t value);
+  private:
+  int64_t _internal_last_active() const;
+  void _internal_set_last_active(int64_t value);
+  public:
+
+  // .chat.UserStatus status = 3;
+  void clear_status();
+  ::chat::UserStatus status() const;
+  void set_status(::chat::UserStatus value);
+  private:
+  ::chat::UserStatus _internal_status() const;
+  void _internal_set_status(::chat::UserStatus value);
+  public:
+
+  // .chat.FlushPolicy flush_policy = 7;
+  void clear_flush_policy();
+  ::chat::FlushPolicy flush_policy() const;
+  void set_flush_policy(::chat::FlushPolicy value);
+  private:
+  ::chat::FlushPolicy _internal_flush_policy() const;
+  void _internal_set_flush_policy(::chat::FlushPolicy value);
+  public:
+
+  // .chat.Compression compression = 8;
+  void clear_compression();
+  ::chat::Compression compression() const;
+  void set_compression(::chat::Compression value);
+  private:
+  ::chat::Compression _internal_compression() const;
+  void _internal_set_compression(::chat::Compression value);
+  public:
+
+  // bool compact = 10;
+  void clear_compact();
+  bool compact() const;
+  void set_compact(bool value);
+  private:
+  bool _internal_compact() const;
+  void _internal_set_compact(bool value);
+  public:
+
+  // uint64 resume_token = 11;
+  void clear_resume_token();
+  uint64_t resume_token() const;
+  void set_resume_token(uint64_t value);
+  private:
+  uint64_t _internal_resume_token() const;
+  void _internal_set_resume_token(uint64_t value);
+  public:
+
+  // int64 registered_at = 13;
+  void clear_registered_at();
+  int64_t registered_at() const;
+  void set_registered_at(int64_t value);
+  private:
+  int64_t _internal_registered_at() const;
+  void _internal_set_registered_at(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.HandoffSession)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> rooms_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PartialTransfer > transfers_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::BufferedFrame > resume_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr input_;
+    int64_t last_active_;
+    int status_;
+    int flush_policy_;
+    int compression_;
+    bool compact_;
+    uint64_t resume_token_;
+    int64_t registered_at_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PartialTransfer final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PartialTransfer) */ {
+ public:
+  inline PartialTransfer() : PartialTransfer(nullptr) {}
+  ~PartialTransfer() override;
+  explicit PROTOBUF_CONSTEXPR PartialTransfer(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PartialTransfer(const PartialTransfer& from);
+  PartialTransfer(PartialTransfer&& from) noexcept
+    : PartialTransfer() {
+    *this = ::std::move(from);
+  }
+
+  inline PartialTransfer& operator=(const PartialTransfer& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PartialTransfer& operator=(PartialTransfer&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PartialTransfer& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PartialTransfer* internal_default_instance() {
+    return reinterpret_cast<const PartialTransfer*>(
+               &_PartialTransfer_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(PartialTransfer& a, PartialTransfer& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PartialTransfer* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PartialTransfer* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PartialTransfer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PartialTransfer>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PartialTransfer& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PartialTransfer& from) {
+    PartialTransfer::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PartialTransfer* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PartialTransfer";
+  }
+  protected:
+  explicit PartialTransfer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 3,
+    kIdFieldNumber = 1,
+    kTotalFieldNumber = 2,
+  };
+  // bytes data = 3;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // uint32 id = 1;
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // uint32 total = 2;
+  void clear_total();
+  uint32_t total() const;
+  void set_total(uint32_t value);
+  private:
+  uint32_t _internal_total() const;
+  void _internal_set_total(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PartialTransfer)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint32_t id_;
+    uint32_t total_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BufferedFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.BufferedFrame) */ {
+ public:
+  inline BufferedFrame() : BufferedFrame(nullptr) {}
+  ~BufferedFrame() override;
+  explicit PROTOBUF_CONSTEXPR BufferedFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BufferedFrame(const BufferedFrame& from);
+  BufferedFrame(BufferedFrame&& from) noexcept
+    : BufferedFrame() {
+    *this = ::std::move(from);
+  }
+
+  inline BufferedFrame& operator=(const BufferedFrame& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BufferedFrame& operator=(BufferedFrame&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BufferedFrame& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BufferedFrame* internal_default_instance() {
+    return reinterpret_cast<const BufferedFrame*>(
+               &_BufferedFrame_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(BufferedFrame& a, BufferedFrame& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BufferedFrame* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BufferedFrame* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BufferedFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BufferedFrame>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BufferedFrame& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BufferedFrame& from) {
+    BufferedFrame::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BufferedFrame* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.BufferedFrame";
+  }
+  protected:
+  explicit BufferedFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFrameFieldNumber = 2,
+    kSeqFieldNumber = 1,
+  };
+  // bytes frame = 2;
+  void clear_frame();
+  const std::string& frame() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_frame(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_frame();
+  PROTOBUF_NODISCARD std::string* release_frame();
+  void set_allocated_frame(std::string* frame);
+  private:
+  const std::string& _internal_frame() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_frame(const std::string& value);
+  std::string* _internal_mutable_frame();
+  public:
+
+  // uint64 seq = 1;
+  void clear_seq();
+  uint64_t seq() const;
+  void set_seq(uint64_t value);
+  private:
+  uint64_t _internal_seq() const;
+  void _internal_set_seq(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.BufferedFrame)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr frame_;
+    uint64_t seq_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DetachedSession final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.DetachedSession) */ {
+ public:
+  inline DetachedSession() : DetachedSession(nullptr) {}
+  ~DetachedSession() override;
+  explicit PROTOBUF_CONSTEXPR DetachedSession(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DetachedSession(const DetachedSession& from);
+  DetachedSession(DetachedSession&& from) noexcept
+    : DetachedSession() {
+    *this = ::std::move(from);
+  }
+
+  inline DetachedSession& operator=(const DetachedSession& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DetachedSession& operator=(DetachedSession&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DetachedSession& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DetachedSession* internal_default_instance() {
+    return reinterpret_cast<const DetachedSession*>(
+               &_DetachedSession_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(DetachedSession& a, DetachedSession& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DetachedSession* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DetachedSession* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DetachedSession* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DetachedSession>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DetachedSession& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DetachedSession& from) {
+    DetachedSession::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DetachedSession* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.DetachedSession";
+  }
+  protected:
+  explicit DetachedSession(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomsFieldNumber = 5,
+    kResumeFieldNumber = 9,
+    kIpFieldNumber = 1,
+    kUsernameFieldNumber = 2,
+    kLastActiveFieldNumber = 4,
+    kStatusFieldNumber = 3,
+    kCompactFieldNumber = 6,
+    kResumeTokenFieldNumber = 7,
+    kDetachedMsFieldNumber = 8,
+    kRegisteredAtFieldNumber = 10,
+  };
+  // repeated string rooms = 5;
+  int rooms_size() const;
+  private:
+  int _internal_rooms_size() const;
+  public:
+  void clear_rooms();
+  const std::string& rooms(int index) const;
+  std::string* mutable_rooms(int index);
+  void set_rooms(int index, const std::string& value);
+  void set_rooms(int index, std::string&& value);
+  void set_rooms(int index, const char* value);
+  void set_rooms(int index, const char* value, size_t size);
+  std::string* add_rooms();
+  void add_rooms(const std::string& value);
+  void add_rooms(std::string&& value);
+  void add_rooms(const char* value);
+  void add_rooms(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& rooms() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_rooms();
+  private:
+  const std::string& _internal_rooms(int index) const;
+  std::string* _internal_add_rooms();
+  public:
+
+  // repeated .chat.BufferedFrame resume = 9;
+  int resume_size() const;
+  private:
+  int _internal_resume_size() const;
+  public:
+  void clear_resume();
+  ::chat::BufferedFrame* mutable_resume(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::BufferedFrame >*
+      mutable_resume();
+  private:
+  const ::chat::BufferedFrame& _internal_resume(int index) const;
+  ::chat::BufferedFrame* _internal_add_resume();
+  public:
+  const ::chat::BufferedFrame& resume(int index) const;
+  ::chat::BufferedFrame* add_resume();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::BufferedFrame >&
+      resume() const;
+
+  // string ip = 1;
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
+
+  // string username = 2;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // int64 last_active = 4;
+  void clear_last_active();
+  int64_t last_active() const;
+  void set_last_active(int64_t value);
+  private:
+  int64_t _internal_last_active() const;
+  void _internal_set_last_active(int64_t value);
+  public:
+
+  // .chat.UserStatus status = 3;
+  void clear_status();
+  ::chat::UserStatus status() const;
+  void set_status(::chat::UserStatus value);
+  private:
+  ::chat::UserStatus _internal_status() const;
+  void _internal_set_status(::chat::UserStatus value);
+  public:
+
+  // bool compact = 6;
+  void clear_compact();
+  bool compact() const;
+  void set_compact(bool value);
+  private:
+  bool _internal_compact() const;
+  void _internal_set_compact(bool value);
+  public:
+
+  // uint64 resume_token = 7;
+  void clear_resume_token();
+  uint64_t resume_token() const;
+  void set_resume_token(uint64_t value);
+  private:
+  uint64_t _internal_resume_token() const;
+  void _internal_set_resume_token(uint64_t value);
+  public:
+
+  // int64 detached_ms = 8;
+  void clear_detached_ms();
+  int64_t detached_ms() const;
+  void set_detached_ms(int64_t value);
+  private:
+  int64_t _internal_detached_ms() const;
+  void _internal_set_detached_ms(int64_t value);
+  public:
+
+  // int64 registered_at = 10;
+  void clear_registered_at();
+  int64_t registered_at() const;
+  void set_registered_at(int64_t value);
+  private:
+  int64_t _internal_registered_at() const;
+  void _internal_set_registered_at(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.DetachedSession)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> rooms_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::BufferedFrame > resume_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    int64_t last_active_;
+    int status_;
+    bool compact_;
+    uint64_t resume_token_;
+    int64_t detached_ms_;
+    int64_t registered_at_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HandoffState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.HandoffState) */ {
+ public:
+  inline HandoffState() : HandoffState(nullptr) {}
+  ~HandoffState() override;
+  explicit PROTOBUF_CONSTEXPR HandoffState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HandoffState(const HandoffState& from);
+  HandoffState(HandoffState&& from) noexcept
+    : HandoffState() {
+    *this = ::std::move(from);
+  }
+
+  inline HandoffState& operator=(const HandoffState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HandoffState& operator=(HandoffState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HandoffState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HandoffState* internal_default_instance() {
+    return reinterpret_cast<const HandoffState*>(
+               &_HandoffState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(HandoffState& a, HandoffState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HandoffState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HandoffState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HandoffState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HandoffState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HandoffState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HandoffState& from) {
+    HandoffState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HandoffState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.HandoffState";
+  }
+  protected:
+  explicit HandoffState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessionsFieldNumber = 2,
+    kDetachedFieldNumber = 5,
+    kNextSeqFieldNumber = 4,
+    kHasListenerFieldNumber = 1,
+    kLastFieldNumber = 3,
+  };
+  // repeated .chat.HandoffSession sessions = 2;
+  int sessions_size() const;
+  private:
+  int _internal_sessions_size() const;
+  public:
+  void clear_sessions();
+  ::chat::HandoffSession* mutable_sessions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::HandoffSession >*
+      mutable_sessions();
+  private:
+  const ::chat::HandoffSession& _internal_sessions(int index) const;
+  ::chat::HandoffSession* _internal_add_sessions();
+  public:
+  const ::chat::HandoffSession& sessions(int index) const;
+  ::chat::HandoffSession* add_sessions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::HandoffSession >&
+      sessions() const;
+
+  // repeated .chat.DetachedSession detached = 5;
+  int detached_size() const;
+  private:
+  int _internal_detached_size() const;
+  public:
+  void clear_detached();
+  ::chat::DetachedSession* mutable_detached(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::DetachedSession >*
+      mutable_detached();
+  private:
+  const ::chat::DetachedSession& _internal_detached(int index) const;
+  ::chat::DetachedSession* _internal_add_detached();
+  public:
+  const ::chat::DetachedSession& detached(int index) const;
+  ::chat::DetachedSession* add_detached();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::DetachedSession >&
+      detached() const;
+
+  // uint64 next_seq = 4;
+  void clear_next_seq();
+  uint64_t next_seq() const;
+  void set_next_seq(uint64_t value);
+  private:
+  uint64_t _internal_next_seq() const;
+  void _internal_set_next_seq(uint64_t value);
+  public:
+
+  // bool has_listener = 1;
+  void clear_has_listener();
+  bool has_listener() const;
+  void set_has_listener(bool value);
+  private:
+  bool _internal_has_listener() const;
+  void _internal_set_has_listener(bool value);
+  public:
+
+  // bool last = 3;
+  void clear_last();
+  bool last() const;
+  void set_last(bool value);
+  private:
+  bool _internal_last() const;
+  void _internal_set_last(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.HandoffState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::HandoffSession > sessions_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::DetachedSession > detached_;
+    uint64_t next_seq_;
+    bool has_listener_;
+    bool last_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SnapshotUser final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.SnapshotUser) */ {
+ public:
+  inline SnapshotUser() : SnapshotUser(nullptr) {}
+  ~SnapshotUser() override;
+  explicit PROTOBUF_CONSTEXPR SnapshotUser(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SnapshotUser(const SnapshotUser& from);
+  SnapshotUser(SnapshotUser&& from) noexcept
+    : SnapshotUser() {
+    *this = ::std::move(from);
+  }
+
+  inline SnapshotUser& operator=(const SnapshotUser& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SnapshotUser& operator=(SnapshotUser&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SnapshotUser& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SnapshotUser* internal_default_instance() {
+    return reinterpret_cast<const SnapshotUser*>(
+               &_SnapshotUser_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(SnapshotUser& a, SnapshotUser& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SnapshotUser* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SnapshotUser* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SnapshotUser* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SnapshotUser>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SnapshotUser& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SnapshotUser& from) {
+    SnapshotUser::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SnapshotUser* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.SnapshotUser";
+  }
+  protected:
+  explicit SnapshotUser(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomsFieldNumber = 5,
+    kUsernameFieldNumber = 1,
+    kIpFieldNumber = 2,
+    kLastActiveFieldNumber = 4,
+    kStatusFieldNumber = 3,
+  };
+  // repeated string rooms = 5;
+  int rooms_size() const;
+  private:
+  int _internal_rooms_size() const;
+  public:
+  void clear_rooms();
+  const std::string& rooms(int index) const;
+  std::string* mutable_rooms(int index);
+  void set_rooms(int index, const std::string& value);
+  void set_rooms(int index, std::string&& value);
+  void set_rooms(int index, const char* value);
+  void set_rooms(int index, const char* value, size_t size);
+  std::string* add_rooms();
+  void add_rooms(const std::string& value);
+  void add_rooms(std::string&& value);
+  void add_rooms(const char* value);
+  void add_rooms(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& rooms() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_rooms();
+  private:
+  const std::string& _internal_rooms(int index) const;
+  std::string* _internal_add_rooms();
+  public:
+
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // string ip = 2;
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
+
+  // int64 last_active = 4;
+  void clear_last_active();
+  int64_t last_active() const;
+  void set_last_active(int64_t value);
+  private:
+  int64_t _internal_last_active() const;
+  void _internal_set_last_active(int64_t value);
+  public:
+
+  // .chat.UserStatus status = 3;
+  void clear_status();
+  ::chat::UserStatus status() const;
+  void set_status(::chat::UserStatus value);
+  private:
+  ::chat::UserStatus _internal_status() const;
+  void _internal_set_status(::chat::UserStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.SnapshotUser)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> rooms_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    int64_t last_active_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerSnapshot final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ServerSnapshot) */ {
+ public:
+  inline ServerSnapshot() : ServerSnapshot(nullptr) {}
+  ~ServerSnapshot() override;
+  explicit PROTOBUF_CONSTEXPR ServerSnapshot(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerSnapshot(const ServerSnapshot& from);
+  ServerSnapshot(ServerSnapshot&& from) noexcept
+    : ServerSnapshot() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerSnapshot& operator=(const ServerSnapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerSnapshot& operator=(ServerSnapshot&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerSnapshot& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerSnapshot* internal_default_instance() {
+    return reinterpret_cast<const ServerSnapshot*>(
+               &_ServerSnapshot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(ServerSnapshot& a, ServerSnapshot& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerSnapshot* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerSnapshot* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerSnapshot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerSnapshot>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerSnapshot& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerSnapshot& from) {
+    ServerSnapshot::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerSnapshot* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ServerSnapshot";
+  }
+  protected:
+  explicit ServerSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsersFieldNumber = 2,
+    kTakenAtFieldNumber = 1,
+  };
+  // repeated .chat.SnapshotUser users = 2;
+  int users_size() const;
+  private:
+  int _internal_users_size() const;
+  public:
+  void clear_users();
+  ::chat::SnapshotUser* mutable_users(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::SnapshotUser >*
+      mutable_users();
+  private:
+  const ::chat::SnapshotUser& _internal_users(int index) const;
+  ::chat::SnapshotUser* _internal_add_users();
+  public:
+  const ::chat::SnapshotUser& users(int index) const;
+  ::chat::SnapshotUser* add_users();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::SnapshotUser >&
+      users() const;
+
+  // int64 taken_at = 1;
+  void clear_taken_at();
+  int64_t taken_at() const;
+  void set_taken_at(int64_t value);
+  private:
+  int64_t _internal_taken_at() const;
+  void _internal_set_taken_at(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ServerSnapshot)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::SnapshotUser > users_;
+    int64_t taken_at_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// User
+
+// string username = 1;
+inline void User::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& User::username() const {
+  // @@protoc_insertion_point(field_get:chat.User.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void User::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.User.username)
+}
+inline std::string* User::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.User.username)
+  return _s;
+}
+inline const std::string& User::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void User::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* User::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* User::release_username() {
+  // @@protoc_insertion_point(field_release:chat.User.username)
+  return _impl_.username_.Release();
+}
+inline void User::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.User.username)
+}
+
+// .chat.UserStatus status = 2;
+inline void User::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::chat::UserStatus User::_internal_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.status_);
+}
+inline ::chat::UserStatus User::status() const {
+  // @@protoc_insertion_point(field_get:chat.User.status)
+  return _internal_status();
+}
+inline void User::_internal_set_status(::chat::UserStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void User::set_status(::chat::UserStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:chat.User.status)
+}
+
+// -------------------------------------------------------------------
+
+// NewUserRequest
+
+// string username = 1;
+inline void NewUserRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& NewUserRequest::username() const {
+  // @@protoc_insertion_point(field_get:chat.NewUserRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NewUserRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.NewUserRequest.username)
+}
+inline std::string* NewUserRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.NewUserRequest.username)
+  return _s;
+}
+inline const std::string& NewUserRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void NewUserRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NewUserRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NewUserRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.NewUserRequest.username)
+  return _impl_.username_.Release();
+}
+inline void NewUserRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.NewUserRequest.username)
+}
+
+// .chat.FlushPolicy flush_policy = 2;
+inline void NewUserRequest::clear_flush_policy() {
+  _impl_.flush_policy_ = 0;
+}
+inline ::chat::FlushPolicy NewUserRequest::_internal_flush_policy() const {
+  return static_cast< ::chat::FlushPolicy >(_impl_.flush_policy_);
+}
+inline ::chat::FlushPolicy NewUserRequest::flush_policy() const {
+  // @@protoc_insertion_point(field_get:chat.NewUserRequest.flush_policy)
+  return _internal_flush_policy();
+}
+inline void NewUserRequest::_internal_set_flush_policy(::chat::FlushPolicy value) {
+  
+  _impl_.flush_policy_ = value;
+}
+inline void NewUserRequest::set_flush_policy(::chat::FlushPolicy value) {
+  _internal_set_flush_policy(value);
+  // @@protoc_insertion_point(field_set:chat.NewUserRequest.flush_policy)
+}
+
+// .chat.Compression compression = 3;
+inline void NewUserRequest::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::chat::Compression NewUserRequest::_internal_compression() const {
+  return static_cast< ::chat::Compression >(_impl_.compression_);
+}
+inline ::chat::Compression NewUserRequest::compression() const {
+  // @@protoc_insertion_point(field_get:chat.NewUserRequest.compression)
+  return _internal_compression();
+}
+inline void NewUserRequest::_internal_set_compression(::chat::Compression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void NewUserRequest::set_compression(::chat::Compression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:chat.NewUserRequest.compression)
+}
+
+// bool compact = 4;
+inline void NewUserRequest::clear_compact() {
+  _impl_.compact_ = false;
+}
+inline bool NewUserRequest::_internal_compact() const {
+  return _impl_.compact_;
+}
+inline bool NewUserRequest::compact() const {
+  // @@protoc_insertion_point(field_get:chat.NewUserRequest.compact)
+  return _internal_compact();
+}
+inline void NewUserRequest::_internal_set_compact(bool value) {
+  
+  _impl_.compact_ = value;
+}
+inline void NewUserRequest::set_compact(bool value) {
+  _internal_set_compact(value);
+  // @@protoc_insertion_point(field_set:chat.NewUserRequest.compact)
+}
+
+// bool resumable = 5;
+inline void NewUserRequest::clear_resumable() {
+  _impl_.resumable_ = false;
+}
+inline bool NewUserRequest::_internal_resumable() const {
+  return _impl_.resumable_;
+}
+inline bool NewUserRequest::resumable() const {
+  // @@protoc_insertion_point(field_get:chat.NewUserRequest.resumable)
+  return _internal_resumable();
+}
+inline void NewUserRequest::_internal_set_resumable(bool value) {
+  
+  _impl_.resumable_ = value;
+}
+inline void NewUserRequest::set_resumable(bool value) {
+  _internal_set_resumable(value);
+  // @@protoc_insertion_point(field_set:chat.NewUserRequest.resumable)
+}
+
+// -------------------------------------------------------------------
+
+// ResumeRequest
+
+// string username = 1;
+inline void ResumeRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& ResumeRequest::username() const {
+  // @@protoc_insertion_point(field_get:chat.ResumeRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResumeRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ResumeRequest.username)
+}
+inline std::string* ResumeRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.ResumeRequest.username)
+  return _s;
+}
+inline const std::string& ResumeRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void ResumeRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResumeRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResumeRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.ResumeRequest.username)
+  return _impl_.username_.Release();
+}
+inline void ResumeRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ResumeRequest.username)
+}
+
+// uint64 token = 2;
+inline void ResumeRequest::clear_token() {
+  _impl_.token_ = uint64_t{0u};
+}
+inline uint64_t ResumeRequest::_internal_token() const {
+  return _impl_.token_;
+}
+inline uint64_t ResumeRequest::token() const {
+  // @@protoc_insertion_point(field_get:chat.ResumeRequest.token)
+  return _internal_token();
+}
+inline void ResumeRequest::_internal_set_token(uint64_t value) {
+  
+  _impl_.token_ = value;
+}
+inline void ResumeRequest::set_token(uint64_t value) {
+  _internal_set_token(value);
+  // @@protoc_insertion_point(field_set:chat.ResumeRequest.token)
+}
+
+// uint64 last_seq = 3;
+inline void ResumeRequest::clear_last_seq() {
+  _impl_.last_seq_ = uint64_t{0u};
+}
+inline uint64_t ResumeRequest::_internal_last_seq() const {
+  return _impl_.last_seq_;
+}
+inline uint64_t ResumeRequest::last_seq() const {
+  // @@protoc_insertion_point(field_get:chat.ResumeRequest.last_seq)
+  return _internal_last_seq();
+}
+inline void ResumeRequest::_internal_set_last_seq(uint64_t value) {
+  
+  _impl_.last_seq_ = value;
+}
+inline void ResumeRequest::set_last_seq(uint64_t value) {
+  _internal_set_last_seq(value);
+  // @@protoc_insertion_point(field_set:chat.ResumeRequest.last_seq)
+}
+
+// .chat.FlushPolicy flush_policy = 4;
+inline void ResumeRequest::clear_flush_policy() {
+  _impl_.flush_policy_ = 0;
+}
+inline ::chat::FlushPolicy ResumeRequest::_internal_flush_policy() const {
+  return static_cast< ::chat::FlushPolicy >(_impl_.flush_policy_);
+}
+inline ::chat::FlushPolicy ResumeRequest::flush_policy() const {
+  // @@protoc_insertion_point(field_get:chat.ResumeRequest.flush_policy)
+  return _internal_flush_policy();
+}
+inline void ResumeRequest::_internal_set_flush_policy(::chat::FlushPolicy value) {
+  
+  _impl_.flush_policy_ = value;
+}
+inline void ResumeRequest::set_flush_policy(::chat::FlushPolicy value) {
+  _internal_set_flush_policy(value);
+  // @@protoc_insertion_point(field_set:chat.ResumeRequest.flush_policy)
+}
+
+// .chat.Compression compression = 5;
+inline void ResumeRequest::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::chat::Compression ResumeRequest::_internal_compression() const {
+  return static_cast< ::chat::Compression >(_impl_.compression_);
+}
+inline ::chat::Compression ResumeRequest::compression() const {
+  // @@protoc_insertion_point(field_get:chat.ResumeRequest.compression)
+  return _internal_compression();
+}
+inline void ResumeRequest::_internal_set_compression(::chat::Compression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void ResumeRequest::set_compression(::chat::Compression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:chat.ResumeRequest.compression)
+}
+
+// -------------------------------------------------------------------
+
+// SendMessageRequest
+
+// string recipient = 1;
+inline void SendMessageRequest::clear_recipient() {
+  _impl_.recipient_.ClearToEmpty();
+}
+inline const std::string& SendMessageRequest::recipient() const {
+  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.recipient)
+  return _internal_recipient();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SendMessageRequest::set_recipient(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.recipient_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.recipient)
+}
+inline std::string* SendMessageRequest::mutable_recipient() {
+  std::string* _s = _internal_mutable_recipient();
+  // @@protoc_insertion_point(field_mutable:chat.SendMessageRequest.recipient)
+  return _s;
+}
+inline const std::string& SendMessageRequest::_internal_recipient() const {
+  return _impl_.recipient_.Get();
+}
+inline void SendMessageRequest::_internal_set_recipient(const std::string& value) {
+  
+  _impl_.recipient_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::_internal_mutable_recipient() {
+  
+  return _impl_.recipient_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::release_recipient() {
+  // @@protoc_insertion_point(field_release:chat.SendMessageRequest.recipient)
+  return _impl_.recipient_.Release();
+}
+inline void SendMessageRequest::set_allocated_recipient(std::string* recipient) {
+  if (recipient != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.recipient_.SetAllocated(recipient, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.recipient_.IsDefault()) {
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.SendMessageRequest.recipient)
+}
+
+// string content = 2;
+inline void SendMessageRequest::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& SendMessageRequest::content() const {
+  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SendMessageRequest::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.content)
+}
+inline std::string* SendMessageRequest::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:chat.SendMessageRequest.content)
+  return _s;
+}
+inline const std::string& SendMessageRequest::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void SendMessageRequest::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::release_content() {
+  // @@protoc_insertion_point(field_release:chat.SendMessageRequest.content)
+  return _impl_.content_.Release();
+}
+inline void SendMessageRequest::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.SendMessageRequest.content)
+}
+
+// -------------------------------------------------------------------
+
+// IncomingMessageResponse
+
+// string sender = 1;
+inline void IncomingMessageResponse::clear_sender() {
+  _impl_.sender_.ClearToEmpty();
+}
+inline const std::string& IncomingMessageResponse::sender() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.sender)
+  return _internal_sender();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IncomingMessageResponse::set_sender(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.sender_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.sender)
+}
+inline std::string* IncomingMessageResponse::mutable_sender() {
+  std::string* _s = _internal_mutable_sender();
+  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.sender)
+  return _s;
+}
+inline const std::string& IncomingMessageResponse::_internal_sender() const {
+  return _impl_.sender_.Get();
+}
+inline void IncomingMessageResponse::_internal_set_sender(const std::string& value) {
+  
+  _impl_.sender_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::_internal_mutable_sender() {
+  
+  return _impl_.sender_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::release_sender() {
+  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.sender)
+  return _impl_.sender_.Release();
+}
+inline void IncomingMessageResponse::set_allocated_sender(std::string* sender) {
+  if (sender != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.sender_.SetAllocated(sender, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sender_.IsDefault()) {
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.sender)
+}
+
+// string content = 2;
+inline void IncomingMessageResponse::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& IncomingMessageResponse::content() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IncomingMessageResponse::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.content)
+}
+inline std::string* IncomingMessageResponse::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.content)
+  return _s;
+}
+inline const std::string& IncomingMessageResponse::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void IncomingMessageResponse::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::release_content() {
+  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.content)
+  return _impl_.content_.Release();
+}
+inline void IncomingMessageResponse::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.content)
+}
+
+// .chat.MessageType type = 3;
+inline void IncomingMessageResponse::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::chat::MessageType IncomingMessageResponse::_internal_type() const {
+  return static_cast< ::chat::MessageType >(_impl_.type_);
+}
+inline ::chat::MessageType IncomingMessageResponse::type() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.type)
+  return _internal_type();
+}
+inline void IncomingMessageResponse::_internal_set_type(::chat::MessageType value) {
+  
+  _impl_.type_ = value;
+}
+inline void IncomingMessageResponse::set_type(::chat::MessageType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.type)
+}
+
+// int64 timestamp = 4;
+inline void IncomingMessageResponse::clear_timestamp() {
+  _impl_.timestamp_ = int64_t{0};
+}
+inline int64_t IncomingMessageResponse::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline int64_t IncomingMessageResponse::timestamp() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.timestamp)
+  return _internal_timestamp();
+}
+inline void IncomingMessageResponse::_internal_set_timestamp(int64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void IncomingMessageResponse::set_timestamp(int64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.timestamp)
+}
+
+// string room = 5;
+inline void IncomingMessageResponse::clear_room() {
+  _impl_.room_.ClearToEmpty();
+}
+inline const std::string& IncomingMessageResponse::room() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.room)
+  return _internal_room();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IncomingMessageResponse::set_room(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.room_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.room)
+}
+inline std::string* IncomingMessageResponse::mutable_room() {
+  std::string* _s = _internal_mutable_room();
+  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.room)
+  return _s;
+}
+inline const std::string& IncomingMessageResponse::_internal_room() const {
+  return _impl_.room_.Get();
+}
+inline void IncomingMessageResponse::_internal_set_room(const std::string& value) {
+  
+  _impl_.room_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::_internal_mutable_room() {
+  
+  return _impl_.room_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::release_room() {
+  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.room)
+  return _impl_.room_.Release();
+}
+inline void IncomingMessageResponse::set_allocated_room(std::string* room) {
+  if (room != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.room_.SetAllocated(room, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.room_.IsDefault()) {
+    _impl_.room_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.room)
+}
+
+// uint32 sender_id = 6;
+inline void IncomingMessageResponse::clear_sender_id() {
+  _impl_.sender_id_ = 0u;
+}
+inline uint32_t IncomingMessageResponse::_internal_sender_id() const {
+  return _impl_.sender_id_;
+}
+inline uint32_t IncomingMessageResponse::sender_id() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.sender_id)
+  return _internal_sender_id();
+}
+inline void IncomingMessageResponse::_internal_set_sender_id(uint32_t value) {
+  
+  _impl_.sender_id_ = value;
+}
+inline void IncomingMessageResponse::set_sender_id(uint32_t value) {
+  _internal_set_sender_id(value);
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.sender_id)
+}
+
+// uint64 message_id = 7;
+inline void IncomingMessageResponse::clear_message_id() {
+  _impl_.message_id_ = uint64_t{0u};
+}
+inline uint64_t IncomingMessageResponse::_internal_message_id() const {
+  return _impl_.message_id_;
+}
+inline uint64_t IncomingMessageResponse::message_id() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.message_id)
+  return _internal_message_id();
+}
+inline void IncomingMessageResponse::_internal_set_message_id(uint64_t value) {
+  
+  _impl_.message_id_ = value;
+}
+inline void IncomingMessageResponse::set_message_id(uint64_t value) {
+  _internal_set_message_id(value);
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.message_id)
+}
+
+// -------------------------------------------------------------------
+
+// UserListRequest
+
+// string username = 1;
+inline void UserListRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& UserListRequest::username() const {
+  // @@protoc_insertion_point(field_get:chat.UserListRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserListRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UserListRequest.username)
+}
+inline std::string* UserListRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.UserListRequest.username)
+  return _s;
+}
+inline const std::string& UserListRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void UserListRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UserListRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UserListRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.UserListRequest.username)
+  return _impl_.username_.Release();
+}
+inline void UserListRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UserListRequest.username)
+}
+
+// -------------------------------------------------------------------
+
+// UserListResponse
+
+// repeated .chat.User users = 1;
+inline int UserListResponse::_internal_users_size() const {
+  return _impl_.users_.size();
+}
+inline int UserListResponse::users_size() const {
+  return _internal_users_size();
+}
+inline void UserListResponse::clear_users() {
+  _impl_.users_.Clear();
+}
+inline ::chat::User* UserListResponse::mutable_users(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.UserListResponse.users)
+  return _impl_.users_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >*
+UserListResponse::mutable_users() {
+  // @@protoc_insertion_point(field_mutable_list:chat.UserListResponse.users)
+  return &_impl_.users_;
+}
+inline const ::chat::User& UserListResponse::_internal_users(int index) const {
+  return _impl_.users_.Get(index);
+}
+inline const ::chat::User& UserListResponse::users(int index) const {
+  // @@protoc_insertion_point(field_get:chat.UserListResponse.users)
+  return _internal_users(index);
+}
+inline ::chat::User* UserListResponse::_internal_add_users() {
+  return _impl_.users_.Add();
+}
+inline ::chat::User* UserListResponse::add_users() {
+  ::chat::User* _add = _internal_add_users();
+  // @@protoc_insertion_point(field_add:chat.UserListResponse.users)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >&
+UserListResponse::users() const {
+  // @@protoc_insertion_point(field_list:chat.UserListResponse.users)
+  return _impl_.users_;
+}
+
+// .chat.UserListType type = 2;
+inline void UserListResponse::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::chat::UserListType UserListResponse::_internal_type() const {
+  return static_cast< ::chat::UserListType >(_impl_.type_);
+}
+inline ::chat::UserListType UserListResponse::type() const {
+  // @@protoc_insertion_point(field_get:chat.UserListResponse.type)
+  return _internal_type();
+}
+inline void UserListResponse::_internal_set_type(::chat::UserListType value) {
+  
+  _impl_.type_ = value;
+}
+inline void UserListResponse::set_type(::chat::UserListType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:chat.UserListResponse.type)
+}
+
+// -------------------------------------------------------------------
+
+// UpdateStatusRequest
+
+// string username = 1;
+inline void UpdateStatusRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& UpdateStatusRequest::username() const {
+  // @@protoc_insertion_point(field_get:chat.UpdateStatusRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpdateStatusRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UpdateStatusRequest.username)
+}
+inline std::string* UpdateStatusRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.UpdateStatusRequest.username)
+  return _s;
+}
+inline const std::string& UpdateStatusRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void UpdateStatusRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UpdateStatusRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UpdateStatusRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.UpdateStatusRequest.username)
+  return _impl_.username_.Release();
+}
+inline void UpdateStatusRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UpdateStatusRequest.username)
+}
+
+// .chat.UserStatus new_status = 2;
+inline void UpdateStatusRequest::clear_new_status() {
+  _impl_.new_status_ = 0;
+}
+inline ::chat::UserStatus UpdateStatusRequest::_internal_new_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.new_status_);
+}
+inline ::chat::UserStatus UpdateStatusRequest::new_status() const {
+  // @@protoc_insertion_point(field_get:chat.UpdateStatusRequest.new_status)
+  return _internal_new_status();
+}
+inline void UpdateStatusRequest::_internal_set_new_status(::chat::UserStatus value) {
+  
+  _impl_.new_status_ = value;
+}
+inline void UpdateStatusRequest::set_new_status(::chat::UserStatus value) {
+  _internal_set_new_status(value);
+  // @@protoc_insertion_point(field_set:chat.UpdateStatusRequest.new_status)
+}
+
+// -------------------------------------------------------------------
+
+// RoomRequest
+
+// string room = 1;
+inline void RoomRequest::clear_room() {
+  _impl_.room_.ClearToEmpty();
+}
+inline const std::string& RoomRequest::room() const {
+  // @@protoc_insertion_point(field_get:chat.RoomRequest.room)
+  return _internal_room();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RoomRequest::set_room(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.room_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.RoomRequest.room)
+}
+inline std::string* RoomRequest::mutable_room() {
+  std::string* _s = _internal_mutable_room();
+  // @@protoc_insertion_point(field_mutable:chat.RoomRequest.room)
+  return _s;
+}
+inline const std::string& RoomRequest::_internal_room() const {
+  return _impl_.room_.Get();
+}
+inline void RoomRequest::_internal_set_room(const std::string& value) {
+  
+  _impl_.room_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RoomRequest::_internal_mutable_room() {
+  
+  return _impl_.room_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RoomRequest::release_room() {
+  // @@protoc_insertion_point(field_release:chat.RoomRequest.room)
+  return _impl_.room_.Release();
+}
+inline void RoomRequest::set_allocated_room(std::string* room) {
+  if (room != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.room_.SetAllocated(room, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.room_.IsDefault()) {
+    _impl_.room_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.RoomRequest.room)
+}
+
+// string content = 2;
+inline void RoomRequest::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& RoomRequest::content() const {
+  // @@protoc_insertion_point(field_get:chat.RoomRequest.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RoomRequest::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.RoomRequest.content)
+}
+inline std::string* RoomRequest::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:chat.RoomRequest.content)
+  return _s;
+}
+inline const std::string& RoomRequest::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void RoomRequest::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RoomRequest::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RoomRequest::release_content() {
+  // @@protoc_insertion_point(field_release:chat.RoomRequest.content)
+  return _impl_.content_.Release();
+}
+inline void RoomRequest::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.RoomRequest.content)
+}
+
+// -------------------------------------------------------------------
+
+// HistoryRequest
+
+// string conversation = 1;
+inline void HistoryRequest::clear_conversation() {
+  _impl_.conversation_.ClearToEmpty();
+}
+inline const std::string& HistoryRequest::conversation() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryRequest.conversation)
+  return _internal_conversation();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HistoryRequest::set_conversation(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.conversation_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.HistoryRequest.conversation)
+}
+inline std::string* HistoryRequest::mutable_conversation() {
+  std::string* _s = _internal_mutable_conversation();
+  // @@protoc_insertion_point(field_mutable:chat.HistoryRequest.conversation)
+  return _s;
+}
+inline const std::string& HistoryRequest::_internal_conversation() const {
+  return _impl_.conversation_.Get();
+}
+inline void HistoryRequest::_internal_set_conversation(const std::string& value) {
+  
+  _impl_.conversation_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HistoryRequest::_internal_mutable_conversation() {
+  
+  return _impl_.conversation_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HistoryRequest::release_conversation() {
+  // @@protoc_insertion_point(field_release:chat.HistoryRequest.conversation)
+  return _impl_.conversation_.Release();
+}
+inline void HistoryRequest::set_allocated_conversation(std::string* conversation) {
+  if (conversation != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.conversation_.SetAllocated(conversation, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.conversation_.IsDefault()) {
+    _impl_.conversation_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.HistoryRequest.conversation)
+}
+
+// int64 since = 2;
+inline void HistoryRequest::clear_since() {
+  _impl_.since_ = int64_t{0};
+}
+inline int64_t HistoryRequest::_internal_since() const {
+  return _impl_.since_;
+}
+inline int64_t HistoryRequest::since() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryRequest.since)
+  return _internal_since();
+}
+inline void HistoryRequest::_internal_set_since(int64_t value) {
+  
+  _impl_.since_ = value;
+}
+inline void HistoryRequest::set_since(int64_t value) {
+  _internal_set_since(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryRequest.since)
+}
+
+// int64 until = 3;
+inline void HistoryRequest::clear_until() {
+  _impl_.until_ = int64_t{0};
+}
+inline int64_t HistoryRequest::_internal_until() const {
+  return _impl_.until_;
+}
+inline int64_t HistoryRequest::until() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryRequest.until)
+  return _internal_until();
+}
+inline void HistoryRequest::_internal_set_until(int64_t value) {
+  
+  _impl_.until_ = value;
+}
+inline void HistoryRequest::set_until(int64_t value) {
+  _internal_set_until(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryRequest.until)
+}
+
+// uint32 limit = 4;
+inline void HistoryRequest::clear_limit() {
+  _impl_.limit_ = 0u;
+}
+inline uint32_t HistoryRequest::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline uint32_t HistoryRequest::limit() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryRequest.limit)
+  return _internal_limit();
+}
+inline void HistoryRequest::_internal_set_limit(uint32_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void HistoryRequest::set_limit(uint32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryRequest.limit)
+}
+
+// string sender = 5;
+inline void HistoryRequest::clear_sender() {
+  _impl_.sender_.ClearToEmpty();
+}
+inline const std::string& HistoryRequest::sender() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryRequest.sender)
+  return _internal_sender();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HistoryRequest::set_sender(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.sender_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.HistoryRequest.sender)
+}
+inline std::string* HistoryRequest::mutable_sender() {
+  std::string* _s = _internal_mutable_sender();
+  // @@protoc_insertion_point(field_mutable:chat.HistoryRequest.sender)
+  return _s;
+}
+inline const std::string& HistoryRequest::_internal_sender() const {
+  return _impl_.sender_.Get();
+}
+inline void HistoryRequest::_internal_set_sender(const std::string& value) {
+  
+  _impl_.sender_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HistoryRequest::_internal_mutable_sender() {
+  
+  return _impl_.sender_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HistoryRequest::release_sender() {
+  // @@protoc_insertion_point(field_release:chat.HistoryRequest.sender)
+  return _impl_.sender_.Release();
+}
+inline void HistoryRequest::set_allocated_sender(std::string* sender) {
+  if (sender != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.sender_.SetAllocated(sender, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sender_.IsDefault()) {
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.HistoryRequest.sender)
+}
+
+// -------------------------------------------------------------------
+
+// Receipts
+
+// repeated uint64 delivered = 1;
+inline int Receipts::_internal_delivered_size() const {
+  return _impl_.delivered_.size();
+}
+inline int Receipts::delivered_size() const {
+  return _internal_delivered_size();
+}
+inline void Receipts::clear_delivered() {
+  _impl_.delivered_.Clear();
+}
+inline uint64_t Receipts::_internal_delivered(int index) const {
+  return _impl_.delivered_.Get(index);
+}
+inline uint64_t Receipts::delivered(int index) const {
+  // @@protoc_insertion_point(field_get:chat.Receipts.delivered)
+  return _internal_delivered(index);
+}
+inline void Receipts::set_delivered(int index, uint64_t value) {
+  _impl_.delivered_.Set(index, value);
+  // @@protoc_insertion_point(field_set:chat.Receipts.delivered)
+}
+inline void Receipts::_internal_add_delivered(uint64_t value) {
+  _impl_.delivered_.Add(value);
+}
+inline void Receipts::add_delivered(uint64_t value) {
+  _internal_add_delivered(value);
+  // @@protoc_insertion_point(field_add:chat.Receipts.delivered)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Receipts::_internal_delivered() const {
+  return _impl_.delivered_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Receipts::delivered() const {
+  // @@protoc_insertion_point(field_list:chat.Receipts.delivered)
+  return _internal_delivered();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Receipts::_internal_mutable_delivered() {
+  return &_impl_.delivered_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Receipts::mutable_delivered() {
+  // @@protoc_insertion_point(field_mutable_list:chat.Receipts.delivered)
+  return _internal_mutable_delivered();
+}
+
+// repeated uint64 read = 2;
+inline int Receipts::_internal_read_size() const {
+  return _impl_.read_.size();
+}
+inline int Receipts::read_size() const {
+  return _internal_read_size();
+}
+inline void Receipts::clear_read() {
+  _impl_.read_.Clear();
+}
+inline uint64_t Receipts::_internal_read(int index) const {
+  return _impl_.read_.Get(index);
+}
+inline uint64_t Receipts::read(int index) const {
+  // @@protoc_insertion_point(field_get:chat.Receipts.read)
+  return _internal_read(index);
+}
+inline void Receipts::set_read(int index, uint64_t value) {
+  _impl_.read_.Set(index, value);
+  // @@protoc_insertion_point(field_set:chat.Receipts.read)
+}
+inline void Receipts::_internal_add_read(uint64_t value) {
+  _impl_.read_.Add(value);
+}
+inline void Receipts::add_read(uint64_t value) {
+  _internal_add_read(value);
+  // @@protoc_insertion_point(field_add:chat.Receipts.read)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Receipts::_internal_read() const {
+  return _impl_.read_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Receipts::read() const {
+  // @@protoc_insertion_point(field_list:chat.Receipts.read)
+  return _internal_read();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Receipts::_internal_mutable_read() {
+  return &_impl_.read_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Receipts::mutable_read() {
+  // @@protoc_insertion_point(field_mutable_list:chat.Receipts.read)
+  return _internal_mutable_read();
+}
+
+// uint64 received_seq = 3;
+inline void Receipts::clear_received_seq() {
+  _impl_.received_seq_ = uint64_t{0u};
+}
+inline uint64_t Receipts::_internal_received_seq() const {
+  return _impl_.received_seq_;
+}
+inline uint64_t Receipts::received_seq() const {
+  // @@protoc_insertion_point(field_get:chat.Receipts.received_seq)
+  return _internal_received_seq();
+}
+inline void Receipts::_internal_set_received_seq(uint64_t value) {
+  
+  _impl_.received_seq_ = value;
+}
+inline void Receipts::set_received_seq(uint64_t value) {
+  _internal_set_received_seq(value);
+  // @@protoc_insertion_point(field_set:chat.Receipts.received_seq)
+}
+
+// -------------------------------------------------------------------
+
+// BatchRequest
+
+// repeated .chat.Request requests = 1;
+inline int BatchRequest::_internal_requests_size() const {
+  return _impl_.requests_.size();
+}
+inline int BatchRequest::requests_size() const {
+  return _internal_requests_size();
+}
+inline void BatchRequest::clear_requests() {
+  _impl_.requests_.Clear();
+}
+inline ::chat::Request* BatchRequest::mutable_requests(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.BatchRequest.requests)
+  return _impl_.requests_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Request >*
+BatchRequest::mutable_requests() {
+  // @@protoc_insertion_point(field_mutable_list:chat.BatchRequest.requests)
+  return &_impl_.requests_;
+}
+inline const ::chat::Request& BatchRequest::_internal_requests(int index) const {
+  return _impl_.requests_.Get(index);
+}
+inline const ::chat::Request& BatchRequest::requests(int index) const {
+  // @@protoc_insertion_point(field_get:chat.BatchRequest.requests)
+  return _internal_requests(index);
+}
+inline ::chat::Request* BatchRequest::_internal_add_requests() {
+  return _impl_.requests_.Add();
+}
+inline ::chat::Request* BatchRequest::add_requests() {
+  ::chat::Request* _add = _internal_add_requests();
+  // @@protoc_insertion_point(field_add:chat.BatchRequest.requests)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Request >&
+BatchRequest::requests() const {
+  // @@protoc_insertion_point(field_list:chat.BatchRequest.requests)
+  return _impl_.requests_;
+}
+
+// -------------------------------------------------------------------
+
+// BatchResponse
+
+// repeated .chat.Response responses = 1;
+inline int BatchResponse::_internal_responses_size() const {
+  return _impl_.responses_.size();
+}
+inline int BatchResponse::responses_size() const {
+  return _internal_responses_size();
+}
+inline void BatchResponse::clear_responses() {
+  _impl_.responses_.Clear();
+}
+inline ::chat::Response* BatchResponse::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.BatchResponse.responses)
+  return _impl_.responses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Response >*
+BatchResponse::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:chat.BatchResponse.responses)
+  return &_impl_.responses_;
+}
+inline const ::chat::Response& BatchResponse::_internal_responses(int index) const {
+  return _impl_.responses_.Get(index);
+}
+inline const ::chat::Response& BatchResponse::responses(int index) const {
+  // @@protoc_insertion_point(field_get:chat.BatchResponse.responses)
+  return _internal_responses(index);
+}
+inline ::chat::Response* BatchResponse::_internal_add_responses() {
+  return _impl_.responses_.Add();
+}
+inline ::chat::Response* BatchResponse::add_responses() {
+  ::chat::Response* _add = _internal_add_responses();
+  // @@protoc_insertion_point(field_add:chat.BatchResponse.responses)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Response >&
+BatchResponse::responses() const {
+  // @@protoc_insertion_point(field_list:chat.BatchResponse.responses)
+  return _impl_.responses_;
+}
+
+// -------------------------------------------------------------------
+
+// HistoryResponse
+
+// repeated .chat.IncomingMessageResponse messages = 1;
+inline int HistoryResponse::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int HistoryResponse::messages_size() const {
+  return _internal_messages_size();
+}
+inline void HistoryResponse::clear_messages() {
+  _impl_.messages_.Clear();
+}
+inline ::chat::IncomingMessageResponse* HistoryResponse::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.HistoryResponse.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::IncomingMessageResponse >*
+HistoryResponse::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:chat.HistoryResponse.messages)
+  return &_impl_.messages_;
+}
+inline const ::chat::IncomingMessageResponse& HistoryResponse::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const ::chat::IncomingMessageResponse& HistoryResponse::messages(int index) const {
+  // @@protoc_insertion_point(field_get:chat.HistoryResponse.messages)
+  return _internal_messages(index);
+}
+inline ::chat::IncomingMessageResponse* HistoryResponse::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline ::chat::IncomingMessageResponse* HistoryResponse::add_messages() {
+  ::chat::IncomingMessageResponse* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:chat.HistoryResponse.messages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::IncomingMessageResponse >&
+HistoryResponse::messages() const {
+  // @@protoc_insertion_point(field_list:chat.HistoryResponse.messages)
+  return _impl_.messages_;
+}
+
+// uint32 page = 2;
+inline void HistoryResponse::clear_page() {
+  _impl_.page_ = 0u;
+}
+inline uint32_t HistoryResponse::_internal_page() const {
+  return _impl_.page_;
+}
+inline uint32_t HistoryResponse::page() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryResponse.page)
+  return _internal_page();
+}
+inline void HistoryResponse::_internal_set_page(uint32_t value) {
+  
+  _impl_.page_ = value;
+}
+inline void HistoryResponse::set_page(uint32_t value) {
+  _internal_set_page(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryResponse.page)
+}
+
+// bool last_page = 3;
+inline void HistoryResponse::clear_last_page() {
+  _impl_.last_page_ = false;
+}
+inline bool HistoryResponse::_internal_last_page() const {
+  return _impl_.last_page_;
+}
+inline bool HistoryResponse::last_page() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryResponse.last_page)
+  return _internal_last_page();
+}
+inline void HistoryResponse::_internal_set_last_page(bool value) {
+  
+  _impl_.last_page_ = value;
+}
+inline void HistoryResponse::set_last_page(bool value) {
+  _internal_set_last_page(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryResponse.last_page)
+}
+
+// -------------------------------------------------------------------
+
+// StoredMessage
+
+// string conversation = 1;
+inline void StoredMessage::clear_conversation() {
+  _impl_.conversation_.ClearToEmpty();
+}
+inline const std::string& StoredMessage::conversation() const {
+  // @@protoc_insertion_point(field_get:chat.StoredMessage.conversation)
+  return _internal_conversation();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StoredMessage::set_conversation(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.conversation_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.StoredMessage.conversation)
+}
+inline std::string* StoredMessage::mutable_conversation() {
+  std::string* _s = _internal_mutable_conversation();
+  // @@protoc_insertion_point(field_mutable:chat.StoredMessage.conversation)
+  return _s;
+}
+inline const std::string& StoredMessage::_internal_conversation() const {
+  return _impl_.conversation_.Get();
+}
+inline void StoredMessage::_internal_set_conversation(const std::string& value) {
+  
+  _impl_.conversation_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StoredMessage::_internal_mutable_conversation() {
+  
+  return _impl_.conversation_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StoredMessage::release_conversation() {
+  // @@protoc_insertion_point(field_release:chat.StoredMessage.conversation)
+  return _impl_.conversation_.Release();
+}
+inline void StoredMessage::set_allocated_conversation(std::string* conversation) {
+  if (conversation != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.conversation_.SetAllocated(conversation, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.conversation_.IsDefault()) {
+    _impl_.conversation_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.StoredMessage.conversation)
+}
+
+// .chat.IncomingMessageResponse message = 2;
+inline bool StoredMessage::_internal_has_message() const {
+  return this != internal_default_instance() && _impl_.message_ != nullptr;
+}
+inline bool StoredMessage::has_message() const {
+  return _internal_has_message();
+}
+inline void StoredMessage::clear_message() {
+  if (GetArenaForAllocation() == nullptr && _impl_.message_ != nullptr) {
+    delete _impl_.message_;
+  }
+  _impl_.message_ = nullptr;
+}
+inline const ::chat::IncomingMessageResponse& StoredMessage::_internal_message() const {
+  const ::chat::IncomingMessageResponse* p = _impl_.message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::IncomingMessageResponse&>(
+      ::chat::_IncomingMessageResponse_default_instance_);
+}
+inline const ::chat::IncomingMessageResponse& StoredMessage::message() const {
+  // @@protoc_insertion_point(field_get:chat.StoredMessage.message)
+  return _internal_message();
+}
+inline void StoredMessage::unsafe_arena_set_allocated_message(
+    ::chat::IncomingMessageResponse* message) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  _impl_.message_ = message;
+  if (message) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.StoredMessage.message)
+}
+inline ::chat::IncomingMessageResponse* StoredMessage::release_message() {
+  
+  ::chat::IncomingMessageResponse* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::IncomingMessageResponse* StoredMessage::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:chat.StoredMessage.message)
+  
+  ::chat::IncomingMessageResponse* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+  return temp;
+}
+inline ::chat::IncomingMessageResponse* StoredMessage::_internal_mutable_message() {
+  
+  if (_impl_.message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::IncomingMessageResponse>(GetArenaForAllocation());
+    _impl_.message_ = p;
+  }
+  return _impl_.message_;
+}
+inline ::chat::IncomingMessageResponse* StoredMessage::mutable_message() {
+  ::chat::IncomingMessageResponse* _msg = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:chat.StoredMessage.message)
+  return _msg;
+}
+inline void StoredMessage::set_allocated_message(::chat::IncomingMessageResponse* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.message_;
+  }
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(message);
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:chat.StoredMessage.message)
+}
+
+// -------------------------------------------------------------------
+
+// Request
+
+// .chat.Operation operation = 1;
+inline void Request::clear_operation() {
+  _impl_.operation_ = 0;
+}
+inline ::chat::Operation Request::_internal_operation() const {
+  return static_cast< ::chat::Operation >(_impl_.operation_);
+}
+inline ::chat::Operation Request::operation() const {
+  // @@protoc_insertion_point(field_get:chat.Request.operation)
+  return _internal_operation();
+}
+inline void Request::_internal_set_operation(::chat::Operation value) {
+  
+  _impl_.operation_ = value;
+}
+inline void Request::set_operation(::chat::Operation value) {
+  _internal_set_operation(value);
+  // @@protoc_insertion_point(field_set:chat.Request.operation)
+}
+
+// .chat.NewUserRequest register_user = 2;
+inline bool Request::_internal_has_register_user() const {
+  return payload_case() == kRegisterUser;
+}
+inline bool Request::has_register_user() const {
+  return _internal_has_register_user();
+}
+inline void Request::set_has_register_user() {
+  _impl_._oneof_case_[0] = kRegisterUser;
+}
+inline void Request::clear_register_user() {
+  if (_internal_has_register_user()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.register_user_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::NewUserRequest* Request::release_register_user() {
+  // @@protoc_insertion_point(field_release:chat.Request.register_user)
+  if (_internal_has_register_user()) {
+    clear_has_payload();
+    ::chat::NewUserRequest* temp = _impl_.payload_.register_user_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.register_user_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::NewUserRequest& Request::_internal_register_user() const {
+  return _internal_has_register_user()
+      ? *_impl_.payload_.register_user_
+      : reinterpret_cast< ::chat::NewUserRequest&>(::chat::_NewUserRequest_default_instance_);
+}
+inline const ::chat::NewUserRequest& Request::register_user() const {
+  // @@protoc_insertion_point(field_get:chat.Request.register_user)
+  return _internal_register_user();
+}
+inline ::chat::NewUserRequest* Request::unsafe_arena_release_register_user() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.register_user)
+  if (_internal_has_register_user()) {
+    clear_has_payload();
+    ::chat::NewUserRequest* temp = _impl_.payload_.register_user_;
+    _impl_.payload_.register_user_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_register_user(::chat::NewUserRequest* register_user) {
+  clear_payload();
+  if (register_user) {
+    set_has_register_user();
+    _impl_.payload_.register_user_ = register_user;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.register_user)
+}
+inline ::chat::NewUserRequest* Request::_internal_mutable_register_user() {
+  if (!_internal_has_register_user()) {
+    clear_payload();
+    set_has_register_user();
+    _impl_.payload_.register_user_ = CreateMaybeMessage< ::chat::NewUserRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.register_user_;
+}
+inline ::chat::NewUserRequest* Request::mutable_register_user() {
+  ::chat::NewUserRequest* _msg = _internal_mutable_register_user();
+  // @@protoc_insertion_point(field_mutable:chat.Request.register_user)
+  return _msg;
+}
+
+// .chat.SendMessageRequest send_message = 3;
+inline bool Request::_internal_has_send_message() const {
+  return payload_case() == kSendMessage;
+}
+inline bool Request::has_send_message() const {
+  return _internal_has_send_message();
+}
+inline void Request::set_has_send_message() {
+  _impl_._oneof_case_[0] = kSendMessage;
+}
+inline void Request::clear_send_message() {
+  if (_internal_has_send_message()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.send_message_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::SendMessageRequest* Request::release_send_message() {
+  // @@protoc_insertion_point(field_release:chat.Request.send_message)
+  if (_internal_has_send_message()) {
+    clear_has_payload();
+    ::chat::SendMessageRequest* temp = _impl_.payload_.send_message_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.send_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::SendMessageRequest& Request::_internal_send_message() const {
+  return _internal_has_send_message()
+      ? *_impl_.payload_.send_message_
+      : reinterpret_cast< ::chat::SendMessageRequest&>(::chat::_SendMessageRequest_default_instance_);
+}
+inline const ::chat::SendMessageRequest& Request::send_message() const {
+  // @@protoc_insertion_point(field_get:chat.Request.send_message)
+  return _internal_send_message();
+}
+inline ::chat::SendMessageRequest* Request::unsafe_arena_release_send_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.send_message)
+  if (_internal_has_send_message()) {
+    clear_has_payload();
+    ::chat::SendMessageRequest* temp = _impl_.payload_.send_message_;
+    _impl_.payload_.send_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_send_message(::chat::SendMessageRequest* send_message) {
+  clear_payload();
+  if (send_message) {
+    set_has_send_message();
+    _impl_.payload_.send_message_ = send_message;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.send_message)
+}
+inline ::chat::SendMessageRequest* Request::_internal_mutable_send_message() {
+  if (!_internal_has_send_message()) {
+    clear_payload();
+    set_has_send_message();
+    _impl_.payload_.send_message_ = CreateMaybeMessage< ::chat::SendMessageRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.send_message_;
+}
+inline ::chat::SendMessageRequest* Request::mutable_send_message() {
+  ::chat::SendMessageRequest* _msg = _internal_mutable_send_message();
+  // @@protoc_insertion_point(field_mutable:chat.Request.send_message)
+  return _msg;
+}
+
+// .chat.UpdateStatusRequest update_status = 4;
+inline bool Request::_internal_has_update_status() const {
+  return payload_case() == kUpdateStatus;
+}
+inline bool Request::has_update_status() const {
+  return _internal_has_update_status();
+}
+inline void Request::set_has_update_status() {
+  _impl_._oneof_case_[0] = kUpdateStatus;
+}
+inline void Request::clear_update_status() {
+  if (_internal_has_update_status()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.update_status_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::UpdateStatusRequest* Request::release_update_status() {
+  // @@protoc_insertion_point(field_release:chat.Request.update_status)
+  if (_internal_has_update_status()) {
+    clear_has_payload();
+    ::chat::UpdateStatusRequest* temp = _impl_.payload_.update_status_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.update_status_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::UpdateStatusRequest& Request::_internal_update_status() const {
+  return _internal_has_update_status()
+      ? *_impl_.payload_.update_status_
+      : reinterpret_cast< ::chat::UpdateStatusRequest&>(::chat::_UpdateStatusRequest_default_instance_);
+}
+inline const ::chat::UpdateStatusRequest& Request::update_status() const {
+  // @@protoc_insertion_point(field_get:chat.Request.update_status)
+  return _internal_update_status();
+}
+inline ::chat::UpdateStatusRequest* Request::unsafe_arena_release_update_status() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.update_status)
+  if (_internal_has_update_status()) {
+    clear_has_payload();
+    ::chat::UpdateStatusRequest* temp = _impl_.payload_.update_status_;
+    _impl_.payload_.update_status_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_update_status(::chat::UpdateStatusRequest* update_status) {
+  clear_payload();
+  if (update_status) {
+    set_has_update_status();
+    _impl_.payload_.update_status_ = update_status;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.update_status)
+}
+inline ::chat::UpdateStatusRequest* Request::_internal_mutable_update_status() {
+  if (!_internal_has_update_status()) {
+    clear_payload();
+    set_has_update_status();
+    _impl_.payload_.update_status_ = CreateMaybeMessage< ::chat::UpdateStatusRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.update_status_;
+}
+inline ::chat::UpdateStatusRequest* Request::mutable_update_status() {
+  ::chat::UpdateStatusRequest* _msg = _internal_mutable_update_status();
+  // @@protoc_insertion_point(field_mutable:chat.Request.update_status)
+  return _msg;
+}
+
+// .chat.UserListRequest get_users = 5;
+inline bool Request::_internal_has_get_users() const {
+  return payload_case() == kGetUsers;
+}
+inline bool Request::has_get_users() const {
+  return _internal_has_get_users();
+}
+inline void Request::set_has_get_users() {
+  _impl_._oneof_case_[0] = kGetUsers;
+}
+inline void Request::clear_get_users() {
+  if (_internal_has_get_users()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.get_users_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::UserListRequest* Request::release_get_users() {
+  // @@protoc_insertion_point(field_release:chat.Request.get_users)
+  if (_internal_has_get_users()) {
+    clear_has_payload();
+    ::chat::UserListRequest* temp = _impl_.payload_.get_users_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.get_users_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::UserListRequest& Request::_internal_get_users() const {
+  return _internal_has_get_users()
+      ? *_impl_.payload_.get_users_
+      : reinterpret_cast< ::chat::UserListRequest&>(::chat::_UserListRequest_default_instance_);
+}
+inline const ::chat::UserListRequest& Request::get_users() const {
+  // @@protoc_insertion_point(field_get:chat.Request.get_users)
+  return _internal_get_users();
+}
+inline ::chat::UserListRequest* Request::unsafe_arena_release_get_users() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.get_users)
+  if (_internal_has_get_users()) {
+    clear_has_payload();
+    ::chat::UserListRequest* temp = _impl_.payload_.get_users_;
+    _impl_.payload_.get_users_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_get_users(::chat::UserListRequest* get_users) {
+  clear_payload();
+  if (get_users) {
+    set_has_get_users();
+    _impl_.payload_.get_users_ = get_users;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.get_users)
+}
+inline ::chat::UserListRequest* Request::_internal_mutable_get_users() {
+  if (!_internal_has_get_users()) {
+    clear_payload();
+    set_has_get_users();
+    _impl_.payload_.get_users_ = CreateMaybeMessage< ::chat::UserListRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.get_users_;
+}
+inline ::chat::UserListRequest* Request::mutable_get_users() {
+  ::chat::UserListRequest* _msg = _internal_mutable_get_users();
+  // @@protoc_insertion_point(field_mutable:chat.Request.get_users)
+  return _msg;
+}
+
+// .chat.User unregister_user = 6;
+inline bool Request::_internal_has_unregister_user() const {
+  return payload_case() == kUnregisterUser;
+}
+inline bool Request::has_unregister_user() const {
+  return _internal_has_unregister_user();
+}
+inline void Request::set_has_unregister_user() {
+  _impl_._oneof_case_[0] = kUnregisterUser;
+}
+inline void Request::clear_unregister_user() {
+  if (_internal_has_unregister_user()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.unregister_user_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::User* Request::release_unregister_user() {
+  // @@protoc_insertion_point(field_release:chat.Request.unregister_user)
+  if (_internal_has_unregister_user()) {
+    clear_has_payload();
+    ::chat::User* temp = _impl_.payload_.unregister_user_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.unregister_user_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::User& Request::_internal_unregister_user() const {
+  return _internal_has_unregister_user()
+      ? *_impl_.payload_.unregister_user_
+      : reinterpret_cast< ::chat::User&>(::chat::_User_default_instance_);
+}
+inline const ::chat::User& Request::unregister_user() const {
+  // @@protoc_insertion_point(field_get:chat.Request.unregister_user)
+  return _internal_unregister_user();
+}
+inline ::chat::User* Request::unsafe_arena_release_unregister_user() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.unregister_user)
+  if (_internal_has_unregister_user()) {
+    clear_has_payload();
+    ::chat::User* temp = _impl_.payload_.unregister_user_;
+    _impl_.payload_.unregister_user_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_unregister_user(::chat::User* unregister_user) {
+  clear_payload();
+  if (unregister_user) {
+    set_has_unregister_user();
+    _impl_.payload_.unregister_user_ = unregister_user;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.unregister_user)
+}
+inline ::chat::User* Request::_internal_mutable_unregister_user() {
+  if (!_internal_has_unregister_user()) {
+    clear_payload();
+    set_has_unregister_user();
+    _impl_.payload_.unregister_user_ = CreateMaybeMessage< ::chat::User >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.unregister_user_;
+}
+inline ::chat::User* Request::mutable_unregister_user() {
+  ::chat::User* _msg = _internal_mutable_unregister_user();
+  // @@protoc_insertion_point(field_mutable:chat.Request.unregister_user)
+  return _msg;
+}
+
+// .chat.HistoryRequest get_history = 7;
+inline bool Request::_internal_has_get_history() const {
+  return payload_case() == kGetHistory;
+}
+inline bool Request::has_get_history() const {
+  return _internal_has_get_history();
+}
+inline void Request::set_has_get_history() {
+  _impl_._oneof_case_[0] = kGetHistory;
+}
+inline void Request::clear_get_history() {
+  if (_internal_has_get_history()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.get_history_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::HistoryRequest* Request::release_get_history() {
+  // @@protoc_insertion_point(field_release:chat.Request.get_history)
+  if (_internal_has_get_history()) {
+    clear_has_payload();
+    ::chat::HistoryRequest* temp = _impl_.payload_.get_history_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.get_history_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::HistoryRequest& Request::_internal_get_history() const {
+  return _internal_has_get_history()
+      ? *_impl_.payload_.get_history_
+      : reinterpret_cast< ::chat::HistoryRequest&>(::chat::_HistoryRequest_default_instance_);
+}
+inline const ::chat::HistoryRequest& Request::get_history() const {
+  // @@protoc_insertion_point(field_get:chat.Request.get_history)
+  return _internal_get_history();
+}
+inline ::chat::HistoryRequest* Request::unsafe_arena_release_get_history() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.get_history)
+  if (_internal_has_get_history()) {
+    clear_has_payload();
+    ::chat::HistoryRequest* temp = _impl_.payload_.get_history_;
+    _impl_.payload_.get_history_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_get_history(::chat::HistoryRequest* get_history) {
+  clear_payload();
+  if (get_history) {
+    set_has_get_history();
+    _impl_.payload_.get_history_ = get_history;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.get_history)
+}
+inline ::chat::HistoryRequest* Request::_internal_mutable_get_history() {
+  if (!_internal_has_get_history()) {
+    clear_payload();
+    set_has_get_history();
+    _impl_.payload_.get_history_ = CreateMaybeMessage< ::chat::HistoryRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.get_history_;
+}
+inline ::chat::HistoryRequest* Request::mutable_get_history() {
+  ::chat::HistoryRequest* _msg = _internal_mutable_get_history();
+  // @@protoc_insertion_point(field_mutable:chat.Request.get_history)
+  return _msg;
+}
+
+// .chat.RoomRequest room = 8;
+inline bool Request::_internal_has_room() const {
+  return payload_case() == kRoom;
+}
+inline bool Request::has_room() const {
+  return _internal_has_room();
+}
+inline void Request::set_has_room() {
+  _impl_._oneof_case_[0] = kRoom;
+}
+inline void Request::clear_room() {
+  if (_internal_has_room()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.room_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::RoomRequest* Request::release_room() {
+  // @@protoc_insertion_point(field_release:chat.Request.room)
+  if (_internal_has_room()) {
+    clear_has_payload();
+    ::chat::RoomRequest* temp = _impl_.payload_.room_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.room_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::RoomRequest& Request::_internal_room() const {
+  return _internal_has_room()
+      ? *_impl_.payload_.room_
+      : reinterpret_cast< ::chat::RoomRequest&>(::chat::_RoomRequest_default_instance_);
+}
+inline const ::chat::RoomRequest& Request::room() const {
+  // @@protoc_insertion_point(field_get:chat.Request.room)
+  return _internal_room();
+}
+inline ::chat::RoomRequest* Request::unsafe_arena_release_room() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.room)
+  if (_internal_has_room()) {
+    clear_has_payload();
+    ::chat::RoomRequest* temp = _impl_.payload_.room_;
+    _impl_.payload_.room_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_room(::chat::RoomRequest* room) {
+  clear_payload();
+  if (room) {
+    set_has_room();
+    _impl_.payload_.room_ = room;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.room)
+}
+inline ::chat::RoomRequest* Request::_internal_mutable_room() {
+  if (!_internal_has_room()) {
+    clear_payload();
+    set_has_room();
+    _impl_.payload_.room_ = CreateMaybeMessage< ::chat::RoomRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.room_;
+}
+inline ::chat::RoomRequest* Request::mutable_room() {
+  ::chat::RoomRequest* _msg = _internal_mutable_room();
+  // @@protoc_insertion_point(field_mutable:chat.Request.room)
+  return _msg;
+}
+
+// .chat.BatchRequest batch = 9;
+inline bool Request::_internal_has_batch() const {
+  return payload_case() == kBatch;
+}
+inline bool Request::has_batch() const {
+  return _internal_has_batch();
+}
+inline void Request::set_has_batch() {
+  _impl_._oneof_case_[0] = kBatch;
+}
+inline void Request::clear_batch() {
+  if (_internal_has_batch()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.batch_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::BatchRequest* Request::release_batch() {
+  // @@protoc_insertion_point(field_release:chat.Request.batch)
+  if (_internal_has_batch()) {
+    clear_has_payload();
+    ::chat::BatchRequest* temp = _impl_.payload_.batch_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::BatchRequest& Request::_internal_batch() const {
+  return _internal_has_batch()
+      ? *_impl_.payload_.batch_
+      : reinterpret_cast< ::chat::BatchRequest&>(::chat::_BatchRequest_default_instance_);
+}
+inline const ::chat::BatchRequest& Request::batch() const {
+  // @@protoc_insertion_point(field_get:chat.Request.batch)
+  return _internal_batch();
+}
+inline ::chat::BatchRequest* Request::unsafe_arena_release_batch() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.batch)
+  if (_internal_has_batch()) {
+    clear_has_payload();
+    ::chat::BatchRequest* temp = _impl_.payload_.batch_;
+    _impl_.payload_.batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_batch(::chat::BatchRequest* batch) {
+  clear_payload();
+  if (batch) {
+    set_has_batch();
+    _impl_.payload_.batch_ = batch;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.batch)
+}
+inline ::chat::BatchRequest* Request::_internal_mutable_batch() {
+  if (!_internal_has_batch()) {
+    clear_payload();
+    set_has_batch();
+    _impl_.payload_.batch_ = CreateMaybeMessage< ::chat::BatchRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.batch_;
+}
+inline ::chat::BatchRequest* Request::mutable_batch() {
+  ::chat::BatchRequest* _msg = _internal_mutable_batch();
+  // @@protoc_insertion_point(field_mutable:chat.Request.batch)
+  return _msg;
+}
+
+// .chat.Receipts acknowledge = 10;
+inline bool Request::_internal_has_acknowledge() const {
+  return payload_case() == kAcknowledge;
+}
+inline bool Request::has_acknowledge() const {
+  return _internal_has_acknowledge();
+}
+inline void Request::set_has_acknowledge() {
+  _impl_._oneof_case_[0] = kAcknowledge;
+}
+inline void Request::clear_acknowledge() {
+  if (_internal_has_acknowledge()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.acknowledge_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::Receipts* Request::release_acknowledge() {
+  // @@protoc_insertion_point(field_release:chat.Request.acknowledge)
+  if (_internal_has_acknowledge()) {
+    clear_has_payload();
+    ::chat::Receipts* temp = _impl_.payload_.acknowledge_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.acknowledge_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::Receipts& Request::_internal_acknowledge() const {
+  return _internal_has_acknowledge()
+      ? *_impl_.payload_.acknowledge_
+      : reinterpret_cast< ::chat::Receipts&>(::chat::_Receipts_default_instance_);
+}
+inline const ::chat::Receipts& Request::acknowledge() const {
+  // @@protoc_insertion_point(field_get:chat.Request.acknowledge)
+  return _internal_acknowledge();
+}
+inline ::chat::Receipts* Request::unsafe_arena_release_acknowledge() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.acknowledge)
+  if (_internal_has_acknowledge()) {
+    clear_has_payload();
+    ::chat::Receipts* temp = _impl_.payload_.acknowledge_;
+    _impl_.payload_.acknowledge_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_acknowledge(::chat::Receipts* acknowledge) {
+  clear_payload();
+  if (acknowledge) {
+    set_has_acknowledge();
+    _impl_.payload_.acknowledge_ = acknowledge;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.acknowledge)
+}
+inline ::chat::Receipts* Request::_internal_mutable_acknowledge() {
+  if (!_internal_has_acknowledge()) {
+    clear_payload();
+    set_has_acknowledge();
+    _impl_.payload_.acknowledge_ = CreateMaybeMessage< ::chat::Receipts >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.acknowledge_;
+}
+inline ::chat::Receipts* Request::mutable_acknowledge() {
+  ::chat::Receipts* _msg = _internal_mutable_acknowledge();
+  // @@protoc_insertion_point(field_mutable:chat.Request.acknowledge)
+  return _msg;
+}
+
+// .chat.ResumeRequest resume = 11;
+inline bool Request::_internal_has_resume() const {
+  return payload_case() == kResume;
+}
+inline bool Request::has_resume() const {
+  return _internal_has_resume();
+}
+inline void Request::set_has_resume() {
+  _impl_._oneof_case_[0] = kResume;
+}
+inline void Request::clear_resume() {
+  if (_internal_has_resume()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.resume_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::ResumeRequest* Request::release_resume() {
+  // @@protoc_insertion_point(field_release:chat.Request.resume)
+  if (_internal_has_resume()) {
+    clear_has_payload();
+    ::chat::ResumeRequest* temp = _impl_.payload_.resume_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.resume_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::ResumeRequest& Request::_internal_resume() const {
+  return _internal_has_resume()
+      ? *_impl_.payload_.resume_
+      : reinterpret_cast< ::chat::ResumeRequest&>(::chat::_ResumeRequest_default_instance_);
+}
+inline const ::chat::ResumeRequest& Request::resume() const {
+  // @@protoc_insertion_point(field_get:chat.Request.resume)
+  return _internal_resume();
+}
+inline ::chat::ResumeRequest* Request::unsafe_arena_release_resume() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.resume)
+  if (_internal_has_resume()) {
+    clear_has_payload();
+    ::chat::ResumeRequest* temp = _impl_.payload_.resume_;
+    _impl_.payload_.resume_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_resume(::chat::ResumeRequest* resume) {
+  clear_payload();
+  if (resume) {
+    set_has_resume();
+    _impl_.payload_.resume_ = resume;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.resume)
+}
+inline ::chat::ResumeRequest* Request::_internal_mutable_resume() {
+  if (!_internal_has_resume()) {
+    clear_payload();
+    set_has_resume();
+    _impl_.payload_.resume_ = CreateMaybeMessage< ::chat::ResumeRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.resume_;
+}
+inline ::chat::ResumeRequest* Request::mutable_resume() {
+  ::chat::ResumeRequest* _msg = _internal_mutable_resume();
+  // @@protoc_insertion_point(field_mutable:chat.Request.resume)
+  return _msg;
+}
+
+inline bool Request::has_payload() const {
+  return payload_case() != PAYLOAD_NOT_SET;
+}
+inline void Request::clear_has_payload() {
+  _impl_._oneof_case_[0] = PAYLOAD_NOT_SET;
+}
+inline Request::PayloadCase Request::payload_case() const {
+  return Request::PayloadCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// ShutdownNotice
+
+// uint32 reconnect_after_ms = 1;
+inline void ShutdownNotice::clear_reconnect_after_ms() {
+  _impl_.reconnect_after_ms_ = 0u;
+}
+inline uint32_t ShutdownNotice::_internal_reconnect_after_ms() const {
+  return _impl_.reconnect_after_ms_;
+}
+inline uint32_t ShutdownNotice::reconnect_after_ms() const {
+  // @@protoc_insertion_point(field_get:chat.ShutdownNotice.reconnect_after_ms)
+  return _internal_reconnect_after_ms();
+}
+inline void ShutdownNotice::_internal_set_reconnect_after_ms(uint32_t value) {
+  
+  _impl_.reconnect_after_ms_ = value;
+}
+inline void ShutdownNotice::set_reconnect_after_ms(uint32_t value) {
+  _internal_set_reconnect_after_ms(value);
+  // @@protoc_insertion_point(field_set:chat.ShutdownNotice.reconnect_after_ms)
+}
+
+// -------------------------------------------------------------------
+
+// Response
+
+// .chat.Operation operation = 1;
+inline void Response::clear_operation() {
+  _impl_.operation_ = 0;
+}
+inline ::chat::Operation Response::_internal_operation() const {
+  return static_cast< ::chat::Operation >(_impl_.operation_);
+}
+inline ::chat::Operation Response::operation() const {
+  // @@protoc_insertion_point(field_get:chat.Response.operation)
+  return _internal_operation();
+}
+inline void Response::_internal_set_operation(::chat::Operation value) {
+  
+  _impl_.operation_ = value;
+}
+inline void Response::set_operation(::chat::Operation value) {
+  _internal_set_operation(value);
+  // @@protoc_insertion_point(field_set:chat.Response.operation)
+}
+
+// .chat.StatusCode status_code = 2;
+inline void Response::clear_status_code() {
+  _impl_.status_code_ = 0;
+}
+inline ::chat::StatusCode Response::_internal_status_code() const {
+  return static_cast< ::chat::StatusCode >(_impl_.status_code_);
+}
+inline ::chat::StatusCode Response::status_code() const {
+  // @@protoc_insertion_point(field_get:chat.Response.status_code)
+  return _internal_status_code();
+}
+inline void Response::_internal_set_status_code(::chat::StatusCode value) {
+  
+  _impl_.status_code_ = value;
+}
+inline void Response::set_status_code(::chat::StatusCode value) {
+  _internal_set_status_code(value);
+  // @@protoc_insertion_point(field_set:chat.Response.status_code)
+}
+
+// string message = 3;
+inline void Response::clear_message() {
+  _impl_.message_.ClearToEmpty();
+}
+inline const std::string& Response::message() const {
+  // @@protoc_insertion_point(field_get:chat.Response.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Response::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.Response.message)
+}
+inline std::string* Response::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:chat.Response.message)
+  return _s;
+}
+inline const std::string& Response::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void Response::_internal_set_message(const std::string& value) {
+  
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Response::_internal_mutable_message() {
+  
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Response::release_message() {
+  // @@protoc_insertion_point(field_release:chat.Response.message)
+  return _impl_.message_.Release();
+}
+inline void Response::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.message)
+}
+
+// .chat.UserListResponse user_list = 4;
+inline bool Response::_internal_has_user_list() const {
+  return result_case() == kUserList;
+}
+inline bool Response::has_user_list() const {
+  return _internal_has_user_list();
+}
+inline void Response::set_has_user_list() {
+  _impl_._oneof_case_[0] = kUserList;
+}
+inline void Response::clear_user_list() {
+  if (_internal_has_user_list()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.user_list_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::UserListResponse* Response::release_user_list() {
+  // @@protoc_insertion_point(field_release:chat.Response.user_list)
+  if (_internal_has_user_list()) {
+    clear_has_result();
+    ::chat::UserListResponse* temp = _impl_.result_.user_list_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.user_list_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::UserListResponse& Response::_internal_user_list() const {
+  return _internal_has_user_list()
+      ? *_impl_.result_.user_list_
+      : reinterpret_cast< ::chat::UserListResponse&>(::chat::_UserListResponse_default_instance_);
+}
+inline const ::chat::UserListResponse& Response::user_list() const {
+  // @@protoc_insertion_point(field_get:chat.Response.user_list)
+  return _internal_user_list();
+}
+inline ::chat::UserListResponse* Response::unsafe_arena_release_user_list() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.user_list)
+  if (_internal_has_user_list()) {
+    clear_has_result();
+    ::chat::UserListResponse* temp = _impl_.result_.user_list_;
+    _impl_.result_.user_list_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_user_list(::chat::UserListResponse* user_list) {
+  clear_result();
+  if (user_list) {
+    set_has_user_list();
+    _impl_.result_.user_list_ = user_list;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.user_list)
+}
+inline ::chat::UserListResponse* Response::_internal_mutable_user_list() {
+  if (!_internal_has_user_list()) {
+    clear_result();
+    set_has_user_list();
+    _impl_.result_.user_list_ = CreateMaybeMessage< ::chat::UserListResponse >(GetArenaForAllocation());
+  }
+  return _impl_.result_.user_list_;
+}
+inline ::chat::UserListResponse* Response::mutable_user_list() {
+  ::chat::UserListResponse* _msg = _internal_mutable_user_list();
+  // @@protoc_insertion_point(field_mutable:chat.Response.user_list)
+  return _msg;
+}
+
+// .chat.IncomingMessageResponse incoming_message = 5;
+inline bool Response::_internal_has_incoming_message() const {
+  return result_case() == kIncomingMessage;
+}
+inline bool Response::has_incoming_message() const {
+  return _internal_has_incoming_message();
+}
+inline void Response::set_has_incoming_message() {
+  _impl_._oneof_case_[0] = kIncomingMessage;
+}
+inline void Response::clear_incoming_message() {
+  if (_internal_has_incoming_message()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.incoming_message_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::IncomingMessageResponse* Response::release_incoming_message() {
+  // @@protoc_insertion_point(field_release:chat.Response.incoming_message)
+  if (_internal_has_incoming_message()) {
+    clear_has_result();
+    ::chat::IncomingMessageResponse* temp = _impl_.result_.incoming_message_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.incoming_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::IncomingMessageResponse& Response::_internal_incoming_message() const {
+  return _internal_has_incoming_message()
+      ? *_impl_.result_.incoming_message_
+      : reinterpret_cast< ::chat::IncomingMessageResponse&>(::chat::_IncomingMessageResponse_default_instance_);
+}
+inline const ::chat::IncomingMessageResponse& Response::incoming_message() const {
+  // @@protoc_insertion_point(field_get:chat.Response.incoming_message)
+  return _internal_incoming_message();
+}
+inline ::chat::IncomingMessageResponse* Response::unsafe_arena_release_incoming_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.incoming_message)
+  if (_internal_has_incoming_message()) {
+    clear_has_result();
+    ::chat::IncomingMessageResponse* temp = _impl_.result_.incoming_message_;
+    _impl_.result_.incoming_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message) {
+  clear_result();
+  if (incoming_message) {
+    set_has_incoming_message();
+    _impl_.result_.incoming_message_ = incoming_message;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.incoming_message)
+}
+inline ::chat::IncomingMessageResponse* Response::_internal_mutable_incoming_message() {
+  if (!_internal_has_incoming_message()) {
+    clear_result();
+    set_has_incoming_message();
+    _impl_.result_.incoming_message_ = CreateMaybeMessage< ::chat::IncomingMessageResponse >(GetArenaForAllocation());
+  }
+  return _impl_.result_.incoming_message_;
+}
+inline ::chat::IncomingMessageResponse* Response::mutable_incoming_message() {
+  ::chat::IncomingMessageResponse* _msg = _internal_mutable_incoming_message();
+  // @@protoc_insertion_point(field_mutable:chat.Response.incoming_message)
+  return _msg;
+}
+
+// .chat.HistoryResponse history = 6;
+inline bool Response::_internal_has_history() const {
+  return result_case() == kHistory;
+}
+inline bool Response::has_history() const {
+  return _internal_has_history();
+}
+inline void Response::set_has_history() {
+  _impl_._oneof_case_[0] = kHistory;
+}
+inline void Response::clear_history() {
+  if (_internal_has_history()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.history_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::HistoryResponse* Response::release_history() {
+  // @@protoc_insertion_point(field_release:chat.Response.history)
+  if (_internal_has_history()) {
+    clear_has_result();
+    ::chat::HistoryResponse* temp = _impl_.result_.history_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.history_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::HistoryResponse& Response::_internal_history() const {
+  return _internal_has_history()
+      ? *_impl_.result_.history_
+      : reinterpret_cast< ::chat::HistoryResponse&>(::chat::_HistoryResponse_default_instance_);
+}
+inline const ::chat::HistoryResponse& Response::history() const {
+  // @@protoc_insertion_point(field_get:chat.Response.history)
+  return _internal_history();
+}
+inline ::chat::HistoryResponse* Response::unsafe_arena_release_history() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.history)
+  if (_internal_has_history()) {
+    clear_has_result();
+    ::chat::HistoryResponse* temp = _impl_.result_.history_;
+    _impl_.result_.history_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_history(::chat::HistoryResponse* history) {
+  clear_result();
+  if (history) {
+    set_has_history();
+    _impl_.result_.history_ = history;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.history)
+}
+inline ::chat::HistoryResponse* Response::_internal_mutable_history() {
+  if (!_internal_has_history()) {
+    clear_result();
+    set_has_history();
+    _impl_.result_.history_ = CreateMaybeMessage< ::chat::HistoryResponse >(GetArenaForAllocation());
+  }
+  return _impl_.result_.history_;
+}
+inline ::chat::HistoryResponse* Response::mutable_history() {
+  ::chat::HistoryResponse* _msg = _internal_mutable_history();
+  // @@protoc_insertion_point(field_mutable:chat.Response.history)
+  return _msg;
+}
+
+// .chat.ShutdownNotice shutdown = 7;
+inline bool Response::_internal_has_shutdown() const {
+  return result_case() == kShutdown;
+}
+inline bool Response::has_shutdown() const {
+  return _internal_has_shutdown();
+}
+inline void Response::set_has_shutdown() {
+  _impl_._oneof_case_[0] = kShutdown;
+}
+inline void Response::clear_shutdown() {
+  if (_internal_has_shutdown()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.shutdown_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::ShutdownNotice* Response::release_shutdown() {
+  // @@protoc_insertion_point(field_release:chat.Response.shutdown)
+  if (_internal_has_shutdown()) {
+    clear_has_result();
+    ::chat::ShutdownNotice* temp = _impl_.result_.shutdown_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.shutdown_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::ShutdownNotice& Response::_internal_shutdown() const {
+  return _internal_has_shutdown()
+      ? *_impl_.result_.shutdown_
+      : reinterpret_cast< ::chat::ShutdownNotice&>(::chat::_ShutdownNotice_default_instance_);
+}
+inline const ::chat::ShutdownNotice& Response::shutdown() const {
+  // @@protoc_insertion_point(field_get:chat.Response.shutdown)
+  return _internal_shutdown();
+}
+inline ::chat::ShutdownNotice* Response::unsafe_arena_release_shutdown() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.shutdown)
+  if (_internal_has_shutdown()) {
+    clear_has_result();
+    ::chat::ShutdownNotice* temp = _impl_.result_.shutdown_;
+    _impl_.result_.shutdown_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_shutdown(::chat::ShutdownNotice* shutdown) {
+  clear_result();
+  if (shutdown) {
+    set_has_shutdown();
+    _impl_.result_.shutdown_ = shutdown;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.shutdown)
+}
+inline ::chat::ShutdownNotice* Response::_internal_mutable_shutdown() {
+  if (!_internal_has_shutdown()) {
+    clear_result();
+    set_has_shutdown();
+    _impl_.result_.shutdown_ = CreateMaybeMessage< ::chat::ShutdownNotice >(GetArenaForAllocation());
+  }
+  return _impl_.result_.shutdown_;
+}
+inline ::chat::ShutdownNotice* Response::mutable_shutdown() {
+  ::chat::ShutdownNotice* _msg = _internal_mutable_shutdown();
+  // @@protoc_insertion_point(field_mutable:chat.Response.shutdown)
+  return _msg;
+}
+
+// .chat.BatchResponse batch = 8;
+inline bool Response::_internal_has_batch() const {
+  return result_case() == kBatch;
+}
+inline bool Response::has_batch() const {
+  return _internal_has_batch();
+}
+inline void Response::set_has_batch() {
+  _impl_._oneof_case_[0] = kBatch;
+}
+inline void Response::clear_batch() {
+  if (_internal_has_batch()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.batch_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::BatchResponse* Response::release_batch() {
+  // @@protoc_insertion_point(field_release:chat.Response.batch)
+  if (_internal_has_batch()) {
+    clear_has_result();
+    ::chat::BatchResponse* temp = _impl_.result_.batch_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::BatchResponse& Response::_internal_batch() const {
+  return _internal_has_batch()
+      ? *_impl_.result_.batch_
+      : reinterpret_cast< ::chat::BatchResponse&>(::chat::_BatchResponse_default_instance_);
+}
+inline const ::chat::BatchResponse& Response::batch() const {
+  // @@protoc_insertion_point(field_get:chat.Response.batch)
+  return _internal_batch();
+}
+inline ::chat::BatchResponse* Response::unsafe_arena_release_batch() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.batch)
+  if (_internal_has_batch()) {
+    clear_has_result();
+    ::chat::BatchResponse* temp = _impl_.result_.batch_;
+    _impl_.result_.batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_batch(::chat::BatchResponse* batch) {
+  clear_result();
+  if (batch) {
+    set_has_batch();
+    _impl_.result_.batch_ = batch;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.batch)
+}
+inline ::chat::BatchResponse* Response::_internal_mutable_batch() {
+  if (!_internal_has_batch()) {
+    clear_result();
+    set_has_batch();
+    _impl_.result_.batch_ = CreateMaybeMessage< ::chat::BatchResponse >(GetArenaForAllocation());
+  }
+  return _impl_.result_.batch_;
+}
+inline ::chat::BatchResponse* Response::mutable_batch() {
+  ::chat::BatchResponse* _msg = _internal_mutable_batch();
+  // @@protoc_insertion_point(field_mutable:chat.Response.batch)
+  return _msg;
+}
+
+// .chat.Receipts receipts = 11;
+inline bool Response::_internal_has_receipts() const {
+  return result_case() == kReceipts;
+}
+inline bool Response::has_receipts() const {
+  return _internal_has_receipts();
+}
+inline void Response::set_has_receipts() {
+  _impl_._oneof_case_[0] = kReceipts;
+}
+inline void Response::clear_receipts() {
+  if (_internal_has_receipts()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.receipts_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::Receipts* Response::release_receipts() {
+  // @@protoc_insertion_point(field_release:chat.Response.receipts)
+  if (_internal_has_receipts()) {
+    clear_has_result();
+    ::chat::Receipts* temp = _impl_.result_.receipts_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.receipts_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::Receipts& Response::_internal_receipts() const {
+  return _internal_has_receipts()
+      ? *_impl_.result_.receipts_
+      : reinterpret_cast< ::chat::Receipts&>(::chat::_Receipts_default_instance_);
+}
+inline const ::chat::Receipts& Response::receipts() const {
+  // @@protoc_insertion_point(field_get:chat.Response.receipts)
+  return _internal_receipts();
+}
+inline ::chat::Receipts* Response::unsafe_arena_release_receipts() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.receipts)
+  if (_internal_has_receipts()) {
+    clear_has_result();
+    ::chat::Receipts* temp = _impl_.result_.receipts_;
+    _impl_.result_.receipts_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_receipts(::chat::Receipts* receipts) {
+  clear_result();
+  if (receipts) {
+    set_has_receipts();
+    _impl_.result_.receipts_ = receipts;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.receipts)
+}
+inline ::chat::Receipts* Response::_internal_mutable_receipts() {
+  if (!_internal_has_receipts()) {
+    clear_result();
+    set_has_receipts();
+    _impl_.result_.receipts_ = CreateMaybeMessage< ::chat::Receipts >(GetArenaForAllocation());
+  }
+  return _impl_.result_.receipts_;
+}
+inline ::chat::Receipts* Response::mutable_receipts() {
+  ::chat::Receipts* _msg = _internal_mutable_receipts();
+  // @@protoc_insertion_point(field_mutable:chat.Response.receipts)
+  return _msg;
+}
+
+// .chat.Compression compression = 9;
+inline void Response::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::chat::Compression Response::_internal_compression() const {
+  return static_cast< ::chat::Compression >(_impl_.compression_);
+}
+inline ::chat::Compression Response::compression() const {
+  // @@protoc_insertion_point(field_get:chat.Response.compression)
+  return _internal_compression();
+}
+inline void Response::_internal_set_compression(::chat::Compression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void Response::set_compression(::chat::Compression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:chat.Response.compression)
+}
+
+// bool compact = 10;
+inline void Response::clear_compact() {
+  _impl_.compact_ = false;
+}
+inline bool Response::_internal_compact() const {
+  return _impl_.compact_;
+}
+inline bool Response::compact() const {
+  // @@protoc_insertion_point(field_get:chat.Response.compact)
+  return _internal_compact();
+}
+inline void Response::_internal_set_compact(bool value) {
+  
+  _impl_.compact_ = value;
+}
+inline void Response::set_compact(bool value) {
+  _internal_set_compact(value);
+  // @@protoc_insertion_point(field_set:chat.Response.compact)
+}
+
+// uint64 message_id = 12;
+inline void Response::clear_message_id() {
+  _impl_.message_id_ = uint64_t{0u};
+}
+inline uint64_t Response::_internal_message_id() const {
+  return _impl_.message_id_;
+}
+inline uint64_t Response::message_id() const {
+  // @@protoc_insertion_point(field_get:chat.Response.message_id)
+  return _internal_message_id();
+}
+inline void Response::_internal_set_message_id(uint64_t value) {
+  
+  _impl_.message_id_ = value;
+}
+inline void Response::set_message_id(uint64_t value) {
+  _internal_set_message_id(value);
+  // @@protoc_insertion_point(field_set:chat.Response.message_id)
+}
+
+// uint64 seq = 13;
+inline void Response::clear_seq() {
+  _impl_.seq_ = uint64_t{0u};
+}
+inline uint64_t Response::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline uint64_t Response::seq() const {
+  // @@protoc_insertion_point(field_get:chat.Response.seq)
+  return _internal_seq();
+}
+inline void Response::_internal_set_seq(uint64_t value) {
+  
+  _impl_.seq_ = value;
+}
+inline void Response::set_seq(uint64_t value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:chat.Response.seq)
+}
+
+// uint64 resume_token = 14;
+inline void Response::clear_resume_token() {
+  _impl_.resume_token_ = uint64_t{0u};
+}
+inline uint64_t Response::_internal_resume_token() const {
+  return _impl_.resume_token_;
+}
+inline uint64_t Response::resume_token() const {
+  // @@protoc_insertion_point(field_get:chat.Response.resume_token)
+  return _internal_resume_token();
+}
+inline void Response::_internal_set_resume_token(uint64_t value) {
+  
+  _impl_.resume_token_ = value;
+}
+inline void Response::set_resume_token(uint64_t value) {
+  _internal_set_resume_token(value);
+  // @@protoc_insertion_point(field_set:chat.Response.resume_token)
+}
+
+inline bool Response::has_result() const {
+  return result_case() != RESULT_NOT_SET;
+}
+inline void Response::clear_has_result() {
+  _impl_._oneof_case_[0] = RESULT_NOT_SET;
+}
+inline Response::ResultCase Response::result_case() const {
+  return Response::ResultCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// PeerPresence
+
+// string username = 1;
+inline void PeerPresence::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& PeerPresence::username() const {
+  // @@protoc_insertion_point(field_get:chat.PeerPresence.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PeerPresence::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.PeerPresence.username)
+}
+inline std::string* PeerPresence::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.PeerPresence.username)
+  return _s;
+}
+inline const std::string& PeerPresence::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void PeerPresence::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PeerPresence::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PeerPresence::release_username() {
+  // @@protoc_insertion_point(field_release:chat.PeerPresence.username)
+  return _impl_.username_.Release();
+}
+inline void PeerPresence::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.PeerPresence.username)
+}
 
-// string username = 1;
-inline void User::clear_username() {
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// .chat.UserStatus status = 2;
+inline void PeerPresence::clear_status() {
+  _impl_.status_ = 0;
 }
-inline const std::string& User::username() const {
-  // @@protoc_insertion_point(field_get:chat.User.username)
-  return _internal_username();
+inline ::chat::UserStatus PeerPresence::_internal_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.status_);
 }
-inline void User::set_username(const std::string& value) {
-  _internal_set_username(value);
-  // @@protoc_insertion_point(field_set:chat.User.username)
+inline ::chat::UserStatus PeerPresence::status() const {
+  // @@protoc_insertion_point(field_get:chat.PeerPresence.status)
+  return _internal_status();
 }
-inline std::string* User::mutable_username() {
-  // @@protoc_insertion_point(field_mutable:chat.User.username)
-  return _internal_mutable_username();
+inline void PeerPresence::_internal_set_status(::chat::UserStatus value) {
+  
+  _impl_.status_ = value;
 }
-inline const std::string& User::_internal_username() const {
-  return username_.Get();
+inline void PeerPresence::set_status(::chat::UserStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:chat.PeerPresence.status)
 }
-inline void User::_internal_set_username(const std::string& value) {
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+
+// bool connected = 3;
+inline void PeerPresence::clear_connected() {
+  _impl_.connected_ = false;
 }
-inline void User::set_username(std::string&& value) {
-  
-  username_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.User.username)
+inline bool PeerPresence::_internal_connected() const {
+  return _impl_.connected_;
 }
-inline void User::set_username(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline bool PeerPresence::connected() const {
+  // @@protoc_insertion_point(field_get:chat.PeerPresence.connected)
+  return _internal_connected();
+}
+inline void PeerPresence::_internal_set_connected(bool value) {
   
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.User.username)
+  _impl_.connected_ = value;
+}
+inline void PeerPresence::set_connected(bool value) {
+  _internal_set_connected(value);
+  // @@protoc_insertion_point(field_set:chat.PeerPresence.connected)
+}
+
+// string node = 4;
+inline void PeerPresence::clear_node() {
+  _impl_.node_.ClearToEmpty();
 }
-inline void User::set_username(const char* value,
-    size_t size) {
+inline const std::string& PeerPresence::node() const {
+  // @@protoc_insertion_point(field_get:chat.PeerPresence.node)
+  return _internal_node();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PeerPresence::set_node(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.node_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.PeerPresence.node)
+}
+inline std::string* PeerPresence::mutable_node() {
+  std::string* _s = _internal_mutable_node();
+  // @@protoc_insertion_point(field_mutable:chat.PeerPresence.node)
+  return _s;
+}
+inline const std::string& PeerPresence::_internal_node() const {
+  return _impl_.node_.Get();
+}
+inline void PeerPresence::_internal_set_node(const std::string& value) {
   
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.User.username)
+  _impl_.node_.Set(value, GetArenaForAllocation());
 }
-inline std::string* User::_internal_mutable_username() {
+inline std::string* PeerPresence::_internal_mutable_node() {
   
-  return username_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.node_.Mutable(GetArenaForAllocation());
 }
-inline std::string* User::release_username() {
-  // @@protoc_insertion_point(field_release:chat.User.username)
-  return username_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* PeerPresence::release_node() {
+  // @@protoc_insertion_point(field_release:chat.PeerPresence.node)
+  return _impl_.node_.Release();
 }
-inline void User::set_allocated_username(std::string* username) {
-  if (username != nullptr) {
+inline void PeerPresence::set_allocated_node(std::string* node) {
+  if (node != nullptr) {
     
   } else {
     
   }
-  username_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), username,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.User.username)
+  _impl_.node_.SetAllocated(node, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node_.IsDefault()) {
+    _impl_.node_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.PeerPresence.node)
+}
+
+// uint64 version = 5;
+inline void PeerPresence::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t PeerPresence::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t PeerPresence::version() const {
+  // @@protoc_insertion_point(field_get:chat.PeerPresence.version)
+  return _internal_version();
+}
+inline void PeerPresence::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void PeerPresence::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:chat.PeerPresence.version)
+}
+
+// int64 changed_at = 6;
+inline void PeerPresence::clear_changed_at() {
+  _impl_.changed_at_ = int64_t{0};
+}
+inline int64_t PeerPresence::_internal_changed_at() const {
+  return _impl_.changed_at_;
+}
+inline int64_t PeerPresence::changed_at() const {
+  // @@protoc_insertion_point(field_get:chat.PeerPresence.changed_at)
+  return _internal_changed_at();
+}
+inline void PeerPresence::_internal_set_changed_at(int64_t value) {
+  
+  _impl_.changed_at_ = value;
 }
-inline std::string* User::unsafe_arena_release_username() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.User.username)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline void PeerPresence::set_changed_at(int64_t value) {
+  _internal_set_changed_at(value);
+  // @@protoc_insertion_point(field_set:chat.PeerPresence.changed_at)
+}
+
+// -------------------------------------------------------------------
+
+// PresenceDigest
+
+// string username = 1;
+inline void PresenceDigest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& PresenceDigest::username() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceDigest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PresenceDigest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.PresenceDigest.username)
+}
+inline std::string* PresenceDigest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.PresenceDigest.username)
+  return _s;
+}
+inline const std::string& PresenceDigest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void PresenceDigest::_internal_set_username(const std::string& value) {
   
-  return username_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  _impl_.username_.Set(value, GetArenaForAllocation());
 }
-inline void User::unsafe_arena_set_allocated_username(
-    std::string* username) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline std::string* PresenceDigest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PresenceDigest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.PresenceDigest.username)
+  return _impl_.username_.Release();
+}
+inline void PresenceDigest::set_allocated_username(std::string* username) {
   if (username != nullptr) {
     
   } else {
     
   }
-  username_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      username, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.User.username)
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.PresenceDigest.username)
 }
 
-// .chat.UserStatus status = 2;
-inline void User::clear_status() {
-  status_ = 0;
+// uint64 version = 2;
+inline void PresenceDigest::clear_version() {
+  _impl_.version_ = uint64_t{0u};
 }
-inline ::chat::UserStatus User::_internal_status() const {
-  return static_cast< ::chat::UserStatus >(status_);
+inline uint64_t PresenceDigest::_internal_version() const {
+  return _impl_.version_;
 }
-inline ::chat::UserStatus User::status() const {
-  // @@protoc_insertion_point(field_get:chat.User.status)
-  return _internal_status();
+inline uint64_t PresenceDigest::version() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceDigest.version)
+  return _internal_version();
 }
-inline void User::_internal_set_status(::chat::UserStatus value) {
+inline void PresenceDigest::_internal_set_version(uint64_t value) {
   
-  status_ = value;
+  _impl_.version_ = value;
 }
-inline void User::set_status(::chat::UserStatus value) {
-  _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:chat.User.status)
+inline void PresenceDigest::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceDigest.version)
 }
 
 // -------------------------------------------------------------------
 
-// NewUserRequest
+// PeerMessage
 
-// string username = 1;
-inline void NewUserRequest::clear_username() {
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// .chat.PeerOperation operation = 1;
+inline void PeerMessage::clear_operation() {
+  _impl_.operation_ = 0;
 }
-inline const std::string& NewUserRequest::username() const {
-  // @@protoc_insertion_point(field_get:chat.NewUserRequest.username)
-  return _internal_username();
+inline ::chat::PeerOperation PeerMessage::_internal_operation() const {
+  return static_cast< ::chat::PeerOperation >(_impl_.operation_);
 }
-inline void NewUserRequest::set_username(const std::string& value) {
-  _internal_set_username(value);
-  // @@protoc_insertion_point(field_set:chat.NewUserRequest.username)
+inline ::chat::PeerOperation PeerMessage::operation() const {
+  // @@protoc_insertion_point(field_get:chat.PeerMessage.operation)
+  return _internal_operation();
 }
-inline std::string* NewUserRequest::mutable_username() {
-  // @@protoc_insertion_point(field_mutable:chat.NewUserRequest.username)
-  return _internal_mutable_username();
+inline void PeerMessage::_internal_set_operation(::chat::PeerOperation value) {
+  
+  _impl_.operation_ = value;
 }
-inline const std::string& NewUserRequest::_internal_username() const {
-  return username_.Get();
+inline void PeerMessage::set_operation(::chat::PeerOperation value) {
+  _internal_set_operation(value);
+  // @@protoc_insertion_point(field_set:chat.PeerMessage.operation)
 }
-inline void NewUserRequest::_internal_set_username(const std::string& value) {
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+
+// string node = 2;
+inline void PeerMessage::clear_node() {
+  _impl_.node_.ClearToEmpty();
+}
+inline const std::string& PeerMessage::node() const {
+  // @@protoc_insertion_point(field_get:chat.PeerMessage.node)
+  return _internal_node();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PeerMessage::set_node(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.node_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.PeerMessage.node)
 }
-inline void NewUserRequest::set_username(std::string&& value) {
+inline std::string* PeerMessage::mutable_node() {
+  std::string* _s = _internal_mutable_node();
+  // @@protoc_insertion_point(field_mutable:chat.PeerMessage.node)
+  return _s;
+}
+inline const std::string& PeerMessage::_internal_node() const {
+  return _impl_.node_.Get();
+}
+inline void PeerMessage::_internal_set_node(const std::string& value) {
   
-  username_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.NewUserRequest.username)
+  _impl_.node_.Set(value, GetArenaForAllocation());
 }
-inline void NewUserRequest::set_username(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline std::string* PeerMessage::_internal_mutable_node() {
   
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.NewUserRequest.username)
+  return _impl_.node_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PeerMessage::release_node() {
+  // @@protoc_insertion_point(field_release:chat.PeerMessage.node)
+  return _impl_.node_.Release();
 }
-inline void NewUserRequest::set_username(const char* value,
-    size_t size) {
+inline void PeerMessage::set_allocated_node(std::string* node) {
+  if (node != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.node_.SetAllocated(node, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node_.IsDefault()) {
+    _impl_.node_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.PeerMessage.node)
+}
+
+// repeated .chat.PeerPresence presence = 3;
+inline int PeerMessage::_internal_presence_size() const {
+  return _impl_.presence_.size();
+}
+inline int PeerMessage::presence_size() const {
+  return _internal_presence_size();
+}
+inline void PeerMessage::clear_presence() {
+  _impl_.presence_.Clear();
+}
+inline ::chat::PeerPresence* PeerMessage::mutable_presence(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.PeerMessage.presence)
+  return _impl_.presence_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PeerPresence >*
+PeerMessage::mutable_presence() {
+  // @@protoc_insertion_point(field_mutable_list:chat.PeerMessage.presence)
+  return &_impl_.presence_;
+}
+inline const ::chat::PeerPresence& PeerMessage::_internal_presence(int index) const {
+  return _impl_.presence_.Get(index);
+}
+inline const ::chat::PeerPresence& PeerMessage::presence(int index) const {
+  // @@protoc_insertion_point(field_get:chat.PeerMessage.presence)
+  return _internal_presence(index);
+}
+inline ::chat::PeerPresence* PeerMessage::_internal_add_presence() {
+  return _impl_.presence_.Add();
+}
+inline ::chat::PeerPresence* PeerMessage::add_presence() {
+  ::chat::PeerPresence* _add = _internal_add_presence();
+  // @@protoc_insertion_point(field_add:chat.PeerMessage.presence)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PeerPresence >&
+PeerMessage::presence() const {
+  // @@protoc_insertion_point(field_list:chat.PeerMessage.presence)
+  return _impl_.presence_;
+}
+
+// string recipient = 4;
+inline void PeerMessage::clear_recipient() {
+  _impl_.recipient_.ClearToEmpty();
+}
+inline const std::string& PeerMessage::recipient() const {
+  // @@protoc_insertion_point(field_get:chat.PeerMessage.recipient)
+  return _internal_recipient();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PeerMessage::set_recipient(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.recipient_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.PeerMessage.recipient)
+}
+inline std::string* PeerMessage::mutable_recipient() {
+  std::string* _s = _internal_mutable_recipient();
+  // @@protoc_insertion_point(field_mutable:chat.PeerMessage.recipient)
+  return _s;
+}
+inline const std::string& PeerMessage::_internal_recipient() const {
+  return _impl_.recipient_.Get();
+}
+inline void PeerMessage::_internal_set_recipient(const std::string& value) {
   
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.NewUserRequest.username)
+  _impl_.recipient_.Set(value, GetArenaForAllocation());
 }
-inline std::string* NewUserRequest::_internal_mutable_username() {
+inline std::string* PeerMessage::_internal_mutable_recipient() {
   
-  return username_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.recipient_.Mutable(GetArenaForAllocation());
 }
-inline std::string* NewUserRequest::release_username() {
-  // @@protoc_insertion_point(field_release:chat.NewUserRequest.username)
-  return username_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* PeerMessage::release_recipient() {
+  // @@protoc_insertion_point(field_release:chat.PeerMessage.recipient)
+  return _impl_.recipient_.Release();
 }
-inline void NewUserRequest::set_allocated_username(std::string* username) {
-  if (username != nullptr) {
+inline void PeerMessage::set_allocated_recipient(std::string* recipient) {
+  if (recipient != nullptr) {
     
   } else {
     
   }
-  username_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), username,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.NewUserRequest.username)
+  _impl_.recipient_.SetAllocated(recipient, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.recipient_.IsDefault()) {
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.PeerMessage.recipient)
 }
-inline std::string* NewUserRequest::unsafe_arena_release_username() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.NewUserRequest.username)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+
+// .chat.IncomingMessageResponse message = 5;
+inline bool PeerMessage::_internal_has_message() const {
+  return this != internal_default_instance() && _impl_.message_ != nullptr;
+}
+inline bool PeerMessage::has_message() const {
+  return _internal_has_message();
+}
+inline void PeerMessage::clear_message() {
+  if (GetArenaForAllocation() == nullptr && _impl_.message_ != nullptr) {
+    delete _impl_.message_;
+  }
+  _impl_.message_ = nullptr;
+}
+inline const ::chat::IncomingMessageResponse& PeerMessage::_internal_message() const {
+  const ::chat::IncomingMessageResponse* p = _impl_.message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::IncomingMessageResponse&>(
+      ::chat::_IncomingMessageResponse_default_instance_);
+}
+inline const ::chat::IncomingMessageResponse& PeerMessage::message() const {
+  // @@protoc_insertion_point(field_get:chat.PeerMessage.message)
+  return _internal_message();
+}
+inline void PeerMessage::unsafe_arena_set_allocated_message(
+    ::chat::IncomingMessageResponse* message) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  _impl_.message_ = message;
+  if (message) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.PeerMessage.message)
+}
+inline ::chat::IncomingMessageResponse* PeerMessage::release_message() {
   
-  return username_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  ::chat::IncomingMessageResponse* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::IncomingMessageResponse* PeerMessage::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:chat.PeerMessage.message)
+  
+  ::chat::IncomingMessageResponse* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+  return temp;
 }
-inline void NewUserRequest::unsafe_arena_set_allocated_username(
-    std::string* username) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (username != nullptr) {
+inline ::chat::IncomingMessageResponse* PeerMessage::_internal_mutable_message() {
+  
+  if (_impl_.message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::IncomingMessageResponse>(GetArenaForAllocation());
+    _impl_.message_ = p;
+  }
+  return _impl_.message_;
+}
+inline ::chat::IncomingMessageResponse* PeerMessage::mutable_message() {
+  ::chat::IncomingMessageResponse* _msg = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:chat.PeerMessage.message)
+  return _msg;
+}
+inline void PeerMessage::set_allocated_message(::chat::IncomingMessageResponse* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.message_;
+  }
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(message);
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
     
   } else {
     
   }
-  username_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      username, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.NewUserRequest.username)
+  _impl_.message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:chat.PeerMessage.message)
 }
 
-// -------------------------------------------------------------------
+// bool routed = 6;
+inline void PeerMessage::clear_routed() {
+  _impl_.routed_ = false;
+}
+inline bool PeerMessage::_internal_routed() const {
+  return _impl_.routed_;
+}
+inline bool PeerMessage::routed() const {
+  // @@protoc_insertion_point(field_get:chat.PeerMessage.routed)
+  return _internal_routed();
+}
+inline void PeerMessage::_internal_set_routed(bool value) {
+  
+  _impl_.routed_ = value;
+}
+inline void PeerMessage::set_routed(bool value) {
+  _internal_set_routed(value);
+  // @@protoc_insertion_point(field_set:chat.PeerMessage.routed)
+}
 
-// SendMessageRequest
+// repeated .chat.PresenceDigest digest = 7;
+inline int PeerMessage::_internal_digest_size() const {
+  return _impl_.digest_.size();
+}
+inline int PeerMessage::digest_size() const {
+  return _internal_digest_size();
+}
+inline void PeerMessage::clear_digest() {
+  _impl_.digest_.Clear();
+}
+inline ::chat::PresenceDigest* PeerMessage::mutable_digest(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.PeerMessage.digest)
+  return _impl_.digest_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceDigest >*
+PeerMessage::mutable_digest() {
+  // @@protoc_insertion_point(field_mutable_list:chat.PeerMessage.digest)
+  return &_impl_.digest_;
+}
+inline const ::chat::PresenceDigest& PeerMessage::_internal_digest(int index) const {
+  return _impl_.digest_.Get(index);
+}
+inline const ::chat::PresenceDigest& PeerMessage::digest(int index) const {
+  // @@protoc_insertion_point(field_get:chat.PeerMessage.digest)
+  return _internal_digest(index);
+}
+inline ::chat::PresenceDigest* PeerMessage::_internal_add_digest() {
+  return _impl_.digest_.Add();
+}
+inline ::chat::PresenceDigest* PeerMessage::add_digest() {
+  ::chat::PresenceDigest* _add = _internal_add_digest();
+  // @@protoc_insertion_point(field_add:chat.PeerMessage.digest)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceDigest >&
+PeerMessage::digest() const {
+  // @@protoc_insertion_point(field_list:chat.PeerMessage.digest)
+  return _impl_.digest_;
+}
 
-// string recipient = 1;
-inline void SendMessageRequest::clear_recipient() {
-  recipient_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// repeated string wanted = 8;
+inline int PeerMessage::_internal_wanted_size() const {
+  return _impl_.wanted_.size();
 }
-inline const std::string& SendMessageRequest::recipient() const {
-  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.recipient)
-  return _internal_recipient();
+inline int PeerMessage::wanted_size() const {
+  return _internal_wanted_size();
 }
-inline void SendMessageRequest::set_recipient(const std::string& value) {
-  _internal_set_recipient(value);
-  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.recipient)
+inline void PeerMessage::clear_wanted() {
+  _impl_.wanted_.Clear();
 }
-inline std::string* SendMessageRequest::mutable_recipient() {
-  // @@protoc_insertion_point(field_mutable:chat.SendMessageRequest.recipient)
-  return _internal_mutable_recipient();
+inline std::string* PeerMessage::add_wanted() {
+  std::string* _s = _internal_add_wanted();
+  // @@protoc_insertion_point(field_add_mutable:chat.PeerMessage.wanted)
+  return _s;
 }
-inline const std::string& SendMessageRequest::_internal_recipient() const {
-  return recipient_.Get();
+inline const std::string& PeerMessage::_internal_wanted(int index) const {
+  return _impl_.wanted_.Get(index);
 }
-inline void SendMessageRequest::_internal_set_recipient(const std::string& value) {
-  
-  recipient_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const std::string& PeerMessage::wanted(int index) const {
+  // @@protoc_insertion_point(field_get:chat.PeerMessage.wanted)
+  return _internal_wanted(index);
 }
-inline void SendMessageRequest::set_recipient(std::string&& value) {
-  
-  recipient_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.SendMessageRequest.recipient)
+inline std::string* PeerMessage::mutable_wanted(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.PeerMessage.wanted)
+  return _impl_.wanted_.Mutable(index);
 }
-inline void SendMessageRequest::set_recipient(const char* value) {
+inline void PeerMessage::set_wanted(int index, const std::string& value) {
+  _impl_.wanted_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:chat.PeerMessage.wanted)
+}
+inline void PeerMessage::set_wanted(int index, std::string&& value) {
+  _impl_.wanted_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:chat.PeerMessage.wanted)
+}
+inline void PeerMessage::set_wanted(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  
-  recipient_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.SendMessageRequest.recipient)
+  _impl_.wanted_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:chat.PeerMessage.wanted)
+}
+inline void PeerMessage::set_wanted(int index, const char* value, size_t size) {
+  _impl_.wanted_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:chat.PeerMessage.wanted)
+}
+inline std::string* PeerMessage::_internal_add_wanted() {
+  return _impl_.wanted_.Add();
+}
+inline void PeerMessage::add_wanted(const std::string& value) {
+  _impl_.wanted_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:chat.PeerMessage.wanted)
+}
+inline void PeerMessage::add_wanted(std::string&& value) {
+  _impl_.wanted_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:chat.PeerMessage.wanted)
+}
+inline void PeerMessage::add_wanted(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.wanted_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:chat.PeerMessage.wanted)
+}
+inline void PeerMessage::add_wanted(const char* value, size_t size) {
+  _impl_.wanted_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:chat.PeerMessage.wanted)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PeerMessage::wanted() const {
+  // @@protoc_insertion_point(field_list:chat.PeerMessage.wanted)
+  return _impl_.wanted_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PeerMessage::mutable_wanted() {
+  // @@protoc_insertion_point(field_mutable_list:chat.PeerMessage.wanted)
+  return &_impl_.wanted_;
+}
+
+// -------------------------------------------------------------------
+
+// HandoffSession
+
+// string ip = 1;
+inline void HandoffSession::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
+}
+inline const std::string& HandoffSession::ip() const {
+  // @@protoc_insertion_point(field_get:chat.HandoffSession.ip)
+  return _internal_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HandoffSession::set_ip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.HandoffSession.ip)
+}
+inline std::string* HandoffSession::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:chat.HandoffSession.ip)
+  return _s;
 }
-inline void SendMessageRequest::set_recipient(const char* value,
-    size_t size) {
+inline const std::string& HandoffSession::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void HandoffSession::_internal_set_ip(const std::string& value) {
   
-  recipient_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.SendMessageRequest.recipient)
+  _impl_.ip_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SendMessageRequest::_internal_mutable_recipient() {
+inline std::string* HandoffSession::_internal_mutable_ip() {
   
-  return recipient_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SendMessageRequest::release_recipient() {
-  // @@protoc_insertion_point(field_release:chat.SendMessageRequest.recipient)
-  return recipient_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* HandoffSession::release_ip() {
+  // @@protoc_insertion_point(field_release:chat.HandoffSession.ip)
+  return _impl_.ip_.Release();
 }
-inline void SendMessageRequest::set_allocated_recipient(std::string* recipient) {
-  if (recipient != nullptr) {
+inline void HandoffSession::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
     
   } else {
     
   }
-  recipient_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), recipient,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.SendMessageRequest.recipient)
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.HandoffSession.ip)
+}
+
+// string username = 2;
+inline void HandoffSession::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& HandoffSession::username() const {
+  // @@protoc_insertion_point(field_get:chat.HandoffSession.username)
+  return _internal_username();
 }
-inline std::string* SendMessageRequest::unsafe_arena_release_recipient() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.SendMessageRequest.recipient)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HandoffSession::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.HandoffSession.username)
+}
+inline std::string* HandoffSession::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.HandoffSession.username)
+  return _s;
+}
+inline const std::string& HandoffSession::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void HandoffSession::_internal_set_username(const std::string& value) {
   
-  return recipient_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  _impl_.username_.Set(value, GetArenaForAllocation());
 }
-inline void SendMessageRequest::unsafe_arena_set_allocated_recipient(
-    std::string* recipient) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (recipient != nullptr) {
+inline std::string* HandoffSession::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HandoffSession::release_username() {
+  // @@protoc_insertion_point(field_release:chat.HandoffSession.username)
+  return _impl_.username_.Release();
+}
+inline void HandoffSession::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
     
   } else {
     
   }
-  recipient_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      recipient, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.SendMessageRequest.recipient)
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.HandoffSession.username)
 }
 
-// string content = 2;
-inline void SendMessageRequest::clear_content() {
-  content_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// .chat.UserStatus status = 3;
+inline void HandoffSession::clear_status() {
+  _impl_.status_ = 0;
 }
-inline const std::string& SendMessageRequest::content() const {
-  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.content)
-  return _internal_content();
+inline ::chat::UserStatus HandoffSession::_internal_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.status_);
 }
-inline void SendMessageRequest::set_content(const std::string& value) {
-  _internal_set_content(value);
-  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.content)
+inline ::chat::UserStatus HandoffSession::status() const {
+  // @@protoc_insertion_point(field_get:chat.HandoffSession.status)
+  return _internal_status();
+}
+inline void HandoffSession::_internal_set_status(::chat::UserStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void HandoffSession::set_status(::chat::UserStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:chat.HandoffSession.status)
+}
+
+// int64 last_active = 4;
+inline void HandoffSession::clear_last_active() {
+  _impl_.last_active_ = int64_t{0};
+}
+inline int64_t HandoffSession::_internal_last_active() const {
+  return _impl_.last_active_;
+}
+inline int64_t HandoffSession::last_active() const {
+  // @@protoc_insertion_point(field_get:chat.HandoffSession.last_active)
+  return _internal_last_active();
+}
+inline void HandoffSession::_internal_set_last_active(int64_t value) {
+  
+  _impl_.last_active_ = value;
+}
+inline void HandoffSession::set_last_active(int64_t value) {
+  _internal_set_last_active(value);
+  // @@protoc_insertion_point(field_set:chat.HandoffSession.last_active)
+}
+
+// repeated string rooms = 5;
+inline int HandoffSession::_internal_rooms_size() const {
+  return _impl_.rooms_.size();
+}
+inline int HandoffSession::rooms_size() const {
+  return _internal_rooms_size();
+}
+inline void HandoffSession::clear_rooms() {
+  _impl_.rooms_.Clear();
+}
+inline std::string* HandoffSession::add_rooms() {
+  std::string* _s = _internal_add_rooms();
+  // @@protoc_insertion_point(field_add_mutable:chat.HandoffSession.rooms)
+  return _s;
+}
+inline const std::string& HandoffSession::_internal_rooms(int index) const {
+  return _impl_.rooms_.Get(index);
+}
+inline const std::string& HandoffSession::rooms(int index) const {
+  // @@protoc_insertion_point(field_get:chat.HandoffSession.rooms)
+  return _internal_rooms(index);
+}
+inline std::string* HandoffSession::mutable_rooms(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.HandoffSession.rooms)
+  return _impl_.rooms_.Mutable(index);
+}
+inline void HandoffSession::set_rooms(int index, const std::string& value) {
+  _impl_.rooms_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:chat.HandoffSession.rooms)
+}
+inline void HandoffSession::set_rooms(int index, std::string&& value) {
+  _impl_.rooms_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:chat.HandoffSession.rooms)
+}
+inline void HandoffSession::set_rooms(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.rooms_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:chat.HandoffSession.rooms)
+}
+inline void HandoffSession::set_rooms(int index, const char* value, size_t size) {
+  _impl_.rooms_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:chat.HandoffSession.rooms)
+}
+inline std::string* HandoffSession::_internal_add_rooms() {
+  return _impl_.rooms_.Add();
+}
+inline void HandoffSession::add_rooms(const std::string& value) {
+  _impl_.rooms_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:chat.HandoffSession.rooms)
+}
+inline void HandoffSession::add_rooms(std::string&& value) {
+  _impl_.rooms_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:chat.HandoffSession.rooms)
+}
+inline void HandoffSession::add_rooms(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.rooms_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:chat.HandoffSession.rooms)
+}
+inline void HandoffSession::add_rooms(const char* value, size_t size) {
+  _impl_.rooms_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:chat.HandoffSession.rooms)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+HandoffSession::rooms() const {
+  // @@protoc_insertion_point(field_list:chat.HandoffSession.rooms)
+  return _impl_.rooms_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+HandoffSession::mutable_rooms() {
+  // @@protoc_insertion_point(field_mutable_list:chat.HandoffSession.rooms)
+  return &_impl_.rooms_;
 }
-inline std::string* SendMessageRequest::mutable_content() {
-  // @@protoc_insertion_point(field_mutable:chat.SendMessageRequest.content)
-  return _internal_mutable_content();
+
+// bytes input = 6;
+inline void HandoffSession::clear_input() {
+  _impl_.input_.ClearToEmpty();
 }
-inline const std::string& SendMessageRequest::_internal_content() const {
-  return content_.Get();
+inline const std::string& HandoffSession::input() const {
+  // @@protoc_insertion_point(field_get:chat.HandoffSession.input)
+  return _internal_input();
 }
-inline void SendMessageRequest::_internal_set_content(const std::string& value) {
-  
-  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HandoffSession::set_input(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.input_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.HandoffSession.input)
 }
-inline void SendMessageRequest::set_content(std::string&& value) {
-  
-  content_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.SendMessageRequest.content)
+inline std::string* HandoffSession::mutable_input() {
+  std::string* _s = _internal_mutable_input();
+  // @@protoc_insertion_point(field_mutable:chat.HandoffSession.input)
+  return _s;
 }
-inline void SendMessageRequest::set_content(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.SendMessageRequest.content)
+inline const std::string& HandoffSession::_internal_input() const {
+  return _impl_.input_.Get();
 }
-inline void SendMessageRequest::set_content(const char* value,
-    size_t size) {
+inline void HandoffSession::_internal_set_input(const std::string& value) {
   
-  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.SendMessageRequest.content)
+  _impl_.input_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SendMessageRequest::_internal_mutable_content() {
+inline std::string* HandoffSession::_internal_mutable_input() {
   
-  return content_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.input_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SendMessageRequest::release_content() {
-  // @@protoc_insertion_point(field_release:chat.SendMessageRequest.content)
-  return content_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* HandoffSession::release_input() {
+  // @@protoc_insertion_point(field_release:chat.HandoffSession.input)
+  return _impl_.input_.Release();
 }
-inline void SendMessageRequest::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
+inline void HandoffSession::set_allocated_input(std::string* input) {
+  if (input != nullptr) {
     
   } else {
     
   }
-  content_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), content,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.SendMessageRequest.content)
+  _impl_.input_.SetAllocated(input, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.input_.IsDefault()) {
+    _impl_.input_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.HandoffSession.input)
 }
-inline std::string* SendMessageRequest::unsafe_arena_release_content() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.SendMessageRequest.content)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+
+// .chat.FlushPolicy flush_policy = 7;
+inline void HandoffSession::clear_flush_policy() {
+  _impl_.flush_policy_ = 0;
+}
+inline ::chat::FlushPolicy HandoffSession::_internal_flush_policy() const {
+  return static_cast< ::chat::FlushPolicy >(_impl_.flush_policy_);
+}
+inline ::chat::FlushPolicy HandoffSession::flush_policy() const {
+  // @@protoc_insertion_point(field_get:chat.HandoffSession.flush_policy)
+  return _internal_flush_policy();
+}
+inline void HandoffSession::_internal_set_flush_policy(::chat::FlushPolicy value) {
   
-  return content_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  _impl_.flush_policy_ = value;
 }
-inline void SendMessageRequest::unsafe_arena_set_allocated_content(
-    std::string* content) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (content != nullptr) {
-    
-  } else {
-    
-  }
-  content_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      content, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.SendMessageRequest.content)
+inline void HandoffSession::set_flush_policy(::chat::FlushPolicy value) {
+  _internal_set_flush_policy(value);
+  // @@protoc_insertion_point(field_set:chat.HandoffSession.flush_policy)
 }
 
-// -------------------------------------------------------------------
-
-// IncomingMessageResponse
+// .chat.Compression compression = 8;
+inline void HandoffSession::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::chat::Compression HandoffSession::_internal_compression() const {
+  return static_cast< ::chat::Compression >(_impl_.compression_);
+}
+inline ::chat::Compression HandoffSession::compression() const {
+  // @@protoc_insertion_point(field_get:chat.HandoffSession.compression)
+  return _internal_compression();
+}
+inline void HandoffSession::_internal_set_compression(::chat::Compression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void HandoffSession::set_compression(::chat::Compression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:chat.HandoffSession.compression)
+}
 
-// string sender = 1;
-inline void IncomingMessageResponse::clear_sender() {
-  sender_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// repeated .chat.PartialTransfer transfers = 9;
+inline int HandoffSession::_internal_transfers_size() const {
+  return _impl_.transfers_.size();
 }
-inline const std::string& IncomingMessageResponse::sender() const {
-  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.sender)
-  return _internal_sender();
+inline int HandoffSession::transfers_size() const {
+  return _internal_transfers_size();
 }
-inline void IncomingMessageResponse::set_sender(const std::string& value) {
-  _internal_set_sender(value);
-  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.sender)
+inline void HandoffSession::clear_transfers() {
+  _impl_.transfers_.Clear();
 }
-inline std::string* IncomingMessageResponse::mutable_sender() {
-  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.sender)
-  return _internal_mutable_sender();
+inline ::chat::PartialTransfer* HandoffSession::mutable_transfers(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.HandoffSession.transfers)
+  return _impl_.transfers_.Mutable(index);
 }
-inline const std::string& IncomingMessageResponse::_internal_sender() const {
-  return sender_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PartialTransfer >*
+HandoffSession::mutable_transfers() {
+  // @@protoc_insertion_point(field_mutable_list:chat.HandoffSession.transfers)
+  return &_impl_.transfers_;
 }
-inline void IncomingMessageResponse::_internal_set_sender(const std::string& value) {
-  
-  sender_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::chat::PartialTransfer& HandoffSession::_internal_transfers(int index) const {
+  return _impl_.transfers_.Get(index);
 }
-inline void IncomingMessageResponse::set_sender(std::string&& value) {
-  
-  sender_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.IncomingMessageResponse.sender)
+inline const ::chat::PartialTransfer& HandoffSession::transfers(int index) const {
+  // @@protoc_insertion_point(field_get:chat.HandoffSession.transfers)
+  return _internal_transfers(index);
 }
-inline void IncomingMessageResponse::set_sender(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  sender_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.IncomingMessageResponse.sender)
+inline ::chat::PartialTransfer* HandoffSession::_internal_add_transfers() {
+  return _impl_.transfers_.Add();
 }
-inline void IncomingMessageResponse::set_sender(const char* value,
-    size_t size) {
-  
-  sender_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.IncomingMessageResponse.sender)
+inline ::chat::PartialTransfer* HandoffSession::add_transfers() {
+  ::chat::PartialTransfer* _add = _internal_add_transfers();
+  // @@protoc_insertion_point(field_add:chat.HandoffSession.transfers)
+  return _add;
 }
-inline std::string* IncomingMessageResponse::_internal_mutable_sender() {
-  
-  return sender_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PartialTransfer >&
+HandoffSession::transfers() const {
+  // @@protoc_insertion_point(field_list:chat.HandoffSession.transfers)
+  return _impl_.transfers_;
 }
-inline std::string* IncomingMessageResponse::release_sender() {
-  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.sender)
-  return sender_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+
+// bool compact = 10;
+inline void HandoffSession::clear_compact() {
+  _impl_.compact_ = false;
 }
-inline void IncomingMessageResponse::set_allocated_sender(std::string* sender) {
-  if (sender != nullptr) {
-    
-  } else {
-    
-  }
-  sender_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), sender,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.sender)
+inline bool HandoffSession::_internal_compact() const {
+  return _impl_.compact_;
+}
+inline bool HandoffSession::compact() const {
+  // @@protoc_insertion_point(field_get:chat.HandoffSession.compact)
+  return _internal_compact();
 }
-inline std::string* IncomingMessageResponse::unsafe_arena_release_sender() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.IncomingMessageResponse.sender)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline void HandoffSession::_internal_set_compact(bool value) {
   
-  return sender_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  _impl_.compact_ = value;
 }
-inline void IncomingMessageResponse::unsafe_arena_set_allocated_sender(
-    std::string* sender) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (sender != nullptr) {
-    
-  } else {
-    
-  }
-  sender_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      sender, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.IncomingMessageResponse.sender)
+inline void HandoffSession::set_compact(bool value) {
+  _internal_set_compact(value);
+  // @@protoc_insertion_point(field_set:chat.HandoffSession.compact)
 }
 
-// string content = 2;
-inline void IncomingMessageResponse::clear_content() {
-  content_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// uint64 resume_token = 11;
+inline void HandoffSession::clear_resume_token() {
+  _impl_.resume_token_ = uint64_t{0u};
 }
-inline const std::string& IncomingMessageResponse::content() const {
-  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.content)
-  return _internal_content();
+inline uint64_t HandoffSession::_internal_resume_token() const {
+  return _impl_.resume_token_;
 }
-inline void IncomingMessageResponse::set_content(const std::string& value) {
-  _internal_set_content(value);
-  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.content)
+inline uint64_t HandoffSession::resume_token() const {
+  // @@protoc_insertion_point(field_get:chat.HandoffSession.resume_token)
+  return _internal_resume_token();
 }
-inline std::string* IncomingMessageResponse::mutable_content() {
-  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.content)
-  return _internal_mutable_content();
+inline void HandoffSession::_internal_set_resume_token(uint64_t value) {
+  
+  _impl_.resume_token_ = value;
 }
-inline const std::string& IncomingMessageResponse::_internal_content() const {
-  return content_.Get();
+inline void HandoffSession::set_resume_token(uint64_t value) {
+  _internal_set_resume_token(value);
+  // @@protoc_insertion_point(field_set:chat.HandoffSession.resume_token)
 }
-inline void IncomingMessageResponse::_internal_set_content(const std::string& value) {
-  
-  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+
+// repeated .chat.BufferedFrame resume = 12;
+inline int HandoffSession::_internal_resume_size() const {
+  return _impl_.resume_.size();
 }
-inline void IncomingMessageResponse::set_content(std::string&& value) {
-  
-  content_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.IncomingMessageResponse.content)
+inline int HandoffSession::resume_size() const {
+  return _internal_resume_size();
 }
-inline void IncomingMessageResponse::set_content(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.IncomingMessageResponse.content)
+inline void HandoffSession::clear_resume() {
+  _impl_.resume_.Clear();
 }
-inline void IncomingMessageResponse::set_content(const char* value,
-    size_t size) {
-  
-  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.IncomingMessageResponse.content)
+inline ::chat::BufferedFrame* HandoffSession::mutable_resume(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.HandoffSession.resume)
+  return _impl_.resume_.Mutable(index);
 }
-inline std::string* IncomingMessageResponse::_internal_mutable_content() {
-  
-  return content_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::BufferedFrame >*
+HandoffSession::mutable_resume() {
+  // @@protoc_insertion_point(field_mutable_list:chat.HandoffSession.resume)
+  return &_impl_.resume_;
 }
-inline std::string* IncomingMessageResponse::release_content() {
-  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.content)
-  return content_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::chat::BufferedFrame& HandoffSession::_internal_resume(int index) const {
+  return _impl_.resume_.Get(index);
 }
-inline void IncomingMessageResponse::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
-    
-  } else {
-    
-  }
-  content_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), content,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.content)
+inline const ::chat::BufferedFrame& HandoffSession::resume(int index) const {
+  // @@protoc_insertion_point(field_get:chat.HandoffSession.resume)
+  return _internal_resume(index);
 }
-inline std::string* IncomingMessageResponse::unsafe_arena_release_content() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.IncomingMessageResponse.content)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return content_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline ::chat::BufferedFrame* HandoffSession::_internal_add_resume() {
+  return _impl_.resume_.Add();
 }
-inline void IncomingMessageResponse::unsafe_arena_set_allocated_content(
-    std::string* content) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (content != nullptr) {
-    
-  } else {
-    
-  }
-  content_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      content, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.IncomingMessageResponse.content)
+inline ::chat::BufferedFrame* HandoffSession::add_resume() {
+  ::chat::BufferedFrame* _add = _internal_add_resume();
+  // @@protoc_insertion_point(field_add:chat.HandoffSession.resume)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::BufferedFrame >&
+HandoffSession::resume() const {
+  // @@protoc_insertion_point(field_list:chat.HandoffSession.resume)
+  return _impl_.resume_;
 }
 
-// .chat.MessageType type = 3;
-inline void IncomingMessageResponse::clear_type() {
-  type_ = 0;
+// int64 registered_at = 13;
+inline void HandoffSession::clear_registered_at() {
+  _impl_.registered_at_ = int64_t{0};
 }
-inline ::chat::MessageType IncomingMessageResponse::_internal_type() const {
-  return static_cast< ::chat::MessageType >(type_);
+inline int64_t HandoffSession::_internal_registered_at() const {
+  return _impl_.registered_at_;
 }
-inline ::chat::MessageType IncomingMessageResponse::type() const {
-  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.type)
-  return _internal_type();
+inline int64_t HandoffSession::registered_at() const {
+  // @@protoc_insertion_point(field_get:chat.HandoffSession.registered_at)
+  return _internal_registered_at();
 }
-inline void IncomingMessageResponse::_internal_set_type(::chat::MessageType value) {
+inline void HandoffSession::_internal_set_registered_at(int64_t value) {
   
-  type_ = value;
+  _impl_.registered_at_ = value;
 }
-inline void IncomingMessageResponse::set_type(::chat::MessageType value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.type)
+inline void HandoffSession::set_registered_at(int64_t value) {
+  _internal_set_registered_at(value);
+  // @@protoc_insertion_point(field_set:chat.HandoffSession.registered_at)
 }
 
 // -------------------------------------------------------------------
 
-// UserListRequest
+// PartialTransfer
 
-// string username = 1;
-inline void UserListRequest::clear_username() {
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// uint32 id = 1;
+inline void PartialTransfer::clear_id() {
+  _impl_.id_ = 0u;
 }
-inline const std::string& UserListRequest::username() const {
-  // @@protoc_insertion_point(field_get:chat.UserListRequest.username)
-  return _internal_username();
+inline uint32_t PartialTransfer::_internal_id() const {
+  return _impl_.id_;
 }
-inline void UserListRequest::set_username(const std::string& value) {
-  _internal_set_username(value);
-  // @@protoc_insertion_point(field_set:chat.UserListRequest.username)
+inline uint32_t PartialTransfer::id() const {
+  // @@protoc_insertion_point(field_get:chat.PartialTransfer.id)
+  return _internal_id();
 }
-inline std::string* UserListRequest::mutable_username() {
-  // @@protoc_insertion_point(field_mutable:chat.UserListRequest.username)
-  return _internal_mutable_username();
+inline void PartialTransfer::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
 }
-inline const std::string& UserListRequest::_internal_username() const {
-  return username_.Get();
+inline void PartialTransfer::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:chat.PartialTransfer.id)
 }
-inline void UserListRequest::_internal_set_username(const std::string& value) {
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+
+// uint32 total = 2;
+inline void PartialTransfer::clear_total() {
+  _impl_.total_ = 0u;
 }
-inline void UserListRequest::set_username(std::string&& value) {
-  
-  username_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.UserListRequest.username)
+inline uint32_t PartialTransfer::_internal_total() const {
+  return _impl_.total_;
 }
-inline void UserListRequest::set_username(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.UserListRequest.username)
+inline uint32_t PartialTransfer::total() const {
+  // @@protoc_insertion_point(field_get:chat.PartialTransfer.total)
+  return _internal_total();
 }
-inline void UserListRequest::set_username(const char* value,
-    size_t size) {
+inline void PartialTransfer::_internal_set_total(uint32_t value) {
   
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.UserListRequest.username)
+  _impl_.total_ = value;
 }
-inline std::string* UserListRequest::_internal_mutable_username() {
-  
-  return username_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void PartialTransfer::set_total(uint32_t value) {
+  _internal_set_total(value);
+  // @@protoc_insertion_point(field_set:chat.PartialTransfer.total)
 }
-inline std::string* UserListRequest::release_username() {
-  // @@protoc_insertion_point(field_release:chat.UserListRequest.username)
-  return username_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+
+// bytes data = 3;
+inline void PartialTransfer::clear_data() {
+  _impl_.data_.ClearToEmpty();
 }
-inline void UserListRequest::set_allocated_username(std::string* username) {
-  if (username != nullptr) {
-    
-  } else {
-    
-  }
-  username_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), username,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.UserListRequest.username)
+inline const std::string& PartialTransfer::data() const {
+  // @@protoc_insertion_point(field_get:chat.PartialTransfer.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PartialTransfer::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.PartialTransfer.data)
+}
+inline std::string* PartialTransfer::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:chat.PartialTransfer.data)
+  return _s;
+}
+inline const std::string& PartialTransfer::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline std::string* UserListRequest::unsafe_arena_release_username() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.UserListRequest.username)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline void PartialTransfer::_internal_set_data(const std::string& value) {
   
-  return username_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline void UserListRequest::unsafe_arena_set_allocated_username(
-    std::string* username) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (username != nullptr) {
+inline std::string* PartialTransfer::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PartialTransfer::release_data() {
+  // @@protoc_insertion_point(field_release:chat.PartialTransfer.data)
+  return _impl_.data_.Release();
+}
+inline void PartialTransfer::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  username_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      username, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.UserListRequest.username)
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.PartialTransfer.data)
 }
 
 // -------------------------------------------------------------------
 
-// UserListResponse
+// BufferedFrame
 
-// repeated .chat.User users = 1;
-inline int UserListResponse::_internal_users_size() const {
-  return users_.size();
+// uint64 seq = 1;
+inline void BufferedFrame::clear_seq() {
+  _impl_.seq_ = uint64_t{0u};
 }
-inline int UserListResponse::users_size() const {
-  return _internal_users_size();
-}
-inline void UserListResponse::clear_users() {
-  users_.Clear();
+inline uint64_t BufferedFrame::_internal_seq() const {
+  return _impl_.seq_;
 }
-inline ::chat::User* UserListResponse::mutable_users(int index) {
-  // @@protoc_insertion_point(field_mutable:chat.UserListResponse.users)
-  return users_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >*
-UserListResponse::mutable_users() {
-  // @@protoc_insertion_point(field_mutable_list:chat.UserListResponse.users)
-  return &users_;
+inline uint64_t BufferedFrame::seq() const {
+  // @@protoc_insertion_point(field_get:chat.BufferedFrame.seq)
+  return _internal_seq();
 }
-inline const ::chat::User& UserListResponse::_internal_users(int index) const {
-  return users_.Get(index);
+inline void BufferedFrame::_internal_set_seq(uint64_t value) {
+  
+  _impl_.seq_ = value;
 }
-inline const ::chat::User& UserListResponse::users(int index) const {
-  // @@protoc_insertion_point(field_get:chat.UserListResponse.users)
-  return _internal_users(index);
+inline void BufferedFrame::set_seq(uint64_t value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:chat.BufferedFrame.seq)
 }
-inline ::chat::User* UserListResponse::_internal_add_users() {
-  return users_.Add();
+
+// bytes frame = 2;
+inline void BufferedFrame::clear_frame() {
+  _impl_.frame_.ClearToEmpty();
 }
-inline ::chat::User* UserListResponse::add_users() {
-  // @@protoc_insertion_point(field_add:chat.UserListResponse.users)
-  return _internal_add_users();
+inline const std::string& BufferedFrame::frame() const {
+  // @@protoc_insertion_point(field_get:chat.BufferedFrame.frame)
+  return _internal_frame();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >&
-UserListResponse::users() const {
-  // @@protoc_insertion_point(field_list:chat.UserListResponse.users)
-  return users_;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BufferedFrame::set_frame(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.frame_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.BufferedFrame.frame)
 }
-
-// .chat.UserListType type = 2;
-inline void UserListResponse::clear_type() {
-  type_ = 0;
+inline std::string* BufferedFrame::mutable_frame() {
+  std::string* _s = _internal_mutable_frame();
+  // @@protoc_insertion_point(field_mutable:chat.BufferedFrame.frame)
+  return _s;
 }
-inline ::chat::UserListType UserListResponse::_internal_type() const {
-  return static_cast< ::chat::UserListType >(type_);
+inline const std::string& BufferedFrame::_internal_frame() const {
+  return _impl_.frame_.Get();
 }
-inline ::chat::UserListType UserListResponse::type() const {
-  // @@protoc_insertion_point(field_get:chat.UserListResponse.type)
-  return _internal_type();
+inline void BufferedFrame::_internal_set_frame(const std::string& value) {
+  
+  _impl_.frame_.Set(value, GetArenaForAllocation());
 }
-inline void UserListResponse::_internal_set_type(::chat::UserListType value) {
+inline std::string* BufferedFrame::_internal_mutable_frame() {
   
-  type_ = value;
+  return _impl_.frame_.Mutable(GetArenaForAllocation());
 }
-inline void UserListResponse::set_type(::chat::UserListType value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:chat.UserListResponse.type)
+inline std::string* BufferedFrame::release_frame() {
+  // @@protoc_insertion_point(field_release:chat.BufferedFrame.frame)
+  return _impl_.frame_.Release();
+}
+inline void BufferedFrame::set_allocated_frame(std::string* frame) {
+  if (frame != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.frame_.SetAllocated(frame, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.frame_.IsDefault()) {
+    _impl_.frame_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.BufferedFrame.frame)
 }
 
 // -------------------------------------------------------------------
 
-// UpdateStatusRequest
+// DetachedSession
 
-// string username = 1;
-inline void UpdateStatusRequest::clear_username() {
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& UpdateStatusRequest::username() const {
-  // @@protoc_insertion_point(field_get:chat.UpdateStatusRequest.username)
-  return _internal_username();
-}
-inline void UpdateStatusRequest::set_username(const std::string& value) {
-  _internal_set_username(value);
-  // @@protoc_insertion_point(field_set:chat.UpdateStatusRequest.username)
-}
-inline std::string* UpdateStatusRequest::mutable_username() {
-  // @@protoc_insertion_point(field_mutable:chat.UpdateStatusRequest.username)
-  return _internal_mutable_username();
+// string ip = 1;
+inline void DetachedSession::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
 }
-inline const std::string& UpdateStatusRequest::_internal_username() const {
-  return username_.Get();
+inline const std::string& DetachedSession::ip() const {
+  // @@protoc_insertion_point(field_get:chat.DetachedSession.ip)
+  return _internal_ip();
 }
-inline void UpdateStatusRequest::_internal_set_username(const std::string& value) {
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DetachedSession::set_ip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.DetachedSession.ip)
 }
-inline void UpdateStatusRequest::set_username(std::string&& value) {
-  
-  username_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.UpdateStatusRequest.username)
+inline std::string* DetachedSession::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:chat.DetachedSession.ip)
+  return _s;
 }
-inline void UpdateStatusRequest::set_username(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.UpdateStatusRequest.username)
+inline const std::string& DetachedSession::_internal_ip() const {
+  return _impl_.ip_.Get();
 }
-inline void UpdateStatusRequest::set_username(const char* value,
-    size_t size) {
+inline void DetachedSession::_internal_set_ip(const std::string& value) {
   
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.UpdateStatusRequest.username)
+  _impl_.ip_.Set(value, GetArenaForAllocation());
 }
-inline std::string* UpdateStatusRequest::_internal_mutable_username() {
+inline std::string* DetachedSession::_internal_mutable_ip() {
   
-  return username_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
 }
-inline std::string* UpdateStatusRequest::release_username() {
-  // @@protoc_insertion_point(field_release:chat.UpdateStatusRequest.username)
-  return username_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* DetachedSession::release_ip() {
+  // @@protoc_insertion_point(field_release:chat.DetachedSession.ip)
+  return _impl_.ip_.Release();
 }
-inline void UpdateStatusRequest::set_allocated_username(std::string* username) {
-  if (username != nullptr) {
+inline void DetachedSession::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
     
   } else {
     
   }
-  username_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), username,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.UpdateStatusRequest.username)
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.DetachedSession.ip)
+}
+
+// string username = 2;
+inline void DetachedSession::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& DetachedSession::username() const {
+  // @@protoc_insertion_point(field_get:chat.DetachedSession.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DetachedSession::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.DetachedSession.username)
+}
+inline std::string* DetachedSession::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.DetachedSession.username)
+  return _s;
+}
+inline const std::string& DetachedSession::_internal_username() const {
+  return _impl_.username_.Get();
 }
-inline std::string* UpdateStatusRequest::unsafe_arena_release_username() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.UpdateStatusRequest.username)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline void DetachedSession::_internal_set_username(const std::string& value) {
   
-  return username_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  _impl_.username_.Set(value, GetArenaForAllocation());
 }
-inline void UpdateStatusRequest::unsafe_arena_set_allocated_username(
-    std::string* username) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline std::string* DetachedSession::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DetachedSession::release_username() {
+  // @@protoc_insertion_point(field_release:chat.DetachedSession.username)
+  return _impl_.username_.Release();
+}
+inline void DetachedSession::set_allocated_username(std::string* username) {
   if (username != nullptr) {
     
   } else {
     
   }
-  username_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      username, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.UpdateStatusRequest.username)
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.DetachedSession.username)
 }
 
-// .chat.UserStatus new_status = 2;
-inline void UpdateStatusRequest::clear_new_status() {
-  new_status_ = 0;
+// .chat.UserStatus status = 3;
+inline void DetachedSession::clear_status() {
+  _impl_.status_ = 0;
 }
-inline ::chat::UserStatus UpdateStatusRequest::_internal_new_status() const {
-  return static_cast< ::chat::UserStatus >(new_status_);
+inline ::chat::UserStatus DetachedSession::_internal_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.status_);
 }
-inline ::chat::UserStatus UpdateStatusRequest::new_status() const {
-  // @@protoc_insertion_point(field_get:chat.UpdateStatusRequest.new_status)
-  return _internal_new_status();
+inline ::chat::UserStatus DetachedSession::status() const {
+  // @@protoc_insertion_point(field_get:chat.DetachedSession.status)
+  return _internal_status();
 }
-inline void UpdateStatusRequest::_internal_set_new_status(::chat::UserStatus value) {
+inline void DetachedSession::_internal_set_status(::chat::UserStatus value) {
   
-  new_status_ = value;
+  _impl_.status_ = value;
 }
-inline void UpdateStatusRequest::set_new_status(::chat::UserStatus value) {
-  _internal_set_new_status(value);
-  // @@protoc_insertion_point(field_set:chat.UpdateStatusRequest.new_status)
+inline void DetachedSession::set_status(::chat::UserStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:chat.DetachedSession.status)
 }
 
-// -------------------------------------------------------------------
-
-// Request
-
-// .chat.Operation operation = 1;
-inline void Request::clear_operation() {
-  operation_ = 0;
-}
-inline ::chat::Operation Request::_internal_operation() const {
-  return static_cast< ::chat::Operation >(operation_);
+// int64 last_active = 4;
+inline void DetachedSession::clear_last_active() {
+  _impl_.last_active_ = int64_t{0};
 }
-inline ::chat::Operation Request::operation() const {
-  // @@protoc_insertion_point(field_get:chat.Request.operation)
-  return _internal_operation();
+inline int64_t DetachedSession::_internal_last_active() const {
+  return _impl_.last_active_;
 }
-inline void Request::_internal_set_operation(::chat::Operation value) {
-  
-  operation_ = value;
+inline int64_t DetachedSession::last_active() const {
+  // @@protoc_insertion_point(field_get:chat.DetachedSession.last_active)
+  return _internal_last_active();
 }
-inline void Request::set_operation(::chat::Operation value) {
-  _internal_set_operation(value);
-  // @@protoc_insertion_point(field_set:chat.Request.operation)
+inline void DetachedSession::_internal_set_last_active(int64_t value) {
+  
+  _impl_.last_active_ = value;
+}
+inline void DetachedSession::set_last_active(int64_t value) {
+  _internal_set_last_active(value);
+  // @@protoc_insertion_point(field_set:chat.DetachedSession.last_active)
 }
 
-// .chat.NewUserRequest register_user = 2;
-inline bool Request::_internal_has_register_user() const {
-  return payload_case() == kRegisterUser;
+// repeated string rooms = 5;
+inline int DetachedSession::_internal_rooms_size() const {
+  return _impl_.rooms_.size();
 }
-inline bool Request::has_register_user() const {
-  return _internal_has_register_user();
+inline int DetachedSession::rooms_size() const {
+  return _internal_rooms_size();
 }
-inline void Request::set_has_register_user() {
-  _oneof_case_[0] = kRegisterUser;
+inline void DetachedSession::clear_rooms() {
+  _impl_.rooms_.Clear();
 }
-inline void Request::clear_register_user() {
-  if (_internal_has_register_user()) {
-    if (GetArena() == nullptr) {
-      delete payload_.register_user_;
-    }
-    clear_has_payload();
-  }
+inline std::string* DetachedSession::add_rooms() {
+  std::string* _s = _internal_add_rooms();
+  // @@protoc_insertion_point(field_add_mutable:chat.DetachedSession.rooms)
+  return _s;
 }
-inline ::chat::NewUserRequest* Request::release_register_user() {
-  // @@protoc_insertion_point(field_release:chat.Request.register_user)
-  if (_internal_has_register_user()) {
-    clear_has_payload();
-      ::chat::NewUserRequest* temp = payload_.register_user_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    payload_.register_user_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline const std::string& DetachedSession::_internal_rooms(int index) const {
+  return _impl_.rooms_.Get(index);
 }
-inline const ::chat::NewUserRequest& Request::_internal_register_user() const {
-  return _internal_has_register_user()
-      ? *payload_.register_user_
-      : *reinterpret_cast< ::chat::NewUserRequest*>(&::chat::_NewUserRequest_default_instance_);
+inline const std::string& DetachedSession::rooms(int index) const {
+  // @@protoc_insertion_point(field_get:chat.DetachedSession.rooms)
+  return _internal_rooms(index);
 }
-inline const ::chat::NewUserRequest& Request::register_user() const {
-  // @@protoc_insertion_point(field_get:chat.Request.register_user)
-  return _internal_register_user();
+inline std::string* DetachedSession::mutable_rooms(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.DetachedSession.rooms)
+  return _impl_.rooms_.Mutable(index);
 }
-inline ::chat::NewUserRequest* Request::unsafe_arena_release_register_user() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.register_user)
-  if (_internal_has_register_user()) {
-    clear_has_payload();
-    ::chat::NewUserRequest* temp = payload_.register_user_;
-    payload_.register_user_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void DetachedSession::set_rooms(int index, const std::string& value) {
+  _impl_.rooms_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:chat.DetachedSession.rooms)
 }
-inline void Request::unsafe_arena_set_allocated_register_user(::chat::NewUserRequest* register_user) {
-  clear_payload();
-  if (register_user) {
-    set_has_register_user();
-    payload_.register_user_ = register_user;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.register_user)
+inline void DetachedSession::set_rooms(int index, std::string&& value) {
+  _impl_.rooms_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:chat.DetachedSession.rooms)
 }
-inline ::chat::NewUserRequest* Request::_internal_mutable_register_user() {
-  if (!_internal_has_register_user()) {
-    clear_payload();
-    set_has_register_user();
-    payload_.register_user_ = CreateMaybeMessage< ::chat::NewUserRequest >(GetArena());
-  }
-  return payload_.register_user_;
+inline void DetachedSession::set_rooms(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.rooms_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:chat.DetachedSession.rooms)
 }
-inline ::chat::NewUserRequest* Request::mutable_register_user() {
-  // @@protoc_insertion_point(field_mutable:chat.Request.register_user)
-  return _internal_mutable_register_user();
+inline void DetachedSession::set_rooms(int index, const char* value, size_t size) {
+  _impl_.rooms_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:chat.DetachedSession.rooms)
 }
-
-// .chat.SendMessageRequest send_message = 3;
-inline bool Request::_internal_has_send_message() const {
-  return payload_case() == kSendMessage;
+inline std::string* DetachedSession::_internal_add_rooms() {
+  return _impl_.rooms_.Add();
 }
-inline bool Request::has_send_message() const {
-  return _internal_has_send_message();
+inline void DetachedSession::add_rooms(const std::string& value) {
+  _impl_.rooms_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:chat.DetachedSession.rooms)
 }
-inline void Request::set_has_send_message() {
-  _oneof_case_[0] = kSendMessage;
+inline void DetachedSession::add_rooms(std::string&& value) {
+  _impl_.rooms_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:chat.DetachedSession.rooms)
 }
-inline void Request::clear_send_message() {
-  if (_internal_has_send_message()) {
-    if (GetArena() == nullptr) {
-      delete payload_.send_message_;
-    }
-    clear_has_payload();
-  }
+inline void DetachedSession::add_rooms(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.rooms_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:chat.DetachedSession.rooms)
 }
-inline ::chat::SendMessageRequest* Request::release_send_message() {
-  // @@protoc_insertion_point(field_release:chat.Request.send_message)
-  if (_internal_has_send_message()) {
-    clear_has_payload();
-      ::chat::SendMessageRequest* temp = payload_.send_message_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    payload_.send_message_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void DetachedSession::add_rooms(const char* value, size_t size) {
+  _impl_.rooms_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:chat.DetachedSession.rooms)
 }
-inline const ::chat::SendMessageRequest& Request::_internal_send_message() const {
-  return _internal_has_send_message()
-      ? *payload_.send_message_
-      : *reinterpret_cast< ::chat::SendMessageRequest*>(&::chat::_SendMessageRequest_default_instance_);
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+DetachedSession::rooms() const {
+  // @@protoc_insertion_point(field_list:chat.DetachedSession.rooms)
+  return _impl_.rooms_;
 }
-inline const ::chat::SendMessageRequest& Request::send_message() const {
-  // @@protoc_insertion_point(field_get:chat.Request.send_message)
-  return _internal_send_message();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+DetachedSession::mutable_rooms() {
+  // @@protoc_insertion_point(field_mutable_list:chat.DetachedSession.rooms)
+  return &_impl_.rooms_;
 }
-inline ::chat::SendMessageRequest* Request::unsafe_arena_release_send_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.send_message)
-  if (_internal_has_send_message()) {
-    clear_has_payload();
-    ::chat::SendMessageRequest* temp = payload_.send_message_;
-    payload_.send_message_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+
+// bool compact = 6;
+inline void DetachedSession::clear_compact() {
+  _impl_.compact_ = false;
 }
-inline void Request::unsafe_arena_set_allocated_send_message(::chat::SendMessageRequest* send_message) {
-  clear_payload();
-  if (send_message) {
-    set_has_send_message();
-    payload_.send_message_ = send_message;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.send_message)
+inline bool DetachedSession::_internal_compact() const {
+  return _impl_.compact_;
 }
-inline ::chat::SendMessageRequest* Request::_internal_mutable_send_message() {
-  if (!_internal_has_send_message()) {
-    clear_payload();
-    set_has_send_message();
-    payload_.send_message_ = CreateMaybeMessage< ::chat::SendMessageRequest >(GetArena());
-  }
-  return payload_.send_message_;
+inline bool DetachedSession::compact() const {
+  // @@protoc_insertion_point(field_get:chat.DetachedSession.compact)
+  return _internal_compact();
 }
-inline ::chat::SendMessageRequest* Request::mutable_send_message() {
-  // @@protoc_insertion_point(field_mutable:chat.Request.send_message)
-  return _internal_mutable_send_message();
+inline void DetachedSession::_internal_set_compact(bool value) {
+  
+  _impl_.compact_ = value;
 }
-
-// .chat.UpdateStatusRequest update_status = 4;
-inline bool Request::_internal_has_update_status() const {
-  return payload_case() == kUpdateStatus;
+inline void DetachedSession::set_compact(bool value) {
+  _internal_set_compact(value);
+  // @@protoc_insertion_point(field_set:chat.DetachedSession.compact)
 }
-inline bool Request::has_update_status() const {
-  return _internal_has_update_status();
+
+// uint64 resume_token = 7;
+inline void DetachedSession::clear_resume_token() {
+  _impl_.resume_token_ = uint64_t{0u};
 }
-inline void Request::set_has_update_status() {
-  _oneof_case_[0] = kUpdateStatus;
+inline uint64_t DetachedSession::_internal_resume_token() const {
+  return _impl_.resume_token_;
 }
-inline void Request::clear_update_status() {
-  if (_internal_has_update_status()) {
-    if (GetArena() == nullptr) {
-      delete payload_.update_status_;
-    }
-    clear_has_payload();
-  }
+inline uint64_t DetachedSession::resume_token() const {
+  // @@protoc_insertion_point(field_get:chat.DetachedSession.resume_token)
+  return _internal_resume_token();
 }
-inline ::chat::UpdateStatusRequest* Request::release_update_status() {
-  // @@protoc_insertion_point(field_release:chat.Request.update_status)
-  if (_internal_has_update_status()) {
-    clear_has_payload();
-      ::chat::UpdateStatusRequest* temp = payload_.update_status_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    payload_.update_status_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void DetachedSession::_internal_set_resume_token(uint64_t value) {
+  
+  _impl_.resume_token_ = value;
 }
-inline const ::chat::UpdateStatusRequest& Request::_internal_update_status() const {
-  return _internal_has_update_status()
-      ? *payload_.update_status_
-      : *reinterpret_cast< ::chat::UpdateStatusRequest*>(&::chat::_UpdateStatusRequest_default_instance_);
+inline void DetachedSession::set_resume_token(uint64_t value) {
+  _internal_set_resume_token(value);
+  // @@protoc_insertion_point(field_set:chat.DetachedSession.resume_token)
 }
-inline const ::chat::UpdateStatusRequest& Request::update_status() const {
-  // @@protoc_insertion_point(field_get:chat.Request.update_status)
-  return _internal_update_status();
+
+// int64 detached_ms = 8;
+inline void DetachedSession::clear_detached_ms() {
+  _impl_.detached_ms_ = int64_t{0};
 }
-inline ::chat::UpdateStatusRequest* Request::unsafe_arena_release_update_status() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.update_status)
-  if (_internal_has_update_status()) {
-    clear_has_payload();
-    ::chat::UpdateStatusRequest* temp = payload_.update_status_;
-    payload_.update_status_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline int64_t DetachedSession::_internal_detached_ms() const {
+  return _impl_.detached_ms_;
 }
-inline void Request::unsafe_arena_set_allocated_update_status(::chat::UpdateStatusRequest* update_status) {
-  clear_payload();
-  if (update_status) {
-    set_has_update_status();
-    payload_.update_status_ = update_status;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.update_status)
+inline int64_t DetachedSession::detached_ms() const {
+  // @@protoc_insertion_point(field_get:chat.DetachedSession.detached_ms)
+  return _internal_detached_ms();
 }
-inline ::chat::UpdateStatusRequest* Request::_internal_mutable_update_status() {
-  if (!_internal_has_update_status()) {
-    clear_payload();
-    set_has_update_status();
-    payload_.update_status_ = CreateMaybeMessage< ::chat::UpdateStatusRequest >(GetArena());
-  }
-  return payload_.update_status_;
+inline void DetachedSession::_internal_set_detached_ms(int64_t value) {
+  
+  _impl_.detached_ms_ = value;
 }
-inline ::chat::UpdateStatusRequest* Request::mutable_update_status() {
-  // @@protoc_insertion_point(field_mutable:chat.Request.update_status)
-  return _internal_mutable_update_status();
+inline void DetachedSession::set_detached_ms(int64_t value) {
+  _internal_set_detached_ms(value);
+  // @@protoc_insertion_point(field_set:chat.DetachedSession.detached_ms)
 }
 
-// .chat.UserListRequest get_users = 5;
-inline bool Request::_internal_has_get_users() const {
-  return payload_case() == kGetUsers;
+// repeated .chat.BufferedFrame resume = 9;
+inline int DetachedSession::_internal_resume_size() const {
+  return _impl_.resume_.size();
 }
-inline bool Request::has_get_users() const {
-  return _internal_has_get_users();
-}
-inline void Request::set_has_get_users() {
-  _oneof_case_[0] = kGetUsers;
+inline int DetachedSession::resume_size() const {
+  return _internal_resume_size();
 }
-inline void Request::clear_get_users() {
-  if (_internal_has_get_users()) {
-    if (GetArena() == nullptr) {
-      delete payload_.get_users_;
-    }
-    clear_has_payload();
-  }
+inline void DetachedSession::clear_resume() {
+  _impl_.resume_.Clear();
 }
-inline ::chat::UserListRequest* Request::release_get_users() {
-  // @@protoc_insertion_point(field_release:chat.Request.get_users)
-  if (_internal_has_get_users()) {
-    clear_has_payload();
-      ::chat::UserListRequest* temp = payload_.get_users_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    payload_.get_users_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline ::chat::BufferedFrame* DetachedSession::mutable_resume(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.DetachedSession.resume)
+  return _impl_.resume_.Mutable(index);
 }
-inline const ::chat::UserListRequest& Request::_internal_get_users() const {
-  return _internal_has_get_users()
-      ? *payload_.get_users_
-      : *reinterpret_cast< ::chat::UserListRequest*>(&::chat::_UserListRequest_default_instance_);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::BufferedFrame >*
+DetachedSession::mutable_resume() {
+  // @@protoc_insertion_point(field_mutable_list:chat.DetachedSession.resume)
+  return &_impl_.resume_;
 }
-inline const ::chat::UserListRequest& Request::get_users() const {
-  // @@protoc_insertion_point(field_get:chat.Request.get_users)
-  return _internal_get_users();
+inline const ::chat::BufferedFrame& DetachedSession::_internal_resume(int index) const {
+  return _impl_.resume_.Get(index);
 }
-inline ::chat::UserListRequest* Request::unsafe_arena_release_get_users() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.get_users)
-  if (_internal_has_get_users()) {
-    clear_has_payload();
-    ::chat::UserListRequest* temp = payload_.get_users_;
-    payload_.get_users_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline const ::chat::BufferedFrame& DetachedSession::resume(int index) const {
+  // @@protoc_insertion_point(field_get:chat.DetachedSession.resume)
+  return _internal_resume(index);
 }
-inline void Request::unsafe_arena_set_allocated_get_users(::chat::UserListRequest* get_users) {
-  clear_payload();
-  if (get_users) {
-    set_has_get_users();
-    payload_.get_users_ = get_users;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.get_users)
+inline ::chat::BufferedFrame* DetachedSession::_internal_add_resume() {
+  return _impl_.resume_.Add();
 }
-inline ::chat::UserListRequest* Request::_internal_mutable_get_users() {
-  if (!_internal_has_get_users()) {
-    clear_payload();
-    set_has_get_users();
-    payload_.get_users_ = CreateMaybeMessage< ::chat::UserListRequest >(GetArena());
-  }
-  return payload_.get_users_;
+inline ::chat::BufferedFrame* DetachedSession::add_resume() {
+  ::chat::BufferedFrame* _add = _internal_add_resume();
+  // @@protoc_insertion_point(field_add:chat.DetachedSession.resume)
+  return _add;
 }
-inline ::chat::UserListRequest* Request::mutable_get_users() {
-  // @@protoc_insertion_point(field_mutable:chat.Request.get_users)
-  return _internal_mutable_get_users();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::BufferedFrame >&
+DetachedSession::resume() const {
+  // @@protoc_insertion_point(field_list:chat.DetachedSession.resume)
+  return _impl_.resume_;
 }
 
-// .chat.User unregister_user = 6;
-inline bool Request::_internal_has_unregister_user() const {
-  return payload_case() == kUnregisterUser;
+// int64 registered_at = 10;
+inline void DetachedSession::clear_registered_at() {
+  _impl_.registered_at_ = int64_t{0};
 }
-inline bool Request::has_unregister_user() const {
-  return _internal_has_unregister_user();
+inline int64_t DetachedSession::_internal_registered_at() const {
+  return _impl_.registered_at_;
 }
-inline void Request::set_has_unregister_user() {
-  _oneof_case_[0] = kUnregisterUser;
+inline int64_t DetachedSession::registered_at() const {
+  // @@protoc_insertion_point(field_get:chat.DetachedSession.registered_at)
+  return _internal_registered_at();
 }
-inline void Request::clear_unregister_user() {
-  if (_internal_has_unregister_user()) {
-    if (GetArena() == nullptr) {
-      delete payload_.unregister_user_;
-    }
-    clear_has_payload();
-  }
+inline void DetachedSession::_internal_set_registered_at(int64_t value) {
+  
+  _impl_.registered_at_ = value;
 }
-inline ::chat::User* Request::release_unregister_user() {
-  // @@protoc_insertion_point(field_release:chat.Request.unregister_user)
-  if (_internal_has_unregister_user()) {
-    clear_has_payload();
-      ::chat::User* temp = payload_.unregister_user_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    payload_.unregister_user_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void DetachedSession::set_registered_at(int64_t value) {
+  _internal_set_registered_at(value);
+  // @@protoc_insertion_point(field_set:chat.DetachedSession.registered_at)
 }
-inline const ::chat::User& Request::_internal_unregister_user() const {
-  return _internal_has_unregister_user()
-      ? *payload_.unregister_user_
-      : *reinterpret_cast< ::chat::User*>(&::chat::_User_default_instance_);
+
+// -------------------------------------------------------------------
+
+// HandoffState
+
+// bool has_listener = 1;
+inline void HandoffState::clear_has_listener() {
+  _impl_.has_listener_ = false;
 }
-inline const ::chat::User& Request::unregister_user() const {
-  // @@protoc_insertion_point(field_get:chat.Request.unregister_user)
-  return _internal_unregister_user();
+inline bool HandoffState::_internal_has_listener() const {
+  return _impl_.has_listener_;
 }
-inline ::chat::User* Request::unsafe_arena_release_unregister_user() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.unregister_user)
-  if (_internal_has_unregister_user()) {
-    clear_has_payload();
-    ::chat::User* temp = payload_.unregister_user_;
-    payload_.unregister_user_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline bool HandoffState::has_listener() const {
+  // @@protoc_insertion_point(field_get:chat.HandoffState.has_listener)
+  return _internal_has_listener();
 }
-inline void Request::unsafe_arena_set_allocated_unregister_user(::chat::User* unregister_user) {
-  clear_payload();
-  if (unregister_user) {
-    set_has_unregister_user();
-    payload_.unregister_user_ = unregister_user;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.unregister_user)
+inline void HandoffState::_internal_set_has_listener(bool value) {
+  
+  _impl_.has_listener_ = value;
 }
-inline ::chat::User* Request::_internal_mutable_unregister_user() {
-  if (!_internal_has_unregister_user()) {
-    clear_payload();
-    set_has_unregister_user();
-    payload_.unregister_user_ = CreateMaybeMessage< ::chat::User >(GetArena());
-  }
-  return payload_.unregister_user_;
+inline void HandoffState::set_has_listener(bool value) {
+  _internal_set_has_listener(value);
+  // @@protoc_insertion_point(field_set:chat.HandoffState.has_listener)
+}
+
+// repeated .chat.HandoffSession sessions = 2;
+inline int HandoffState::_internal_sessions_size() const {
+  return _impl_.sessions_.size();
+}
+inline int HandoffState::sessions_size() const {
+  return _internal_sessions_size();
+}
+inline void HandoffState::clear_sessions() {
+  _impl_.sessions_.Clear();
 }
-inline ::chat::User* Request::mutable_unregister_user() {
-  // @@protoc_insertion_point(field_mutable:chat.Request.unregister_user)
-  return _internal_mutable_unregister_user();
+inline ::chat::HandoffSession* HandoffState::mutable_sessions(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.HandoffState.sessions)
+  return _impl_.sessions_.Mutable(index);
 }
-
-inline bool Request::has_payload() const {
-  return payload_case() != PAYLOAD_NOT_SET;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::HandoffSession >*
+HandoffState::mutable_sessions() {
+  // @@protoc_insertion_point(field_mutable_list:chat.HandoffState.sessions)
+  return &_impl_.sessions_;
 }
-inline void Request::clear_has_payload() {
-  _oneof_case_[0] = PAYLOAD_NOT_SET;
+inline const ::chat::HandoffSession& HandoffState::_internal_sessions(int index) const {
+  return _impl_.sessions_.Get(index);
 }
-inline Request::PayloadCase Request::payload_case() const {
-  return Request::PayloadCase(_oneof_case_[0]);
+inline const ::chat::HandoffSession& HandoffState::sessions(int index) const {
+  // @@protoc_insertion_point(field_get:chat.HandoffState.sessions)
+  return _internal_sessions(index);
+}
+inline ::chat::HandoffSession* HandoffState::_internal_add_sessions() {
+  return _impl_.sessions_.Add();
+}
+inline ::chat::HandoffSession* HandoffState::add_sessions() {
+  ::chat::HandoffSession* _add = _internal_add_sessions();
+  // @@protoc_insertion_point(field_add:chat.HandoffState.sessions)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::HandoffSession >&
+HandoffState::sessions() const {
+  // @@protoc_insertion_point(field_list:chat.HandoffState.sessions)
+  return _impl_.sessions_;
 }
-// -------------------------------------------------------------------
-
-// Response
 
-// .chat.Operation operation = 1;
-inline void Response::clear_operation() {
-  operation_ = 0;
+// bool last = 3;
+inline void HandoffState::clear_last() {
+  _impl_.last_ = false;
 }
-inline ::chat::Operation Response::_internal_operation() const {
-  return static_cast< ::chat::Operation >(operation_);
+inline bool HandoffState::_internal_last() const {
+  return _impl_.last_;
 }
-inline ::chat::Operation Response::operation() const {
-  // @@protoc_insertion_point(field_get:chat.Response.operation)
-  return _internal_operation();
+inline bool HandoffState::last() const {
+  // @@protoc_insertion_point(field_get:chat.HandoffState.last)
+  return _internal_last();
 }
-inline void Response::_internal_set_operation(::chat::Operation value) {
+inline void HandoffState::_internal_set_last(bool value) {
   
-  operation_ = value;
+  _impl_.last_ = value;
 }
-inline void Response::set_operation(::chat::Operation value) {
-  _internal_set_operation(value);
-  // @@protoc_insertion_point(field_set:chat.Response.operation)
+inline void HandoffState::set_last(bool value) {
+  _internal_set_last(value);
+  // @@protoc_insertion_point(field_set:chat.HandoffState.last)
 }
 
-// .chat.StatusCode status_code = 2;
-inline void Response::clear_status_code() {
-  status_code_ = 0;
+// uint64 next_seq = 4;
+inline void HandoffState::clear_next_seq() {
+  _impl_.next_seq_ = uint64_t{0u};
 }
-inline ::chat::StatusCode Response::_internal_status_code() const {
-  return static_cast< ::chat::StatusCode >(status_code_);
+inline uint64_t HandoffState::_internal_next_seq() const {
+  return _impl_.next_seq_;
 }
-inline ::chat::StatusCode Response::status_code() const {
-  // @@protoc_insertion_point(field_get:chat.Response.status_code)
-  return _internal_status_code();
+inline uint64_t HandoffState::next_seq() const {
+  // @@protoc_insertion_point(field_get:chat.HandoffState.next_seq)
+  return _internal_next_seq();
 }
-inline void Response::_internal_set_status_code(::chat::StatusCode value) {
+inline void HandoffState::_internal_set_next_seq(uint64_t value) {
   
-  status_code_ = value;
+  _impl_.next_seq_ = value;
 }
-inline void Response::set_status_code(::chat::StatusCode value) {
-  _internal_set_status_code(value);
-  // @@protoc_insertion_point(field_set:chat.Response.status_code)
+inline void HandoffState::set_next_seq(uint64_t value) {
+  _internal_set_next_seq(value);
+  // @@protoc_insertion_point(field_set:chat.HandoffState.next_seq)
 }
 
-// string message = 3;
-inline void Response::clear_message() {
-  message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// repeated .chat.DetachedSession detached = 5;
+inline int HandoffState::_internal_detached_size() const {
+  return _impl_.detached_.size();
 }
-inline const std::string& Response::message() const {
-  // @@protoc_insertion_point(field_get:chat.Response.message)
-  return _internal_message();
+inline int HandoffState::detached_size() const {
+  return _internal_detached_size();
 }
-inline void Response::set_message(const std::string& value) {
-  _internal_set_message(value);
-  // @@protoc_insertion_point(field_set:chat.Response.message)
+inline void HandoffState::clear_detached() {
+  _impl_.detached_.Clear();
 }
-inline std::string* Response::mutable_message() {
-  // @@protoc_insertion_point(field_mutable:chat.Response.message)
-  return _internal_mutable_message();
+inline ::chat::DetachedSession* HandoffState::mutable_detached(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.HandoffState.detached)
+  return _impl_.detached_.Mutable(index);
 }
-inline const std::string& Response::_internal_message() const {
-  return message_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::DetachedSession >*
+HandoffState::mutable_detached() {
+  // @@protoc_insertion_point(field_mutable_list:chat.HandoffState.detached)
+  return &_impl_.detached_;
 }
-inline void Response::_internal_set_message(const std::string& value) {
-  
-  message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::chat::DetachedSession& HandoffState::_internal_detached(int index) const {
+  return _impl_.detached_.Get(index);
 }
-inline void Response::set_message(std::string&& value) {
-  
-  message_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.Response.message)
+inline const ::chat::DetachedSession& HandoffState::detached(int index) const {
+  // @@protoc_insertion_point(field_get:chat.HandoffState.detached)
+  return _internal_detached(index);
 }
-inline void Response::set_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.Response.message)
+inline ::chat::DetachedSession* HandoffState::_internal_add_detached() {
+  return _impl_.detached_.Add();
+}
+inline ::chat::DetachedSession* HandoffState::add_detached() {
+  ::chat::DetachedSession* _add = _internal_add_detached();
+  // @@protoc_insertion_point(field_add:chat.HandoffState.detached)
+  return _add;
 }
-inline void Response::set_message(const char* value,
-    size_t size) {
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::DetachedSession >&
+HandoffState::detached() const {
+  // @@protoc_insertion_point(field_list:chat.HandoffState.detached)
+  return _impl_.detached_;
+}
+
+// -------------------------------------------------------------------
+
+// SnapshotUser
+
+// string username = 1;
+inline void SnapshotUser::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& SnapshotUser::username() const {
+  // @@protoc_insertion_point(field_get:chat.SnapshotUser.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SnapshotUser::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.SnapshotUser.username)
+}
+inline std::string* SnapshotUser::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.SnapshotUser.username)
+  return _s;
+}
+inline const std::string& SnapshotUser::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void SnapshotUser::_internal_set_username(const std::string& value) {
   
-  message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.Response.message)
+  _impl_.username_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Response::_internal_mutable_message() {
+inline std::string* SnapshotUser::_internal_mutable_username() {
   
-  return message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.username_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Response::release_message() {
-  // @@protoc_insertion_point(field_release:chat.Response.message)
-  return message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* SnapshotUser::release_username() {
+  // @@protoc_insertion_point(field_release:chat.SnapshotUser.username)
+  return _impl_.username_.Release();
 }
-inline void Response::set_allocated_message(std::string* message) {
-  if (message != nullptr) {
+inline void SnapshotUser::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
     
   } else {
     
   }
-  message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.Response.message)
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.SnapshotUser.username)
+}
+
+// string ip = 2;
+inline void SnapshotUser::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
+}
+inline const std::string& SnapshotUser::ip() const {
+  // @@protoc_insertion_point(field_get:chat.SnapshotUser.ip)
+  return _internal_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SnapshotUser::set_ip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.SnapshotUser.ip)
 }
-inline std::string* Response::unsafe_arena_release_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.message)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline std::string* SnapshotUser::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:chat.SnapshotUser.ip)
+  return _s;
+}
+inline const std::string& SnapshotUser::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void SnapshotUser::_internal_set_ip(const std::string& value) {
   
-  return message_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  _impl_.ip_.Set(value, GetArenaForAllocation());
 }
-inline void Response::unsafe_arena_set_allocated_message(
-    std::string* message) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (message != nullptr) {
+inline std::string* SnapshotUser::_internal_mutable_ip() {
+  
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SnapshotUser::release_ip() {
+  // @@protoc_insertion_point(field_release:chat.SnapshotUser.ip)
+  return _impl_.ip_.Release();
+}
+inline void SnapshotUser::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
     
   } else {
     
   }
-  message_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      message, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.message)
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.SnapshotUser.ip)
 }
 
-// .chat.UserListResponse user_list = 4;
-inline bool Response::_internal_has_user_list() const {
-  return result_case() == kUserList;
-}
-inline bool Response::has_user_list() const {
-  return _internal_has_user_list();
+// .chat.UserStatus status = 3;
+inline void SnapshotUser::clear_status() {
+  _impl_.status_ = 0;
 }
-inline void Response::set_has_user_list() {
-  _oneof_case_[0] = kUserList;
+inline ::chat::UserStatus SnapshotUser::_internal_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.status_);
 }
-inline void Response::clear_user_list() {
-  if (_internal_has_user_list()) {
-    if (GetArena() == nullptr) {
-      delete result_.user_list_;
-    }
-    clear_has_result();
-  }
+inline ::chat::UserStatus SnapshotUser::status() const {
+  // @@protoc_insertion_point(field_get:chat.SnapshotUser.status)
+  return _internal_status();
 }
-inline ::chat::UserListResponse* Response::release_user_list() {
-  // @@protoc_insertion_point(field_release:chat.Response.user_list)
-  if (_internal_has_user_list()) {
-    clear_has_result();
-      ::chat::UserListResponse* temp = result_.user_list_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    result_.user_list_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void SnapshotUser::_internal_set_status(::chat::UserStatus value) {
+  
+  _impl_.status_ = value;
 }
-inline const ::chat::UserListResponse& Response::_internal_user_list() const {
-  return _internal_has_user_list()
-      ? *result_.user_list_
-      : *reinterpret_cast< ::chat::UserListResponse*>(&::chat::_UserListResponse_default_instance_);
+inline void SnapshotUser::set_status(::chat::UserStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:chat.SnapshotUser.status)
 }
-inline const ::chat::UserListResponse& Response::user_list() const {
-  // @@protoc_insertion_point(field_get:chat.Response.user_list)
-  return _internal_user_list();
+
+// int64 last_active = 4;
+inline void SnapshotUser::clear_last_active() {
+  _impl_.last_active_ = int64_t{0};
 }
-inline ::chat::UserListResponse* Response::unsafe_arena_release_user_list() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.user_list)
-  if (_internal_has_user_list()) {
-    clear_has_result();
-    ::chat::UserListResponse* temp = result_.user_list_;
-    result_.user_list_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline int64_t SnapshotUser::_internal_last_active() const {
+  return _impl_.last_active_;
 }
-inline void Response::unsafe_arena_set_allocated_user_list(::chat::UserListResponse* user_list) {
-  clear_result();
-  if (user_list) {
-    set_has_user_list();
-    result_.user_list_ = user_list;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.user_list)
+inline int64_t SnapshotUser::last_active() const {
+  // @@protoc_insertion_point(field_get:chat.SnapshotUser.last_active)
+  return _internal_last_active();
 }
-inline ::chat::UserListResponse* Response::_internal_mutable_user_list() {
-  if (!_internal_has_user_list()) {
-    clear_result();
-    set_has_user_list();
-    result_.user_list_ = CreateMaybeMessage< ::chat::UserListResponse >(GetArena());
-  }
-  return result_.user_list_;
+inline void SnapshotUser::_internal_set_last_active(int64_t value) {
+  
+  _impl_.last_active_ = value;
 }
-inline ::chat::UserListResponse* Response::mutable_user_list() {
-  // @@protoc_insertion_point(field_mutable:chat.Response.user_list)
-  return _internal_mutable_user_list();
+inline void SnapshotUser::set_last_active(int64_t value) {
+  _internal_set_last_active(value);
+  // @@protoc_insertion_point(field_set:chat.SnapshotUser.last_active)
 }
 
-// .chat.IncomingMessageResponse incoming_message = 5;
-inline bool Response::_internal_has_incoming_message() const {
-  return result_case() == kIncomingMessage;
+// repeated string rooms = 5;
+inline int SnapshotUser::_internal_rooms_size() const {
+  return _impl_.rooms_.size();
 }
-inline bool Response::has_incoming_message() const {
-  return _internal_has_incoming_message();
+inline int SnapshotUser::rooms_size() const {
+  return _internal_rooms_size();
 }
-inline void Response::set_has_incoming_message() {
-  _oneof_case_[0] = kIncomingMessage;
+inline void SnapshotUser::clear_rooms() {
+  _impl_.rooms_.Clear();
 }
-inline void Response::clear_incoming_message() {
-  if (_internal_has_incoming_message()) {
-    if (GetArena() == nullptr) {
-      delete result_.incoming_message_;
-    }
-    clear_has_result();
-  }
+inline std::string* SnapshotUser::add_rooms() {
+  std::string* _s = _internal_add_rooms();
+  // @@protoc_insertion_point(field_add_mutable:chat.SnapshotUser.rooms)
+  return _s;
 }
-inline ::chat::IncomingMessageResponse* Response::release_incoming_message() {
-  // @@protoc_insertion_point(field_release:chat.Response.incoming_message)
-  if (_internal_has_incoming_message()) {
-    clear_has_result();
-      ::chat::IncomingMessageResponse* temp = result_.incoming_message_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    result_.incoming_message_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline const std::string& SnapshotUser::_internal_rooms(int index) const {
+  return _impl_.rooms_.Get(index);
 }
-inline const ::chat::IncomingMessageResponse& Response::_internal_incoming_message() const {
-  return _internal_has_incoming_message()
-      ? *result_.incoming_message_
-      : *reinterpret_cast< ::chat::IncomingMessageResponse*>(&::chat::_IncomingMessageResponse_default_instance_);
+inline const std::string& SnapshotUser::rooms(int index) const {
+  // @@protoc_insertion_point(field_get:chat.SnapshotUser.rooms)
+  return _internal_rooms(index);
 }
-inline const ::chat::IncomingMessageResponse& Response::incoming_message() const {
-  // @@protoc_insertion_point(field_get:chat.Response.incoming_message)
-  return _internal_incoming_message();
+inline std::string* SnapshotUser::mutable_rooms(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.SnapshotUser.rooms)
+  return _impl_.rooms_.Mutable(index);
 }
-inline ::chat::IncomingMessageResponse* Response::unsafe_arena_release_incoming_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.incoming_message)
-  if (_internal_has_incoming_message()) {
-    clear_has_result();
-    ::chat::IncomingMessageResponse* temp = result_.incoming_message_;
-    result_.incoming_message_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void SnapshotUser::set_rooms(int index, const std::string& value) {
+  _impl_.rooms_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:chat.SnapshotUser.rooms)
 }
-inline void Response::unsafe_arena_set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message) {
-  clear_result();
-  if (incoming_message) {
-    set_has_incoming_message();
-    result_.incoming_message_ = incoming_message;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.incoming_message)
+inline void SnapshotUser::set_rooms(int index, std::string&& value) {
+  _impl_.rooms_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:chat.SnapshotUser.rooms)
 }
-inline ::chat::IncomingMessageResponse* Response::_internal_mutable_incoming_message() {
-  if (!_internal_has_incoming_message()) {
-    clear_result();
-    set_has_incoming_message();
-    result_.incoming_message_ = CreateMaybeMessage< ::chat::IncomingMessageResponse >(GetArena());
-  }
-  return result_.incoming_message_;
+inline void SnapshotUser::set_rooms(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.rooms_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:chat.SnapshotUser.rooms)
 }
-inline ::chat::IncomingMessageResponse* Response::mutable_incoming_message() {
-  // @@protoc_insertion_point(field_mutable:chat.Response.incoming_message)
-  return _internal_mutable_incoming_message();
+inline void SnapshotUser::set_rooms(int index, const char* value, size_t size) {
+  _impl_.rooms_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:chat.SnapshotUser.rooms)
+}
+inline std::string* SnapshotUser::_internal_add_rooms() {
+  return _impl_.rooms_.Add();
+}
+inline void SnapshotUser::add_rooms(const std::string& value) {
+  _impl_.rooms_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:chat.SnapshotUser.rooms)
+}
+inline void SnapshotUser::add_rooms(std::string&& value) {
+  _impl_.rooms_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:chat.SnapshotUser.rooms)
+}
+inline void SnapshotUser::add_rooms(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.rooms_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:chat.SnapshotUser.rooms)
+}
+inline void SnapshotUser::add_rooms(const char* value, size_t size) {
+  _impl_.rooms_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:chat.SnapshotUser.rooms)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SnapshotUser::rooms() const {
+  // @@protoc_insertion_point(field_list:chat.SnapshotUser.rooms)
+  return _impl_.rooms_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SnapshotUser::mutable_rooms() {
+  // @@protoc_insertion_point(field_mutable_list:chat.SnapshotUser.rooms)
+  return &_impl_.rooms_;
 }
 
-inline bool Response::has_result() const {
-  return result_case() != RESULT_NOT_SET;
+// -------------------------------------------------------------------
+
+// ServerSnapshot
+
+// int64 taken_at = 1;
+inline void ServerSnapshot::clear_taken_at() {
+  _impl_.taken_at_ = int64_t{0};
 }
-inline void Response::clear_has_result() {
-  _oneof_case_[0] = RESULT_NOT_SET;
+inline int64_t ServerSnapshot::_internal_taken_at() const {
+  return _impl_.taken_at_;
 }
-inline Response::ResultCase Response::result_case() const {
-  return Response::ResultCase(_oneof_case_[0]);
+inline int64_t ServerSnapshot::taken_at() const {
+  // @@protoc_insertion_point(field_get:chat.ServerSnapshot.taken_at)
+  return _internal_taken_at();
+}
+inline void ServerSnapshot::_internal_set_taken_at(int64_t value) {
+  
+  _impl_.taken_at_ = value;
+}
+inline void ServerSnapshot::set_taken_at(int64_t value) {
+  _internal_set_taken_at(value);
+  // @@protoc_insertion_point(field_set:chat.ServerSnapshot.taken_at)
+}
+
+// repeated .chat.SnapshotUser users = 2;
+inline int ServerSnapshot::_internal_users_size() const {
+  return _impl_.users_.size();
+}
+inline int ServerSnapshot::users_size() const {
+  return _internal_users_size();
+}
+inline void ServerSnapshot::clear_users() {
+  _impl_.users_.Clear();
+}
+inline ::chat::SnapshotUser* ServerSnapshot::mutable_users(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.ServerSnapshot.users)
+  return _impl_.users_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::SnapshotUser >*
+ServerSnapshot::mutable_users() {
+  // @@protoc_insertion_point(field_mutable_list:chat.ServerSnapshot.users)
+  return &_impl_.users_;
+}
+inline const ::chat::SnapshotUser& ServerSnapshot::_internal_users(int index) const {
+  return _impl_.users_.Get(index);
+}
+inline const ::chat::SnapshotUser& ServerSnapshot::users(int index) const {
+  // @@protoc_insertion_point(field_get:chat.ServerSnapshot.users)
+  return _internal_users(index);
 }
+inline ::chat::SnapshotUser* ServerSnapshot::_internal_add_users() {
+  return _impl_.users_.Add();
+}
+inline ::chat::SnapshotUser* ServerSnapshot::add_users() {
+  ::chat::SnapshotUser* _add = _internal_add_users();
+  // @@protoc_insertion_point(field_add:chat.ServerSnapshot.users)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::SnapshotUser >&
+ServerSnapshot::users() const {
+  // @@protoc_insertion_point(field_list:chat.ServerSnapshot.users)
+  return _impl_.users_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -3384,6 +11241,44 @@ inline Response::ResultCase Response::result_case() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -3396,6 +11291,16 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::chat::UserStatus>() {
   return ::chat::UserStatus_descriptor();
 }
+template <> struct is_proto_enum< ::chat::FlushPolicy> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::FlushPolicy>() {
+  return ::chat::FlushPolicy_descriptor();
+}
+template <> struct is_proto_enum< ::chat::Compression> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::Compression>() {
+  return ::chat::Compression_descriptor();
+}
 template <> struct is_proto_enum< ::chat::MessageType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::chat::MessageType>() {
@@ -3416,6 +11321,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::chat::StatusCode>() {
   return ::chat::StatusCode_descriptor();
 }
+template <> struct is_proto_enum< ::chat::PeerOperation> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::PeerOperation>() {
+  return ::chat::PeerOperation_descriptor();
+}
 
 PROTOBUF_NAMESPACE_CLOSE
 
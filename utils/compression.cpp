@@ -0,0 +1,117 @@
+// compression.cpp
+#include "compression.h"
+#include "metrics.h"
+#include <ctime> // For clock_gettime
+#include <zlib.h>
+
+// Both sides must use the same bytes, changing them needs a new Compression value in chat.proto.
+// zlib finds matches closer to the end faster, so the most common strings go last.
+static const char DICTIONARY[] =
+    "history page fetched successfully.all users fetched successfully.room name is required."
+    "user not found or already unregistered.user not registered or username mismatch."
+    "rate limit exceeded, retry later.server busy, try again later.status updated successfully."
+    "ONLINE BUSY OFFLINE the and you that have for not with this but from they what about "
+    "there when your can just like know will would time some them could hola que para por como "
+    "pero con una los las del esta est\xc3\xa1 bien gracias s\xc3\xad no ya "
+    "http://https://www..com .org .net ```\n"
+    "Room message sent successfully.Room message incoming.Broadcast message sent successfully."
+    "Broadcast message incoming.User fetched successfully.Recipient not found."
+    "Message sent successfully.Message incoming.User not registered.";
+
+static const Bytef *dictionary_bytes = reinterpret_cast<const Bytef *>(DICTIONARY);
+static const uInt dictionary_size = sizeof(DICTIONARY) - 1;
+
+static uint64_t thread_cpu_ns()
+{
+  timespec now;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+  return static_cast<uint64_t>(now.tv_sec) * 1000000000 + now.tv_nsec;
+}
+
+/**
+ * zlib streams are costly to set up, each thread initializes one pair and resets it per payload
+ */
+struct ZlibStreams
+{
+  z_stream deflater{};
+  z_stream inflater{};
+  bool ready = false;
+
+  ZlibStreams()
+  {
+    ready = deflateInit2(&deflater, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) == Z_OK &&
+            inflateInit2(&inflater, -15) == Z_OK;
+  }
+
+  ~ZlibStreams()
+  {
+    deflateEnd(&deflater);
+    inflateEnd(&inflater);
+  }
+};
+
+static thread_local ZlibStreams streams;
+
+bool compress_payload(const char *data, size_t size, std::string &output)
+{
+  static Metric &bytes_in = metric("compression.bytes_in");
+  static Metric &bytes_out = metric("compression.bytes_out");
+  static Metric &ratio = metric("compression.percent_of_original");
+  static Metric &cpu = metric("compression.cpu_ns");
+  static Metric &skipped = metric("compression.skipped");
+
+  if (!streams.ready)
+    return false;
+
+  uint64_t started = thread_cpu_ns();
+  z_stream &stream = streams.deflater;
+  deflateReset(&stream);
+  deflateSetDictionary(&stream, dictionary_bytes, dictionary_size);
+
+  // Anything past size would not be worth sending compressed
+  output.resize(size);
+  stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+  stream.avail_in = static_cast<uInt>(size);
+  stream.next_out = reinterpret_cast<Bytef *>(&output[0]);
+  stream.avail_out = static_cast<uInt>(size);
+  int result = deflate(&stream, Z_FINISH);
+  cpu.observe(thread_cpu_ns() - started);
+
+  if (result != Z_STREAM_END)
+  {
+    skipped.add();
+    return false;
+  }
+  output.resize(size - stream.avail_out);
+  bytes_in.add(size);
+  bytes_out.add(output.size());
+  ratio.observe(output.size() * 100 / size);
+  return true;
+}
+
+bool decompress_payload(const char *data, size_t size, size_t max_size, std::string &output)
+{
+  static Metric &cpu = metric("decompression.cpu_ns");
+
+  if (!streams.ready)
+    return false;
+
+  uint64_t started = thread_cpu_ns();
+  z_stream &stream = streams.inflater;
+  inflateReset(&stream);
+  inflateSetDictionary(&stream, dictionary_bytes, dictionary_size);
+
+  // One byte of room past max_size tells an oversized payload from one that fits exactly
+  output.resize(max_size + 1);
+  stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+  stream.avail_in = static_cast<uInt>(size);
+  stream.next_out = reinterpret_cast<Bytef *>(&output[0]);
+  stream.avail_out = static_cast<uInt>(output.size());
+  int result = inflate(&stream, Z_FINISH);
+  cpu.observe(thread_cpu_ns() - started);
+
+  if (result != Z_STREAM_END || stream.avail_out == 0)
+    return false;
+  output.resize(output.size() - stream.avail_out);
+  return true;
+}
@@ -0,0 +1,21 @@
+// compression.h
+#ifndef COMPRESSION_H
+#define COMPRESSION_H
+
+#include <string>
+#include <cstddef> // For size_t
+
+/**
+ * Frame payload codec: raw deflate primed with a preset dictionary of chat text and the
+ * server's usual replies, so even short frames find matches. Every payload is compressed
+ * on its own (no state across frames) so a fan-out frame can be compressed once for all
+ * its recipients. Each thread keeps its own zlib streams.
+ */
+
+// Compresses a payload, returns false when it did not get smaller (send it as it is)
+bool compress_payload(const char *data, size_t size, std::string &output);
+
+// Inflates a payload, failing on corrupt input or output larger than max_size
+bool decompress_payload(const char *data, size_t size, size_t max_size, std::string &output);
+
+#endif // COMPRESSION_H
@@ -3,6 +3,7 @@
 #define CONSTANTS_H
 
 #include <sys/types.h> // For ssize_t
+#include <cstdint>     // For uint32_t
 
 // Boolean flag for handling UNIQUE IP
 constexpr bool HANDLE_UNIQUE_IP = false;
@@ -16,4 +17,166 @@ constexpr size_t BUFFER_SIZE = 64 * 1024; // This is 64 KB
 // Indicating if using verbose mode
 constexpr bool VERBOSE = false;
 
+// Size of the length prefix written before every protobuf frame
+constexpr size_t FRAME_HEADER_SIZE = sizeof(uint32_t);
+
+// File where relayed messages are persisted for GET_HISTORY
+constexpr const char *HISTORY_FILE = "chat_history.log";
+
+// Every N messages of a conversation a (timestamp, position) mark is kept for range lookups
+constexpr size_t HISTORY_INDEX_STRIDE = 64;
+
+// Messages returned when GET_HISTORY does not specify a limit, and the hard maximum
+constexpr size_t HISTORY_DEFAULT_LIMIT = 100;
+constexpr size_t HISTORY_MAX_LIMIT = 1000;
+
+// Maximum messages per history page, pages also stay below half the buffer size
+constexpr size_t HISTORY_PAGE_SIZE = 50;
+
+// Seconds between attempts to (re)connect to a federation peer
+constexpr int PEER_RETRY_SECONDS = 2;
+
+// Points every node gets on the consistent hashing ring that assigns users a home node
+constexpr int HASH_RING_VIRTUAL_NODES = 128;
+
+// Presence gossip: milliseconds between rounds, peers contacted per round and entries per message
+constexpr int GOSSIP_INTERVAL_MS = 200;
+constexpr int GOSSIP_FANOUT = 2;
+constexpr int GOSSIP_MAX_ENTRIES = 256;
+
+// Rounds a changed presence entry is pushed before it is left to anti-entropy
+constexpr int GOSSIP_RUMOR_ROUNDS = 4;
+
+// Seconds a disconnected user is remembered, so the disconnect reaches every node
+constexpr int PRESENCE_TOMBSTONE_SECONDS = 60;
+
+// Per user token buckets: sustained requests per second and burst, by kind of operation
+constexpr uint32_t RATE_MESSAGES_PER_SECOND = 20;
+constexpr uint32_t RATE_MESSAGES_BURST = 40;
+constexpr uint32_t RATE_QUERIES_PER_SECOND = 5;
+constexpr uint32_t RATE_QUERIES_BURST = 10;
+constexpr uint32_t RATE_OTHER_PER_SECOND = 5;
+constexpr uint32_t RATE_OTHER_BURST = 10;
+
+// ACKNOWLEDGE has its own bucket, outside the IP one; acks over it are dropped without a reply
+constexpr uint32_t RATE_ACKS_PER_SECOND = 100;
+constexpr uint32_t RATE_ACKS_BURST = 200;
+
+// Token bucket shared by all the connections of one IP, over every operation
+constexpr uint32_t RATE_IP_PER_SECOND = 100;
+constexpr uint32_t RATE_IP_BURST = 200;
+
+// Over-limit requests that would get a token within this many milliseconds are delayed instead of rejected
+constexpr int RATE_MAX_DELAY_MS = 50;
+
+// Admission control: open connections and connections not registered yet, globally and per IP
+constexpr int MAX_CONNECTIONS = 4096;
+constexpr int MAX_CONNECTIONS_PER_IP = 64;
+constexpr int MAX_HANDSHAKES = 256;
+constexpr int MAX_HANDSHAKES_PER_IP = 16;
+
+// Seconds a new connection has to register before it is dropped
+constexpr int HANDSHAKE_TIMEOUT_SECONDS = 10;
+
+// Pending connections queued by the kernel, and connections taken per wake up of the accept loop
+constexpr int LISTEN_BACKLOG = 1024;
+constexpr int ACCEPT_BATCH_SIZE = 64;
+
+// Server threads: I/O threads parse frames, workers run the handlers (0 means one per core)
+constexpr int IO_THREADS = 2;
+constexpr int WORKER_THREADS = 0;
+constexpr int IO_EVENTS_PER_WAIT = 64;
+
+// Requests of one connection a worker runs before yielding to other connections
+constexpr int STRAND_BATCH = 16;
+
+// Milliseconds a send waits for a slow reader before the frame is dropped
+constexpr int SEND_TIMEOUT_MS = 5000;
+
+// A session reported writable that still cannot start its frame retries after this many milliseconds
+constexpr int SEND_STALL_RETRY_MS = 5;
+
+// Number of locks sockets are spread over to serialize their outgoing frames
+constexpr int SEND_LOCK_STRIPES = 64;
+
+// Drain mode: seconds the sessions get to finish before the server exits anyway, and the
+// window the clients are told to spread their reconnects over
+constexpr int DRAIN_TIMEOUT_SECONDS = 10;
+constexpr uint32_t DRAIN_RECONNECT_SPREAD_MS = 5000;
+
+// Hot restart: sessions per handoff chunk (each carries one descriptor, SCM_RIGHTS takes at most 253)
+// and seconds the old process waits for in-flight requests before handing the sessions over
+constexpr int HANDOFF_CHUNK_SESSIONS = 200;
+constexpr int HANDOFF_QUIESCE_SECONDS = 5;
+
+// State snapshots: file (prefixed with the server name), seconds between snapshots and the
+// age after which a snapshot is too old to restore from
+constexpr const char *SNAPSHOT_FILE = "snapshot.bin";
+constexpr int SNAPSHOT_INTERVAL_SECONDS = 30;
+constexpr int SNAPSHOT_MAX_AGE_SECONDS = 600;
+
+// Batching: most requests the server takes in one BATCH frame, and the window and size
+// the client coalesces its outgoing messages with
+constexpr int BATCH_MAX_REQUESTS = 256;
+constexpr int CLIENT_BATCH_WINDOW_US = 2000;
+constexpr size_t CLIENT_BATCH_MAX_REQUESTS = 64;
+
+// Flush policy: microseconds a corked socket gathers frames before they are pushed out, and the
+// gap under which an adaptive connection treats consecutive frames as a burst
+constexpr int FLUSH_COALESCE_BUDGET_US = 500;
+constexpr int FLUSH_BURST_GAP_US = 200;
+
+// Frame header bit set when the payload is compressed, the rest of the header is the wire length
+constexpr uint32_t FRAME_COMPRESSED = 0x80000000u;
+
+// Whether the server accepts clients asking for compression, and payload bytes from which frames to a connection that negotiated compression are deflated
+constexpr bool COMPRESSION_ENABLED = true;
+constexpr size_t COMPRESSION_THRESHOLD = 256;
+
+// Chunked transfers: header bit of chunk frames, largest message, bytes per chunk, and messages
+// and bytes one connection may have half received at once
+constexpr uint32_t FRAME_CHUNK = 0x40000000u;
+constexpr size_t MAX_MESSAGE_SIZE = 4 * 1024 * 1024; // This is 4 MB
+constexpr size_t TRANSFER_CHUNK_SIZE = 16 * 1024;
+constexpr size_t MAX_CHUNKED_TRANSFERS = 4;
+constexpr size_t MAX_CHUNKED_BYTES = MAX_MESSAGE_SIZE;
+
+// Whether clients may ask for compact messages, where known senders travel as a numeric id
+constexpr bool COMPACT_MESSAGES_ENABLED = true;
+
+// Whether the I/O threads dispatch SEND_MESSAGE from its wire bytes, without a full parse
+constexpr bool HEADER_PEEK_ENABLED = true;
+
+// Slab pools: bytes carved at a time for a size class, and free blocks a thread trades with the shared list at once
+constexpr size_t POOL_SLAB_BYTES = 64 * 1024;
+constexpr uint32_t POOL_CACHE_BATCH = 32;
+
+// Delivery receipts: direct messages tracked at once (24 bytes each, older unacknowledged ones are
+// forgotten), lock stripes over them, and how often the acknowledged ones go out to their senders
+constexpr size_t RECEIPT_TRACKING_SLOTS = 1 << 20;
+constexpr size_t RECEIPT_LOCK_STRIPES = 64;
+constexpr int RECEIPT_FLUSH_MS = 50;
+
+// Resumable sessions: how long a dropped session waits for its client, and the notifications kept
+// for a resume, at most RESUME_BUFFER_FRAMES and, while the client is connected, RESUME_BUFFER_MS old
+constexpr int RESUME_GRACE_MS = 30000;
+constexpr size_t RESUME_BUFFER_FRAMES = 256;
+constexpr int RESUME_BUFFER_MS = 10000;
+
+// Notifications a client receives before it tells the server, with no other acknowledgement to send
+constexpr size_t RESUME_ACK_FRAMES = 32;
+
+// Client reconnects: backoff ceiling of the first attempt (doubled on each one, up to the max),
+// attempts before giving up, and requests kept for the new connection meanwhile
+constexpr uint32_t CLIENT_RECONNECT_BASE_MS = 250;
+constexpr uint32_t CLIENT_RECONNECT_MAX_MS = 8000;
+constexpr int CLIENT_RECONNECT_ATTEMPTS = 12;
+constexpr size_t CLIENT_OFFLINE_REQUESTS = 256;
+
+// Incoming notifications a client holds while the user types a command, newer ones are dropped past it
+constexpr size_t CLIENT_INBOX_SIZE = 1024;
+
+// Script mode: how long the client waits for the replies of the last commands before its report
+constexpr int SCRIPT_REPLY_TIMEOUT_MS = 10000;
+
 #endif // CONSTANTS_H
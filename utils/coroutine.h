@@ -0,0 +1,33 @@
+// coroutine.h
+#ifndef COROUTINE_H
+#define COROUTINE_H
+
+#include <coroutine> // For std::coroutine_handle, std::suspend_always
+#include <exception> // For std::terminate
+#include <cstddef>   // For size_t
+#include "pool.h"
+
+/**
+ * Fire and forget coroutine. It starts suspended so the caller decides where it first
+ * runs (resume DetachedTask::handle), and its frame frees itself when it returns.
+ * Exceptions must be handled inside the coroutine, an escaping one terminates.
+ * Frames come from the slab pools, a connection's session reuses the one of an earlier one.
+ */
+struct DetachedTask
+{
+  struct promise_type
+  {
+    DetachedTask get_return_object() { return {std::coroutine_handle<promise_type>::from_promise(*this)}; }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+
+    static void *operator new(size_t size) { return pool_allocate(size); }
+    static void operator delete(void *frame, size_t size) { pool_free(frame, size); }
+  };
+
+  std::coroutine_handle<promise_type> handle;
+};
+
+#endif // COROUTINE_H
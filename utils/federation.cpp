@@ -0,0 +1,522 @@
+// federation.cpp
+#include "federation.h"
+#include "message.h"
+#include "metrics.h"
+#include <iostream>     // For std::cout, std::cerr
+#include <thread>       // For std::thread
+#include <chrono>       // For std::chrono
+#include <random>       // For std::mt19937
+#include <algorithm>    // For std::shuffle
+#include <cstring>      // For strerror
+#include <unistd.h>     // For close
+#include <arpa/inet.h>  // For inet_pton
+#include <netinet/in.h> // For sockaddr_in
+
+/**
+ * Opens the cluster port and starts dialing the configured peers
+ */
+bool Federation::start(const std::string &node_name, int cluster_port, const std::vector<std::string> &peers, const FederationHandlers &federation_handlers)
+{
+  node = node_name;
+  handlers = federation_handlers;
+
+  cluster_fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (cluster_fd < 0)
+  {
+    perror("Cluster socket creation failed");
+    return false;
+  }
+
+  int opt = 1;
+  setsockopt(cluster_fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+
+  sockaddr_in address;
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = INADDR_ANY;
+  address.sin_port = htons(cluster_port);
+
+  if (bind(cluster_fd, (struct sockaddr *)&address, sizeof(address)) < 0 || listen(cluster_fd, 10) < 0)
+  {
+    perror("Cluster bind failed");
+    close(cluster_fd);
+    return false;
+  }
+
+  ring.add_node(node);
+  running = true;
+  std::cout << "Node " << node << " listening for peers on port " << cluster_port << std::endl;
+
+  std::thread(&Federation::accept_loop, this).detach();
+  std::thread(&Federation::gossip_loop, this).detach();
+  for (const auto &peer : peers)
+  {
+    std::thread(&Federation::dial_loop, this, peer).detach();
+  }
+  return true;
+}
+
+/**
+ * Leaves the cluster: the links and the cluster socket are shut down, so peers see the node
+ * go and no more messages are taken from them. Their threads return on their own.
+ */
+void Federation::stop()
+{
+  if (!running.exchange(false))
+    return;
+  shutdown(cluster_fd, SHUT_RDWR);
+  std::lock_guard<std::mutex> lock(federation_mutex);
+  for (const auto &entry : links)
+    shutdown(entry.second->sock, SHUT_RDWR);
+}
+
+/**
+ * Records a change of a local user, the next gossip rounds spread it
+ */
+void Federation::publish_presence(const std::string &username, chat::UserStatus status, bool connected)
+{
+  if (!running)
+    return;
+  presence.set_local(node, username, status, connected);
+}
+
+/**
+ * Records where a local user is connected on the user's home node
+ */
+void Federation::publish_location(const std::string &username, bool connected)
+{
+  if (!running)
+    return;
+
+  std::shared_ptr<PeerLink> link;
+  {
+    std::lock_guard<std::mutex> lock(federation_mutex);
+    const std::string &home = ring.node_for(username);
+    if (home == node)
+    {
+      if (connected)
+        directory[username] = node;
+      else
+        directory.erase(username);
+      return;
+    }
+    auto it = links.find(home);
+    if (it == links.end())
+      return;
+    link = it->second;
+  }
+
+  chat::PeerMessage message;
+  message.set_operation(chat::PeerOperation::PEER_LOCATION);
+  message.set_node(node);
+  chat::PeerPresence *presence = message.add_presence();
+  presence->set_username(username);
+  presence->set_connected(connected);
+  send_to(link, message);
+}
+
+/**
+ * Forwards a direct message towards the node hosting the recipient, false if there is no route
+ */
+bool Federation::forward_direct(const std::string &recipient, const chat::IncomingMessageResponse &message)
+{
+  bool routed = false;
+  std::shared_ptr<PeerLink> link = route_to(recipient, routed);
+  if (!link)
+    return false;
+
+  chat::PeerMessage peer_message;
+  peer_message.set_operation(chat::PeerOperation::PEER_FORWARD);
+  peer_message.set_node(node);
+  peer_message.set_recipient(recipient);
+  peer_message.set_routed(routed);
+  *peer_message.mutable_message() = message;
+  return send_to(link, peer_message);
+}
+
+/**
+ * Next hop for a direct message: the recipient's home node, or the hosting node when we are the home
+ */
+std::shared_ptr<Federation::PeerLink> Federation::route_to(const std::string &recipient, bool &routed)
+{
+  std::lock_guard<std::mutex> lock(federation_mutex);
+  std::string target = ring.node_for(recipient);
+  routed = false;
+  if (target == node)
+  {
+    auto host = directory.find(recipient);
+    if (host == directory.end())
+      return nullptr;
+    target = host->second;
+    routed = true;
+  }
+
+  auto it = links.find(target);
+  if (it == links.end())
+    return nullptr;
+  return it->second;
+}
+
+/**
+ * Forwards a broadcast or room message to every peer, each one fans it out locally
+ */
+void Federation::forward_to_all(const chat::IncomingMessageResponse &message)
+{
+  if (!running)
+    return;
+
+  chat::PeerMessage peer_message;
+  peer_message.set_operation(chat::PeerOperation::PEER_FORWARD);
+  peer_message.set_node(node);
+  *peer_message.mutable_message() = message;
+  send_to_all(peer_message);
+}
+
+/**
+ * Looks up a user connected to another live node
+ */
+bool Federation::find_user(const std::string &username, RemoteUser &user)
+{
+  chat::PeerPresence entry;
+  if (!running || !presence.lookup(username, entry))
+    return false;
+  if (!entry.connected() || entry.node() == node || !is_linked(entry.node()))
+    return false;
+  user = RemoteUser{entry.node(), entry.status()};
+  return true;
+}
+
+std::map<std::string, RemoteUser> Federation::remote_users_snapshot()
+{
+  std::map<std::string, RemoteUser> users;
+  if (!running)
+    return users;
+  for (const auto &entry : presence.snapshot())
+  {
+    // Users of an unreachable node stay in the table, hidden until it comes back
+    if (entry.connected() && entry.node() != node && is_linked(entry.node()))
+      users[entry.username()] = RemoteUser{entry.node(), entry.status()};
+  }
+  return users;
+}
+
+bool Federation::is_linked(const std::string &peer)
+{
+  std::lock_guard<std::mutex> lock(federation_mutex);
+  return links.count(peer) > 0;
+}
+
+void Federation::accept_loop()
+{
+  while (running)
+  {
+    int peer_sock = accept(cluster_fd, NULL, NULL);
+    if (peer_sock < 0)
+    {
+      if (!running)
+        break;
+      perror("Cluster accept failed");
+      continue;
+    }
+    std::thread(&Federation::run_link, this, peer_sock).detach();
+  }
+}
+
+/**
+ * Keeps a link to the peer at host:port, reconnecting when it drops
+ */
+void Federation::dial_loop(const std::string &address)
+{
+  std::string host = address.substr(0, address.find(':'));
+  int port = std::stoi(address.substr(address.find(':') + 1));
+
+  sockaddr_in peer_addr;
+  peer_addr.sin_family = AF_INET;
+  peer_addr.sin_port = htons(port);
+  if (inet_pton(AF_INET, host.c_str(), &peer_addr.sin_addr) <= 0)
+  {
+    std::cerr << "Invalid peer address: " << address << std::endl;
+    return;
+  }
+
+  while (running)
+  {
+    int peer_sock = socket(AF_INET, SOCK_STREAM, 0);
+    if (connect(peer_sock, (struct sockaddr *)&peer_addr, sizeof(peer_addr)) == 0)
+    {
+      run_link(peer_sock); // Returns once the link drops
+    }
+    else
+    {
+      close(peer_sock);
+    }
+    std::this_thread::sleep_for(std::chrono::seconds(PEER_RETRY_SECONDS));
+  }
+}
+
+/**
+ * Handshake and receive loop of a link, both for dialed and accepted peers
+ */
+void Federation::run_link(int sock)
+{
+  auto link = std::make_shared<PeerLink>();
+  link->sock = sock;
+
+  // Introduce ourselves, presence follows through gossip
+  chat::PeerMessage hello;
+  hello.set_operation(chat::PeerOperation::PEER_HELLO);
+  hello.set_node(node);
+
+  chat::PeerMessage message;
+  if (!send_to(link, hello) || !RPM(sock, message) || message.operation() != chat::PeerOperation::PEER_HELLO)
+  {
+    close(sock);
+    return;
+  }
+
+  link->node = message.node();
+  {
+    std::lock_guard<std::mutex> lock(federation_mutex);
+    if (link->node == node || links.count(link->node))
+    {
+      // Both sides dialed each other, the first link wins
+      close(sock);
+      return;
+    }
+    links[link->node] = link;
+  }
+  std::cout << "Peer " << link->node << " connected." << std::endl;
+  update_ring(link->node, true);
+
+  while (running && RPM(sock, message))
+  {
+    switch (message.operation())
+    {
+    case chat::PeerOperation::PEER_DIGEST:
+    {
+      chat::PeerMessage reply;
+      reply.set_node(node);
+      presence.answer_digest(message, reply);
+      if (reply.presence_size() > 0 || reply.wanted_size() > 0)
+        send_to(link, reply);
+      break;
+    }
+    case chat::PeerOperation::PEER_GOSSIP:
+    {
+      presence.merge(message);
+      if (message.wanted_size() > 0)
+      {
+        chat::PeerMessage reply;
+        reply.set_node(node);
+        presence.collect_wanted(message, reply);
+        if (reply.presence_size() > 0)
+          send_to(link, reply);
+      }
+      break;
+    }
+    case chat::PeerOperation::PEER_FORWARD:
+      if (!message.recipient().empty() && !message.routed())
+        relay_direct(message); // We are the home node of the recipient
+      else
+        handlers.on_forward(message);
+      break;
+    case chat::PeerOperation::PEER_LOCATION:
+      apply_location(link->node, message);
+      break;
+    default:
+      std::cerr << "Unexpected peer message from " << link->node << std::endl;
+      break;
+    }
+  }
+
+  // The users of the node are unreachable until it comes back
+  {
+    std::lock_guard<std::mutex> lock(federation_mutex);
+    links.erase(link->node);
+    for (auto it = directory.begin(); it != directory.end();)
+    {
+      if (it->second == link->node)
+        it = directory.erase(it);
+      else
+        ++it;
+    }
+  }
+  close(sock);
+  std::cout << "Peer " << link->node << " disconnected." << std::endl;
+  update_ring(link->node, false);
+}
+
+bool Federation::send_to(const std::shared_ptr<PeerLink> &link, const chat::PeerMessage &message)
+{
+  static Metric &gossip_bytes = metric("gossip.bytes_sent");
+  if (message.operation() == chat::PeerOperation::PEER_DIGEST || message.operation() == chat::PeerOperation::PEER_GOSSIP)
+    gossip_bytes.add(message.ByteSizeLong());
+
+  std::lock_guard<std::mutex> lock(link->send_mutex);
+  return SPM(link->sock, message);
+}
+
+void Federation::send_to_all(const chat::PeerMessage &message)
+{
+  std::vector<std::shared_ptr<PeerLink>> targets;
+  {
+    std::lock_guard<std::mutex> lock(federation_mutex);
+    for (const auto &link : links)
+    {
+      targets.push_back(link.second);
+    }
+  }
+
+  // Serialize once for the whole cluster
+  std::string frame;
+  if (!BPF(message, frame))
+    return;
+  for (const auto &link : targets)
+  {
+    std::lock_guard<std::mutex> lock(link->send_mutex);
+    SPF(link->sock, frame);
+  }
+}
+
+/**
+ * Every GOSSIP_INTERVAL_MS sends a digest to GOSSIP_FANOUT random peers
+ */
+void Federation::gossip_loop()
+{
+  static Metric &rounds = metric("gossip.rounds");
+  std::mt19937 random(std::random_device{}());
+
+  while (running)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(GOSSIP_INTERVAL_MS));
+    presence.expire_tombstones();
+
+    std::vector<std::shared_ptr<PeerLink>> targets;
+    {
+      std::lock_guard<std::mutex> lock(federation_mutex);
+      for (const auto &link : links)
+      {
+        targets.push_back(link.second);
+      }
+    }
+    if (targets.empty())
+      continue;
+    std::shuffle(targets.begin(), targets.end(), random);
+    targets.resize(std::min<size_t>(targets.size(), GOSSIP_FANOUT));
+
+    chat::PeerMessage digest;
+    digest.set_node(node);
+    presence.build_digest(digest);
+    for (const auto &link : targets)
+    {
+      send_to(link, digest);
+    }
+    rounds.add();
+  }
+}
+
+void Federation::apply_location(const std::string &from, const chat::PeerMessage &message)
+{
+  std::lock_guard<std::mutex> lock(federation_mutex);
+  for (const auto &presence : message.presence())
+  {
+    if (presence.connected())
+      directory[presence.username()] = from;
+    else if (directory.count(presence.username()) && directory[presence.username()] == from)
+      directory.erase(presence.username()); // A late disconnect must not drop a newer location
+  }
+}
+
+/**
+ * Home node side of a direct message: hand it to the hosting node
+ */
+void Federation::relay_direct(const chat::PeerMessage &message)
+{
+  std::shared_ptr<PeerLink> link;
+  {
+    std::lock_guard<std::mutex> lock(federation_mutex);
+    auto host = directory.find(message.recipient());
+    if (host != directory.end() && host->second != node)
+    {
+      auto it = links.find(host->second);
+      if (it != links.end())
+        link = it->second;
+    }
+  }
+
+  if (!link)
+  {
+    // Hosted here, or unknown while the ring rebalances: try local delivery
+    handlers.on_forward(message);
+    return;
+  }
+
+  chat::PeerMessage relayed = message;
+  relayed.set_routed(true);
+  send_to(link, relayed);
+}
+
+/**
+ * Adds or removes a peer from the ring and re-homes the local users whose home moved
+ */
+void Federation::update_ring(const std::string &peer, bool joined)
+{
+  // Taken before the federation lock, the handler locks the server state
+  std::vector<chat::PeerPresence> local_users = handlers.local_presence();
+
+  std::map<std::string, chat::PeerMessage> moves; // New home node to the locations it must learn
+  {
+    std::lock_guard<std::mutex> lock(federation_mutex);
+    std::vector<std::string> old_homes;
+    for (const auto &user : local_users)
+    {
+      old_homes.push_back(ring.node_for(user.username()));
+    }
+
+    if (joined)
+      ring.add_node(peer);
+    else
+      ring.remove_node(peer);
+
+    for (size_t i = 0; i < local_users.size(); i++)
+    {
+      const std::string &home = ring.node_for(local_users[i].username());
+      if (home == old_homes[i])
+        continue;
+      if (home == node)
+      {
+        directory[local_users[i].username()] = node;
+        continue;
+      }
+      chat::PeerMessage &message = moves[home];
+      message.set_operation(chat::PeerOperation::PEER_LOCATION);
+      message.set_node(node);
+      chat::PeerPresence *presence = message.add_presence();
+      presence->set_username(local_users[i].username());
+      presence->set_connected(true);
+    }
+
+    // Records for users that are now homed elsewhere are re-sent by their hosts
+    for (auto it = directory.begin(); it != directory.end();)
+    {
+      if (ring.node_for(it->first) != node)
+        it = directory.erase(it);
+      else
+        ++it;
+    }
+  }
+
+  size_t moved = 0;
+  for (const auto &move : moves)
+  {
+    std::shared_ptr<PeerLink> link;
+    {
+      std::lock_guard<std::mutex> lock(federation_mutex);
+      auto it = links.find(move.first);
+      if (it != links.end())
+        link = it->second;
+    }
+    if (link && send_to(link, move.second))
+      moved += move.second.presence_size();
+  }
+  std::cout << "Ring " << (joined ? "joined by " : "left by ") << peer << ": " << moved << " of " << local_users.size() << " local users re-homed." << std::endl;
+}
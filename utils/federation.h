@@ -0,0 +1,91 @@
+// federation.h
+#ifndef FEDERATION_H
+#define FEDERATION_H
+
+#include "chat.pb.h"
+#include "constants.h"
+#include "hash_ring.h"
+#include "gossip.h"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <functional>
+
+// A user hosted by another node of the cluster
+struct RemoteUser
+{
+  std::string node;
+  chat::UserStatus status;
+};
+
+// Hooks the server provides to the federation layer, never called with federation locks held
+struct FederationHandlers
+{
+  std::function<void(const chat::PeerMessage &)> on_forward;           // Deliver a forwarded message to local users
+  std::function<std::vector<chat::PeerPresence>()> local_presence;     // Every local user, re-homed when the ring changes
+};
+
+/**
+ * Cluster link between server processes.
+ *
+ * Every node listens on a cluster port and dials the peers given on the command
+ * line, links are full duplex so each pair of nodes needs a single connection.
+ * Nodes gossip the presence of the users they host (see PresenceTable) and forward
+ * direct, room and broadcast messages to the nodes hosting the recipients.
+ *
+ * Direct messages are routed through a consistent hashing ring: every username has
+ * a home node that keeps the authoritative record of where the user is connected,
+ * so locating a recipient costs one hop to its home node instead of a cluster query.
+ */
+class Federation
+{
+public:
+  bool start(const std::string &node, int cluster_port, const std::vector<std::string> &peers, const FederationHandlers &handlers);
+  void stop();
+  bool enabled() const { return running; }
+  const std::string &node_name() const { return node; }
+
+  void publish_presence(const std::string &username, chat::UserStatus status, bool connected);
+  void publish_location(const std::string &username, bool connected);
+  bool forward_direct(const std::string &recipient, const chat::IncomingMessageResponse &message);
+  void forward_to_all(const chat::IncomingMessageResponse &message);
+
+  bool find_user(const std::string &username, RemoteUser &user);
+  std::map<std::string, RemoteUser> remote_users_snapshot();
+
+private:
+  struct PeerLink
+  {
+    std::string node;
+    int sock;
+    std::mutex send_mutex; // Frames from different client threads must not interleave
+  };
+
+  void accept_loop();
+  void dial_loop(const std::string &address);
+  void run_link(int sock);
+  bool send_to(const std::shared_ptr<PeerLink> &link, const chat::PeerMessage &message);
+  void send_to_all(const chat::PeerMessage &message);
+  void gossip_loop();
+  bool is_linked(const std::string &peer);
+  void apply_location(const std::string &from, const chat::PeerMessage &message);
+  void relay_direct(const chat::PeerMessage &message);
+  void update_ring(const std::string &peer, bool joined);
+  std::shared_ptr<PeerLink> route_to(const std::string &recipient, bool &routed);
+
+  std::string node;
+  int cluster_fd = -1;
+  std::atomic<bool> running{false};
+  FederationHandlers handlers;
+
+  std::map<std::string, std::shared_ptr<PeerLink>> links; // Node name to its link
+  PresenceTable presence;                                 // Cluster wide presence, kept in sync by gossip
+  HashRing ring;                                          // Live nodes, assigns every username a home node
+  std::map<std::string, std::string> directory;           // Username to hosting node, for users whose home is this node
+  std::mutex federation_mutex;
+};
+
+#endif // FEDERATION_H
@@ -0,0 +1,197 @@
+// flush.cpp
+#include "flush.h"
+#include "message.h"
+#include "metrics.h"
+#include "constants.h"
+#include <chrono>             // For std::chrono::steady_clock
+#include <mutex>              // For std::mutex, std::call_once
+#include <condition_variable> // For std::condition_variable
+#include <atomic>             // For std::atomic
+#include <queue>              // For std::priority_queue
+#include <thread>             // For std::thread
+#include <unordered_map>      // For std::unordered_map
+#include <sys/socket.h>       // For setsockopt, getsockopt
+#include <netinet/in.h>       // For IPPROTO_TCP
+#include <linux/tcp.h>        // For TCP_NODELAY, TCP_CORK, TCP_INFO
+
+using Clock = std::chrono::steady_clock;
+
+struct SocketFlush
+{
+  chat::FlushPolicy policy = chat::FlushPolicy::FLUSH_ADAPTIVE;
+  bool corked = false;
+  uint64_t generation = 0; // Of the last cork, a timer only uncorks the cork it was set for
+  Clock::time_point last_frame;
+  uint64_t frames = 0;
+  uint32_t base_segments = 0; // Segments already sent when the policy was set (handed over sockets)
+};
+
+// Sockets spread over stripes like the send locks, the timer thread takes them too
+static std::mutex flush_locks[SEND_LOCK_STRIPES];
+static std::unordered_map<int, SocketFlush> flush_sockets[SEND_LOCK_STRIPES];
+
+// Process wide, so an uncork left queued by an earlier socket on the same descriptor never matches
+static std::atomic<uint64_t> next_generation{0};
+
+struct Uncork
+{
+  Clock::time_point deadline;
+  int sock;
+  uint64_t generation;
+  bool operator>(const Uncork &other) const { return deadline > other.deadline; }
+};
+
+// The timer thread waits on the condition variable until the process exits, so its state is
+// never destroyed: glibc would block the exit destroying a condition variable with a waiter
+struct UncorkTimer
+{
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::priority_queue<Uncork, std::vector<Uncork>, std::greater<Uncork>> uncorks;
+};
+static UncorkTimer &timer = *new UncorkTimer();
+
+static void set_cork(int sock, int value)
+{
+  setsockopt(sock, IPPROTO_TCP, TCP_CORK, &value, sizeof(value));
+}
+
+static uint32_t segments_out(int sock)
+{
+  tcp_info info{};
+  socklen_t size = sizeof(info);
+  if (getsockopt(sock, IPPROTO_TCP, TCP_INFO, &info, &size) != 0)
+    return 0;
+  return info.tcpi_segs_out;
+}
+
+/**
+ * Send hook, runs with the socket's send lock held so frames of one socket see it in order
+ */
+static void before_send(int sock)
+{
+  static Metric &frames = metric("flush.frames");
+  static Metric &corks = metric("flush.corks");
+
+  Clock::time_point now = Clock::now();
+  int stripe = sock % SEND_LOCK_STRIPES;
+  Uncork uncork;
+  {
+    std::lock_guard<std::mutex> lock(flush_locks[stripe]);
+    auto it = flush_sockets[stripe].find(sock);
+    if (it == flush_sockets[stripe].end())
+      return;
+
+    SocketFlush &state = it->second;
+    bool burst = state.frames > 0 && now - state.last_frame < std::chrono::microseconds(FLUSH_BURST_GAP_US);
+    state.frames++;
+    state.last_frame = now;
+    frames.add();
+
+    bool cork = !state.corked && (state.policy == chat::FlushPolicy::FLUSH_COALESCE ||
+                                  (state.policy == chat::FlushPolicy::FLUSH_ADAPTIVE && burst));
+    if (!cork)
+      return;
+
+    set_cork(sock, 1);
+    state.corked = true;
+    state.generation = ++next_generation;
+    uncork = {now + std::chrono::microseconds(FLUSH_COALESCE_BUDGET_US), sock, state.generation};
+  }
+  corks.add();
+
+  std::lock_guard<std::mutex> lock(timer.mutex);
+  bool earliest = timer.uncorks.empty() || uncork.deadline < timer.uncorks.top().deadline;
+  timer.uncorks.push(uncork);
+  if (earliest)
+    timer.cv.notify_one();
+}
+
+/**
+ * Uncorks sockets when their coalescing budget runs out, the kernel then sends what is queued
+ */
+static void uncork_loop()
+{
+  std::unique_lock<std::mutex> lock(timer.mutex);
+  while (true)
+  {
+    if (timer.uncorks.empty())
+    {
+      timer.cv.wait(lock);
+      continue;
+    }
+    Uncork next = timer.uncorks.top();
+    if (Clock::now() < next.deadline)
+    {
+      timer.cv.wait_until(lock, next.deadline);
+      continue;
+    }
+    timer.uncorks.pop();
+    lock.unlock();
+
+    int stripe = next.sock % SEND_LOCK_STRIPES;
+    {
+      std::lock_guard<std::mutex> socket_lock(flush_locks[stripe]);
+      auto it = flush_sockets[stripe].find(next.sock);
+      if (it != flush_sockets[stripe].end() && it->second.corked && it->second.generation == next.generation)
+      {
+        set_cork(next.sock, 0);
+        it->second.corked = false;
+      }
+    }
+    lock.lock();
+  }
+}
+
+void start_flush_control()
+{
+  static std::once_flag started;
+  std::call_once(started, []
+                 {
+                   set_send_hook(before_send);
+                   std::thread(uncork_loop).detach(); });
+}
+
+void set_flush_policy(int sock, chat::FlushPolicy policy)
+{
+  int enable = 1;
+  setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+  int stripe = sock % SEND_LOCK_STRIPES;
+  std::lock_guard<std::mutex> lock(flush_locks[stripe]);
+  auto inserted = flush_sockets[stripe].try_emplace(sock);
+  if (inserted.second)
+    inserted.first->second.base_segments = segments_out(sock);
+  inserted.first->second.policy = policy;
+}
+
+chat::FlushPolicy flush_policy(int sock)
+{
+  int stripe = sock % SEND_LOCK_STRIPES;
+  std::lock_guard<std::mutex> lock(flush_locks[stripe]);
+  auto it = flush_sockets[stripe].find(sock);
+  return it == flush_sockets[stripe].end() ? chat::FlushPolicy::FLUSH_ADAPTIVE : it->second.policy;
+}
+
+void forget_flush_policy(int sock)
+{
+  SocketFlush state;
+  int stripe = sock % SEND_LOCK_STRIPES;
+  {
+    std::lock_guard<std::mutex> lock(flush_locks[stripe]);
+    auto it = flush_sockets[stripe].find(sock);
+    if (it == flush_sockets[stripe].end())
+      return;
+    state = it->second;
+    flush_sockets[stripe].erase(it);
+  }
+
+  // Segments include the ACKs of the requests, a chatty client sits a bit above its real ratio
+  uint32_t segments = segments_out(sock) - state.base_segments;
+  if (state.frames == 0 || segments == 0)
+    return;
+  const std::string prefix = "net." + chat::FlushPolicy_Name(state.policy);
+  metric(prefix + ".frames").add(state.frames);
+  metric(prefix + ".segments").add(segments);
+  metric(prefix + ".segments_per_100_frames").observe(segments * 100 / state.frames);
+}
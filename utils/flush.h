@@ -0,0 +1,27 @@
+// flush.h
+#ifndef FLUSH_H
+#define FLUSH_H
+
+#include "chat.pb.h"
+
+/**
+ * Per connection flush policy. Every connection gets TCP_NODELAY, so a lone frame leaves in
+ * its own packet without waiting on Nagle. When frames should share packets the socket is
+ * corked (TCP_CORK) and a timer uncorks it FLUSH_COALESCE_BUDGET_US later:
+ *  - FLUSH_IMMEDIATE never corks.
+ *  - FLUSH_COALESCE corks on every frame that finds the socket uncorked.
+ *  - FLUSH_ADAPTIVE sends the first frame at once and corks when the next one follows within
+ *    FLUSH_BURST_GAP_US, so broadcast bursts are coalesced and interactive traffic is not.
+ */
+
+// Installs the send hook of message.h and starts the uncork timer
+void start_flush_control();
+
+// Sets the policy of a socket, a socket without one is left alone by the send hook
+void set_flush_policy(int sock, chat::FlushPolicy policy);
+chat::FlushPolicy flush_policy(int sock);
+
+// Records the packets per frame of a socket and forgets it, call it before closing the socket
+void forget_flush_policy(int sock);
+
+#endif // FLUSH_H
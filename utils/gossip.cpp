@@ -0,0 +1,175 @@
+// gossip.cpp
+#include "gossip.h"
+#include "metrics.h"
+#include <chrono>    // For std::chrono
+#include <algorithm> // For std::max, std::min
+
+static int64_t now_ms()
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Records a change of a user hosted by this node
+ */
+void PresenceTable::set_local(const std::string &node, const std::string &username, chat::UserStatus status, bool connected)
+{
+  std::lock_guard<std::mutex> lock(presence_mutex);
+
+  // Versions follow the wall clock so a user moving between nodes gets a higher version on the new one
+  int64_t now = now_ms();
+  last_version = std::max<uint64_t>(last_version + 1, static_cast<uint64_t>(now) * 1000);
+
+  chat::PeerPresence &entry = entries[username];
+  entry.set_username(username);
+  entry.set_node(node);
+  entry.set_status(status);
+  entry.set_connected(connected);
+  entry.set_version(last_version);
+  entry.set_changed_at(now);
+  rumors[username] = GOSSIP_RUMOR_ROUNDS;
+}
+
+bool PresenceTable::lookup(const std::string &username, chat::PeerPresence &entry)
+{
+  std::lock_guard<std::mutex> lock(presence_mutex);
+  auto it = entries.find(username);
+  if (it == entries.end())
+    return false;
+  entry = it->second;
+  return true;
+}
+
+std::vector<chat::PeerPresence> PresenceTable::snapshot()
+{
+  std::lock_guard<std::mutex> lock(presence_mutex);
+  std::vector<chat::PeerPresence> result;
+  result.reserve(entries.size());
+  for (const auto &entry : entries)
+  {
+    result.push_back(entry.second);
+  }
+  return result;
+}
+
+/**
+ * Digest for one round: rumors first, then the next entries after the cursor
+ */
+void PresenceTable::build_digest(chat::PeerMessage &message)
+{
+  std::lock_guard<std::mutex> lock(presence_mutex);
+  message.set_operation(chat::PeerOperation::PEER_DIGEST);
+
+  for (auto it = rumors.begin(); it != rumors.end() && message.digest_size() < GOSSIP_MAX_ENTRIES;)
+  {
+    auto entry = entries.find(it->first);
+    if (entry != entries.end())
+    {
+      chat::PresenceDigest *digest = message.add_digest();
+      digest->set_username(entry->first);
+      digest->set_version(entry->second.version());
+    }
+    if (entry == entries.end() || --it->second == 0)
+      it = rumors.erase(it);
+    else
+      ++it;
+  }
+
+  size_t budget = std::min<size_t>(GOSSIP_MAX_ENTRIES - message.digest_size(), entries.size());
+  auto it = entries.upper_bound(cursor);
+  for (size_t i = 0; i < budget; i++)
+  {
+    if (it == entries.end())
+      it = entries.begin(); // Wrap around the table
+    chat::PresenceDigest *digest = message.add_digest();
+    digest->set_username(it->first);
+    digest->set_version(it->second.version());
+    cursor = it->first;
+    ++it;
+  }
+}
+
+/**
+ * Receiver side of a digest: send back what is newer here, ask for what is newer there
+ */
+void PresenceTable::answer_digest(const chat::PeerMessage &digest, chat::PeerMessage &reply)
+{
+  std::lock_guard<std::mutex> lock(presence_mutex);
+  reply.set_operation(chat::PeerOperation::PEER_GOSSIP);
+
+  for (const auto &item : digest.digest())
+  {
+    auto it = entries.find(item.username());
+    if (it == entries.end() || it->second.version() < item.version())
+    {
+      reply.add_wanted(item.username());
+    }
+    else if (it->second.version() > item.version() && reply.presence_size() < GOSSIP_MAX_ENTRIES)
+    {
+      *reply.add_presence() = it->second;
+    }
+  }
+}
+
+void PresenceTable::collect_wanted(const chat::PeerMessage &request, chat::PeerMessage &reply)
+{
+  std::lock_guard<std::mutex> lock(presence_mutex);
+  reply.set_operation(chat::PeerOperation::PEER_GOSSIP);
+
+  for (const auto &username : request.wanted())
+  {
+    auto it = entries.find(username);
+    if (it != entries.end() && reply.presence_size() < GOSSIP_MAX_ENTRIES)
+      *reply.add_presence() = it->second;
+  }
+}
+
+/**
+ * Applies the entries that are newer than ours, returns how many were applied
+ */
+size_t PresenceTable::merge(const chat::PeerMessage &gossip)
+{
+  static Metric &convergence = metric("gossip.convergence_ms");
+  static Metric &applied_entries = metric("gossip.entries_applied");
+
+  std::lock_guard<std::mutex> lock(presence_mutex);
+  size_t applied = 0;
+  int64_t now = now_ms();
+
+  for (const auto &incoming : gossip.presence())
+  {
+    auto it = entries.find(incoming.username());
+    if (it != entries.end() && !newer(incoming, it->second))
+      continue;
+
+    entries[incoming.username()] = incoming;
+    rumors[incoming.username()] = GOSSIP_RUMOR_ROUNDS; // Keep spreading it
+    convergence.observe(now > incoming.changed_at() ? now - incoming.changed_at() : 0);
+    applied++;
+  }
+  applied_entries.add(applied);
+  return applied;
+}
+
+/**
+ * Forgets disconnected users once every node had time to learn about it
+ */
+void PresenceTable::expire_tombstones()
+{
+  std::lock_guard<std::mutex> lock(presence_mutex);
+  int64_t cutoff = now_ms() - PRESENCE_TOMBSTONE_SECONDS * 1000;
+  for (auto it = entries.begin(); it != entries.end();)
+  {
+    if (!it->second.connected() && it->second.changed_at() < cutoff)
+      it = entries.erase(it);
+    else
+      ++it;
+  }
+}
+
+bool PresenceTable::newer(const chat::PeerPresence &a, const chat::PeerPresence &b)
+{
+  if (a.version() != b.version())
+    return a.version() > b.version();
+  return a.node() > b.node(); // Same version on two nodes, any fixed order converges
+}
@@ -0,0 +1,45 @@
+// gossip.h
+#ifndef GOSSIP_H
+#define GOSSIP_H
+
+#include "chat.pb.h"
+#include "constants.h"
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint> // For uint64_t
+
+/**
+ * Versioned, eventually consistent view of the presence of every user in the cluster.
+ *
+ * Only the hosting node changes an entry, stamping it with a higher version, and
+ * merges keep the highest version. Gossip rounds carry digests of at most
+ * GOSSIP_MAX_ENTRIES (username, version) pairs: recent changes are spread as rumors
+ * for GOSSIP_RUMOR_ROUNDS rounds, the rest of the budget walks the table with a
+ * rotating cursor so every entry is eventually compared (anti-entropy).
+ */
+class PresenceTable
+{
+public:
+  void set_local(const std::string &node, const std::string &username, chat::UserStatus status, bool connected);
+  bool lookup(const std::string &username, chat::PeerPresence &entry);
+  std::vector<chat::PeerPresence> snapshot();
+
+  void build_digest(chat::PeerMessage &message);
+  void answer_digest(const chat::PeerMessage &digest, chat::PeerMessage &reply);
+  void collect_wanted(const chat::PeerMessage &request, chat::PeerMessage &reply);
+  size_t merge(const chat::PeerMessage &gossip);
+  void expire_tombstones();
+
+private:
+  static bool newer(const chat::PeerPresence &a, const chat::PeerPresence &b);
+
+  std::map<std::string, chat::PeerPresence> entries;
+  std::map<std::string, int> rumors; // Username to gossip rounds left
+  std::string cursor;                // Last username compared by anti-entropy
+  uint64_t last_version = 0;
+  std::mutex presence_mutex;
+};
+
+#endif // GOSSIP_H
@@ -0,0 +1,185 @@
+// handoff.cpp
+#include "handoff.h"
+#include "constants.h"
+#include <iostream>     // For std::cerr
+#include <cstring>      // For memcpy, strncpy
+#include <cerrno>       // For errno
+#include <unistd.h>     // For close, unlink
+#include <sys/socket.h> // For sendmsg, recvmsg, SCM_RIGHTS
+#include <sys/stat.h>   // For chmod
+#include <sys/un.h>     // For sockaddr_un
+#include <netinet/in.h> // For htonl, ntohl
+
+std::string handoff_path(const std::string &server_name)
+{
+  return server_name + "_handoff.sock";
+}
+
+static bool unix_address(const std::string &path, sockaddr_un &address)
+{
+  if (path.size() >= sizeof(address.sun_path))
+  {
+    std::cerr << "Handoff socket path too long: " << path << std::endl;
+    return false;
+  }
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+  return true;
+}
+
+/**
+ * Listens for a replacement process, only the owner of the server may connect
+ */
+int listen_handoff(const std::string &path)
+{
+  sockaddr_un address;
+  if (!unix_address(path, address))
+    return -1;
+
+  int sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (sock == -1)
+  {
+    perror("Handoff socket creation failed");
+    return -1;
+  }
+
+  // A stale path from a previous run would make bind fail
+  unlink(path.c_str());
+  if (bind(sock, (struct sockaddr *)&address, sizeof(address)) < 0 || listen(sock, 1) < 0)
+  {
+    perror("Handoff bind failed");
+    close(sock);
+    return -1;
+  }
+  chmod(path.c_str(), 0600);
+  return sock;
+}
+
+int connect_handoff(const std::string &path)
+{
+  sockaddr_un address;
+  if (!unix_address(path, address))
+    return -1;
+
+  int sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (sock == -1 || connect(sock, (struct sockaddr *)&address, sizeof(address)) < 0)
+  {
+    perror("Handoff connect failed");
+    if (sock != -1)
+      close(sock);
+    return -1;
+  }
+  return sock;
+}
+
+/**
+ * Sends one chunk as a length prefixed frame, the descriptors ride on its first bytes
+ */
+bool send_handoff(int sock, const chat::HandoffState &state, const std::vector<int> &fds)
+{
+  if (fds.size() > HANDOFF_CHUNK_SESSIONS + 1)
+  {
+    std::cerr << "Too many descriptors for one handoff chunk: " << fds.size() << std::endl;
+    return false;
+  }
+
+  std::string output;
+  state.SerializeToString(&output);
+  uint32_t length = htonl(static_cast<uint32_t>(output.size()));
+  std::string frame(reinterpret_cast<const char *>(&length), FRAME_HEADER_SIZE);
+  frame += output;
+
+  std::vector<char> control(CMSG_SPACE(sizeof(int) * fds.size()));
+  size_t total = 0;
+  while (total < frame.size())
+  {
+    iovec data = {&frame[total], frame.size() - total};
+    msghdr message = {};
+    message.msg_iov = &data;
+    message.msg_iovlen = 1;
+
+    // Descriptors go with the first piece only
+    if (total == 0 && !fds.empty())
+    {
+      message.msg_control = control.data();
+      message.msg_controllen = control.size();
+      cmsghdr *header = CMSG_FIRSTHDR(&message);
+      header->cmsg_level = SOL_SOCKET;
+      header->cmsg_type = SCM_RIGHTS;
+      header->cmsg_len = CMSG_LEN(sizeof(int) * fds.size());
+      memcpy(CMSG_DATA(header), fds.data(), sizeof(int) * fds.size());
+    }
+
+    ssize_t sent = sendmsg(sock, &message, MSG_NOSIGNAL);
+    if (sent < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      perror("Handoff send failed");
+      return false;
+    }
+    total += sent;
+  }
+  return true;
+}
+
+/**
+ * Receives one chunk and the descriptors that came with it
+ */
+bool receive_handoff(int sock, chat::HandoffState &state, std::vector<int> &fds)
+{
+  uint32_t length;
+  std::vector<char> control(CMSG_SPACE(sizeof(int) * (HANDOFF_CHUNK_SESSIONS + 1)));
+  iovec data = {&length, FRAME_HEADER_SIZE};
+  msghdr message = {};
+  message.msg_iov = &data;
+  message.msg_iovlen = 1;
+  message.msg_control = control.data();
+  message.msg_controllen = control.size();
+
+  // The header is the first piece of the frame, the descriptors arrive with it
+  ssize_t received;
+  do
+  {
+    received = recvmsg(sock, &message, MSG_WAITALL | MSG_CMSG_CLOEXEC);
+  } while (received < 0 && errno == EINTR);
+  if (received != static_cast<ssize_t>(FRAME_HEADER_SIZE))
+  {
+    std::cerr << "Handoff connection closed." << std::endl;
+    return false;
+  }
+  if (message.msg_flags & MSG_CTRUNC)
+  {
+    std::cerr << "Handoff descriptors truncated." << std::endl;
+    return false;
+  }
+
+  fds.clear();
+  for (cmsghdr *header = CMSG_FIRSTHDR(&message); header; header = CMSG_NXTHDR(&message, header))
+  {
+    if (header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_RIGHTS)
+    {
+      size_t count = (header->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+      fds.resize(count);
+      memcpy(fds.data(), CMSG_DATA(header), sizeof(int) * count);
+    }
+  }
+
+  length = ntohl(length);
+  std::string buffer(length, '\0');
+  size_t total = 0;
+  while (total < length)
+  {
+    ssize_t bytes = recv(sock, &buffer[total], length - total, MSG_WAITALL);
+    if (bytes < 0 && errno == EINTR)
+      continue;
+    if (bytes <= 0)
+    {
+      std::cerr << "Handoff connection closed mid chunk." << std::endl;
+      return false;
+    }
+    total += bytes;
+  }
+  return state.ParseFromString(buffer);
+}
@@ -0,0 +1,25 @@
+// handoff.h
+#ifndef HANDOFF_H
+#define HANDOFF_H
+
+#include "chat.pb.h"
+#include <string>
+#include <vector>
+
+/**
+ * Hot restart transport. The running server listens on a Unix socket; its replacement
+ * connects and receives the server state as HandoffState chunks, each one sent with its
+ * descriptors attached (SCM_RIGHTS), so the listening socket and the client connections
+ * keep working in the new process without being closed.
+ */
+
+// Unix socket path of a server, next to its history file
+std::string handoff_path(const std::string &server_name);
+
+int listen_handoff(const std::string &path);
+int connect_handoff(const std::string &path);
+
+bool send_handoff(int sock, const chat::HandoffState &state, const std::vector<int> &fds);
+bool receive_handoff(int sock, chat::HandoffState &state, std::vector<int> &fds);
+
+#endif // HANDOFF_H
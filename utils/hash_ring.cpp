@@ -0,0 +1,71 @@
+// hash_ring.cpp
+#include "hash_ring.h"
+#include "constants.h"
+#include <algorithm> // For std::sort, std::find, std::upper_bound
+
+void HashRing::add_node(const std::string &node)
+{
+  if (contains(node))
+    return;
+  nodes.push_back(node);
+  rebuild();
+}
+
+void HashRing::remove_node(const std::string &node)
+{
+  auto it = std::find(nodes.begin(), nodes.end(), node);
+  if (it == nodes.end())
+    return;
+  nodes.erase(it);
+  rebuild();
+}
+
+bool HashRing::contains(const std::string &node) const
+{
+  return std::find(nodes.begin(), nodes.end(), node) != nodes.end();
+}
+
+/**
+ * Node owning the key, the ring must not be empty
+ */
+const std::string &HashRing::node_for(const std::string &key) const
+{
+  Point probe{hash(key), 0};
+  auto it = std::upper_bound(points.begin(), points.end(), probe);
+  if (it == points.end())
+    it = points.begin(); // Wrap around the ring
+  return nodes[it->node];
+}
+
+/**
+ * FNV-1a followed by a 64-bit finalizer, node names only differ in a suffix
+ */
+uint64_t HashRing::hash(const std::string &key)
+{
+  uint64_t h = 1469598103934665603ULL;
+  for (unsigned char c : key)
+  {
+    h ^= c;
+    h *= 1099511628211ULL;
+  }
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+void HashRing::rebuild()
+{
+  points.clear();
+  points.reserve(nodes.size() * HASH_RING_VIRTUAL_NODES);
+  for (size_t i = 0; i < nodes.size(); i++)
+  {
+    for (int replica = 0; replica < HASH_RING_VIRTUAL_NODES; replica++)
+    {
+      points.push_back({hash(nodes[i] + "#" + std::to_string(replica)), i});
+    }
+  }
+  std::sort(points.begin(), points.end());
+}
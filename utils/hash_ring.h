@@ -0,0 +1,41 @@
+// hash_ring.h
+#ifndef HASH_RING_H
+#define HASH_RING_H
+
+#include <string>
+#include <vector>
+#include <cstdint> // For uint64_t
+
+/**
+ * Consistent hashing ring with virtual nodes.
+ *
+ * Every node is placed HASH_RING_VIRTUAL_NODES times on a 64-bit ring and a key
+ * belongs to the first point at or after its hash. Adding or removing a node only
+ * moves the keys of the arcs that node owns, about 1/N of them.
+ */
+class HashRing
+{
+public:
+  void add_node(const std::string &node);
+  void remove_node(const std::string &node);
+  bool contains(const std::string &node) const;
+  bool empty() const { return points.empty(); }
+  const std::string &node_for(const std::string &key) const;
+
+  static uint64_t hash(const std::string &key);
+
+private:
+  struct Point
+  {
+    uint64_t hash;
+    size_t node; // Index in nodes
+    bool operator<(const Point &other) const { return hash < other.hash; }
+  };
+
+  void rebuild();
+
+  std::vector<std::string> nodes;
+  std::vector<Point> points; // Sorted by hash
+};
+
+#endif // HASH_RING_H
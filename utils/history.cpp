@@ -0,0 +1,217 @@
+// history.cpp
+#include "history.h"
+#include <iostream>  // For std::cout
+#include <algorithm> // For std::max, std::lower_bound
+#include <chrono>    // For std::chrono
+#include <fcntl.h>   // For open
+#include <unistd.h>  // For pread, write, close
+#include <netinet/in.h> // For htonl, ntohl
+
+MessageHistory::~MessageHistory()
+{
+  if (fd != -1)
+    close(fd);
+}
+
+/**
+ * Opens (or creates) the log and rebuilds the in-memory indexes from it
+ */
+bool MessageHistory::open(const std::string &path)
+{
+  std::lock_guard<std::mutex> lock(history_mutex);
+
+  fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+  if (fd == -1)
+  {
+    perror("Failed to open history file");
+    return false;
+  }
+
+  uint64_t offset = 0;
+  uint32_t length = 0;
+  chat::StoredMessage record;
+  while (read_record(offset, record, &length))
+  {
+    index_record(record.conversation(), offset, record.message());
+    last_timestamp = std::max(last_timestamp, record.message().timestamp());
+    offset += FRAME_HEADER_SIZE + length;
+  }
+
+  // Drop a partially written trailing record, if the previous run died mid-write
+  if (ftruncate(fd, offset) == -1)
+    perror("Failed to truncate history file");
+  end_offset = offset;
+
+  std::cout << "History loaded: " << conversations.size() << " conversations." << std::endl;
+  return true;
+}
+
+/**
+ * Stamps the message with the relay time and persists it
+ */
+void MessageHistory::append(const std::string &conversation, chat::IncomingMessageResponse &message)
+{
+  std::lock_guard<std::mutex> lock(history_mutex);
+
+  // Timestamps never go backwards inside the log, the time index relies on it
+  int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+  last_timestamp = std::max(last_timestamp, now);
+  message.set_timestamp(last_timestamp);
+
+  if (fd == -1)
+    return;
+
+  chat::StoredMessage record;
+  record.set_conversation(conversation);
+  *record.mutable_message() = message;
+
+  std::string output;
+  record.SerializeToString(&output);
+  uint32_t length = htonl(static_cast<uint32_t>(output.size()));
+  std::string frame(reinterpret_cast<const char *>(&length), FRAME_HEADER_SIZE);
+  frame += output;
+
+  if (write(fd, frame.data(), frame.size()) != static_cast<ssize_t>(frame.size()))
+  {
+    perror("Failed to write history record");
+    return;
+  }
+
+  index_record(conversation, end_offset, message);
+  end_offset += frame.size();
+}
+
+/**
+ * Streams the messages of a conversation within [since, until) in pages
+ */
+void MessageHistory::query(const std::string &conversation, const HistoryQuery &range, const HistoryPageCallback &on_page)
+{
+  std::vector<uint64_t> offsets;
+  {
+    std::lock_guard<std::mutex> lock(history_mutex);
+    auto it = conversations.find(conversation);
+    if (it != conversations.end())
+    {
+      const Conversation &entry = it->second;
+      size_t begin = range.since > 0 ? lower_bound(entry, range.since) : 0;
+      if (range.visible_from > 0)
+        begin = std::max(begin, lower_bound(entry, range.visible_from));
+      size_t end = range.until > 0 ? lower_bound(entry, range.until) : entry.offsets.size();
+
+      // A sender filter walks that sender's positions inside [begin, end) instead
+      static const std::vector<size_t> no_positions;
+      const std::vector<size_t> *positions = nullptr;
+      if (!range.sender.empty())
+      {
+        auto sender = entry.senders.find(range.sender);
+        positions = sender != entry.senders.end() ? &sender->second : &no_positions;
+        begin = std::lower_bound(positions->begin(), positions->end(), begin) - positions->begin();
+        end = std::lower_bound(positions->begin(), positions->end(), end) - positions->begin();
+      }
+
+      if (end > begin + range.limit)
+      {
+        // Without a lower bound the caller wants the latest messages of the range
+        if (range.since > 0)
+          end = begin + range.limit;
+        else
+          begin = end - range.limit;
+      }
+      for (size_t i = begin; i < end; i++)
+        offsets.push_back(entry.offsets[positions ? (*positions)[i] : i]);
+    }
+  }
+
+  std::vector<chat::IncomingMessageResponse> page;
+  size_t page_bytes = 0;
+  for (size_t i = 0; i < offsets.size(); i++)
+  {
+    chat::StoredMessage record;
+    if (!read_record(offsets[i], record))
+      continue;
+
+    size_t record_bytes = record.message().ByteSizeLong();
+    if (!page.empty() && (page.size() == HISTORY_PAGE_SIZE || page_bytes + record_bytes > BUFFER_SIZE / 2))
+    {
+      if (!on_page(page, false))
+        return;
+      page.clear();
+      page_bytes = 0;
+    }
+    page.push_back(record.message());
+    page_bytes += record_bytes;
+  }
+
+  // Always answer with a final page, even an empty one
+  on_page(page, true);
+}
+
+/**
+ * Forces the log to stable storage
+ */
+void MessageHistory::flush()
+{
+  std::lock_guard<std::mutex> lock(history_mutex);
+  if (fd != -1)
+    fsync(fd);
+}
+
+/**
+ * Direct conversations are keyed by both usernames, in order, so both sides share the key
+ */
+std::string MessageHistory::direct_conversation(const std::string &user_a, const std::string &user_b)
+{
+  // Unit separator, it can not be typed as part of a username
+  if (user_a < user_b)
+    return user_a + '\x1f' + user_b;
+  return user_b + '\x1f' + user_a;
+}
+
+void MessageHistory::index_record(const std::string &conversation, uint64_t offset, const chat::IncomingMessageResponse &message)
+{
+  Conversation &entry = conversations[conversation];
+  if (entry.offsets.size() % HISTORY_INDEX_STRIDE == 0)
+  {
+    entry.marks.push_back({message.timestamp(), entry.offsets.size()});
+  }
+  entry.senders[message.sender()].push_back(entry.offsets.size());
+  entry.offsets.push_back(offset);
+}
+
+bool MessageHistory::read_record(uint64_t offset, chat::StoredMessage &record, uint32_t *record_length) const
+{
+  uint32_t length;
+  if (pread(fd, &length, FRAME_HEADER_SIZE, offset) != static_cast<ssize_t>(FRAME_HEADER_SIZE))
+    return false;
+  length = ntohl(length);
+
+  std::string buffer(length, '\0');
+  if (pread(fd, &buffer[0], length, offset + FRAME_HEADER_SIZE) != static_cast<ssize_t>(length))
+    return false;
+  if (record_length)
+    *record_length = length;
+  return record.ParseFromString(buffer);
+}
+
+/**
+ * First position of the conversation whose timestamp is >= the given one
+ */
+size_t MessageHistory::lower_bound(const Conversation &conversation, int64_t timestamp) const
+{
+  // Last mark strictly before the timestamp, everything before it is older too
+  auto mark = std::lower_bound(conversation.marks.begin(), conversation.marks.end(), timestamp,
+                               [](const TimeMark &m, int64_t t)
+                               { return m.timestamp < t; });
+  if (mark == conversation.marks.begin())
+    return 0;
+  --mark;
+
+  // Scan at most one stride of records from disk
+  size_t position = mark->position;
+  chat::StoredMessage record;
+  while (position < conversation.offsets.size() && read_record(conversation.offsets[position], record) && record.message().timestamp() < timestamp)
+  {
+    position++;
+  }
+  return position;
+}
@@ -0,0 +1,76 @@
+// history.h
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include "chat.pb.h"
+#include "constants.h"
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>    // For uint64_t, int64_t
+#include <functional> // For std::function
+
+// Conversation key used for the broadcast channel
+const std::string BROADCAST_CONVERSATION = "*";
+
+// Called for every page of a query, returning false stops the query
+using HistoryPageCallback = std::function<bool(const std::vector<chat::IncomingMessageResponse> &page, bool last_page)>;
+
+// Range of a history query, timestamps in milliseconds since epoch and 0 for no bound
+struct HistoryQuery
+{
+  int64_t since = 0; // Inclusive, when set the oldest messages of the range are returned first
+  int64_t until = 0; // Exclusive
+  size_t limit = 0;
+  std::string sender;       // Only messages of this sender, empty for all of them
+  int64_t visible_from = 0; // Older messages are hidden, unlike since it keeps the latest first
+};
+
+/**
+ * Append-only message log with per-conversation indexes.
+ *
+ * Records are kept on disk as length prefixed StoredMessage frames. In memory each
+ * conversation only keeps the file offsets of its records and a sparse time index
+ * with one mark every HISTORY_INDEX_STRIDE messages, so a time range lookup costs a
+ * binary search plus at most one stride of record reads. The positions of every
+ * sender's records are kept too, so filtering by sender skips the other records.
+ */
+class MessageHistory
+{
+public:
+  ~MessageHistory();
+
+  bool open(const std::string &path);
+  void append(const std::string &conversation, chat::IncomingMessageResponse &message);
+  void query(const std::string &conversation, const HistoryQuery &range, const HistoryPageCallback &on_page);
+  void flush();
+
+  static std::string direct_conversation(const std::string &user_a, const std::string &user_b);
+
+private:
+  struct TimeMark
+  {
+    int64_t timestamp;
+    size_t position;
+  };
+
+  struct Conversation
+  {
+    std::vector<uint64_t> offsets; // File offset of every record of the conversation, in order
+    std::vector<TimeMark> marks;   // Timestamp of every HISTORY_INDEX_STRIDE-th record
+    std::map<std::string, std::vector<size_t>> senders; // Positions in offsets of each sender's records
+  };
+
+  void index_record(const std::string &conversation, uint64_t offset, const chat::IncomingMessageResponse &message);
+  bool read_record(uint64_t offset, chat::StoredMessage &record, uint32_t *record_length = nullptr) const;
+  size_t lower_bound(const Conversation &conversation, int64_t timestamp) const;
+
+  int fd = -1;
+  uint64_t end_offset = 0;
+  int64_t last_timestamp = 0;
+  std::map<std::string, Conversation> conversations;
+  std::mutex history_mutex;
+};
+
+#endif // HISTORY_H
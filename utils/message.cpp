@@ -1,65 +1,484 @@
 // message.cpp
 #include "message.h"
+#include "compression.h"
 #include <iostream> // For std::cerr
 #include <vector>   // For std::vector
 #include <cstring>  // For memcpy
 #include <unistd.h> // For ssize_t
 #include <cerrno>   // For errno
+#include <mutex>    // For std::mutex
+#include <unordered_set> // For std::unordered_set
+#include <atomic>   // For std::atomic
+#include <thread>   // For std::this_thread::yield
+#include <algorithm> // For std::min
+#include <poll.h>   // For poll
+#include <sys/ioctl.h>    // For ioctl
+#include <linux/sockios.h> // For SIOCOUTQ
 
-bool SPM(int sock, const google::protobuf::Message &message)
+// Frames for one socket may come from several threads, a striped lock keeps them from interleaving
+static std::mutex send_locks[SEND_LOCK_STRIPES];
+
+static void (*send_hook)(int sock) = nullptr;
+
+void set_send_hook(void (*hook)(int sock))
+{
+  send_hook = hook;
+}
+
+// Sockets that negotiated compression, striped like the send locks
+static std::mutex compression_locks[SEND_LOCK_STRIPES];
+static std::unordered_set<int> compressed_sockets[SEND_LOCK_STRIPES];
+
+void set_compression(int sock, bool enabled)
+{
+  std::lock_guard<std::mutex> lock(compression_locks[sock % SEND_LOCK_STRIPES]);
+  if (enabled)
+    compressed_sockets[sock % SEND_LOCK_STRIPES].insert(sock);
+  else
+    compressed_sockets[sock % SEND_LOCK_STRIPES].erase(sock);
+}
+
+bool compression_enabled(int sock)
+{
+  std::lock_guard<std::mutex> lock(compression_locks[sock % SEND_LOCK_STRIPES]);
+  return compressed_sockets[sock % SEND_LOCK_STRIPES].count(sock) > 0;
+}
+
+// A chunk's payload starts with its transfer id and the size of the whole message
+static constexpr size_t CHUNK_HEADER_SIZE = 2 * sizeof(uint32_t);
+
+// Transfer ids only have to be unique among the transfers of one connection
+static std::atomic<uint32_t> next_transfer{1};
+
+/**
+ * Compressed version of a frame, or the frame itself when it is small or does not shrink.
+ * A fan-out sends the same frame to many sockets in a row, so the last result of each
+ * thread is kept and reused while the frame stays the same. The reference is valid until
+ * the next call from the same thread.
+ */
+static const std::string &compressed_frame(const std::string &frame)
 {
-  std::string output;
-  message.SerializeToString(&output);
+  thread_local std::string last_frame;
+  thread_local std::string last_wire;
+  thread_local bool last_shrunk = false;
 
-  // Ensure the message fits in the buffer
-  if (output.size() > BUFFER_SIZE)
+  if (frame.size() < FRAME_HEADER_SIZE + COMPRESSION_THRESHOLD)
+    return frame;
+
+  // Chunks carry a slice of a message, never compressed
+  uint32_t header;
+  memcpy(&header, frame.data(), FRAME_HEADER_SIZE);
+  if (ntohl(header) & FRAME_CHUNK)
+    return frame;
+  if (frame == last_frame)
+    return last_shrunk ? last_wire : frame;
+
+  std::string payload;
+  last_frame = frame;
+  last_shrunk = compress_payload(frame.data() + FRAME_HEADER_SIZE, frame.size() - FRAME_HEADER_SIZE, payload);
+  if (last_shrunk)
   {
-    std::cerr << "Message size exceeds buffer capacity. Size: " << output.size() << ", Buffer Capacity: " << BUFFER_SIZE << std::endl;
-    return false;
+    uint32_t length = htonl(static_cast<uint32_t>(payload.size()) | FRAME_COMPRESSED);
+    last_wire.assign(reinterpret_cast<const char *>(&length), FRAME_HEADER_SIZE);
+    last_wire += payload;
+    return last_wire;
   }
+  return frame;
+}
 
-  // Send the message directly
-  ssize_t sentBytes = send(sock, output.data(), output.size(), 0);
-  if (sentBytes < 0)
+/**
+ * Parses a frame payload, inflating it first when the header says it is compressed
+ */
+static bool parse_payload(const char *data, uint32_t length, bool compressed, google::protobuf::Message &message)
+{
+  if (!compressed)
+    return message.ParseFromArray(data, length);
+
+  std::string payload;
+  if (!decompress_payload(data, length, BUFFER_SIZE, payload))
   {
-    perror("send failed");
+    std::cerr << "Failed to decompress the message. Bytes read: " << length << std::endl;
     return false;
   }
-  else if (sentBytes < output.size())
+  return message.ParseFromString(payload);
+}
+
+/**
+ * Finds or starts the transfer a chunk belongs to and counts the chunk's bytes as buffered,
+ * nullptr when the chunk breaks the limits
+ */
+static ChunkedTransfer *chunk_transfer(Reassembly &reassembly, const char *header, uint32_t length)
+{
+  if (length < CHUNK_HEADER_SIZE)
+  {
+    std::cerr << "Chunk too short for its header. Size: " << length << std::endl;
+    return nullptr;
+  }
+  uint32_t id;
+  uint32_t total;
+  memcpy(&id, header, sizeof(id));
+  memcpy(&total, header + sizeof(id), sizeof(total));
+  id = ntohl(id);
+  total = ntohl(total);
+  size_t size = length - CHUNK_HEADER_SIZE;
+
+  if (total > MAX_MESSAGE_SIZE)
+  {
+    std::cerr << "Chunked message exceeds the maximum size. Size: " << total << ", Maximum: " << MAX_MESSAGE_SIZE << std::endl;
+    return nullptr;
+  }
+  if (reassembly.buffered + size > MAX_CHUNKED_BYTES)
+  {
+    std::cerr << "Too many chunked bytes in flight." << std::endl;
+    return nullptr;
+  }
+  auto it = reassembly.transfers.find(id);
+  if (it == reassembly.transfers.end())
+  {
+    if (reassembly.transfers.size() >= MAX_CHUNKED_TRANSFERS)
+    {
+      std::cerr << "Too many chunked messages in flight." << std::endl;
+      return nullptr;
+    }
+    it = reassembly.transfers.emplace(id, ChunkedTransfer{total, std::string()}).first;
+  }
+  if (it->second.total != total || it->second.data.size() + size > total)
+  {
+    std::cerr << "Chunk does not match its transfer." << std::endl;
+    return nullptr;
+  }
+  reassembly.buffered += size;
+  return &it->second;
+}
+
+/**
+ * Parses a transfer whose chunks all arrived and forgets it
+ */
+static bool finish_transfer(Reassembly &reassembly, const char *header, google::protobuf::Message &message)
+{
+  uint32_t id;
+  memcpy(&id, header, sizeof(id));
+  auto it = reassembly.transfers.find(ntohl(id));
+  bool parsed = message.ParseFromString(it->second.data);
+  if (!parsed)
+    std::cerr << "Failed to parse the chunked message. Bytes read: " << it->second.data.size() << std::endl;
+  reassembly.buffered -= it->second.data.size();
+  reassembly.transfers.erase(it);
+  return parsed;
+}
+
+/**
+ * Writes the whole buffer, retrying on partial sends and interrupted calls
+ */
+static bool send_all(int sock, const char *data, size_t size)
+{
+  size_t total = 0;
+  while (total < size)
+  {
+    // MSG_NOSIGNAL: a peer that went away must not kill the process with SIGPIPE
+    ssize_t sentBytes = send(sock, data + total, size - total, MSG_NOSIGNAL);
+    if (sentBytes < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+      {
+        // Non-blocking socket with a full buffer, wait for room up to SEND_TIMEOUT_MS
+        struct pollfd writable = {sock, POLLOUT, 0};
+        if (poll(&writable, 1, SEND_TIMEOUT_MS) > 0)
+          continue;
+        std::cerr << "send timed out, peer is not reading." << std::endl;
+        return false;
+      }
+      perror("send failed");
+      return false;
+    }
+    total += sentBytes;
+  }
+  return true;
+}
+
+/**
+ * Reads exactly size bytes, returns false on error or disconnection
+ */
+static bool recv_all(int sock, char *data, size_t size)
+{
+  size_t total = 0;
+  while (total < size)
   {
-    std::cerr << "Not all data was sent. Sent " << sentBytes << " of " << output.size() << " bytes." << std::endl;
+    ssize_t bytesRead = recv(sock, data + total, size - total, MSG_WAITALL);
+    if (bytesRead <= 0)
+    {
+      if (bytesRead < 0 && errno == EINTR)
+        continue;
+      if (bytesRead < 0)
+        perror("recv failed");
+      else
+        std::cerr << "Connection closed by peer." << std::endl;
+      return false;
+    }
+    total += bytesRead;
+  }
+  return true;
+}
+
+bool BPF(const google::protobuf::Message &message, std::string &frame)
+{
+  size_t size = message.ByteSizeLong();
+
+  // Messages above the buffer size are sent in chunks, up to MAX_MESSAGE_SIZE
+  if (size > MAX_MESSAGE_SIZE)
+  {
+    std::cerr << "Message size exceeds the maximum. Size: " << size << ", Maximum: " << MAX_MESSAGE_SIZE << std::endl;
+    return false;
+  }
+
+  // Every frame is prefixed by its length, so back-to-back messages can be told apart. The message
+  // is serialized in place behind it, a reused frame keeps its capacity and allocates nothing.
+  frame.resize(FRAME_HEADER_SIZE + size);
+  uint32_t length = htonl(static_cast<uint32_t>(size));
+  memcpy(&frame[0], &length, FRAME_HEADER_SIZE);
+  message.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t *>(&frame[FRAME_HEADER_SIZE]));
+  return true;
+}
+
+bool CPF(const std::string &frame, std::vector<std::string> &chunks)
+{
+  if (frame.size() <= FRAME_HEADER_SIZE + BUFFER_SIZE)
     return false;
+
+  uint32_t id = htonl(next_transfer.fetch_add(1, std::memory_order_relaxed));
+  uint32_t total = htonl(static_cast<uint32_t>(frame.size() - FRAME_HEADER_SIZE));
+  chunks.clear();
+  for (size_t offset = FRAME_HEADER_SIZE; offset < frame.size(); offset += TRANSFER_CHUNK_SIZE)
+  {
+    size_t size = std::min(TRANSFER_CHUNK_SIZE, frame.size() - offset);
+    uint32_t length = htonl(static_cast<uint32_t>(CHUNK_HEADER_SIZE + size) | FRAME_CHUNK);
+    std::string chunk;
+    chunk.reserve(FRAME_HEADER_SIZE + CHUNK_HEADER_SIZE + size);
+    chunk.append(reinterpret_cast<const char *>(&length), FRAME_HEADER_SIZE);
+    chunk.append(reinterpret_cast<const char *>(&id), sizeof(id));
+    chunk.append(reinterpret_cast<const char *>(&total), sizeof(total));
+    chunk.append(frame, offset, size);
+    chunks.push_back(std::move(chunk));
   }
+  return true;
+}
+
+/**
+ * Writes one frame under the socket's send lock
+ */
+static bool send_frame(int sock, const std::string &frame)
+{
+  std::lock_guard<std::mutex> lock(send_locks[sock % SEND_LOCK_STRIPES]);
+  if (send_hook)
+    send_hook(sock);
+  if (!send_all(sock, frame.data(), frame.size()))
+    return false;
 
   if (VERBOSE)
-    std::cerr << "Sent " << sentBytes << " bytes successfully." << std::endl;
+    std::cerr << "Sent " << frame.size() - FRAME_HEADER_SIZE << " bytes successfully." << std::endl;
+
+  return true;
+}
+
+bool SPF(int sock, const std::string &frame)
+{
+  std::vector<std::string> chunks;
+  if (!CPF(frame, chunks))
+    return send_frame(sock, compression_enabled(sock) ? compressed_frame(frame) : frame);
 
+  // The lock is released after every chunk, so frames from other threads get in between
+  for (const auto &chunk : chunks)
+  {
+    if (!send_frame(sock, chunk))
+      return false;
+    std::this_thread::yield();
+  }
   return true;
 }
 
+bool SPM(int sock, const google::protobuf::Message &message)
+{
+  // Each thread reuses one frame buffer, a large message does not keep its memory pinned
+  thread_local std::string frame;
+  bool sent = BPF(message, frame) && SPF(sock, frame);
+  if (frame.capacity() > BUFFER_SIZE)
+    std::string().swap(frame);
+  return sent;
+}
+
 bool RPM(int sock, google::protobuf::Message &message)
 {
-  std::vector<char> buffer(BUFFER_SIZE);
+  // Large messages come in chunks that may be interleaved with whole frames, each socket
+  // read by this thread keeps its unfinished ones here
+  thread_local std::unordered_map<int, Reassembly> reassemblies;
+  uint32_t length;
+  bool compressed;
+  while (true)
+  {
+    // Read the frame header first to know how many bytes the message has
+    if (!recv_all(sock, reinterpret_cast<char *>(&length), FRAME_HEADER_SIZE))
+    {
+      reassemblies.erase(sock);
+      return false; // Handle errors or disconnection
+    }
+    length = ntohl(length);
+    compressed = length & FRAME_COMPRESSED;
+    bool chunk = length & FRAME_CHUNK;
+    length &= ~(FRAME_COMPRESSED | FRAME_CHUNK);
+
+    if (length > BUFFER_SIZE)
+    {
+      std::cerr << "Incoming frame exceeds buffer capacity. Size: " << length << ", Buffer Capacity: " << BUFFER_SIZE << std::endl;
+      reassemblies.erase(sock);
+      return false;
+    }
+    if (!chunk)
+      break;
 
-  // Read the data into the buffer
-  ssize_t bytesRead = recv(sock, buffer.data(), buffer.size(), 0);
-  if (bytesRead <= 0)
+    // The chunk is received straight into the message it belongs to
+    Reassembly &reassembly = reassemblies[sock];
+    char header[CHUNK_HEADER_SIZE];
+    ChunkedTransfer *transfer = nullptr;
+    if (length >= CHUNK_HEADER_SIZE && recv_all(sock, header, CHUNK_HEADER_SIZE))
+      transfer = chunk_transfer(reassembly, header, length);
+    if (!transfer)
+    {
+      reassemblies.erase(sock);
+      return false;
+    }
+    size_t size = length - CHUNK_HEADER_SIZE;
+    size_t received = transfer->data.size();
+    transfer->data.resize(received + size);
+    if (size > 0 && !recv_all(sock, &transfer->data[received], size))
+    {
+      reassemblies.erase(sock);
+      return false;
+    }
+    if (transfer->data.size() == transfer->total)
+      return finish_transfer(reassembly, header, message);
+  }
+
+  std::vector<char> buffer(length);
+  if (length > 0 && !recv_all(sock, buffer.data(), length))
   {
-    if (bytesRead < 0)
-      perror("recv failed");
-    else
-      std::cerr << "Connection closed by peer." << std::endl;
-    return false; // Handle errors or disconnection
+    reassemblies.erase(sock);
+    return false;
   }
 
   // Parse the received data
-  if (!message.ParseFromArray(buffer.data(), bytesRead))
+  if (!parse_payload(buffer.data(), length, compressed, message))
   {
-    std::cerr << "Failed to parse the message. Bytes read: " << bytesRead << std::endl;
+    std::cerr << "Failed to parse the message. Bytes read: " << length << std::endl;
     return false;
   }
 
   if (VERBOSE)
-    std::cerr << "Received " << bytesRead << " bytes successfully." << std::endl;
+    std::cerr << "Received " << length << " bytes successfully." << std::endl;
   return true;
-}
\ No newline at end of file
+}
+
+int TPF(const char *data, size_t size, google::protobuf::Message &message, size_t &consumed, Reassembly *reassembly)
+{
+  if (size < FRAME_HEADER_SIZE)
+    return 0;
+
+  uint32_t length;
+  memcpy(&length, data, FRAME_HEADER_SIZE);
+  length = ntohl(length);
+  bool compressed = length & FRAME_COMPRESSED;
+  bool chunk = length & FRAME_CHUNK;
+  length &= ~(FRAME_COMPRESSED | FRAME_CHUNK);
+  if (length > BUFFER_SIZE)
+  {
+    std::cerr << "Incoming frame exceeds buffer capacity. Size: " << length << ", Buffer Capacity: " << BUFFER_SIZE << std::endl;
+    return -1;
+  }
+  if (size < FRAME_HEADER_SIZE + length)
+    return 0;
+
+  if (chunk)
+  {
+    if (!reassembly)
+    {
+      std::cerr << "Chunked message on a connection that does not take them." << std::endl;
+      return -1;
+    }
+    const char *header = data + FRAME_HEADER_SIZE;
+    ChunkedTransfer *transfer = chunk_transfer(*reassembly, header, length);
+    if (!transfer)
+      return -1;
+    transfer->data.append(header + CHUNK_HEADER_SIZE, length - CHUNK_HEADER_SIZE);
+    consumed = FRAME_HEADER_SIZE + length;
+    if (transfer->data.size() < transfer->total)
+      return 2;
+    return finish_transfer(*reassembly, header, message) ? 1 : -1;
+  }
+
+  if (!parse_payload(data + FRAME_HEADER_SIZE, length, compressed, message))
+  {
+    std::cerr << "Failed to parse the message. Bytes read: " << length << std::endl;
+    return -1;
+  }
+
+  consumed = FRAME_HEADER_SIZE + length;
+  if (VERBOSE)
+    std::cerr << "Received " << length << " bytes successfully." << std::endl;
+  return 1;
+}
+
+const char *PPF(const char *data, size_t size, uint32_t &length)
+{
+  if (size < FRAME_HEADER_SIZE)
+    return nullptr;
+
+  uint32_t header;
+  memcpy(&header, data, FRAME_HEADER_SIZE);
+  header = ntohl(header);
+  if ((header & (FRAME_COMPRESSED | FRAME_CHUNK)) || header > BUFFER_SIZE || size < FRAME_HEADER_SIZE + header)
+    return nullptr;
+  length = header;
+  return data + FRAME_HEADER_SIZE;
+}
+
+int TSF(int sock, const std::string &plain_frame)
+{
+  if (plain_frame.size() > FRAME_HEADER_SIZE + BUFFER_SIZE)
+  {
+    std::cerr << "Frame too large for one send, split it with CPF. Size: " << plain_frame.size() << std::endl;
+    return -1;
+  }
+
+  const std::string &frame = compression_enabled(sock) ? compressed_frame(plain_frame) : plain_frame;
+  std::lock_guard<std::mutex> lock(send_locks[sock % SEND_LOCK_STRIPES]);
+
+  // Only start a frame the socket buffer can take whole, a partial one would have to be finished
+  // blocking. An empty queue starts any frame, one larger than the buffer would never fit.
+  int queued = 0;
+  int buffer_size = 0;
+  socklen_t option_size = sizeof(buffer_size);
+  if (ioctl(sock, SIOCOUTQ, &queued) == 0 && queued > 0 && getsockopt(sock, SOL_SOCKET, SO_SNDBUF, &buffer_size, &option_size) == 0 &&
+      buffer_size / 2 - queued < static_cast<int>(frame.size()))
+    return 0; // SO_SNDBUF reports twice the payload room, the kernel keeps the rest for bookkeeping
+
+  if (send_hook)
+    send_hook(sock);
+  ssize_t sentBytes = send(sock, frame.data(), frame.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+  if (sentBytes < 0)
+  {
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+      return 0;
+    perror("send failed");
+    return -1;
+  }
+
+  // Part of the frame is out, finish it before releasing the lock so no other frame interleaves
+  size_t sent = static_cast<size_t>(sentBytes);
+  if (sent < frame.size() && !send_all(sock, frame.data() + sent, frame.size() - sent))
+    return -1;
+
+  if (VERBOSE)
+    std::cerr << "Sent " << frame.size() - FRAME_HEADER_SIZE << " bytes successfully." << std::endl;
+  return 1;
+}
@@ -5,13 +5,62 @@
 #include "constants.h"
 #include <vector>
 #include <string>
+#include <unordered_map>
 #include <cstdint>                   // For uint32_t
 #include <sys/types.h>               // For ssize_t
 #include <sys/socket.h>              // For send, recv, and MSG_WAITALL
 #include <netinet/in.h>              // For htonl, ntohl
 #include <google/protobuf/message.h> // For Google Protobuf
 
+// Large messages: BPF takes messages up to MAX_MESSAGE_SIZE, frames above BUFFER_SIZE go on the
+// wire as FRAME_CHUNK frames of TRANSFER_CHUNK_SIZE bytes that other frames can be sent in between.
+// Receivers append each chunk as it arrives, so a message is only buffered once, and the buffer
+// only grows with bytes that did arrive whatever size the first chunk announces.
+struct ChunkedTransfer
+{
+  uint32_t total;   // Size of the whole message
+  std::string data; // Bytes received so far
+};
+
+// Chunked messages still arriving on one connection, by transfer id, and the bytes they hold
+struct Reassembly
+{
+  std::unordered_map<uint32_t, ChunkedTransfer> transfers;
+  size_t buffered = 0;
+};
+
 bool SPM(int sock, const google::protobuf::Message &message); // SPM: Send Protobuf Message
 bool RPM(int sock, google::protobuf::Message &message);       // RPM: Receive Protobuf Message
 
+// Fan-out helpers: serialize once with BPF, then send the same frame to many sockets with SPF
+bool BPF(const google::protobuf::Message &message, std::string &frame); // BPF: Build Protobuf Frame
+bool SPF(int sock, const std::string &frame);                            // SPF: Send Protobuf Frame
+
+// Splits a frame above BUFFER_SIZE into chunk frames, returns false when it fits in one frame
+bool CPF(const std::string &frame, std::vector<std::string> &chunks); // CPF: Chunk Protobuf Frame
+
+// Non-blocking receive side: parses the first frame of a byte buffer.
+// Returns 1 and sets consumed when a message was parsed, 0 when the frame is incomplete, -1 on a bad frame.
+// Chunks are gathered in reassembly (refused without one), 2 means a chunk was consumed and its
+// message is not complete yet.
+int TPF(const char *data, size_t size, google::protobuf::Message &message, size_t &consumed, Reassembly *reassembly = nullptr); // TPF: Take Protobuf Frame
+
+// Payload of the first frame of a byte buffer without parsing it, for callers that read the wire
+// bytes themselves. nullptr unless the frame is complete and neither compressed nor a chunk.
+const char *PPF(const char *data, size_t size, uint32_t &length); // PPF: Peek Protobuf Frame
+
+// Non-blocking send side: returns 1 when the frame was sent, 0 when the socket buffer cannot
+// take it whole and nothing was written (retry once it drains), -1 on error. Frames above
+// BUFFER_SIZE must be split with CPF first.
+int TSF(int sock, const std::string &frame); // TSF: Try Send Frame
+
+// Called by SPF and TSF with the socket's send lock held, right before a frame is written.
+// The server uses it to apply each connection's flush policy; no hook is set by default.
+void set_send_hook(void (*hook)(int sock));
+
+// Negotiated per connection: SPF and TSF deflate the frames of a socket with compression enabled
+// once their payload reaches COMPRESSION_THRESHOLD. Receiving inflates flagged frames either way.
+void set_compression(int sock, bool enabled);
+bool compression_enabled(int sock);
+
 #endif // MESSAGE_H
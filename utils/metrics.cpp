@@ -0,0 +1,50 @@
+// metrics.cpp
+#include "metrics.h"
+#include <map>
+#include <mutex>
+#include <memory>
+
+static std::mutex metrics_mutex;
+static std::map<std::string, std::unique_ptr<Metric>> metrics;
+
+void Metric::observe(uint64_t value)
+{
+  samples.fetch_add(1, std::memory_order_relaxed);
+  total.fetch_add(value, std::memory_order_relaxed);
+  uint64_t current = maximum.load(std::memory_order_relaxed);
+  while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+  {
+  }
+}
+
+void Metric::report(const std::string &name, std::ostream &out) const
+{
+  uint64_t count = samples.load(std::memory_order_relaxed);
+  uint64_t sum = total.load(std::memory_order_relaxed);
+  if (count == 0)
+  {
+    out << name << " " << sum << std::endl;
+  }
+  else
+  {
+    out << name << " count=" << count << " avg=" << sum / count << " max=" << maximum.load(std::memory_order_relaxed) << std::endl;
+  }
+}
+
+Metric &metric(const std::string &name)
+{
+  std::lock_guard<std::mutex> lock(metrics_mutex);
+  std::unique_ptr<Metric> &entry = metrics[name];
+  if (!entry)
+    entry.reset(new Metric());
+  return *entry;
+}
+
+void report_metrics(std::ostream &out)
+{
+  std::lock_guard<std::mutex> lock(metrics_mutex);
+  for (const auto &entry : metrics)
+  {
+    entry.second->report(entry.first, out);
+  }
+}
@@ -0,0 +1,34 @@
+// metrics.h
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <atomic>
+#include <string>
+#include <ostream>
+#include <cstdint> // For uint64_t
+
+/**
+ * A named counter or distribution, updated with relaxed atomics so it can sit on hot paths.
+ * add() counts events, observe() records samples and reports their count, mean and max.
+ */
+class Metric
+{
+public:
+  void add(uint64_t value = 1) { total.fetch_add(value, std::memory_order_relaxed); }
+  void observe(uint64_t value);
+  void report(const std::string &name, std::ostream &out) const;
+
+private:
+  std::atomic<uint64_t> total{0};
+  std::atomic<uint64_t> samples{0};
+  std::atomic<uint64_t> maximum{0};
+};
+
+// Returns the metric registered under name, creating it on first use. The reference stays valid,
+// hot paths keep it in a static local: static Metric &sent = metric("net.bytes_sent");
+Metric &metric(const std::string &name);
+
+// Prints every registered metric, one per line, sorted by name
+void report_metrics(std::ostream &out);
+
+#endif // METRICS_H
@@ -0,0 +1,108 @@
+// outbox.cpp
+#include "outbox.h"
+#include "message.h"
+#include "constants.h"
+#include <mutex>
+#include <condition_variable>
+#include <unordered_map>
+#include <unistd.h> // For close
+
+// Frames queued for each socket and not sent yet, whether it was closed meanwhile, and the replies
+// queued and sent so far; striped like the send locks
+struct SocketHold
+{
+  uint32_t frames = 0;
+  bool closed = false;
+  uint64_t replies_queued = 0;
+  uint64_t replies_sent = 0;
+};
+static std::mutex hold_locks[SEND_LOCK_STRIPES];
+static std::condition_variable reply_sent[SEND_LOCK_STRIPES];
+static std::unordered_map<int, SocketHold> held_sockets[SEND_LOCK_STRIPES];
+
+void Outbox::queue(int sock, std::shared_ptr<const std::string> frame, bool reply)
+{
+  uint64_t after_replies;
+  {
+    std::lock_guard<std::mutex> lock(hold_locks[sock % SEND_LOCK_STRIPES]);
+    SocketHold &hold = held_sockets[sock % SEND_LOCK_STRIPES][sock];
+    hold.frames++;
+    after_replies = reply ? hold.replies_queued++ : hold.replies_queued;
+  }
+  frames.push_back({sock, reply, after_replies, std::move(frame)});
+}
+
+void Outbox::add(int sock, std::shared_ptr<const std::string> frame)
+{
+  queue(sock, std::move(frame), false);
+}
+
+void Outbox::add_reply(int sock, const google::protobuf::Message &message)
+{
+  auto frame = std::make_shared<std::string>();
+  if (BPF(message, *frame))
+    queue(sock, std::move(frame), true);
+}
+
+void Outbox::send()
+{
+  for (const auto &entry : frames)
+  {
+    const size_t stripe = entry.sock % SEND_LOCK_STRIPES;
+    bool closed;
+    {
+      // Replies queued before the frame, by earlier clients_mutex holders, go first
+      std::unique_lock<std::mutex> lock(hold_locks[stripe]);
+      SocketHold &hold = held_sockets[stripe][entry.sock];
+      reply_sent[stripe].wait(lock, [&]
+                              { return hold.replies_sent >= entry.after_replies; });
+      closed = hold.closed;
+    }
+    if (!closed)
+      SPF(entry.sock, *entry.frame);
+
+    bool close_now = false;
+    {
+      std::lock_guard<std::mutex> lock(hold_locks[stripe]);
+      auto it = held_sockets[stripe].find(entry.sock);
+      if (entry.reply)
+        it->second.replies_sent++;
+      if (--it->second.frames == 0)
+      {
+        close_now = it->second.closed;
+        held_sockets[stripe].erase(it);
+      }
+    }
+    if (entry.reply)
+      reply_sent[stripe].notify_all();
+    if (close_now)
+      close(entry.sock);
+  }
+  frames.clear();
+}
+
+size_t outbox_frames_pending()
+{
+  size_t pending = 0;
+  for (size_t stripe = 0; stripe < SEND_LOCK_STRIPES; stripe++)
+  {
+    std::lock_guard<std::mutex> lock(hold_locks[stripe]);
+    for (const auto &entry : held_sockets[stripe])
+      pending += entry.second.frames;
+  }
+  return pending;
+}
+
+int close_socket(int sock)
+{
+  {
+    std::lock_guard<std::mutex> lock(hold_locks[sock % SEND_LOCK_STRIPES]);
+    auto it = held_sockets[sock % SEND_LOCK_STRIPES].find(sock);
+    if (it != held_sockets[sock % SEND_LOCK_STRIPES].end())
+    {
+      it->second.closed = true;
+      return 0;
+    }
+  }
+  return close(sock);
+}
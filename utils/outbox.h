@@ -0,0 +1,58 @@
+// outbox.h
+#ifndef OUTBOX_H
+#define OUTBOX_H
+
+#include <google/protobuf/message.h>
+#include <memory> // For std::shared_ptr
+#include <string>
+#include <vector>
+#include <cstdint> // For uint64_t
+
+/**
+ * Notification frames picked under clients_mutex and sent once it is released. A send waits
+ * up to SEND_TIMEOUT_MS on a recipient that stopped reading, under the lock that would stall
+ * every session of the node; out of it only the sender's session waits.
+ *
+ * Sockets in an outbox are held open: close_socket on one of them leaves the close to the last
+ * outbox releasing it, so its descriptor is not reused by a new connection under a pending
+ * send. Replies queued under the lock (registration, resume) reach the client before any frame
+ * queued after them by a later lock holder; notifications of different outboxes do not wait for
+ * each other and can reach a client out of seq order, clients keep the highest seq they saw.
+ */
+class Outbox
+{
+public:
+  Outbox() = default;
+  Outbox(const Outbox &) = delete;
+  Outbox &operator=(const Outbox &) = delete;
+  ~Outbox() { send(); } // Declare it before the lock, so it only sends once that is released
+
+  // Caller holds clients_mutex, so the socket is still the recipient's, and queues every frame
+  // of the outbox within one hold of it
+  void add(int sock, std::shared_ptr<const std::string> frame);
+  void add_reply(int sock, const google::protobuf::Message &message);
+
+  // Sends the frames in the order they were added and releases their sockets
+  void send();
+
+private:
+  struct QueuedFrame
+  {
+    int sock;
+    bool reply;
+    uint64_t after_replies; // Replies to the socket that must be sent first
+    std::shared_ptr<const std::string> frame;
+  };
+  void queue(int sock, std::shared_ptr<const std::string> frame, bool reply);
+
+  std::vector<QueuedFrame> frames;
+};
+
+// Frames queued on outboxes and not sent yet, over every socket
+size_t outbox_frames_pending();
+
+// Closes a socket, or marks it for the last outbox holding it to close. Returns close's result,
+// 0 when the close is left to an outbox.
+int close_socket(int sock);
+
+#endif // OUTBOX_H
@@ -0,0 +1,242 @@
+// pool.cpp
+#include "pool.h"
+#include "constants.h"
+#include "metrics.h"
+#include <atomic>
+#include <bit>    // For std::bit_width
+#include <mutex>  // For std::mutex
+#include <vector> // For std::vector
+
+// Block sizes, powers of two so the class of a size is its bit width
+constexpr size_t SMALLEST_CLASS = 32;
+constexpr int CLASS_COUNT = 8; // 32 bytes to 4 KB
+constexpr size_t LARGEST_CLASS = SMALLEST_CLASS << (CLASS_COUNT - 1);
+
+struct FreeBlock
+{
+  FreeBlock *next;
+};
+
+// Shared side of a size class
+struct SizeClass
+{
+  std::mutex mutex;
+  FreeBlock *free = nullptr;
+  size_t free_count = 0;
+  size_t slabs = 0;
+  size_t blocks = 0; // Carved from the slabs so far
+};
+
+// A thread's free blocks of one class. Only the owner touches the list, the count is atomic
+// for the stats; both are trivially destructible so the hot path has no thread_local guard.
+struct CacheList
+{
+  FreeBlock *head = nullptr;
+  std::atomic<uint32_t> count{0};
+};
+
+// Never destroyed: detached threads may still free blocks while the process exits
+static SizeClass *classes = new SizeClass[CLASS_COUNT];
+static std::mutex &caches_mutex = *new std::mutex();
+static std::vector<CacheList *> &caches = *new std::vector<CacheList *>(); // Every live thread's lists
+
+static thread_local CacheList thread_lists[CLASS_COUNT];
+static thread_local bool thread_retired = false; // Past the cache owner's destructor, use the shared lists
+
+/**
+ * Registers the thread's lists when it first fills one and gives its blocks back when it exits
+ */
+struct CacheOwner
+{
+  bool registered = false;
+
+  void enroll()
+  {
+    if (registered)
+      return;
+    registered = true;
+    std::lock_guard<std::mutex> lock(caches_mutex);
+    caches.push_back(thread_lists);
+  }
+
+  ~CacheOwner();
+};
+
+static thread_local CacheOwner cache_owner;
+
+static int class_of(size_t size)
+{
+  return size <= SMALLEST_CLASS ? 0 : std::bit_width(size - 1) - std::bit_width(SMALLEST_CLASS - 1);
+}
+
+/**
+ * Moves up to count blocks off a list onto the class's shared list, caller holds its mutex
+ */
+static void give_back(SizeClass &size_class, FreeBlock *&head, uint32_t count)
+{
+  for (uint32_t i = 0; i < count && head; i++)
+  {
+    FreeBlock *block = head;
+    head = block->next;
+    block->next = size_class.free;
+    size_class.free = block;
+    size_class.free_count++;
+  }
+}
+
+CacheOwner::~CacheOwner()
+{
+  thread_retired = true;
+  {
+    std::lock_guard<std::mutex> lock(caches_mutex);
+    for (size_t i = 0; i < caches.size(); i++)
+    {
+      if (caches[i] == thread_lists)
+      {
+        caches[i] = caches.back();
+        caches.pop_back();
+        break;
+      }
+    }
+  }
+  for (int index = 0; index < CLASS_COUNT; index++)
+  {
+    CacheList &list = thread_lists[index];
+    std::lock_guard<std::mutex> lock(classes[index].mutex);
+    give_back(classes[index], list.head, list.count.load(std::memory_order_relaxed));
+    list.count.store(0, std::memory_order_relaxed);
+  }
+}
+
+/**
+ * Carves a new slab into the shared list, caller holds the class mutex
+ */
+static void carve_slab(SizeClass &size_class, size_t block_size)
+{
+  char *slab = static_cast<char *>(::operator new(POOL_SLAB_BYTES));
+  for (size_t offset = 0; offset + block_size <= POOL_SLAB_BYTES; offset += block_size)
+  {
+    FreeBlock *block = reinterpret_cast<FreeBlock *>(slab + offset);
+    block->next = size_class.free;
+    size_class.free = block;
+    size_class.free_count++;
+    size_class.blocks++;
+  }
+  size_class.slabs++;
+}
+
+/**
+ * Slow path: refills a thread's empty list with a batch from the shared list
+ */
+static void refill(int index, CacheList &list)
+{
+  cache_owner.enroll();
+
+  SizeClass &size_class = classes[index];
+  std::lock_guard<std::mutex> lock(size_class.mutex);
+  if (!size_class.free)
+    carve_slab(size_class, SMALLEST_CLASS << index);
+
+  uint32_t taken = 0;
+  while (taken < POOL_CACHE_BATCH && size_class.free)
+  {
+    FreeBlock *block = size_class.free;
+    size_class.free = block->next;
+    block->next = list.head;
+    list.head = block;
+    taken++;
+  }
+  size_class.free_count -= taken;
+  list.count.store(list.count.load(std::memory_order_relaxed) + taken, std::memory_order_relaxed);
+}
+
+void *pool_allocate(size_t size)
+{
+  static Metric &oversize = metric("slab.oversize");
+
+  if (size > LARGEST_CLASS)
+  {
+    oversize.add();
+    return ::operator new(size);
+  }
+
+  int index = class_of(size);
+  if (thread_retired)
+  {
+    SizeClass &size_class = classes[index];
+    std::lock_guard<std::mutex> lock(size_class.mutex);
+    if (!size_class.free)
+      carve_slab(size_class, SMALLEST_CLASS << index);
+    FreeBlock *block = size_class.free;
+    size_class.free = block->next;
+    size_class.free_count--;
+    return block;
+  }
+
+  CacheList &list = thread_lists[index];
+  if (!list.head)
+    refill(index, list);
+  FreeBlock *block = list.head;
+  list.head = block->next;
+  list.count.store(list.count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+  return block;
+}
+
+void pool_free(void *block, size_t size)
+{
+  if (size > LARGEST_CLASS)
+  {
+    ::operator delete(block);
+    return;
+  }
+
+  int index = class_of(size);
+  FreeBlock *freed = static_cast<FreeBlock *>(block);
+  if (thread_retired)
+  {
+    std::lock_guard<std::mutex> lock(classes[index].mutex);
+    give_back(classes[index], freed, 1);
+    return;
+  }
+
+  // A thread that frees more than it allocates (blocks of another thread) passes the extra on
+  CacheList &list = thread_lists[index];
+  if (!list.head)
+    cache_owner.enroll(); // A thread that never allocated still gives its blocks back on exit
+  freed->next = list.head;
+  list.head = freed;
+  uint32_t count = list.count.load(std::memory_order_relaxed) + 1;
+  if (count >= 2 * POOL_CACHE_BATCH)
+  {
+    std::lock_guard<std::mutex> lock(classes[index].mutex);
+    give_back(classes[index], list.head, POOL_CACHE_BATCH);
+    count -= POOL_CACHE_BATCH;
+  }
+  list.count.store(count, std::memory_order_relaxed);
+}
+
+void report_pools(std::ostream &out)
+{
+  std::lock_guard<std::mutex> lock(caches_mutex);
+  for (int index = 0; index < CLASS_COUNT; index++)
+  {
+    SizeClass &size_class = classes[index];
+    size_t slabs, blocks, free;
+    {
+      std::lock_guard<std::mutex> class_lock(size_class.mutex);
+      slabs = size_class.slabs;
+      blocks = size_class.blocks;
+      free = size_class.free_count;
+    }
+    if (slabs == 0)
+      continue;
+
+    // Thread counts are read while their owners run, the split between in use and cached is approximate
+    for (CacheList *lists : caches)
+      free += lists[index].count.load(std::memory_order_relaxed);
+    const std::string prefix = "slab." + std::to_string(SMALLEST_CLASS << index);
+    out << prefix << ".count " << slabs << std::endl;
+    out << prefix << ".in_use " << (blocks > free ? blocks - free : 0) << std::endl;
+    out << prefix << ".free " << free << std::endl;
+  }
+}
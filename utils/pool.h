@@ -0,0 +1,50 @@
+// pool.h
+#ifndef POOL_H
+#define POOL_H
+
+#include <ostream>
+#include <new>     // For std::bad_alloc
+#include <cstddef> // For size_t, std::max_align_t
+#include <cstdint> // For SIZE_MAX
+
+/**
+ * Size-class slab pools for what connections churn through: session structs and coroutine
+ * frames, request and task queue nodes. Each class carves POOL_SLAB_BYTES slabs into equal
+ * blocks. Every thread caches free blocks per class, so an allocation pops a pointer off a
+ * thread local list; caches trade POOL_CACHE_BATCH blocks at a time with the class's shared
+ * list. Slabs are never handed back, memory grows to the peak of live blocks and then stays
+ * flat however connections come and go. Sizes above the largest class go to the heap.
+ */
+
+void *pool_allocate(size_t size);
+void pool_free(void *block, size_t size); // size must be the one it was allocated with
+
+// Per class: slabs, blocks in use and free blocks, in the metrics format
+void report_pools(std::ostream &out);
+
+// STL allocator over the pools
+template <typename T>
+struct PoolAllocator
+{
+  static_assert(alignof(T) <= alignof(std::max_align_t), "Pool blocks are only aligned like the heap");
+  using value_type = T;
+
+  PoolAllocator() = default;
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U> &) {}
+
+  T *allocate(size_t n)
+  {
+    if (n > SIZE_MAX / sizeof(T))
+      throw std::bad_alloc();
+    return static_cast<T *>(pool_allocate(n * sizeof(T)));
+  }
+  void deallocate(T *block, size_t n) { pool_free(block, n * sizeof(T)); }
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U> &) const { return true; }
+  template <typename U>
+  bool operator!=(const PoolAllocator<U> &) const { return false; }
+};
+
+#endif // POOL_H
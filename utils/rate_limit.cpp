@@ -0,0 +1,77 @@
+// rate_limit.cpp
+#include "rate_limit.h"
+#include <chrono> // For std::chrono
+
+static uint32_t now_ms()
+{
+  static const auto start = std::chrono::steady_clock::now();
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+void TokenBucket::configure(RateBudget bucket_budget)
+{
+  budget = bucket_budget;
+  // Buckets start full
+  state = (static_cast<uint64_t>(budget.burst) * 1000 << 32) | now_ms();
+}
+
+/**
+ * Takes one token. Returns 0 on success, otherwise the milliseconds until a token is available
+ */
+int64_t TokenBucket::take()
+{
+  if (budget.per_second == 0)
+    return 0; // Unlimited
+
+  uint64_t current = state.load(std::memory_order_relaxed);
+  while (true)
+  {
+    uint32_t now = now_ms();
+    uint64_t tokens = current >> 32;
+    uint32_t last = static_cast<uint32_t>(current);
+
+    // Refill: per_second tokens per second is per_second milli-tokens per millisecond
+    uint64_t refilled = tokens + static_cast<uint64_t>(now - last) * budget.per_second;
+    uint64_t capacity = static_cast<uint64_t>(budget.burst) * 1000;
+    if (refilled > capacity)
+      refilled = capacity;
+
+    if (refilled < 1000)
+    {
+      return (1000 - refilled + budget.per_second - 1) / budget.per_second;
+    }
+
+    uint64_t next = ((refilled - 1000) << 32) | now;
+    if (state.compare_exchange_weak(current, next, std::memory_order_relaxed))
+      return 0;
+  }
+}
+
+ClientRateLimits::ClientRateLimits()
+{
+  for (int operation = 0; operation < chat::Operation_ARRAYSIZE; operation++)
+  {
+    operations[operation].configure(operation_budget(static_cast<chat::Operation>(operation)));
+  }
+}
+
+/**
+ * Per user budget of every request type
+ */
+RateBudget operation_budget(chat::Operation operation)
+{
+  switch (operation)
+  {
+  case chat::Operation::SEND_MESSAGE:
+  case chat::Operation::SEND_ROOM_MESSAGE:
+  case chat::Operation::BATCH: // The envelope, every message inside is charged on its own
+    return {RATE_MESSAGES_PER_SECOND, RATE_MESSAGES_BURST};
+  case chat::Operation::ACKNOWLEDGE: // Clients send at most one per frame of incoming messages
+    return {RATE_ACKS_PER_SECOND, RATE_ACKS_BURST};
+  case chat::Operation::GET_USERS:
+  case chat::Operation::GET_HISTORY:
+    return {RATE_QUERIES_PER_SECOND, RATE_QUERIES_BURST};
+  default:
+    return {RATE_OTHER_PER_SECOND, RATE_OTHER_BURST};
+  }
+}
@@ -0,0 +1,48 @@
+// rate_limit.h
+#ifndef RATE_LIMIT_H
+#define RATE_LIMIT_H
+
+#include "chat.pb.h"
+#include "constants.h"
+#include <atomic>
+#include <memory>
+#include <cstdint> // For uint64_t, int64_t
+
+// Sustained rate and burst size of a token bucket
+struct RateBudget
+{
+  uint32_t per_second;
+  uint32_t burst;
+};
+
+/**
+ * Token bucket whose whole state (milli-tokens and last refill time) is packed in one
+ * 64-bit atomic, so taking a token is a single compare-and-swap with no lock.
+ */
+class TokenBucket
+{
+public:
+  explicit TokenBucket(RateBudget budget = {0, 0}) { configure(budget); }
+  void configure(RateBudget budget);
+  int64_t take();
+
+private:
+  RateBudget budget;
+  std::atomic<uint64_t> state; // High 32 bits: milli-tokens, low 32 bits: refill time in ms
+};
+
+/**
+ * Budgets of one client: a bucket per Operation, owned by the connection thread, plus
+ * the buckets shared by every connection from the same IP.
+ */
+struct ClientRateLimits
+{
+  TokenBucket operations[chat::Operation_ARRAYSIZE];
+  std::shared_ptr<TokenBucket> ip_bucket;
+
+  ClientRateLimits();
+};
+
+RateBudget operation_budget(chat::Operation operation);
+
+#endif // RATE_LIMIT_H
@@ -0,0 +1,106 @@
+// receipts.cpp
+#include "receipts.h"
+#include "metrics.h"
+#include <cstdlib> // For calloc, free
+#include <new>     // For std::bad_alloc
+
+static_assert((RECEIPT_TRACKING_SLOTS & (RECEIPT_TRACKING_SLOTS - 1)) == 0, "The slot of an id is a mask of it");
+
+ReceiptTracker::ReceiptTracker()
+    : slots(static_cast<Slot *>(calloc(RECEIPT_TRACKING_SLOTS, sizeof(Slot))))
+{
+  if (!slots)
+    throw std::bad_alloc();
+}
+
+ReceiptTracker::~ReceiptTracker()
+{
+  free(slots);
+}
+
+uint64_t ReceiptTracker::track(UserId sender, uint32_t sender_wire, uint32_t recipient_wire)
+{
+  static Metric &tracked = metric("receipts.tracked");
+  static Metric &evicted = metric("receipts.evicted");
+
+  uint64_t id = next_id.fetch_add(1, std::memory_order_relaxed);
+  size_t index = id & (RECEIPT_TRACKING_SLOTS - 1);
+  std::lock_guard<std::mutex> lock(slot_locks[index % RECEIPT_LOCK_STRIPES]);
+  Slot &slot = slots[index];
+  if (slot.id != 0 && slot.state != READ)
+    evicted.add();
+  slot = {id, sender, sender_wire, recipient_wire, SENT, false};
+  tracked.add();
+  return id;
+}
+
+void ReceiptTracker::acknowledge(uint64_t id, uint32_t recipient_wire, bool read)
+{
+  static Metric &stale = metric("receipts.stale");
+
+  size_t index = id & (RECEIPT_TRACKING_SLOTS - 1);
+  UserId sender;
+  uint32_t sender_wire;
+  {
+    std::lock_guard<std::mutex> lock(slot_locks[index % RECEIPT_LOCK_STRIPES]);
+    Slot &slot = slots[index];
+    if (slot.id != id || slot.recipient_wire != recipient_wire)
+    {
+      stale.add();
+      return;
+    }
+    uint8_t state = read ? READ : DELIVERED;
+    if (state <= slot.state)
+      return; // Repeated acknowledgement
+    slot.state = state;
+    if (slot.queued)
+      return; // Already waiting, the round reports the latest state
+    slot.queued = true;
+    sender = slot.sender;
+    sender_wire = slot.sender_wire;
+  }
+
+  std::lock_guard<std::mutex> lock(pending_mutex);
+  Queued &queued = pending[sender_wire];
+  queued.sender = sender;
+  queued.ids.push_back(id);
+}
+
+void ReceiptTracker::take_pending(std::vector<SenderReceipts> &out)
+{
+  static Metric &delivered = metric("receipts.delivered");
+  static Metric &read = metric("receipts.read");
+
+  std::unordered_map<uint32_t, Queued> taken;
+  {
+    std::lock_guard<std::mutex> lock(pending_mutex);
+    taken.swap(pending);
+  }
+
+  for (auto &entry : taken)
+  {
+    SenderReceipts receipts{entry.second.sender, entry.first, {}, {}};
+    for (uint64_t id : entry.second.ids)
+    {
+      size_t index = id & (RECEIPT_TRACKING_SLOTS - 1);
+      std::lock_guard<std::mutex> lock(slot_locks[index % RECEIPT_LOCK_STRIPES]);
+      Slot &slot = slots[index];
+      if (slot.id != id)
+        continue; // Evicted in between
+      slot.queued = false;
+      if (slot.state == READ)
+      {
+        receipts.read.push_back(id);
+        slot.id = 0; // Nothing more can happen to it
+      }
+      else
+      {
+        receipts.delivered.push_back(id);
+      }
+    }
+    delivered.add(receipts.delivered.size());
+    read.add(receipts.read.size());
+    if (!receipts.delivered.empty() || !receipts.read.empty())
+      out.push_back(std::move(receipts));
+  }
+}
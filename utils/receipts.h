@@ -0,0 +1,79 @@
+// receipts.h
+#ifndef RECEIPTS_H
+#define RECEIPTS_H
+
+#include "constants.h"
+#include "user_directory.h"
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <unordered_map>
+#include <cstdint> // For uint64_t, uint32_t
+
+// Receipts waiting to go out to one sender, coalesced: a read message is only listed as read
+struct SenderReceipts
+{
+  UserId sender;
+  uint32_t sender_wire; // Wire id of the sending session, tells it from a later user in the same slot
+  std::vector<uint64_t> delivered;
+  std::vector<uint64_t> read;
+};
+
+/**
+ * Delivery tracking of direct messages.
+ *
+ * Ids are handed out in sequence and each lives in slot id % RECEIPT_TRACKING_SLOTS of a fixed
+ * ring, so the memory is bounded whatever the number of outstanding messages: a message that
+ * was never acknowledged is forgotten once the ids come around to its slot. Acknowledgements
+ * queue the message for its sender; take_pending collects them and the server sends each
+ * sender one RECEIPTS notification per round.
+ */
+class ReceiptTracker
+{
+public:
+  ReceiptTracker();
+  ~ReceiptTracker();
+
+  // Starts tracking a direct message, returns its id
+  uint64_t track(UserId sender, uint32_t sender_wire, uint32_t recipient_wire);
+
+  // The recipient got (or read) a message, ignored unless it comes from the recipient's session
+  void acknowledge(uint64_t id, uint32_t recipient_wire, bool read);
+
+  // Receipts acknowledged since the last call, one entry per sender
+  void take_pending(std::vector<SenderReceipts> &out);
+
+private:
+  enum State : uint8_t
+  {
+    SENT = 1,
+    DELIVERED,
+    READ
+  };
+
+  struct Slot
+  {
+    uint64_t id; // 0 for a free slot
+    UserId sender;
+    uint32_t sender_wire;
+    uint32_t recipient_wire;
+    uint8_t state;
+    bool queued; // Waiting in pending for the next round
+  };
+
+  Slot *slots; // Zeroed lazily by the kernel, untouched pages cost nothing
+  std::atomic<uint64_t> next_id{1};
+  std::mutex slot_locks[RECEIPT_LOCK_STRIPES];
+
+  // Acknowledged messages of one sender, their state is read from the slots when they go out
+  struct Queued
+  {
+    UserId sender;
+    std::vector<uint64_t> ids;
+  };
+
+  std::mutex pending_mutex;
+  std::unordered_map<uint32_t, Queued> pending; // By sender wire id
+};
+
+#endif // RECEIPTS_H
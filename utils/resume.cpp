@@ -0,0 +1,22 @@
+// resume.cpp
+#include "resume.h"
+#include "constants.h"
+
+void ResumeBuffer::push(uint64_t seq, std::shared_ptr<const std::string> frame, bool expire)
+{
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  if (expire)
+  {
+    while (!frames.empty() && now - frames.front().sent > std::chrono::milliseconds(RESUME_BUFFER_MS))
+      frames.pop_front();
+  }
+  if (frames.size() >= RESUME_BUFFER_FRAMES)
+    frames.pop_front();
+  frames.push_back({seq, std::move(frame), now});
+}
+
+void ResumeBuffer::acknowledge(uint64_t seq)
+{
+  while (!frames.empty() && frames.front().seq <= seq)
+    frames.pop_front();
+}
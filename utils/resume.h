@@ -0,0 +1,62 @@
+// resume.h
+#ifndef RESUME_H
+#define RESUME_H
+
+#include <deque>
+#include <memory> // For std::shared_ptr
+#include <string>
+#include <chrono>
+#include <cstdint> // For uint64_t
+
+// A notification frame as it was sent, shared with the other recipients of its fan-out
+struct ResumeFrame
+{
+  uint64_t seq;
+  std::shared_ptr<const std::string> frame;
+  std::chrono::steady_clock::time_point sent;
+};
+
+/**
+ * Notifications sent to a session that its client has not acknowledged yet, oldest first.
+ *
+ * When the connection drops they are what may have been lost on the way, a RESUME sends again
+ * the ones after the last seq the client saw. Only references are kept, a fan-out frame is not
+ * copied per recipient. Bounded by RESUME_BUFFER_FRAMES, and by RESUME_BUFFER_MS for the frames
+ * of a connected session; a resume past dropped frames misses them. Not synchronized, the
+ * server guards it with clients_mutex.
+ */
+class ResumeBuffer
+{
+public:
+  // Keeps a frame, expire drops the ones sent more than RESUME_BUFFER_MS before it
+  void push(uint64_t seq, std::shared_ptr<const std::string> frame, bool expire);
+
+  // The client received everything up to seq
+  void acknowledge(uint64_t seq);
+
+  // Calls f(frame) for each frame after seq, in order
+  template <typename F>
+  void for_each_after(uint64_t seq, F f) const
+  {
+    for (const ResumeFrame &entry : frames)
+    {
+      if (entry.seq > seq)
+        f(entry.frame);
+    }
+  }
+
+  // Calls f(entry) for every frame kept, oldest first
+  template <typename F>
+  void for_each(F f) const
+  {
+    for (const ResumeFrame &entry : frames)
+      f(entry);
+  }
+
+  size_t size() const { return frames.size(); }
+
+private:
+  std::deque<ResumeFrame> frames;
+};
+
+#endif // RESUME_H
@@ -0,0 +1,57 @@
+// ring.h
+#ifndef RING_H
+#define RING_H
+
+#include <atomic>
+#include <vector>
+#include <cstddef> // For size_t
+
+/**
+ * Bounded single producer, single consumer queue. Neither side waits on the other: push fails
+ * when the ring is full and pop when it is empty. Slots are constructed once and items are
+ * moved in and out, so a slot keeps the buffers of what it held before (a protobuf message
+ * stops allocating once the ring is warm). One thread may push and one may pop at a time.
+ */
+template <typename T>
+class SpscRing
+{
+public:
+  // Capacity is rounded up to a power of two
+  explicit SpscRing(size_t capacity) : slots(round_up(capacity)), mask(slots.size() - 1) {}
+
+  bool try_push(T &item)
+  {
+    size_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) == slots.size())
+      return false;
+    slots[h & mask] = std::move(item);
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool try_pop(T &item)
+  {
+    size_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire))
+      return false;
+    item = std::move(slots[t & mask]);
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+private:
+  static size_t round_up(size_t capacity)
+  {
+    size_t size = 1;
+    while (size < capacity)
+      size <<= 1;
+    return size;
+  }
+
+  std::vector<T> slots;
+  size_t mask;
+  alignas(64) std::atomic<size_t> head{0}; // Next slot to fill, written by the producer
+  alignas(64) std::atomic<size_t> tail{0}; // Next slot to take, written by the consumer
+};
+
+#endif // RING_H
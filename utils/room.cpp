@@ -0,0 +1,113 @@
+// room.cpp
+#include "room.h"
+#include <algorithm> // For std::lower_bound, std::binary_search, std::find
+
+/**
+ * Adds the socket to the room, returns false if it was already a member
+ */
+bool RoomDirectory::join(const std::string &room, int sock)
+{
+  std::lock_guard<std::mutex> lock(rooms_mutex);
+  std::vector<int> &members = rooms[room];
+  auto it = std::lower_bound(members.begin(), members.end(), sock);
+  if (it != members.end() && *it == sock)
+    return false;
+
+  members.insert(it, sock);
+  rooms_by_socket[sock].push_back(room);
+  return true;
+}
+
+/**
+ * Removes the socket from the room, returns false if it was not a member
+ */
+bool RoomDirectory::leave(const std::string &room, int sock)
+{
+  std::lock_guard<std::mutex> lock(rooms_mutex);
+  auto room_it = rooms.find(room);
+  if (room_it == rooms.end())
+    return false;
+
+  std::vector<int> &members = room_it->second;
+  auto it = std::lower_bound(members.begin(), members.end(), sock);
+  if (it == members.end() || *it != sock)
+    return false;
+
+  members.erase(it);
+  if (members.empty())
+    rooms.erase(room_it);
+
+  std::vector<std::string> &joined = rooms_by_socket[sock];
+  joined.erase(std::find(joined.begin(), joined.end(), room));
+  if (joined.empty())
+    rooms_by_socket.erase(sock);
+  return true;
+}
+
+/**
+ * Removes the socket from every room it joined, used when a session ends
+ */
+void RoomDirectory::leave_all(int sock)
+{
+  std::lock_guard<std::mutex> lock(rooms_mutex);
+  auto joined_it = rooms_by_socket.find(sock);
+  if (joined_it == rooms_by_socket.end())
+    return;
+
+  for (const auto &room : joined_it->second)
+  {
+    auto room_it = rooms.find(room);
+    if (room_it == rooms.end())
+      continue;
+    std::vector<int> &members = room_it->second;
+    auto it = std::lower_bound(members.begin(), members.end(), sock);
+    if (it != members.end() && *it == sock)
+      members.erase(it);
+    if (members.empty())
+      rooms.erase(room_it);
+  }
+  rooms_by_socket.erase(joined_it);
+}
+
+bool RoomDirectory::is_member(const std::string &room, int sock)
+{
+  std::lock_guard<std::mutex> lock(rooms_mutex);
+  auto room_it = rooms.find(room);
+  if (room_it == rooms.end())
+    return false;
+  return std::binary_search(room_it->second.begin(), room_it->second.end(), sock);
+}
+
+/**
+ * Snapshot of the member sockets, so the fan-out does not hold the directory lock
+ */
+std::vector<int> RoomDirectory::members(const std::string &room)
+{
+  std::lock_guard<std::mutex> lock(rooms_mutex);
+  auto room_it = rooms.find(room);
+  if (room_it == rooms.end())
+    return {};
+  return room_it->second;
+}
+
+/**
+ * Rooms a socket has joined, in join order
+ */
+std::vector<std::string> RoomDirectory::rooms_of(int sock)
+{
+  std::lock_guard<std::mutex> lock(rooms_mutex);
+  return rooms_of_unlocked(sock);
+}
+
+std::unique_lock<std::mutex> RoomDirectory::hold()
+{
+  return std::unique_lock<std::mutex>(rooms_mutex);
+}
+
+std::vector<std::string> RoomDirectory::rooms_of_unlocked(int sock) const
+{
+  auto joined_it = rooms_by_socket.find(sock);
+  if (joined_it == rooms_by_socket.end())
+    return {};
+  return joined_it->second;
+}
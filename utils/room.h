@@ -0,0 +1,38 @@
+// room.h
+#ifndef ROOM_H
+#define ROOM_H
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * Room membership directory.
+ *
+ * Every room keeps its member sockets in a sorted vector: membership checks are a
+ * binary search and a room broadcast walks contiguous memory. Rooms are created on
+ * the first join and dropped when the last member leaves.
+ */
+class RoomDirectory
+{
+public:
+  bool join(const std::string &room, int sock);
+  bool leave(const std::string &room, int sock);
+  void leave_all(int sock);
+  bool is_member(const std::string &room, int sock);
+  std::vector<int> members(const std::string &room);
+  std::vector<std::string> rooms_of(int sock);
+
+  // Fork based snapshots: the parent holds the directory while it forks, the child (where no
+  // other thread is left to release the lock) reads it with rooms_of_unlocked
+  std::unique_lock<std::mutex> hold();
+  std::vector<std::string> rooms_of_unlocked(int sock) const;
+
+private:
+  std::unordered_map<std::string, std::vector<int>> rooms;             // Room name to sorted member sockets
+  std::unordered_map<int, std::vector<std::string>> rooms_by_socket;   // Socket to joined rooms, for disconnect cleanup
+  std::mutex rooms_mutex;
+};
+
+#endif // ROOM_H
@@ -0,0 +1,61 @@
+// snapshot.cpp
+#include "snapshot.h"
+#include <fcntl.h>    // For open
+#include <unistd.h>   // For write, fsync, close
+#include <cstdio>     // For rename
+#include <sys/stat.h> // For fstat
+
+bool write_snapshot(const std::string &path, const chat::ServerSnapshot &snapshot)
+{
+  std::string output;
+  if (!snapshot.SerializeToString(&output))
+    return false;
+
+  std::string temporary = path + ".tmp";
+  int fd = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  if (fd == -1)
+    return false;
+
+  size_t total = 0;
+  while (total < output.size())
+  {
+    ssize_t written = write(fd, output.data() + total, output.size() - total);
+    if (written <= 0)
+    {
+      close(fd);
+      return false;
+    }
+    total += written;
+  }
+
+  // Durable before it replaces the previous snapshot
+  bool synced = fsync(fd) == 0;
+  close(fd);
+  return synced && rename(temporary.c_str(), path.c_str()) == 0;
+}
+
+bool read_snapshot(const std::string &path, chat::ServerSnapshot &snapshot)
+{
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd == -1)
+    return false;
+
+  struct stat info;
+  if (fstat(fd, &info) == -1)
+  {
+    close(fd);
+    return false;
+  }
+
+  std::string input(info.st_size, '\0');
+  size_t total = 0;
+  while (total < input.size())
+  {
+    ssize_t bytes = read(fd, &input[total], input.size() - total);
+    if (bytes <= 0)
+      break;
+    total += bytes;
+  }
+  close(fd);
+  return total == input.size() && snapshot.ParseFromString(input);
+}
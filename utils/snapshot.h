@@ -0,0 +1,16 @@
+// snapshot.h
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "chat.pb.h"
+#include <string>
+
+/**
+ * Snapshot files. The writer only uses system calls and the heap, so it is safe to run in
+ * a child forked from a multithreaded server. The file is written next to its final path
+ * and renamed into place: a reader never sees a half written snapshot.
+ */
+bool write_snapshot(const std::string &path, const chat::ServerSnapshot &snapshot);
+bool read_snapshot(const std::string &path, chat::ServerSnapshot &snapshot);
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,62 @@
+// timer.cpp
+#include "timer.h"
+#include <mutex>              // For std::mutex, std::call_once
+#include <condition_variable> // For std::condition_variable
+#include <queue>              // For std::priority_queue
+#include <thread>             // For std::thread
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+struct TimerEntry
+{
+  Clock::time_point deadline;
+  std::function<void()> callback;
+  bool operator>(const TimerEntry &other) const { return deadline > other.deadline; }
+};
+
+// Never destroyed, the timer thread waits on the condition variable until the process exits
+struct TimerQueue
+{
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::priority_queue<TimerEntry, std::vector<TimerEntry>, std::greater<TimerEntry>> entries;
+};
+static TimerQueue &timers = *new TimerQueue();
+
+static void timer_loop()
+{
+  std::unique_lock<std::mutex> lock(timers.mutex);
+  while (true)
+  {
+    if (timers.entries.empty())
+    {
+      timers.cv.wait(lock);
+      continue;
+    }
+    if (Clock::now() < timers.entries.top().deadline)
+    {
+      timers.cv.wait_until(lock, timers.entries.top().deadline);
+      continue;
+    }
+    std::function<void()> callback = std::move(const_cast<TimerEntry &>(timers.entries.top()).callback);
+    timers.entries.pop();
+    lock.unlock();
+    callback();
+    lock.lock();
+  }
+}
+
+void run_after(std::chrono::milliseconds delay, std::function<void()> callback)
+{
+  static std::once_flag started;
+  std::call_once(started, []
+                 { std::thread(timer_loop).detach(); });
+
+  std::lock_guard<std::mutex> lock(timers.mutex);
+  TimerEntry entry{Clock::now() + delay, std::move(callback)};
+  bool earliest = timers.entries.empty() || entry.deadline < timers.entries.top().deadline;
+  timers.entries.push(std::move(entry));
+  if (earliest)
+    timers.cv.notify_one();
+}
@@ -0,0 +1,14 @@
+// timer.h
+#ifndef TIMER_H
+#define TIMER_H
+
+#include <chrono>
+#include <functional>
+
+/**
+ * Shared timer for short waits. The callback runs on the timer thread once the delay passed,
+ * so it should only hand the work on (resume a coroutine on the worker pool, say).
+ */
+void run_after(std::chrono::milliseconds delay, std::function<void()> callback);
+
+#endif // TIMER_H
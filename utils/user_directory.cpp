@@ -0,0 +1,103 @@
+// user_directory.cpp
+#include "user_directory.h"
+#include <algorithm> // For std::find
+
+UserId UserDirectory::add(const std::string &name, const std::string &ip, int sock)
+{
+  auto inserted = ids.emplace(name, NO_USER);
+  if (!inserted.second)
+    return NO_USER;
+
+  UserId id;
+  if (free_ids.empty())
+  {
+    id = users.size();
+    users.emplace_back();
+  }
+  else
+  {
+    id = free_ids.back();
+    free_ids.pop_back();
+  }
+  inserted.first->second = id;
+
+  LocalUser &user = users[id];
+  user.name = name;
+  user.ip = ip;
+  user.sock = sock;
+  user.status = chat::UserStatus::ONLINE;
+  user.last_active = std::chrono::system_clock::now();
+  user.registered_at = user.last_active;
+  user.wire_id = next_wire_id++;
+
+  // A session handed over by the previous process while its client was away
+  if (sock == DETACHED)
+  {
+    user.detached_at = std::chrono::steady_clock::now();
+    detached_ids.push_back(id);
+    return id;
+  }
+
+  if (sock >= static_cast<int>(socket_ids.size()))
+    socket_ids.resize(sock + 1, NO_USER);
+  socket_ids[sock] = id;
+  return id;
+}
+
+void UserDirectory::remove(UserId id)
+{
+  if (id >= users.size() || users[id].sock == -1)
+    return;
+
+  LocalUser &user = users[id];
+  ids.erase(user.name);
+  if (user.sock == DETACHED)
+    detached_ids.erase(std::find(detached_ids.begin(), detached_ids.end(), id));
+  else
+    socket_ids[user.sock] = NO_USER;
+  user = LocalUser();
+  free_ids.push_back(id);
+}
+
+void UserDirectory::detach(UserId id)
+{
+  LocalUser &user = users[id];
+  if (user.sock < 0)
+    return;
+  socket_ids[user.sock] = NO_USER;
+  user.sock = DETACHED;
+  user.detached_at = std::chrono::steady_clock::now();
+  detached_ids.push_back(id);
+}
+
+void UserDirectory::attach(UserId id, int sock)
+{
+  LocalUser &user = users[id];
+  if (user.sock != DETACHED)
+    return;
+  detached_ids.erase(std::find(detached_ids.begin(), detached_ids.end(), id));
+  user.sock = sock;
+  if (sock >= static_cast<int>(socket_ids.size()))
+    socket_ids.resize(sock + 1, NO_USER);
+  socket_ids[sock] = id;
+}
+
+UserId UserDirectory::find(std::string_view name) const
+{
+  auto it = ids.find(name);
+  return it == ids.end() ? NO_USER : it->second;
+}
+
+UserId UserDirectory::by_socket(int sock) const
+{
+  if (sock < 0 || sock >= static_cast<int>(socket_ids.size()))
+    return NO_USER;
+  return socket_ids[sock];
+}
+
+const std::string &UserDirectory::name_by_socket(int sock) const
+{
+  static const std::string unregistered;
+  UserId id = by_socket(sock);
+  return id == NO_USER ? unregistered : users[id].name;
+}
@@ -0,0 +1,100 @@
+// user_directory.h
+#ifndef USER_DIRECTORY_H
+#define USER_DIRECTORY_H
+
+#include "chat.pb.h"
+#include "resume.h"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <unordered_set>
+#include <chrono>
+#include <cstdint> // For uint32_t
+
+// Dense id of a registered user, ids of users that left are reused
+using UserId = uint32_t;
+constexpr UserId NO_USER = UINT32_MAX;
+
+// Socket of a user whose connection dropped, kept until its client resumes or the grace period ends
+constexpr int DETACHED = -2;
+
+struct LocalUser
+{
+  std::string name;
+  std::string ip;
+  int sock = -1;
+  chat::UserStatus status = chat::UserStatus::ONLINE;
+  std::chrono::system_clock::time_point last_active;
+
+  // When the name was claimed, direct history older than that belongs to a previous owner
+  std::chrono::system_clock::time_point registered_at;
+
+  // Compact wire mode: the id messages of this user carry, never reused by the process, and
+  // for a session in compact mode the ids of the senders it was already told the name of
+  uint32_t wire_id = 0;
+  bool compact = false;
+  std::unordered_set<uint32_t> announced;
+
+  // Resumable sessions: the token (0 when the client did not ask for one), the notifications
+  // the client may not have yet and, while detached, since when and the rooms it was in
+  uint64_t resume_token = 0;
+  ResumeBuffer resume;
+  std::chrono::steady_clock::time_point detached_at;
+  std::vector<std::string> rooms;
+};
+
+/**
+ * Users registered on this node.
+ *
+ * Usernames are interned on registration: the server keeps and passes around the UserId,
+ * a slot in a vector, and only turns it back into a string when a reply is serialized.
+ * Sockets map to ids through a vector indexed by the descriptor, so the per request
+ * lookups are array accesses. Not synchronized, the server guards it with clients_mutex.
+ */
+class UserDirectory
+{
+public:
+  // Interns the username, NO_USER when it is taken. A DETACHED sock adds it already detached
+  UserId add(const std::string &name, const std::string &ip, int sock);
+  void remove(UserId id);
+
+  UserId find(std::string_view name) const; // Without building a string, for names read off the wire
+  UserId by_socket(int sock) const;
+
+  // Resumable sessions: unbinds a user from its socket, keeping the name and the slot, and binds
+  // it to the socket of the connection that resumed it
+  void detach(UserId id);
+  void attach(UserId id, int sock);
+  const std::vector<UserId> &detached() const { return detached_ids; }
+
+  LocalUser &operator[](UserId id) { return users[id]; }
+  const std::string &name(UserId id) const { return users[id].name; }
+
+  // Name of the user on a socket, empty when the socket is not registered
+  const std::string &name_by_socket(int sock) const;
+
+  // Registered users ordered by name, for listings
+  const std::map<std::string, UserId, std::less<>> &by_name() const { return ids; }
+
+  // Calls f(id, user) for every registered user, in id order, detached ones included
+  template <typename F>
+  void for_each(F f)
+  {
+    for (UserId id = 0; id < users.size(); id++)
+    {
+      if (users[id].sock != -1)
+        f(id, users[id]);
+    }
+  }
+
+private:
+  std::vector<LocalUser> users; // Indexed by id, a free slot has no socket
+  std::vector<UserId> free_ids;
+  std::map<std::string, UserId, std::less<>> ids;
+  std::vector<UserId> socket_ids; // Indexed by socket descriptor
+  std::vector<UserId> detached_ids;
+  uint32_t next_wire_id = 1;      // 0 means no id on the wire
+};
+
+#endif // USER_DIRECTORY_H
@@ -0,0 +1,196 @@
+// wire.cpp
+#include "wire.h"
+#include "constants.h"
+#include <iostream>
+#include <cstdint>      // For uint8_t, uint64_t
+#include <cstring>      // For memcpy
+#include <netinet/in.h> // For htonl
+
+// Wire types of the protobuf encoding
+constexpr uint32_t WIRE_VARINT = 0;
+constexpr uint32_t WIRE_LENGTH_DELIMITED = 2;
+
+static bool read_varint(const uint8_t *&position, const uint8_t *end, uint64_t &value)
+{
+  value = 0;
+  for (int shift = 0; shift < 64 && position < end; shift += 7)
+  {
+    uint8_t byte = *position++;
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if (!(byte & 0x80))
+      return true;
+  }
+  return false;
+}
+
+static bool read_bytes(const uint8_t *&position, const uint8_t *end, std::string_view &bytes)
+{
+  uint64_t size;
+  if (!read_varint(position, end, size) || size > static_cast<uint64_t>(end - position))
+    return false;
+  bytes = std::string_view(reinterpret_cast<const char *>(position), size);
+  position += size;
+  return true;
+}
+
+/**
+ * The full parse rejects string fields that are not UTF-8, the peek must too: a client
+ * would fail to parse a frame carrying them
+ */
+static bool valid_utf8(std::string_view text)
+{
+  const uint8_t *position = reinterpret_cast<const uint8_t *>(text.data());
+  const uint8_t *end = position + text.size();
+  while (position < end)
+  {
+    uint8_t byte = *position++;
+    if (byte < 0x80)
+      continue;
+
+    int continuation;
+    uint32_t code_point;
+    if ((byte & 0xe0) == 0xc0)
+    {
+      continuation = 1;
+      code_point = byte & 0x1f;
+    }
+    else if ((byte & 0xf0) == 0xe0)
+    {
+      continuation = 2;
+      code_point = byte & 0x0f;
+    }
+    else if ((byte & 0xf8) == 0xf0)
+    {
+      continuation = 3;
+      code_point = byte & 0x07;
+    }
+    else
+    {
+      return false;
+    }
+    if (end - position < continuation)
+      return false;
+    for (int i = 0; i < continuation; i++)
+    {
+      if ((position[i] & 0xc0) != 0x80)
+        return false;
+      code_point = (code_point << 6) | (position[i] & 0x3f);
+    }
+    position += continuation;
+
+    // Overlong encodings, surrogates and code points past Unicode
+    static const uint32_t smallest[] = {0, 0x80, 0x800, 0x10000};
+    if (code_point < smallest[continuation] || (code_point >= 0xd800 && code_point <= 0xdfff) || code_point > 0x10ffff)
+      return false;
+  }
+  return true;
+}
+
+static bool peek_send_message(std::string_view payload, RequestPeek &peek)
+{
+  const uint8_t *position = reinterpret_cast<const uint8_t *>(payload.data());
+  const uint8_t *end = position + payload.size();
+  while (position < end)
+  {
+    uint64_t key;
+    if (!read_varint(position, end, key) || (key & 7) != WIRE_LENGTH_DELIMITED)
+      return false;
+
+    // A field seen twice keeps its last value, as in a full parse
+    switch (key >> 3)
+    {
+    case chat::SendMessageRequest::kRecipientFieldNumber:
+      if (!read_bytes(position, end, peek.recipient))
+        return false;
+      break;
+    case chat::SendMessageRequest::kContentFieldNumber:
+      if (!read_bytes(position, end, peek.content))
+        return false;
+      break;
+    default:
+      return false;
+    }
+  }
+  return valid_utf8(peek.recipient) && valid_utf8(peek.content);
+}
+
+bool peek_request(const char *data, size_t size, RequestPeek &peek)
+{
+  peek = RequestPeek();
+  const uint8_t *position = reinterpret_cast<const uint8_t *>(data);
+  const uint8_t *end = position + size;
+  while (position < end)
+  {
+    uint64_t key;
+    if (!read_varint(position, end, key))
+      return false;
+
+    if ((key >> 3) == chat::Request::kOperationFieldNumber && (key & 7) == WIRE_VARINT)
+    {
+      uint64_t operation;
+      if (!read_varint(position, end, operation))
+        return false;
+      peek.operation = static_cast<chat::Operation>(operation);
+    }
+    else if ((key >> 3) == chat::Request::kSendMessageFieldNumber && (key & 7) == WIRE_LENGTH_DELIMITED)
+    {
+      // Repeated occurrences of a message field merge on a full parse, the fields are read into the same peek
+      std::string_view send_message;
+      if (!read_bytes(position, end, send_message) || !peek_send_message(send_message, peek))
+        return false;
+      peek.send_message = true;
+    }
+    else
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void append_varint(std::string &output, uint64_t value)
+{
+  while (value >= 0x80)
+  {
+    output += static_cast<char>((value & 0x7f) | 0x80);
+    value >>= 7;
+  }
+  output += static_cast<char>(value);
+}
+
+static size_t varint_size(uint64_t value)
+{
+  size_t size = 1;
+  while (value >= 0x80)
+  {
+    value >>= 7;
+    size++;
+  }
+  return size;
+}
+
+bool build_incoming_frame(const chat::Response &response, std::string_view content, std::string &frame)
+{
+  frame.assign(FRAME_HEADER_SIZE, '\0');
+  response.AppendToString(&frame);
+
+  if (!content.empty())
+  {
+    uint32_t content_key = (chat::IncomingMessageResponse::kContentFieldNumber << 3) | WIRE_LENGTH_DELIMITED;
+    append_varint(frame, (chat::Response::kIncomingMessageFieldNumber << 3) | WIRE_LENGTH_DELIMITED);
+    append_varint(frame, varint_size(content_key) + varint_size(content.size()) + content.size());
+    append_varint(frame, content_key);
+    append_varint(frame, content.size());
+    frame.append(content);
+  }
+
+  size_t size = frame.size() - FRAME_HEADER_SIZE;
+  if (size > MAX_MESSAGE_SIZE)
+  {
+    std::cerr << "Message size exceeds the maximum. Size: " << size << ", Maximum: " << MAX_MESSAGE_SIZE << std::endl;
+    return false;
+  }
+  uint32_t length = htonl(static_cast<uint32_t>(size));
+  memcpy(&frame[0], &length, FRAME_HEADER_SIZE);
+  return true;
+}
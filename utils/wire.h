@@ -0,0 +1,33 @@
+// wire.h
+#ifndef WIRE_H
+#define WIRE_H
+
+#include "chat.pb.h"
+#include <string>
+#include <string_view>
+#include <cstddef> // For size_t
+
+/**
+ * Fast dispatch of SEND_MESSAGE. The I/O thread reads the operation and the routing fields
+ * straight from the protobuf wire bytes instead of parsing a chat::Request, and the content
+ * goes into the recipients' frames as the same bytes, never copied into a message on the way.
+ */
+
+// Fields of a request read from its wire bytes, views into the payload that was peeked
+struct RequestPeek
+{
+  chat::Operation operation = chat::Operation::REGISTER_USER;
+  bool send_message = false; // The payload holds a SendMessageRequest
+  std::string_view recipient;
+  std::string_view content;
+};
+
+// Peeks a Request payload, false for anything but the operation and a SendMessageRequest
+// (other payloads, unknown fields, invalid UTF-8): those take the full parse
+bool peek_request(const char *data, size_t size, RequestPeek &peek);
+
+// Builds the frame of a Response whose incoming message takes content from a byte slice. The
+// slice goes after the serialized response as a second incoming_message, parsers merge the two.
+bool build_incoming_frame(const chat::Response &response, std::string_view content, std::string &frame);
+
+#endif // WIRE_H
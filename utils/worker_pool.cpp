@@ -0,0 +1,120 @@
+// worker_pool.cpp
+#include "worker_pool.h"
+#include "metrics.h"
+
+// Index of the worker running on this thread, -1 outside the pool
+static thread_local int current_worker = -1;
+static thread_local WorkerPool *current_pool = nullptr;
+
+WorkerPool::WorkerPool(size_t threads)
+{
+  if (threads == 0)
+    threads = 1;
+  for (size_t i = 0; i < threads; i++)
+  {
+    workers.emplace_back(new Worker());
+  }
+  for (size_t i = 0; i < threads; i++)
+  {
+    this->threads.emplace_back(&WorkerPool::run, this, i);
+  }
+}
+
+WorkerPool::~WorkerPool()
+{
+  stop();
+}
+
+void WorkerPool::submit(std::function<void()> task, bool yield)
+{
+  size_t index = current_pool == this ? current_worker : next_worker++ % workers.size();
+
+  // Counted before it is published, a thief may take it (and decrement) right away
+  pending++;
+  {
+    std::lock_guard<std::mutex> lock(workers[index]->mutex);
+    if (yield)
+      workers[index]->tasks.push_front(std::move(task));
+    else
+      workers[index]->tasks.push_back(std::move(task));
+  }
+
+  // Take the idle lock so a worker about to sleep can not miss the notification
+  std::lock_guard<std::mutex> lock(idle_mutex);
+  idle_cv.notify_one();
+}
+
+/**
+ * Stops the workers once they finish their current task, queued tasks are dropped
+ */
+void WorkerPool::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(idle_mutex);
+    if (stopping)
+      return;
+    stopping = true;
+  }
+  idle_cv.notify_all();
+  for (auto &thread : threads)
+  {
+    if (thread.joinable())
+      thread.join();
+  }
+}
+
+void WorkerPool::run(size_t index)
+{
+  current_worker = index;
+  current_pool = this;
+  static Metric &executed = metric("pool.tasks");
+
+  while (!stopping)
+  {
+    std::function<void()> task;
+    if (take(index, task))
+    {
+      task();
+      executed.add();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(idle_mutex);
+    idle_cv.wait(lock, [this]
+                 { return pending > 0 || stopping; });
+  }
+}
+
+/**
+ * Own deque first (newest task), then steal the oldest task of another worker
+ */
+bool WorkerPool::take(size_t index, std::function<void()> &task)
+{
+  static Metric &steals = metric("pool.steals");
+  {
+    Worker &own = *workers[index];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.tasks.empty())
+    {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      pending--;
+      return true;
+    }
+  }
+
+  for (size_t offset = 1; offset < workers.size(); offset++)
+  {
+    Worker &victim = *workers[(index + offset) % workers.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty())
+    {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      pending--;
+      steals.add();
+      return true;
+    }
+  }
+  return false;
+}
@@ -0,0 +1,54 @@
+// worker_pool.h
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+#include "pool.h"
+
+/**
+ * Fixed pool of worker threads with work stealing.
+ *
+ * Every worker owns a deque: tasks submitted from a worker go to the back of its own
+ * deque and it pops from the back (the most recent, cache-warm task), idle workers
+ * steal from the front of the other deques. Tasks submitted from other threads are
+ * spread round robin. A yielding task goes to the front of its worker's deque so the
+ * worker runs the others first. Ordering between tasks is not guaranteed, callers that need it
+ * (a connection's requests) serialize their own work.
+ */
+class WorkerPool
+{
+public:
+  explicit WorkerPool(size_t threads);
+  ~WorkerPool();
+
+  void submit(std::function<void()> task, bool yield = false);
+  void stop();
+  size_t size() const { return workers.size(); }
+
+private:
+  struct Worker
+  {
+    std::deque<std::function<void()>, PoolAllocator<std::function<void()>>> tasks; // Blocks from the slab pools
+    std::mutex mutex;
+  };
+
+  void run(size_t index);
+  bool take(size_t index, std::function<void()> &task);
+
+  std::vector<std::unique_ptr<Worker>> workers;
+  std::vector<std::thread> threads;
+  std::atomic<size_t> next_worker{0};
+  std::atomic<size_t> pending{0};
+  std::atomic<bool> stopping{false};
+  std::mutex idle_mutex;
+  std::condition_variable idle_cv;
+};
+
+#endif // WORKER_POOL_H